@@ -144,6 +144,19 @@
             return 0;
        }
 
+    For simulation that should not depend on frame rate, provide a `fixed_update` callback. Each frame, gunslinger 
+    accumulates the previous frame's delta and calls `fixed_update` once per `1 / fixed_rate` seconds (60hz by default) 
+    before calling `update`. The leftover fraction of a step is available as `gs_platform_fixed_alpha()` for 
+    interpolating between the previous and current simulation states when rendering:
+
+        gs_app_desc_t gs_main(int32_t argc, char** argv) {
+            return (gs_app_desc_t) {
+                .fixed_update = my_physics_step,   // Step with gs_platform_time()->fixed_delta
+                .fixed_rate = 120.f,
+                .update = my_update                // Render with gs_platform_fixed_alpha()
+            };
+        }
+
     NOTE: 
         Lastly, while it is possible to use gunslinger without it controlling the main application loop, this isn't recommended. 
         Internally, gunslinger does its best to handle the boiler plate drudge work of implementing (in correct order) 
@@ -202,6 +215,20 @@
         *VQS:
             - gs_vqs:  gs_vec3, gs_quat, gs_vec3
 
+        *Batch kernels:
+            - gs_mat4_mul_vec4_batch / gs_mat4_mul_vec3_batch: transform N vectors/points by one matrix
+            - gs_vqs_absolute_transform_batch: compose N local/parent transform pairs
+
+        (SIMD):
+
+        Define GS_MATH_SIMD before including gunslinger to run mat4 mul/inverse, mat4 * vec, quat mul, 
+        vqs composition and the batch kernels with 128-bit SSE (x86/x64) or NEON (arm64). All structures keep 
+        their layout, so this is a drop-in switch.
+
+            #define GS_MATH_SIMD
+            #define GS_IMPL
+            #include "gs.h"
+
         (SPECIAL NOTE): 
 
         `gs_vqs` is a transform structure that's commonly used in games/physics sims, especially with complex child/parent hierarchies. It stands for
@@ -327,6 +354,17 @@
                 gs_hash_table_clear(ht);                        // Clears all elements. Sets size to 0.
                 gs_hash_table_free(ht);                         // Frees hash table internal data calling `gs_free` internally.
 
+            Tables can optionally be created in control byte mode (power-of-two capacity, split control byte array, tombstones).
+            Misses stop at the first empty slot and the table can be kept at a higher load factor. Same API as above:
+
+                gs_hash_table(uint64_t, entity_t) ht = NULL;
+                gs_hash_table_init_ctrl(ht, uint64_t, entity_t);   // Init in control byte mode (define GS_HASH_TABLE_DEFAULT_CTRL to make this the default)
+
+            Keys are hashed with `gs_hash_key_bytes`, which picks a multiply-fold mixer by key size (4/8 bytes and other
+            multiples of 8) and uses siphash for the rest. A custom hasher can still be supplied:
+
+                gs_hash_table_init_ex(ht, key_t, float, gs_hash_bytes);   // Any size_t (*)(void* key, size_t len, size_t seed)
+
         gs_slot_array: 
 
             Slot arrays are internally just dynamic arrays but alleviate the issue with losing references to internal 
@@ -414,6 +452,35 @@
                 gs_slot_map_clear(sm);                              // Clears map. Sets size to 0.
                 gs_slot_map_free(sm);                               // Frees map memory. Calls `gs_free` internally.
 
+        gs_slot_pool:
+
+            Generational variant of the slot array for large, high churn sets. Unused index slots are chained into an intrusive 
+            free list and the data array keeps a back-pointer to its slot, so insert and erase (swap and pop) are O(1). Handles 
+            are 64 bit (slot index | generation << 32). Erasing bumps the slot's generation, so stale handles are detected instead 
+            of silently aliasing whatever gets inserted next. Handle 0 is never valid. Data stays densely packed, so iteration 
+            walks the data array directly:
+
+                gs_slot_pool(float) sp = NULL;                          // Create slot pool with internal 'float' data
+                gs_slot_pool_handle h = gs_slot_pool_insert(sp, 3.f);   // Insert data into slot pool. Init/Grow on demand.
+                bool valid = gs_slot_pool_exists(sp, h);                // False once h has been erased (even if its slot is reused)
+                float v = gs_slot_pool_get(sp, h);                      // Get data at handle (handle must be valid)
+                float* vp = gs_slot_pool_getp(sp, h);                   // Get pointer reference at handle. Dangerous (same as slot array).
+                gs_slot_pool_erase(sp, h);                              // Swap and pop erase. Returns false for stale handles.
+                uint32_t sz = gs_slot_pool_size(sp);                    // Size of slot pool. Returns 0 if NULL.
+                gs_slot_pool_clear(sp);                                 // Invalidates all handles. Sets size to 0.
+                gs_slot_pool_free(sp);                                  // Frees pool memory. Calls `gs_free` internally.
+
+                for (
+                    gs_slot_pool_iter it = 0; 
+                    gs_slot_pool_iter_valid(sp, it);
+                    gs_slot_pool_iter_advance(sp, it) 
+                ) {
+                    float* vp = gs_slot_pool_iter_getp(sp, it);             // Get value pointer using iterator
+                    gs_slot_pool_handle h = gs_slot_pool_iter_handle(sp, it);  // Get handle for value using iterator
+                }
+
+            Erasing while iterating moves the last element into the erased position, so don't advance the iterator after an erase.
+
     GS_PLATFORM:
 
         By default, Gunslinger supports (via included GLFW) the following platforms:
@@ -466,6 +533,13 @@
             // For custom graphics implementation
             #define GS_GRAPHICS_IMPL_CUSTOM
 
+        To run without a GPU (headless servers, CI, benchmarking command generation), define GS_GRAPHICS_IMPL_NULL. 
+        The null backend tracks resources and decodes every submitted command buffer without issuing any api calls, 
+        validating handles and draw ranges and recording per-frame statistics (see gs_graphics_stats()):
+
+            // For headless graphics implementation
+            #define GS_GRAPHICS_IMPL_NULL
+
 */
 
 /*===== Gunslinger Include ======*/
@@ -1146,6 +1220,36 @@ gs_util_str_is_numeric(const char* str)
     return true;
 }
 
+// Decodes the UTF-8 sequence at *str and advances past it. Malformed bytes decode as themselves (Latin-1).
+gs_force_inline uint32_t
+gs_util_utf8_next(const char** str)
+{
+    const uint8_t* s = (const uint8_t*)*str;
+    uint32_t c = s[0], n = 0;
+    if      ((c & 0xE0) == 0xC0) {c &= 0x1F; n = 1;}
+    else if ((c & 0xF0) == 0xE0) {c &= 0x0F; n = 2;}
+    else if ((c & 0xF8) == 0xF0) {c &= 0x07; n = 3;}
+    for (uint32_t i = 1; i <= n; ++i)
+    {
+        if ((s[i] & 0xC0) != 0x80) {c = s[0]; n = 0; break;}
+        c = (c << 6) | (s[i] & 0x3F);
+    }
+    *str += n + 1;
+    return c;
+}
+
+// Writes codepoint as UTF-8 into buf (at least 4 bytes, not null terminated), returns bytes written
+gs_force_inline uint32_t
+gs_util_utf8_encode(uint32_t c, char* buf)
+{
+    if (c < 0x80)    {buf[0] = (char)c; return 1;}
+    if (c < 0x800)   {buf[0] = (char)(0xC0 | (c >> 6)); buf[1] = (char)(0x80 | (c & 0x3F)); return 2;}
+    if (c < 0x10000) {buf[0] = (char)(0xE0 | (c >> 12)); buf[1] = (char)(0x80 | ((c >> 6) & 0x3F)); buf[2] = (char)(0x80 | (c & 0x3F)); return 3;}
+    buf[0] = (char)(0xF0 | ((c >> 18) & 0x07)); buf[1] = (char)(0x80 | ((c >> 12) & 0x3F)); 
+    buf[2] = (char)(0x80 | ((c >> 6) & 0x3F)); buf[3] = (char)(0x80 | (c & 0x3F)); 
+    return 4;
+}
+
 // Will return a null buffer if file does not exist or allocation fails
 GS_API_DECL char* 
 gs_read_file_contents_into_string_null_term (const char* file_path, const char* mode, size_t* _sz);
@@ -1657,6 +1761,82 @@ size_t gs_hash_bytes(void *p, size_t len, size_t seed)
   return gs_hash_murmur3(p, len, seed);
 #endif
 }
+
+/*
+    Key hashing (wyhash style multiply-fold), the default for gs_hash_table and gs_hash_set:
+        - 4 and 8 byte keys (ints, pointers, handles, ids) are a single 64x64->128 multiply plus a final mix.
+        - Other multiples of 8 bytes (16, 24, 32, ... byte structs) fold 16 bytes per multiply.
+        - Anything else falls back to siphash.
+    Tables compare against gs_hash_key_bytes and call it directly, so the key size is a constant there and
+    the dispatch compiles away. gs_hash_bytes itself is unchanged.
+*/
+
+#define GS_HASH_WY_P0   UINT64_C(0xa0761d6478bd642f)
+#define GS_HASH_WY_P1   UINT64_C(0xe7037ed1a0b428db)
+
+// 128-bit product of a and b, low half into a, high half into b
+gs_force_inline void
+gs_hash_mum(uint64_t* a, uint64_t* b)
+{
+#if (defined __SIZEOF_INT128__)
+    __uint128_t r = (__uint128_t)(*a) * (*b);
+    *a = (uint64_t)r;
+    *b = (uint64_t)(r >> 64);
+#else
+    uint64_t ha = *a >> 32, hb = *b >> 32, la = (uint32_t)*a, lb = (uint32_t)*b;
+    uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+    uint64_t t = rl + (rm0 << 32), c = t < rl, lo = t + (rm1 << 32);
+    c += lo < t;
+    *a = lo;
+    *b = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+#endif
+}
+
+gs_force_inline uint64_t
+gs_hash_wymix(uint64_t a, uint64_t b)
+{
+    gs_hash_mum(&a, &b);
+    return a ^ b;
+}
+
+gs_force_inline uint64_t
+gs_hash_read_u64(const uint8_t* p)
+{
+    uint64_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+gs_force_inline
+size_t gs_hash_key_bytes(void* p, size_t len, size_t seed)
+{
+    const uint8_t* d = (const uint8_t*)p;
+    uint64_t s = (uint64_t)seed ^ GS_HASH_WY_P0, a, b;
+    if (len == 4)
+    {
+        uint32_t k;
+        memcpy(&k, d, sizeof(k));
+        a = ((uint64_t)k << 32) | k;
+        b = a;
+    }
+    else if (len && !(len & 7))
+    {
+        size_t i = len;
+        for (; i > 8; i -= 16, d += 16) {
+            s = gs_hash_wymix(gs_hash_read_u64(d) ^ GS_HASH_WY_P1, gs_hash_read_u64(d + 8) ^ s);
+        }
+        a = i ? gs_hash_read_u64(d) : 0;
+        b = 0;
+    }
+    else
+    {
+        return gs_hash_siphash_bytes(p, len, seed);
+    }
+    a ^= GS_HASH_WY_P1;
+    b ^= s;
+    gs_hash_mum(&a, &b);
+    return (size_t)gs_hash_wymix(a ^ GS_HASH_WY_P0 ^ (uint64_t)len, b ^ GS_HASH_WY_P1);
+}
 #ifdef _MSC_VER
 #pragma warning(pop)
 #endif
@@ -1966,6 +2146,27 @@ void gs_dyn_array_set_data_i(void** arr, void* val, size_t val_len, uint32_t off
 #define GS_HASH_TABLE_HASH_SEED         0x31415296
 #define GS_HASH_TABLE_INVALID_INDEX     UINT32_MAX
 
+/*
+    Control byte mode (opt-in per table via gs_hash_table_init_ctrl, or for all tables with GS_HASH_TABLE_DEFAULT_CTRL):
+        - Capacity is kept at a power of two, so probing masks instead of using modulo.
+        - A separate array of control bytes (one per slot) holds either EMPTY, TOMBSTONE or the top 7 bits of the
+          slot's hash. Probes walk these bytes linearly and only touch entry data on a fragment match.
+        - Erased slots become tombstones, so a probe can stop at the first EMPTY byte. Misses are O(1) expected.
+        - Tables rehash (using the stored hashes) when live entries + tombstones pass GS_HASH_TABLE_CTRL_MAX_LOAD_FACTOR.
+*/
+
+#ifndef GS_HASH_TABLE_CTRL_MAX_LOAD_FACTOR
+    #define GS_HASH_TABLE_CTRL_MAX_LOAD_FACTOR  0.85f
+#endif
+
+#define GS_HASH_TABLE_CTRL_MIN_CAPACITY     8
+#define GS_HASH_TABLE_CTRL_EMPTY            0x80
+#define GS_HASH_TABLE_CTRL_TOMBSTONE        0xFE
+
+// Top 7 bits of hash, stored in control byte for full slots (high bit always clear)
+#define gs_hash_table_ctrl_h2(__HSH)\
+    ((uint8_t)(((size_t)(__HSH) >> (sizeof(size_t) * 8 - 7)) & 0x7F))
+
 typedef enum gs_hash_table_entry_state {
     GS_HASH_TABLE_ENTRY_INACTIVE = 0x00,
     GS_HASH_TABLE_ENTRY_ACTIVE = 0x01
@@ -1990,6 +2191,8 @@ typedef size_t (*gs_hash_func_t)(void*, size_t, size_t);
         size_t klpvl;\
         size_t tmp_idx;\
         gs_hash_func_t hash_func;\
+        uint8_t* ctrl;\
+        uint32_t tombstones;\
     }*
 
 // Need a way to create a temporary key so I can take the address of it
@@ -1997,9 +2200,16 @@ typedef size_t (*gs_hash_func_t)(void*, size_t, size_t);
 #define gs_hash_table_new(__K, __V)\
     NULL
 
-GS_API_DECL void 
+GS_API_DECL void
 __gs_hash_table_init_impl(void** ht, size_t sz);
 
+// Rebuilds data/ctrl arrays at new_cap (power of two) from stored hashes, dropping all tombstones
+GS_API_DECL void
+__gs_hash_table_ctrl_rehash(void** data, uint8_t** ctrl, uint32_t* tombstones, size_t stride, size_t klpvl, uint32_t new_cap);
+
+GS_API_DECL void
+__gs_hash_table_ctrl_reserve(void** data, uint8_t** ctrl, uint32_t* tombstones, size_t stride, size_t klpvl, uint32_t count);
+
 #define gs_hash_table_init_ex(__HT, __K, __V, __HFUNC)\
     do {\
         size_t entry_sz = sizeof(*__HT->data);\
@@ -2022,21 +2232,42 @@ __gs_hash_table_init_impl(void** ht, size_t sz);
 gs_force_inline
 size_t __gs_hash_table_compute_hash(gs_hash_func_t hash_func, void* key, size_t key_len, size_t seed)
 {
-    if (hash_func) {
-        return hash_func(key, key_len, seed);
+    // Default hasher is called directly so key_len (a sizeof at every call site) folds the dispatch away
+    if (!hash_func || hash_func == gs_hash_key_bytes) {
+        return gs_hash_key_bytes(key, key_len, seed);
     }
-    return gs_hash_bytes(key, key_len, seed);
+    return hash_func(key, key_len, seed);
 }
 
-#define gs_hash_table_init(__HT, __K, __V)\
-    gs_hash_table_init_ex(__HT, __K, __V, gs_hash_bytes)
+#define gs_hash_table_init_ctrl_ex(__HT, __K, __V, __HFUNC)\
+    do {\
+        gs_hash_table_init_ex(__HT, __K, __V, __HFUNC);\
+        __gs_hash_table_ctrl_rehash((void**)&(__HT)->data, &(__HT)->ctrl, &(__HT)->tombstones,\
+            (__HT)->stride, (__HT)->klpvl, GS_HASH_TABLE_CTRL_MIN_CAPACITY);\
+    } while (0)
+
+#define gs_hash_table_init_ctrl(__HT, __K, __V)\
+    gs_hash_table_init_ctrl_ex(__HT, __K, __V, gs_hash_key_bytes)
+
+#ifdef GS_HASH_TABLE_DEFAULT_CTRL
+    #define gs_hash_table_init(__HT, __K, __V)\
+        gs_hash_table_init_ctrl_ex(__HT, __K, __V, gs_hash_key_bytes)
+#else
+    #define gs_hash_table_init(__HT, __K, __V)\
+        gs_hash_table_init_ex(__HT, __K, __V, gs_hash_key_bytes)
+#endif
 
 #define gs_hash_table_reserve(_HT, _KT, _VT, _CT)\
     do {\
         if ((_HT) == NULL) {\
             gs_hash_table_init((_HT), _KT, _VT);\
         }\
-        gs_dyn_array_reserve((_HT)->data, _CT);\
+        if ((_HT)->ctrl) {\
+            __gs_hash_table_ctrl_reserve((void**)&(_HT)->data, &(_HT)->ctrl, &(_HT)->tombstones,\
+                (_HT)->stride, (_HT)->klpvl, (uint32_t)(_CT));\
+        } else {\
+            gs_dyn_array_reserve((_HT)->data, _CT);\
+        }\
     } while (0)
 
 #define gs_hash_table_size(__HT)\
@@ -2061,6 +2292,10 @@ size_t __gs_hash_table_compute_hash(gs_hash_func_t hash_func, void* key, size_t
             for (uint32_t i = 0; i < capacity; ++i) {\
                 (__HT)->data[i].state = GS_HASH_TABLE_ENTRY_INACTIVE;\
             }\
+            if ((__HT)->ctrl) {\
+                memset((__HT)->ctrl, GS_HASH_TABLE_CTRL_EMPTY, capacity);\
+                (__HT)->tombstones = 0;\
+            }\
             /*memset((__HT)->data, 0, gs_dyn_array_capacity((__HT)->data) * );*/\
             gs_dyn_array_clear((__HT)->data);\
         }\
@@ -2071,6 +2306,7 @@ size_t __gs_hash_table_compute_hash(gs_hash_func_t hash_func, void* key, size_t
         if ((__HT) != NULL) {\
             gs_dyn_array_free((__HT)->data);\
             (__HT)->data = NULL;\
+            if ((__HT)->ctrl) gs_free((__HT)->ctrl);\
             gs_free(__HT);\
             (__HT) = NULL;\
         }\
@@ -2083,7 +2319,28 @@ size_t __gs_hash_table_compute_hash(gs_hash_func_t hash_func, void* key, size_t
         if ((__HT) == NULL) {\
             gs_hash_table_init((__HT), (__HMK), (__HMV));\
         }\
-    \
+        if ((__HT)->ctrl) {\
+            __gs_hash_table_insert_ctrl((__HT), (__HMK), (__HMV));\
+        } else {\
+            __gs_hash_table_insert_linear((__HT), (__HMK), (__HMV));\
+        }\
+    } while (0)
+
+#define __gs_hash_table_insert_ctrl(__HT, __HMK, __HMV)\
+    do {\
+        (__HT)->tmp_key = (__HMK);\
+        size_t __HSH = __gs_hash_table_compute_hash((__HT)->hash_func, (void*)&((__HT)->tmp_key), sizeof((__HT)->tmp_key), GS_HASH_TABLE_HASH_SEED);\
+        uint32_t __HSH_IDX = __gs_hash_table_ctrl_insert_index_func((void**)&(__HT)->data, &(__HT)->ctrl, &(__HT)->tombstones,\
+            (void*)&((__HT)->tmp_key), sizeof((__HT)->tmp_key), (__HT)->stride, (__HT)->klpvl, __HSH);\
+        (__HT)->data[__HSH_IDX].key = (__HT)->tmp_key;\
+        (__HT)->data[__HSH_IDX].val = (__HMV);\
+        (__HT)->data[__HSH_IDX].hash = __HSH;\
+        (__HT)->data[__HSH_IDX].state = GS_HASH_TABLE_ENTRY_ACTIVE;\
+        (__HT)->tmp_idx = __HSH_IDX;\
+    } while (0)
+
+#define __gs_hash_table_insert_linear(__HT, __HMK, __HMV)\
+    do {\
         /* Grow table if necessary */\
         uint32_t __CAP = gs_hash_table_capacity(__HT);\
         float __LF = gs_hash_table_load_factor(__HT);\
@@ -2105,17 +2362,15 @@ size_t __gs_hash_table_compute_hash(gs_hash_func_t hash_func, void* key, size_t
         (__HT)->tmp_key = (__HMK);\
         size_t __HSH = __gs_hash_table_compute_hash((__HT)->hash_func, (void*)&((__HT)->tmp_key), sizeof((__HT)->tmp_key), GS_HASH_TABLE_HASH_SEED);\
         size_t __HSH_IDX = __HSH % __CAP;\
-        (__HT)->tmp_key = (__HT)->data[__HSH_IDX].key;\
         uint32_t c = 0;\
     \
-        /* Find valid idx and place data */\
+        /* Find valid idx and place data (compares stored hashes, keys are never rehashed) */\
         while (\
             c < __CAP\
-            && __HSH != __gs_hash_table_compute_hash((__HT)->hash_func, (void*)&(__HT)->tmp_key, sizeof((__HT)->tmp_key), GS_HASH_TABLE_HASH_SEED)\
-            && (__HT)->data[__HSH_IDX].state == GS_HASH_TABLE_ENTRY_ACTIVE)\
+            && (__HT)->data[__HSH_IDX].state == GS_HASH_TABLE_ENTRY_ACTIVE\
+            && __HSH != (__HT)->data[__HSH_IDX].hash)\
         {\
             __HSH_IDX = ((__HSH_IDX + 1) % __CAP);\
-            (__HT)->tmp_key = (__HT)->data[__HSH_IDX].key;\
             ++c;\
         }\
         (__HT)->data[__HSH_IDX].key = (__HMK);\
@@ -2141,8 +2396,7 @@ uint32_t gs_hash_table_get_key_index_func(void** data, void* key, size_t key_len
 	uint32_t size = gs_dyn_array_size(*data);
 	if (!capacity || !size) return (size_t)GS_HASH_TABLE_INVALID_INDEX;
     size_t idx = (size_t)GS_HASH_TABLE_INVALID_INDEX;
-    // size_t hash = (size_t)gs_hash_bytes(key, key_len, GS_HASH_TABLE_HASH_SEED);
-    size_t hash = (size_t)hash_func(key, key_len, GS_HASH_TABLE_HASH_SEED);
+    size_t hash = __gs_hash_table_compute_hash(hash_func, key, key_len, GS_HASH_TABLE_HASH_SEED);
     size_t hash_idx = (hash % capacity);
 
     // Iterate through data 
@@ -2164,6 +2418,102 @@ uint32_t gs_hash_table_get_key_index_func(void** data, void* key, size_t key_len
     return (uint32_t)idx;
 }
 
+gs_force_inline
+uint32_t gs_hash_table_get_key_index_ctrl_func(void** data, const uint8_t* ctrl, void* key, size_t key_len,
+    size_t stride, size_t klpvl, gs_hash_func_t hash_func)
+{
+    if (!data || !ctrl || !key) return GS_HASH_TABLE_INVALID_INDEX;
+
+    uint32_t capacity = gs_dyn_array_capacity(*data);
+    uint32_t size = gs_dyn_array_size(*data);
+    if (!capacity || !size) return GS_HASH_TABLE_INVALID_INDEX;
+    size_t hash = __gs_hash_table_compute_hash(hash_func, key, key_len, GS_HASH_TABLE_HASH_SEED);
+    uint8_t h2 = gs_hash_table_ctrl_h2(hash);
+    uint32_t mask = capacity - 1;
+
+    for (uint32_t i = (uint32_t)(hash & mask), c = 0; c < capacity; ++c, i = ((i + 1) & mask)) {
+        uint8_t cb = ctrl[i];
+        // Key would have been placed here or earlier, so stop at first empty slot
+        if (cb == GS_HASH_TABLE_CTRL_EMPTY) break;
+        // Tombstones and fragment mismatches never touch entry data
+        if (cb != h2) continue;
+        size_t offset = (i * stride);
+        size_t stored_hash = *(size_t*)((char*)(*data) + offset + (klpvl) - sizeof(size_t));
+        if (hash != stored_hash) continue;
+        if (gs_compare_bytes((char*)(*data) + offset, key, key_len)) {
+            return i;
+        }
+    }
+    return GS_HASH_TABLE_INVALID_INDEX;
+}
+
+// Returns slot for key (existing or newly claimed), growing/purging tombstones first if necessary
+gs_force_inline
+uint32_t __gs_hash_table_ctrl_insert_index_func(void** data, uint8_t** ctrl, uint32_t* tombstones, void* key, size_t key_len,
+    size_t stride, size_t klpvl, size_t hash)
+{
+    uint32_t capacity = gs_dyn_array_capacity(*data);
+    uint32_t size = gs_dyn_array_size(*data);
+    const float max_load = (float)capacity * GS_HASH_TABLE_CTRL_MAX_LOAD_FACTOR;
+
+    // Keep at least one empty slot so probes always terminate. Only double if live entries (not tombstones) need the room.
+    if ((float)(size + *tombstones + 1) > max_load) {
+        uint32_t new_cap = (float)(size + 1) > max_load * 0.5f ? capacity * 2 : capacity;
+        __gs_hash_table_ctrl_rehash(data, ctrl, tombstones, stride, klpvl, new_cap);
+        capacity = new_cap;
+    }
+
+    uint8_t h2 = gs_hash_table_ctrl_h2(hash);
+    uint32_t mask = capacity - 1;
+    uint32_t idx = (uint32_t)(hash & mask);
+    uint32_t tomb = GS_HASH_TABLE_INVALID_INDEX;
+
+    for (;;) {
+        uint8_t cb = (*ctrl)[idx];
+        if (cb == GS_HASH_TABLE_CTRL_EMPTY) break;
+        if (cb == GS_HASH_TABLE_CTRL_TOMBSTONE) {
+            if (tomb == GS_HASH_TABLE_INVALID_INDEX) tomb = idx;
+        }
+        else if (cb == h2) {
+            size_t offset = (idx * stride);
+            size_t stored_hash = *(size_t*)((char*)(*data) + offset + (klpvl) - sizeof(size_t));
+            if (hash == stored_hash && gs_compare_bytes((char*)(*data) + offset, key, key_len)) {
+                return idx;
+            }
+        }
+        idx = (idx + 1) & mask;
+    }
+
+    // Reuse first tombstone seen along the probe sequence
+    if (tomb != GS_HASH_TABLE_INVALID_INDEX) {
+        idx = tomb;
+        (*tombstones)--;
+    }
+    (*ctrl)[idx] = h2;
+    gs_dyn_array_head(*data)->size++;
+    return idx;
+}
+
+gs_force_inline
+void __gs_hash_table_ctrl_erase_func(void* data, uint8_t* ctrl, uint32_t* tombstones, uint32_t idx)
+{
+    uint32_t mask = gs_dyn_array_capacity(data) - 1;
+    // If next slot is empty, no probe sequence can pass through this one, so it can be emptied outright
+    if (ctrl[(idx + 1) & mask] == GS_HASH_TABLE_CTRL_EMPTY) {
+        ctrl[idx] = GS_HASH_TABLE_CTRL_EMPTY;
+    } else {
+        ctrl[idx] = GS_HASH_TABLE_CTRL_TOMBSTONE;
+        (*tombstones)++;
+    }
+}
+
+#define __gs_hash_table_key_index(__HT)\
+    ((__HT)->ctrl ?\
+        gs_hash_table_get_key_index_ctrl_func((void**)&(__HT)->data, (__HT)->ctrl, (void*)&((__HT)->tmp_key),\
+            sizeof((__HT)->tmp_key), (__HT)->stride, (__HT)->klpvl, (__HT)->hash_func) :\
+        gs_hash_table_get_key_index_func((void**)&(__HT)->data, (void*)&((__HT)->tmp_key),\
+            sizeof((__HT)->tmp_key), sizeof((__HT)->tmp_val), (__HT)->stride, (__HT)->klpvl, (__HT)->hash_func))
+
 // Get key at index
 #define gs_hash_table_getk(__HT, __I)\
     (((__HT))->data[(__I)].key)
@@ -2175,22 +2525,18 @@ uint32_t gs_hash_table_get_key_index_func(void** data, void* key, size_t key_len
 // Could search for the index in the macro instead now. Does this help me?
 #define gs_hash_table_get(__HT, __HTK)\
     ((__HT)->tmp_key = (__HTK),\
-        (gs_hash_table_geti((__HT),\
-            gs_hash_table_get_key_index_func((void**)&(__HT)->data, (void*)&((__HT)->tmp_key),\
-                sizeof((__HT)->tmp_key), sizeof((__HT)->tmp_val), (__HT)->stride, (__HT)->klpvl, (__HT)->hash_func)))) 
+        (gs_hash_table_geti((__HT), __gs_hash_table_key_index(__HT))))
 
 #define gs_hash_table_getp(__HT, __HTK)\
     (\
         (__HT)->tmp_key = (__HTK),\
-        ((__HT)->tmp_idx = (uint32_t)gs_hash_table_get_key_index_func((void**)&(__HT->data), (void*)&(__HT->tmp_key), sizeof(__HT->tmp_key),\
-            sizeof(__HT->tmp_val), __HT->stride, __HT->klpvl, __HT->hash_func)),\
+        ((__HT)->tmp_idx = (uint32_t)__gs_hash_table_key_index(__HT)),\
         ((__HT)->tmp_idx != GS_HASH_TABLE_INVALID_INDEX ? &gs_hash_table_geti((__HT), (__HT)->tmp_idx) : NULL)\
     )
 
 #define _gs_hash_table_key_exists_internal(__HT, __HTK)\
     ((__HT)->tmp_key = (__HTK),\
-        (__HT)->tmp_idx = gs_hash_table_get_key_index_func((void**)&(__HT->data), (void*)&(__HT->tmp_key), sizeof(__HT->tmp_key),\
-            sizeof(__HT->tmp_val), __HT->stride, __HT->klpvl, __HT->hash_func), ((__HT->tmp_idx) != GS_HASH_TABLE_INVALID_INDEX))
+        (__HT)->tmp_idx = __gs_hash_table_key_index(__HT), ((__HT->tmp_idx) != GS_HASH_TABLE_INVALID_INDEX))
 
 // uint32_t gs_hash_table_get_key_index_func(void** data, void* key, size_t key_len, size_t val_len, size_t stride, size_t klpvl)
 
@@ -2206,9 +2552,10 @@ uint32_t gs_hash_table_get_key_index_func(void** data, void* key, size_t key_len
         {\
             /* Get idx for key */\
             (__HT)->tmp_key = (__HTK);\
-            uint32_t __IDX = gs_hash_table_get_key_index_func((void**)&(__HT)->data, (void*)&((__HT)->tmp_key), sizeof((__HT)->tmp_key), sizeof((__HT)->tmp_val), (__HT)->stride, (__HT)->klpvl, (__HT)->hash_func);\
+            uint32_t __IDX = __gs_hash_table_key_index(__HT);\
             if (__IDX != GS_HASH_TABLE_INVALID_INDEX) {\
                 (__HT)->data[__IDX].state = GS_HASH_TABLE_ENTRY_INACTIVE;\
+                if ((__HT)->ctrl) __gs_hash_table_ctrl_erase_func((__HT)->data, (__HT)->ctrl, &(__HT)->tombstones, __IDX);\
                 if (gs_dyn_array_head((__HT)->data)->size) gs_dyn_array_head((__HT)->data)->size--;\
             }\
         }\
@@ -2333,7 +2680,7 @@ __gs_hash_set_init_impl( void** ht, size_t sz );
     } while (0)
 
 #define gs_hash_set_init(__S, __T)\
-    gs_hash_set_init_ex(__S, __T, gs_hash_bytes)
+    gs_hash_set_init_ex(__S, __T, gs_hash_key_bytes)
 
 #define gs_hash_set_reserve(__S, __T, __CT)\
     do {\
@@ -2389,19 +2736,17 @@ uint32_t gs_hash_set_get_key_index_func(void** data, void* key, size_t key_len,
 	uint32_t size = gs_dyn_array_size(*data);
 	if (!capacity || !size) return (size_t)GS_HASH_SET_INVALID_INDEX;
     size_t idx = (size_t)GS_HASH_SET_INVALID_INDEX;
-    size_t hash = (size_t)hfunc(key, key_len, GS_HASH_SET_HASH_SEED); 
+    size_t hash = __gs_hash_table_compute_hash(hfunc, key, key_len, GS_HASH_SET_HASH_SEED); 
     size_t hash_idx = (hash % capacity);
     size_t c = 0;
     size_t max_probe = GS_HASH_SET_MAX_PROBE;
 
-    // Iterate through data
+    // Iterate through data (equal bytes hash equal, so probed keys are only compared)
     for (size_t i = hash_idx; c < max_probe; ++c, i = ((i + c) % capacity)) {
         size_t offset = (i * stride);
         void* k = ((char*)(*data) + (offset));  
-        size_t kh = hfunc(k, key_len, GS_HASH_SET_HASH_SEED);
-        bool comp = gs_compare_bytes(k, key, key_len);
         gs_hash_set_entry_state state = *(gs_hash_set_entry_state*)((char*)(*data) + offset + (klpvl));
-        if (comp && hash == kh && state == GS_HASH_SET_ENTRY_ACTIVE) {
+        if (state == GS_HASH_SET_ENTRY_ACTIVE && gs_compare_bytes(k, key, key_len)) {
             idx = i;
             break;
         }
@@ -2423,7 +2768,7 @@ void gs_hash_set_rehash(void** data, void** new_data, size_t new_cap, size_t key
             continue;
         }
         void* k = ((char*)(*data) + offset);  
-        size_t kh = hfunc(k, key_len, GS_HASH_SET_HASH_SEED);
+        size_t kh = __gs_hash_table_compute_hash(hfunc, k, key_len, GS_HASH_SET_HASH_SEED);
         // Hash idx into new data with new capacity
         uint32_t c = 0;
         size_t hash_idx = (kh % new_cap);
@@ -2469,7 +2814,7 @@ void gs_hash_set_rehash(void** data, void** new_data, size_t new_cap, size_t key
     \
         /* Get hash of key */\
         (__S)->tmp_val = (__T);\
-        size_t __HSH = (__S)->hash_func((void*)&((__S)->tmp_val), sizeof((__S)->tmp_val), GS_HASH_SET_HASH_SEED);\
+        size_t __HSH = __gs_hash_table_compute_hash((__S)->hash_func, (void*)&((__S)->tmp_val), sizeof((__S)->tmp_val), GS_HASH_SET_HASH_SEED);\
         size_t __HSH_IDX = __HSH % __CAP;\
         uint32_t c = 0;\
         bool exists = false;\
@@ -2562,7 +2907,7 @@ bool _gs_hash_set_is_subset_of_internal(void** s0, void** s1, size_t key_len, si
         } 
         // Valid entry, check against s1
         void* k0 = ((char*)(*s0) + (offset));
-        size_t kh = hfunc(k0, key_len, GS_HASH_SET_HASH_SEED);
+        size_t kh = __gs_hash_table_compute_hash(hfunc, k0, key_len, GS_HASH_SET_HASH_SEED);
         uint32_t hidx = (kh % c1); // Hash idx into super set
         uint32_t cc = 0;
         bool found = false;
@@ -2871,6 +3216,126 @@ uint32_t _gs_slot_array_iter_find_first_valid_index(gs_dyn_array(uint32_t) indic
 #define gs_slot_array_iter_getp(__SA, __IT)\
     gs_slot_array_getp(__SA, __IT)
 
+/*===================================
+// Slot Pool
+===================================*/
+
+// Generation (high 32 bits) | slot index (low 32 bits)
+typedef uint64_t gs_slot_pool_handle;
+
+#define GS_SLOT_POOL_INVALID_HANDLE     0
+#define GS_SLOT_POOL_FREE_LIST_END      UINT32_MAX
+
+#define gs_slot_pool_handle_index(__H)  ((uint32_t)((__H) & 0xFFFFFFFF))
+#define gs_slot_pool_handle_gen(__H)    ((uint32_t)((__H) >> 32))
+#define gs_slot_pool_handle_make(__I, __G) (((gs_slot_pool_handle)(__G) << 32) | (gs_slot_pool_handle)(__I))
+
+typedef struct __gs_slot_pool_dummy_header {
+    gs_dyn_array(uint32_t) indices;     // Slot -> data index (live), or next free slot (free)
+    gs_dyn_array(uint32_t) gens;        // Slot -> generation (bumped on erase)
+    gs_dyn_array(uint32_t) slots;       // Data index -> slot (back-pointer for swap and pop)
+    void* data;
+    uint32_t free_head;
+} __gs_slot_pool_dummy_header;
+
+#define gs_slot_pool(__T)\
+    struct\
+    {\
+        gs_dyn_array(uint32_t) indices;\
+        gs_dyn_array(uint32_t) gens;\
+        gs_dyn_array(uint32_t) slots;\
+        gs_dyn_array(__T) data;\
+        uint32_t free_head;\
+        __T tmp;\
+    }*
+
+#define gs_slot_pool_new(__T)\
+    NULL
+
+GS_API_DECL void** 
+gs_slot_pool_init(void** sp, size_t sz);
+
+GS_API_DECL gs_slot_pool_handle 
+gs_slot_pool_insert_func(void* sp, void* val, size_t val_len);
+
+GS_API_DECL bool 
+gs_slot_pool_erase_func(void* sp, gs_slot_pool_handle hndl, size_t val_len);
+
+GS_API_DECL void 
+gs_slot_pool_clear_func(void* sp);
+
+#define gs_slot_pool_insert(__SP, __VAL)\
+    (gs_slot_pool_init((void**)&(__SP), sizeof(*(__SP))), (__SP)->tmp = (__VAL),\
+        gs_slot_pool_insert_func((__SP), (void*)&((__SP)->tmp), sizeof((__SP)->tmp)))
+
+#define gs_slot_pool_reserve(__SP, __NUM)\
+    do {\
+        gs_slot_pool_init((void**)&(__SP), sizeof(*(__SP)));\
+        gs_dyn_array_reserve((__SP)->data, __NUM);\
+        gs_dyn_array_reserve((__SP)->slots, __NUM);\
+        gs_dyn_array_reserve((__SP)->indices, __NUM);\
+        gs_dyn_array_reserve((__SP)->gens, __NUM);\
+    } while (0)
+
+#define gs_slot_pool_size(__SP)\
+    ((__SP) == NULL ? 0 : gs_dyn_array_size((__SP)->data))
+
+#define gs_slot_pool_empty(__SP)\
+    (gs_slot_pool_size(__SP) == 0)
+
+#define gs_slot_pool_exists(__SP, __H)\
+    ((__SP) && gs_slot_pool_handle_index(__H) < (uint32_t)gs_dyn_array_size((__SP)->gens) &&\
+        (__SP)->gens[gs_slot_pool_handle_index(__H)] == gs_slot_pool_handle_gen(__H))
+
+#define gs_slot_pool_get(__SP, __H)\
+    ((__SP)->data[(__SP)->indices[gs_slot_pool_handle_index(__H)]])
+
+#define gs_slot_pool_getp(__SP, __H)\
+    (&(gs_slot_pool_get(__SP, (__H))))
+
+#define gs_slot_pool_erase(__SP, __H)\
+    ((__SP) ? gs_slot_pool_erase_func((__SP), (__H), sizeof((__SP)->tmp)) : false)
+
+#define gs_slot_pool_clear(__SP)\
+    do {\
+        if ((__SP) != NULL) {\
+            gs_slot_pool_clear_func((__SP));\
+        }\
+    } while (0)
+
+#define gs_slot_pool_free(__SP)\
+    do {\
+        if ((__SP) != NULL) {\
+            gs_dyn_array_free((__SP)->data);\
+            gs_dyn_array_free((__SP)->slots);\
+            gs_dyn_array_free((__SP)->indices);\
+            gs_dyn_array_free((__SP)->gens);\
+            gs_free((__SP));\
+            (__SP) = NULL;\
+        }\
+    } while (0)
+
+/*=== Slot Pool Iterator ===*/
+
+// Iterates data densely, iterator is a data index
+typedef uint32_t gs_slot_pool_iter;
+typedef gs_slot_pool_iter gs_slot_pool_iter_t;
+
+#define gs_slot_pool_iter_valid(__SP, __IT)\
+    ((__IT) < gs_slot_pool_size(__SP))
+
+#define gs_slot_pool_iter_advance(__SP, __IT)\
+    (++(__IT))
+
+#define gs_slot_pool_iter_get(__SP, __IT)\
+    ((__SP)->data[(__IT)])
+
+#define gs_slot_pool_iter_getp(__SP, __IT)\
+    (&((__SP)->data[(__IT)]))
+
+#define gs_slot_pool_iter_handle(__SP, __IT)\
+    gs_slot_pool_handle_make((__SP)->slots[(__IT)], (__SP)->gens[(__SP)->slots[(__IT)]])
+
 /*===================================
 // Slot Map
 ===================================*/
@@ -3160,6 +3625,7 @@ typedef gs_pqueue_iter gs_pqueue_iter_t;
 typedef struct gs_command_buffer_t
 {
     uint32_t num_commands;
+    uint32_t num_sort_keys;     // Sort keys recorded (keyed packets get sorted on submit when non-zero)
     gs_byte_buffer_t commands;
 } gs_command_buffer_t;
 
@@ -3183,6 +3649,7 @@ gs_force_inline
 void gs_command_buffer_clear(gs_command_buffer_t* cb)
 {
     cb->num_commands = 0;
+    cb->num_sort_keys = 0;
     gs_byte_buffer_clear(&cb->commands);
 }
 
@@ -3359,6 +3826,189 @@ GS_API_DECL void gs_paged_allocator_clear(gs_paged_allocator_t* pa);
 #define GS_YAXIS    gs_v3(0.f, 1.f, 0.f)
 #define GS_ZAXIS    gs_v3(0.f, 0.f, 1.f)
 
+/*================================================================================
+// SIMD
+================================================================================*/
+
+/*
+    Define GS_MATH_SIMD before including gs.h to implement gs_mat4_mul, gs_mat4_inverse, gs_mat4_mul_vec3/4, 
+    gs_quat_mul, the vqs composition (including its quaternion rotate) and the batch kernels with 128-bit SSE 
+    (x86/x64) or NEON (arm64). The public structs are unchanged (unaligned loads/stores), so results only differ from 
+    the scalar path by float rounding. Falls back to scalar when neither instruction set is available.
+*/
+
+#ifdef GS_MATH_SIMD
+    #if (defined __SSE__ || defined _M_X64 || defined _M_AMD64 || (defined _M_IX86_FP && _M_IX86_FP >= 1))
+        #include <xmmintrin.h>
+        #define __GS_SIMD_SSE
+    #elif ((defined __ARM_NEON || defined __ARM_NEON__) && defined __aarch64__) || defined _M_ARM64
+        #include <arm_neon.h>
+        #define __GS_SIMD_NEON
+    #endif
+#endif
+
+#if (defined __GS_SIMD_SSE)
+
+    #define __GS_SIMD
+    typedef __m128 __gs_simd_f4;
+
+    #define __gs_simd_load(__P)                 _mm_loadu_ps(__P)
+    #define __gs_simd_store(__P, __V)           _mm_storeu_ps((__P), (__V))
+    #define __gs_simd_set(__X, __Y, __Z, __W)   _mm_setr_ps((__X), (__Y), (__Z), (__W))
+    #define __gs_simd_splat(__S)                _mm_set1_ps(__S)
+    #define __gs_simd_add(__A, __B)             _mm_add_ps((__A), (__B))
+    #define __gs_simd_sub(__A, __B)             _mm_sub_ps((__A), (__B))
+    #define __gs_simd_mul(__A, __B)             _mm_mul_ps((__A), (__B))
+    #define __gs_simd_div(__A, __B)             _mm_div_ps((__A), (__B))
+    #define __gs_simd_sqrt(__A)                 _mm_sqrt_ps(__A)
+    #define __gs_simd_madd(__C, __A, __B)       _mm_add_ps((__C), _mm_mul_ps((__A), (__B)))
+    #define __gs_simd_xor(__A, __B)             _mm_xor_ps((__A), (__B))
+    #define __gs_simd_or(__A, __B)              _mm_or_ps((__A), (__B))
+    #define __gs_simd_cmplt(__A, __B)           _mm_cmplt_ps((__A), (__B))
+    #define __gs_simd_movemask(__V)             _mm_movemask_ps(__V)
+
+    // (a[i0], a[i1], b[i2], b[i3]), indices must be constants
+    #define __gs_simd_shuffle(__A, __B, __I0, __I1, __I2, __I3)\
+        _mm_shuffle_ps((__A), (__B), _MM_SHUFFLE((__I3), (__I2), (__I1), (__I0)))
+
+    #define __gs_simd_lane(__V, __I)\
+        _mm_shuffle_ps((__V), (__V), _MM_SHUFFLE((__I), (__I), (__I), (__I)))
+
+    gs_force_inline __gs_simd_f4 
+    __gs_simd_load3(const float* p)
+    {
+        return _mm_movelh_ps(_mm_loadl_pi(_mm_setzero_ps(), (const __m64*)p), _mm_load_ss(p + 2));
+    }
+
+    gs_force_inline void 
+    __gs_simd_store3(float* p, __gs_simd_f4 v)
+    {
+        _mm_storel_pi((__m64*)p, v);
+        _mm_store_ss(p + 2, _mm_movehl_ps(v, v));
+    }
+
+#elif (defined __GS_SIMD_NEON)
+
+    #define __GS_SIMD
+    typedef float32x4_t __gs_simd_f4;
+
+    #define __gs_simd_load(__P)                 vld1q_f32(__P)
+    #define __gs_simd_store(__P, __V)           vst1q_f32((__P), (__V))
+    #define __gs_simd_splat(__S)                vdupq_n_f32(__S)
+    #define __gs_simd_add(__A, __B)             vaddq_f32((__A), (__B))
+    #define __gs_simd_sub(__A, __B)             vsubq_f32((__A), (__B))
+    #define __gs_simd_mul(__A, __B)             vmulq_f32((__A), (__B))
+    #define __gs_simd_div(__A, __B)             vdivq_f32((__A), (__B))
+    #define __gs_simd_sqrt(__A)                 vsqrtq_f32(__A)
+    #define __gs_simd_madd(__C, __A, __B)       vmlaq_f32((__C), (__A), (__B))
+    #define __gs_simd_xor(__A, __B)             vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(__A), vreinterpretq_u32_f32(__B)))
+    #define __gs_simd_or(__A, __B)              vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(__A), vreinterpretq_u32_f32(__B)))
+    #define __gs_simd_cmplt(__A, __B)           vreinterpretq_f32_u32(vcltq_f32((__A), (__B)))
+
+    // (a[i0], a[i1], b[i2], b[i3]), indices must be constants (lane gathers fold to ext/zip/trn)
+    #define __gs_simd_shuffle(__A, __B, __I0, __I1, __I2, __I3)\
+        vsetq_lane_f32(vgetq_lane_f32((__B), (__I3)),\
+        vsetq_lane_f32(vgetq_lane_f32((__B), (__I2)),\
+        vsetq_lane_f32(vgetq_lane_f32((__A), (__I1)),\
+        vdupq_n_f32(vgetq_lane_f32((__A), (__I0))), 1), 2), 3)
+
+    #define __gs_simd_lane(__V, __I)\
+        vdupq_laneq_f32((__V), (__I))
+
+    gs_force_inline __gs_simd_f4 
+    __gs_simd_set(float x, float y, float z, float w)
+    {
+        const float v[4] = {x, y, z, w};
+        return vld1q_f32(v);
+    }
+
+    // Sign bit of each lane packed into bits 0-3, as _mm_movemask_ps
+    gs_force_inline int32_t 
+    __gs_simd_movemask(__gs_simd_f4 v)
+    {
+        const int32_t shift[4] = {0, 1, 2, 3};
+        const uint32x4_t bits = vshlq_u32(vshrq_n_u32(vreinterpretq_u32_f32(v), 31), vld1q_s32(shift));
+        return (int32_t)vaddvq_u32(bits);
+    }
+
+    gs_force_inline __gs_simd_f4 
+    __gs_simd_load3(const float* p)
+    {
+        return vcombine_f32(vld1_f32(p), vld1_lane_f32(p + 2, vdup_n_f32(0.f), 0));
+    }
+
+    gs_force_inline void 
+    __gs_simd_store3(float* p, __gs_simd_f4 v)
+    {
+        vst1_f32(p, vget_low_f32(v));
+        vst1q_lane_f32(p + 2, v, 2);
+    }
+
+#endif
+
+#ifdef __GS_SIMD
+
+// Dot product of all four lanes, broadcast
+gs_force_inline __gs_simd_f4 
+__gs_simd_dot4(__gs_simd_f4 a, __gs_simd_f4 b)
+{
+    __gs_simd_f4 d = __gs_simd_mul(a, b);
+    d = __gs_simd_add(d, __gs_simd_shuffle(d, d, 1, 0, 3, 2));
+    return __gs_simd_add(d, __gs_simd_shuffle(d, d, 2, 3, 0, 1));
+}
+
+// Same as gs_quat_norm: scale by the reciprocal length
+gs_force_inline __gs_simd_f4 
+__gs_simd_norm4(__gs_simd_f4 v)
+{
+    return __gs_simd_mul(v, __gs_simd_div(__gs_simd_splat(1.f), __gs_simd_sqrt(__gs_simd_dot4(v, v))));
+}
+
+// xyz cross product, w is garbage
+gs_force_inline __gs_simd_f4 
+__gs_simd_cross3(__gs_simd_f4 a, __gs_simd_f4 b)
+{
+    const __gs_simd_f4 c = __gs_simd_sub(
+        __gs_simd_mul(a, __gs_simd_shuffle(b, b, 1, 2, 0, 3)),
+        __gs_simd_mul(__gs_simd_shuffle(a, a, 1, 2, 0, 3), b)
+    );
+    return __gs_simd_shuffle(c, c, 1, 2, 0, 3);
+}
+
+// q0 * q1 as a sum of lane broadcasts of q0 against sign flipped permutations of q1 (xor with -0.f flips)
+gs_force_inline __gs_simd_f4 
+__gs_simd_quat_mul(__gs_simd_f4 q0, __gs_simd_f4 q1)
+{
+    const __gs_simd_f4 a = __gs_simd_mul(__gs_simd_lane(q0, 3), q1);
+    const __gs_simd_f4 b = __gs_simd_mul(__gs_simd_lane(q0, 0), __gs_simd_xor(__gs_simd_shuffle(q1, q1, 3, 2, 1, 0), __gs_simd_set(0.f, -0.f, 0.f, -0.f)));
+    const __gs_simd_f4 c = __gs_simd_mul(__gs_simd_lane(q0, 1), __gs_simd_xor(__gs_simd_shuffle(q1, q1, 2, 3, 0, 1), __gs_simd_set(0.f, 0.f, -0.f, -0.f)));
+    const __gs_simd_f4 d = __gs_simd_mul(__gs_simd_lane(q0, 2), __gs_simd_xor(__gs_simd_shuffle(q1, q1, 1, 0, 3, 2), __gs_simd_set(-0.f, 0.f, 0.f, -0.f)));
+    return __gs_simd_add(__gs_simd_add(a, b), __gs_simd_add(c, d));
+}
+
+// v + 2w(q x v) + 2(q x (q x v)), same as gs_quat_rotate
+gs_force_inline __gs_simd_f4 
+__gs_simd_quat_rotate(__gs_simd_f4 q, __gs_simd_f4 v)
+{
+    const __gs_simd_f4 uv = __gs_simd_cross3(q, v);
+    const __gs_simd_f4 uuv = __gs_simd_cross3(q, uv);
+    const __gs_simd_f4 two = __gs_simd_splat(2.f);
+    return __gs_simd_madd(__gs_simd_madd(v, uv, __gs_simd_mul(two, __gs_simd_lane(q, 3))), uuv, two);
+}
+
+// Columns c0..c3 times (v.x, v.y, v.z, v.w)
+gs_force_inline __gs_simd_f4 
+__gs_simd_mat4_mul_vec4(__gs_simd_f4 c0, __gs_simd_f4 c1, __gs_simd_f4 c2, __gs_simd_f4 c3, __gs_simd_f4 v)
+{
+    __gs_simd_f4 r = __gs_simd_mul(c0, __gs_simd_lane(v, 0));
+    r = __gs_simd_madd(r, c1, __gs_simd_lane(v, 1));
+    r = __gs_simd_madd(r, c2, __gs_simd_lane(v, 2));
+    return __gs_simd_madd(r, c3, __gs_simd_lane(v, 3));
+}
+
+#endif // __GS_SIMD
+
+
 /*================================================================================
 // Useful Common Math Functions
 ================================================================================*/
@@ -4091,6 +4741,16 @@ gs_inline gs_mat4
 gs_mat4_mul(gs_mat4 m0, gs_mat4 m1)
 {
     gs_mat4 m_res = gs_mat4_ctor(); 
+#ifdef __GS_SIMD
+    const __gs_simd_f4 c0 = __gs_simd_load(m0.elements + 0);
+    const __gs_simd_f4 c1 = __gs_simd_load(m0.elements + 4);
+    const __gs_simd_f4 c2 = __gs_simd_load(m0.elements + 8);
+    const __gs_simd_f4 c3 = __gs_simd_load(m0.elements + 12);
+    for (u32 y = 0; y < 4; ++y)
+    {
+        __gs_simd_store(m_res.elements + y * 4, __gs_simd_mat4_mul_vec4(c0, c1, c2, c3, __gs_simd_load(m1.elements + y * 4)));
+    }
+#else
     for (u32 y = 0; y < 4; ++y)
     {
         for (u32 x = 0; x < 4; ++x)
@@ -4103,6 +4763,7 @@ gs_mat4_mul(gs_mat4 m0, gs_mat4 m1)
             m_res.elements[x + y * 4] = sum;
         }
     }
+#endif
 
     return m_res;
 }
@@ -4176,6 +4837,68 @@ gs_mat4 gs_mat4_inverse(gs_mat4 m)
 {
     gs_mat4 res = gs_mat4_identity();
 
+#ifdef __GS_SIMD
+    {
+        // Blockwise inverse through 2x2 sub-matrices (A B / C D), each packed into one register.
+        // Works on the transpose as well, so the column-major layout needs no special handling.
+        // Source: https://lxjk.github.io/2017-09-03-Fast-4x4-Matrix-Inverse-with-SSE-SIMD-Explained.html
+        const __gs_simd_f4 c0 = __gs_simd_load(m.elements + 0);
+        const __gs_simd_f4 c1 = __gs_simd_load(m.elements + 4);
+        const __gs_simd_f4 c2 = __gs_simd_load(m.elements + 8);
+        const __gs_simd_f4 c3 = __gs_simd_load(m.elements + 12);
+
+        const __gs_simd_f4 A = __gs_simd_shuffle(c0, c1, 0, 1, 0, 1);
+        const __gs_simd_f4 B = __gs_simd_shuffle(c0, c1, 2, 3, 2, 3);
+        const __gs_simd_f4 C = __gs_simd_shuffle(c2, c3, 0, 1, 0, 1);
+        const __gs_simd_f4 D = __gs_simd_shuffle(c2, c3, 2, 3, 2, 3);
+
+        // Determinants of A, B, C, D
+        const __gs_simd_f4 det_sub = __gs_simd_sub(
+            __gs_simd_mul(__gs_simd_shuffle(c0, c2, 0, 2, 0, 2), __gs_simd_shuffle(c1, c3, 1, 3, 1, 3)),
+            __gs_simd_mul(__gs_simd_shuffle(c0, c2, 1, 3, 1, 3), __gs_simd_shuffle(c1, c3, 0, 2, 0, 2))
+        );
+        const __gs_simd_f4 det_a = __gs_simd_lane(det_sub, 0);
+        const __gs_simd_f4 det_b = __gs_simd_lane(det_sub, 1);
+        const __gs_simd_f4 det_c = __gs_simd_lane(det_sub, 2);
+        const __gs_simd_f4 det_d = __gs_simd_lane(det_sub, 3);
+
+        // adj(D) * C, adj(A) * B
+        const __gs_simd_f4 dc = __gs_simd_sub(__gs_simd_mul(__gs_simd_shuffle(D, D, 3, 3, 0, 0), C), 
+            __gs_simd_mul(__gs_simd_shuffle(D, D, 1, 1, 2, 2), __gs_simd_shuffle(C, C, 2, 3, 0, 1)));
+        const __gs_simd_f4 ab = __gs_simd_sub(__gs_simd_mul(__gs_simd_shuffle(A, A, 3, 3, 0, 0), B), 
+            __gs_simd_mul(__gs_simd_shuffle(A, A, 1, 1, 2, 2), __gs_simd_shuffle(B, B, 2, 3, 0, 1)));
+
+        // X = det(D) * A - B * (adj(D) * C), W = det(A) * D - C * (adj(A) * B)
+        __gs_simd_f4 x = __gs_simd_sub(__gs_simd_mul(det_d, A), __gs_simd_add(__gs_simd_mul(B, __gs_simd_shuffle(dc, dc, 0, 3, 0, 3)), 
+            __gs_simd_mul(__gs_simd_shuffle(B, B, 1, 0, 3, 2), __gs_simd_shuffle(dc, dc, 2, 1, 2, 1))));
+        __gs_simd_f4 w = __gs_simd_sub(__gs_simd_mul(det_a, D), __gs_simd_add(__gs_simd_mul(C, __gs_simd_shuffle(ab, ab, 0, 3, 0, 3)), 
+            __gs_simd_mul(__gs_simd_shuffle(C, C, 1, 0, 3, 2), __gs_simd_shuffle(ab, ab, 2, 1, 2, 1))));
+
+        // Y = det(B) * C - D * adj(adj(A) * B), Z = det(C) * B - A * adj(adj(D) * C)
+        __gs_simd_f4 y = __gs_simd_sub(__gs_simd_mul(det_b, C), __gs_simd_sub(__gs_simd_mul(D, __gs_simd_shuffle(ab, ab, 3, 0, 3, 0)), 
+            __gs_simd_mul(__gs_simd_shuffle(D, D, 1, 0, 3, 2), __gs_simd_shuffle(ab, ab, 2, 1, 2, 1))));
+        __gs_simd_f4 z = __gs_simd_sub(__gs_simd_mul(det_c, B), __gs_simd_sub(__gs_simd_mul(A, __gs_simd_shuffle(dc, dc, 3, 0, 3, 0)), 
+            __gs_simd_mul(__gs_simd_shuffle(A, A, 1, 0, 3, 2), __gs_simd_shuffle(dc, dc, 2, 1, 2, 1))));
+
+        // det(M) = det(A) * det(D) + det(B) * det(C) - tr((adj(A) * B) * (adj(D) * C))
+        __gs_simd_f4 tr = __gs_simd_mul(ab, __gs_simd_shuffle(dc, dc, 0, 2, 1, 3));
+        tr = __gs_simd_add(tr, __gs_simd_shuffle(tr, tr, 1, 0, 3, 2));
+        tr = __gs_simd_add(tr, __gs_simd_shuffle(tr, tr, 2, 3, 0, 1));
+        const __gs_simd_f4 det = __gs_simd_sub(__gs_simd_add(__gs_simd_mul(det_a, det_d), __gs_simd_mul(det_b, det_c)), tr);
+        const __gs_simd_f4 rdet = __gs_simd_div(__gs_simd_set(1.f, -1.f, -1.f, 1.f), det);   // Adjugate signs
+
+        x = __gs_simd_mul(x, rdet);
+        y = __gs_simd_mul(y, rdet);
+        z = __gs_simd_mul(z, rdet);
+        w = __gs_simd_mul(w, rdet);
+
+        __gs_simd_store(res.elements + 0, __gs_simd_shuffle(x, y, 3, 1, 3, 1));
+        __gs_simd_store(res.elements + 4, __gs_simd_shuffle(x, y, 2, 0, 2, 0));
+        __gs_simd_store(res.elements + 8, __gs_simd_shuffle(z, w, 3, 1, 3, 1));
+        __gs_simd_store(res.elements + 12, __gs_simd_shuffle(z, w, 2, 0, 2, 0));
+    }
+#else
+
     f32 temp[16];
 
     temp[0] = m.elements[5] * m.elements[10] * m.elements[15] -
@@ -4295,6 +5018,7 @@ gs_mat4 gs_mat4_inverse(gs_mat4 m)
 
     for (int i = 0; i < 4 * 4; i++)
         res.elements[i] = (float)(temp[i] * (float)determinant);
+#endif
 
     return res;
 }
@@ -4486,7 +5210,7 @@ gs_mat4 gs_mat4_recompose(const float* translation, const float* rotation, const
         rot[i] = gs_mat4_rotatev(gs_deg2rad(rotation[i]), direction_unary[i]);
     }
 
-    mat = gs_mat4_mul_list(3, rot[2], rot[1], rot[0]);
+    mat = gs_mat4_mul(gs_mat4_mul(rot[2], rot[1]), rot[0]);
 
     float valid_scale[3] = gs_default_val();
     for (uint32_t i = 0; i < 3; ++i) {
@@ -4505,6 +5229,12 @@ gs_mat4 gs_mat4_recompose(const float* translation, const float* rotation, const
 gs_inline
 gs_vec4 gs_mat4_mul_vec4(gs_mat4 m, gs_vec4 v)
 {
+#ifdef __GS_SIMD
+    gs_vec4 r;
+    __gs_simd_store(r.xyzw, __gs_simd_mat4_mul_vec4(__gs_simd_load(m.elements + 0), __gs_simd_load(m.elements + 4), 
+        __gs_simd_load(m.elements + 8), __gs_simd_load(m.elements + 12), __gs_simd_load(v.xyzw)));
+    return r;
+#else
     return gs_vec4_ctor
     (
         m.elements[0 + 4 * 0] * v.x + m.elements[0 + 4 * 1] * v.y + m.elements[0 + 4 * 2] * v.z + m.elements[0 + 4 * 3] * v.w,  
@@ -4512,22 +5242,98 @@ gs_vec4 gs_mat4_mul_vec4(gs_mat4 m, gs_vec4 v)
         m.elements[2 + 4 * 0] * v.x + m.elements[2 + 4 * 1] * v.y + m.elements[2 + 4 * 2] * v.z + m.elements[2 + 4 * 3] * v.w,  
         m.elements[3 + 4 * 0] * v.x + m.elements[3 + 4 * 1] * v.y + m.elements[3 + 4 * 2] * v.z + m.elements[3 + 4 * 3] * v.w
     );
+#endif
 }
 
 gs_inline
 gs_vec3 gs_mat4_mul_vec3(gs_mat4 m, gs_vec3 v)
 {
+#ifdef __GS_SIMD
+    gs_vec3 r;
+    __gs_simd_f4 o = __gs_simd_madd(__gs_simd_load(m.elements + 12), __gs_simd_load(m.elements + 0), __gs_simd_splat(v.x));
+    o = __gs_simd_madd(o, __gs_simd_load(m.elements + 4), __gs_simd_splat(v.y));
+    o = __gs_simd_madd(o, __gs_simd_load(m.elements + 8), __gs_simd_splat(v.z));
+    __gs_simd_store3(r.xyz, o);
+    return r;
+#else
     return gs_v4tov3(gs_mat4_mul_vec4(m, gs_v4_xyz_s(v, 1.f)));
+#endif
 }
-    
-
-/*================================================================================
-// Quaternion
-================================================================================*/
 
-typedef struct
+// out[i] = m * in[i], in and out may alias
+gs_inline
+void gs_mat4_mul_vec4_batch(const gs_mat4* m, const gs_vec4* in, gs_vec4* out, uint32_t count)
 {
-    union 
+#ifdef __GS_SIMD
+    const __gs_simd_f4 c0 = __gs_simd_load(m->elements + 0);
+    const __gs_simd_f4 c1 = __gs_simd_load(m->elements + 4);
+    const __gs_simd_f4 c2 = __gs_simd_load(m->elements + 8);
+    const __gs_simd_f4 c3 = __gs_simd_load(m->elements + 12);
+    for (uint32_t i = 0; i < count; ++i) {
+        __gs_simd_store(out[i].xyzw, __gs_simd_mat4_mul_vec4(c0, c1, c2, c3, __gs_simd_load(in[i].xyzw)));
+    }
+#else
+    for (uint32_t i = 0; i < count; ++i) {
+        out[i] = gs_mat4_mul_vec4(*m, in[i]);
+    }
+#endif
+}
+
+// out[i] = m * (in[i], 1), in and out may alias
+gs_inline
+void gs_mat4_mul_vec3_batch(const gs_mat4* m, const gs_vec3* in, gs_vec3* out, uint32_t count)
+{
+#ifdef __GS_SIMD
+    const __gs_simd_f4 c0 = __gs_simd_load(m->elements + 0);
+    const __gs_simd_f4 c1 = __gs_simd_load(m->elements + 4);
+    const __gs_simd_f4 c2 = __gs_simd_load(m->elements + 8);
+    const __gs_simd_f4 c3 = __gs_simd_load(m->elements + 12);
+    const __gs_simd_f4 m00 = __gs_simd_lane(c0, 0), m10 = __gs_simd_lane(c0, 1), m20 = __gs_simd_lane(c0, 2);
+    const __gs_simd_f4 m01 = __gs_simd_lane(c1, 0), m11 = __gs_simd_lane(c1, 1), m21 = __gs_simd_lane(c1, 2);
+    const __gs_simd_f4 m02 = __gs_simd_lane(c2, 0), m12 = __gs_simd_lane(c2, 1), m22 = __gs_simd_lane(c2, 2);
+    const __gs_simd_f4 m03 = __gs_simd_lane(c3, 0), m13 = __gs_simd_lane(c3, 1), m23 = __gs_simd_lane(c3, 2);
+    uint32_t i = 0;
+
+    // Four points per iteration: deinterleave xyz|xyz|xyz|xyz into x4, y4, z4, transform, interleave back
+    for (; i + 4 <= count; i += 4) 
+    {
+        const float* src = in[i].xyz;
+        float* dst = out[i].xyz;
+        const __gs_simd_f4 a = __gs_simd_load(src + 0), b = __gs_simd_load(src + 4), c = __gs_simd_load(src + 8);
+        const __gs_simd_f4 x = __gs_simd_shuffle(a, __gs_simd_shuffle(b, c, 2, 2, 1, 1), 0, 3, 0, 2);
+        const __gs_simd_f4 y = __gs_simd_shuffle(__gs_simd_shuffle(a, b, 1, 1, 0, 0), __gs_simd_shuffle(b, c, 3, 3, 2, 2), 0, 2, 0, 2);
+        const __gs_simd_f4 z = __gs_simd_shuffle(__gs_simd_shuffle(a, b, 2, 2, 1, 1), __gs_simd_shuffle(c, c, 0, 0, 3, 3), 0, 2, 0, 2);
+
+        const __gs_simd_f4 ox = __gs_simd_madd(__gs_simd_madd(__gs_simd_madd(m03, m00, x), m01, y), m02, z);
+        const __gs_simd_f4 oy = __gs_simd_madd(__gs_simd_madd(__gs_simd_madd(m13, m10, x), m11, y), m12, z);
+        const __gs_simd_f4 oz = __gs_simd_madd(__gs_simd_madd(__gs_simd_madd(m23, m20, x), m21, y), m22, z);
+
+        __gs_simd_store(dst + 0, __gs_simd_shuffle(__gs_simd_shuffle(ox, oy, 0, 0, 0, 0), __gs_simd_shuffle(oz, ox, 0, 0, 1, 1), 0, 2, 0, 2));
+        __gs_simd_store(dst + 4, __gs_simd_shuffle(__gs_simd_shuffle(oy, oz, 1, 1, 1, 1), __gs_simd_shuffle(ox, oy, 2, 2, 2, 2), 0, 2, 0, 2));
+        __gs_simd_store(dst + 8, __gs_simd_shuffle(__gs_simd_shuffle(oz, ox, 2, 2, 3, 3), __gs_simd_shuffle(oy, oz, 3, 3, 3, 3), 0, 2, 0, 2));
+    }
+
+    for (; i < count; ++i) {
+        __gs_simd_f4 r = __gs_simd_madd(c3, c0, __gs_simd_splat(in[i].x));
+        r = __gs_simd_madd(r, c1, __gs_simd_splat(in[i].y));
+        r = __gs_simd_madd(r, c2, __gs_simd_splat(in[i].z));
+        __gs_simd_store3(out[i].xyz, r);
+    }
+#else
+    for (uint32_t i = 0; i < count; ++i) {
+        out[i] = gs_mat4_mul_vec3(*m, in[i]);
+    }
+#endif
+}
+    
+
+/*================================================================================
+// Quaternion
+================================================================================*/
+
+typedef struct
+{
+    union 
     {
         struct {
             union {
@@ -4584,12 +5390,18 @@ gs_quat_sub(gs_quat q0, gs_quat q1)
 gs_inline gs_quat
 gs_quat_mul(gs_quat q0, gs_quat q1)
 {
+#ifdef __GS_SIMD
+    gs_quat r;
+    __gs_simd_store(r.xyzw, __gs_simd_quat_mul(__gs_simd_load(q0.xyzw), __gs_simd_load(q1.xyzw)));
+    return r;
+#else
     return gs_quat_ctor(
         q0.w * q1.x + q1.w * q0.x + q0.y * q1.z - q1.y * q0.z,
         q0.w * q1.y + q1.w * q0.y + q0.z * q1.x - q1.z * q0.x,
         q0.w * q1.z + q1.w * q0.z + q0.x * q1.y - q1.x * q0.y,
         q0.w * q1.w - q0.x * q1.x - q0.y * q1.y - q0.z * q1.z
     );
+#endif
 }
 
 gs_inline 
@@ -4609,12 +5421,7 @@ gs_quat gs_quat_mul_list(u32 count, ...)
 gs_inline gs_quat 
 gs_quat_mul_quat(gs_quat q0, gs_quat q1)
 {
-    return gs_quat_ctor(
-        q0.w * q1.x + q1.w * q0.x + q0.y * q1.z - q1.y * q0.z,
-        q0.w * q1.y + q1.w * q0.y + q0.z * q1.x - q1.z * q0.x,
-        q0.w * q1.z + q1.w * q0.z + q0.x * q1.y - q1.x * q0.y,
-        q0.w * q1.w - q0.x * q1.x - q0.y * q1.y - q0.z * q1.z
-    );
+    return gs_quat_mul(q0, q1);
 }
 
 gs_inline 
@@ -4682,6 +5489,7 @@ gs_inline gs_vec3
 gs_quat_rotate(gs_quat q, gs_vec3 v)
 {
     // nVidia SDK implementation
+    // Stays scalar under GS_MATH_SIMD: for a lone vec3 the register packing costs more than it saves
     gs_vec3 qvec = gs_vec3_ctor(q.x, q.y, q.z);
     gs_vec3 uv = gs_vec3_cross(qvec, v);
     gs_vec3 uuv = gs_vec3_cross(qvec, uv);
@@ -4943,6 +5751,24 @@ gs_vqs_default()
     return t;
 }
 
+#ifdef __GS_SIMD
+// Loads everything before storing, so out may alias local or parent
+gs_force_inline void
+__gs_simd_vqs_absolute_transform(const gs_vqs* local, const gs_vqs* parent, gs_vqs* out)
+{
+    const __gs_simd_f4 p_rot = __gs_simd_norm4(__gs_simd_load(parent->rotation.xyzw));
+    const __gs_simd_f4 l_rot = __gs_simd_norm4(__gs_simd_load(local->rotation.xyzw));
+    const __gs_simd_f4 p_scl = __gs_simd_load3(parent->scale.xyz);
+    const __gs_simd_f4 scl = __gs_simd_mul(__gs_simd_load3(local->scale.xyz), p_scl);
+    const __gs_simd_f4 rot = __gs_simd_norm4(__gs_simd_quat_mul(p_rot, l_rot));
+    const __gs_simd_f4 tns = __gs_simd_add(__gs_simd_load3(parent->position.xyz), 
+        __gs_simd_quat_rotate(p_rot, __gs_simd_mul(p_scl, __gs_simd_load3(local->position.xyz))));
+    __gs_simd_store3(out->position.xyz, tns);
+    __gs_simd_store(out->rotation.xyzw, rot);
+    __gs_simd_store3(out->scale.xyz, scl);
+}
+#endif
+
 // AbsScale = ParentScale * LocalScale
 // AbsRot   = LocalRot * ParentRot
 // AbsTrans = ParentPos + [ParentRot * (ParentScale * LocalPos)]
@@ -4953,6 +5779,12 @@ gs_vqs_absolute_transform(const gs_vqs* local, const gs_vqs* parent)
         return gs_vqs_default();
     }
 
+#ifdef __GS_SIMD
+    gs_vqs r;
+    __gs_simd_vqs_absolute_transform(local, parent, &r);
+    return r;
+#else
+
     // Normalized rotations
     gs_quat p_rot_norm = gs_quat_norm(parent->rotation);
     gs_quat l_rot_norm = gs_quat_norm(local->rotation);
@@ -4965,6 +5797,7 @@ gs_vqs_absolute_transform(const gs_vqs* local, const gs_vqs* parent)
     gs_vec3 tns = gs_vec3_add(parent->position, gs_quat_rotate(p_rot_norm, gs_vec3_mul(parent->scale, local->position)));
 
     return gs_vqs_ctor(tns, rot, scl);
+#endif
 }
 
 // RelScale = AbsScale / ParentScale 
@@ -4992,6 +5825,19 @@ gs_vqs_relative_transform(const gs_vqs* absolute, const gs_vqs* parent)
     return gs_vqs_ctor(tns, rot, scl);
 }
 
+// out[i] = absolute transform of local[i] under parent[i], out may alias either input
+gs_inline void 
+gs_vqs_absolute_transform_batch(const gs_vqs* local, const gs_vqs* parent, gs_vqs* out, uint32_t count)
+{
+    for (uint32_t i = 0; i < count; ++i) {
+#ifdef __GS_SIMD
+        __gs_simd_vqs_absolute_transform(&local[i], &parent[i], &out[i]);
+#else
+        out[i] = gs_vqs_absolute_transform(&local[i], &parent[i]);
+#endif
+    }
+}
+
 gs_inline gs_mat4 
 gs_vqs_to_mat4(const gs_vqs* transform)
 {
@@ -5154,9 +6000,109 @@ typedef mco_result gs_coro_result;
 GS_API_DECL uint32_t
 gs_atomic_cmp_swp(volatile uint32_t *dst, uint32_t swap, uint32_t cmp);
 
+// Returns the new value
 GS_API_DECL int32_t 
 gs_atomic_add(volatile int32_t *dst, int32_t value);
 
+// Load with acquire semantics
+GS_API_DECL uint32_t
+gs_atomic_load(volatile uint32_t* src);
+
+// Store with release semantics
+GS_API_DECL void
+gs_atomic_store(volatile uint32_t* dst, uint32_t value);
+
+/*================================================================================
+// Jobs
+================================================================================*/
+
+/*
+    Job system built on the scheduler. The engine owns one (gs_subsystem(jobs)), sized
+    through gs_app_desc_t.jobs, and util headers can take a gs_jobs_t* to spread work across it.
+
+    * Jobs run func over [0, count) split into partitions of at least grain items.
+    * Dependencies: gs_jobs_depend(job, dep) holds job back until dep has finished. Declare all
+        dependencies before submitting, then submit every job (in any order); jobs with
+        unfinished dependencies are kicked as continuations by the last partition of their dependency.
+    * A job with count == 0 runs nothing and is useful as a join point for other jobs.
+    * gs_jobs_wait() helps run other jobs while waiting. Jobs must stay alive until waited on; waiting
+        on a job also covers everything it (transitively) depends on.
+    * Submit and wait from the thread that created the job system, or from inside a job.
+*/
+
+#ifndef GS_JOBS_MAX_CONTINUATIONS
+    #define GS_JOBS_MAX_CONTINUATIONS 8
+#endif
+
+#ifndef GS_JOBS_MAX_DEPENDENCIES
+    #define GS_JOBS_MAX_DEPENDENCIES 8
+#endif
+
+#ifndef GS_JOBS_SCRATCH_SIZE_DEFAULT
+    #define GS_JOBS_SCRATCH_SIZE_DEFAULT (256 * 1024)
+#endif
+
+// Process items [start, end) of a job. Thread is in [0, thread_count) and indexes per-thread scratch.
+typedef void (* gs_job_func_t)(void* user_data, uint32_t start, uint32_t end, uint32_t thread);
+
+typedef struct gs_job_t
+{
+    gs_job_func_t func;
+    void* user_data;
+    uint32_t count;
+    uint32_t grain;
+    volatile gs_atomic_int_t remaining;         // Items left + 1, zero once finished and continuations kicked
+    volatile gs_atomic_int_t dependencies;      // Unfinished dependencies + 1 until submitted
+    struct gs_job_t* continuations[GS_JOBS_MAX_CONTINUATIONS];
+    uint32_t continuation_count;
+    struct gs_job_t* depends_on[GS_JOBS_MAX_DEPENDENCIES];
+    uint32_t depends_on_count;
+    struct gs_jobs_t* jobs;
+    gs_sched_task_t task;
+} gs_job_t;
+
+typedef struct gs_jobs_desc_t
+{
+    uint32_t thread_count;      // Including calling thread, 0 for hardware thread count
+    size_t scratch_size;        // Scratch arena bytes per thread, 0 for GS_JOBS_SCRATCH_SIZE_DEFAULT
+} gs_jobs_desc_t;
+
+typedef struct gs_jobs_scratch_t
+{
+    uint8_t* data;
+    size_t capacity;
+    size_t offset;
+    uint8_t pad[64 - 2 * sizeof(size_t) - sizeof(uint8_t*)];   // Keep arenas on separate cache lines
+} gs_jobs_scratch_t;
+
+typedef struct gs_jobs_t
+{
+    gs_scheduler_t sched;
+    void* sched_memory;
+    uint32_t thread_count;
+    gs_jobs_scratch_t* scratch;
+    volatile gs_atomic_int_t pending;           // Submitted jobs that haven't finished yet
+} gs_jobs_t;
+
+/* Create, Destroy */
+GS_API_DECL gs_jobs_t* gs_jobs_create(const gs_jobs_desc_t* desc);
+GS_API_DECL void       gs_jobs_destroy(gs_jobs_t* jobs);    // Waits for all jobs to finish
+
+/* Jobs */
+GS_API_DECL void gs_job_init(gs_job_t* job, gs_job_func_t func, void* user_data, uint32_t count, uint32_t grain);
+GS_API_DECL void gs_jobs_depend(gs_job_t* job, gs_job_t* dependency);
+GS_API_DECL void gs_jobs_submit(gs_jobs_t* jobs, gs_job_t* job);
+GS_API_DECL void gs_jobs_wait(gs_jobs_t* jobs, gs_job_t* job);
+GS_API_DECL bool32_t gs_jobs_done(const gs_job_t* job);
+GS_API_DECL uint32_t gs_jobs_pending(gs_jobs_t* jobs);    // Submitted jobs not finished yet (inline parallel_for runs aren't counted)
+GS_API_DECL void gs_jobs_parallel_for(gs_jobs_t* jobs, gs_job_func_t func, void* user_data, uint32_t count, uint32_t grain);
+
+/* Per-thread scratch, 16 byte aligned. Returns NULL when the thread's arena is exhausted. 
+   The engine resets all arenas at the start of each frame, but skips the reset while gs_jobs_pending() is non-zero,
+   so allocations made by jobs that outlive a frame (async asset decodes) stay valid until they finish. */
+GS_API_DECL void* gs_jobs_scratch_alloc(gs_jobs_t* jobs, uint32_t thread, size_t sz);
+GS_API_DECL void  gs_jobs_scratch_reset(gs_jobs_t* jobs);   // All threads, call with no jobs in flight
+
 /*================================================================================
 // Noise
 ================================================================================*/
@@ -5428,15 +6374,34 @@ GS_API_DECL gs_token_t gs_lexer_c_next_token(gs_lexer_t* lex);
 // Platform Time
 ============================================================*/
 
+// Frame pacing: sleep until this many ms before the frame deadline, then spin on the clock for the remainder.
+// OS sleeps routinely overshoot by a scheduler quantum, so the spin window absorbs that slack.
+#ifndef GS_PLATFORM_SPIN_THRESHOLD
+    #ifdef GS_PLATFORM_WEB
+        #define GS_PLATFORM_SPIN_THRESHOLD 0.0   // Never spin the browser main thread
+    #else
+        #define GS_PLATFORM_SPIN_THRESHOLD 2.0
+    #endif
+#endif
+
+// Max number of fixed updates run in a single frame before the accumulator is dropped (avoids spiral of death)
+#ifndef GS_PLATFORM_MAX_FIXED_STEPS
+    #define GS_PLATFORM_MAX_FIXED_STEPS 8
+#endif
+
+// All times in ms unless noted. Stored as double so sub-ms precision holds over long uptimes.
 typedef struct gs_platform_time_t
 {
     float max_fps;
-    float elapsed;
-    float previous;
-    float update;
-    float render;
-    float delta;
-    float frame;
+    double elapsed;
+    double previous;
+    double update;
+    double render;
+    double delta;           // Seconds
+    double frame;
+    double fixed_delta;     // Seconds per fixed update
+    double accumulator;     // Seconds of unsimulated time carried into the next frame
+    double alpha;           // accumulator / fixed_delta, for interpolating between fixed states when rendering
 } gs_platform_time_t;
 
 /*============================================================
@@ -5939,6 +6904,9 @@ typedef struct gs_platform_t
     // Cursors
     void* cursors[GS_PLATFORM_CURSOR_COUNT];
 
+    // Mounted archives, searched last to first
+    gs_dyn_array(struct gs_platform_archive_t*) archives;
+
     // Specific user data (for custom implementations)
     void* user_data;
 
@@ -5964,6 +6932,8 @@ GS_API_DECL void gs_platform_update(gs_platform_t* platform);    // Update platf
 GS_API_DECL const gs_platform_time_t* gs_platform_time();
 GS_API_DECL float  gs_platform_delta_time();
 GS_API_DECL float  gs_platform_frame_time();
+GS_API_DECL double gs_platform_fixed_alpha();
+GS_API_DECL void   gs_platform_sleep_precise(double ms);   // Hybrid sleep then spin, see GS_PLATFORM_SPIN_THRESHOLD
 
 // Platform UUID
 GS_API_DECL gs_uuid_t gs_platform_uuid_generate();
@@ -6079,6 +7049,86 @@ GS_API_DECL void*      gs_platform_library_proc_address_default_impl(void* lib,
 #define gs_platform_library_proc_address gs_platform_library_proc_address_default_impl
 #endif
 
+/* == Platform Archive == */
+
+/*
+    Packed archive of many files in one, read through a memory mapped table of contents:
+
+        // Offline: pack files (name defaults to path, which is what loaders will request)
+        gs_platform_archive_build_entry_t entries[] = {
+            {.path = "assets/tex.png"},
+            {.path = "assets/level.json", .compress = true}
+        };
+        gs_platform_archive_build("assets.gsar", entries, gs_array_size(entries));
+
+        // Runtime: mount once, then every gs_platform_read_file_contents/file_exists/file_size_in_bytes
+        // call checks mounted archives (last mounted first) before falling back to loose files
+        gs_platform_archive_mount("assets.gsar");
+
+    Uncompressed entries are 16 byte aligned in the file and can be viewed in place without a copy through 
+    gs_platform_archive_view(). Compressed entries use an LZ4 block format and are decoded on read. 
+
+    Mount and unmount from the main thread while no loads are in flight. Lookups are read only and safe 
+    from worker threads.
+*/
+
+#define GS_PLATFORM_ARCHIVE_MAGIC       0x52415347      // "GSAR"
+#define GS_PLATFORM_ARCHIVE_VERSION     1
+#define GS_PLATFORM_ARCHIVE_ALIGNMENT   16
+
+#define GS_PLATFORM_ARCHIVE_ENTRY_COMPRESSED    0x01
+
+typedef struct gs_platform_archive_header_t
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t entry_count;
+    uint32_t names_size;
+    uint64_t toc_offset;            // Entries, sorted by hash
+    uint64_t names_offset;          // Null terminated entry names
+} gs_platform_archive_header_t;
+
+typedef struct gs_platform_archive_entry_t
+{
+    uint64_t hash;                  // FNV-1a of normalized name
+    uint64_t offset;
+    uint64_t size;                  // Decompressed size
+    uint64_t stored_size;           // Size in archive
+    uint32_t name_offset;
+    uint32_t flags;
+} gs_platform_archive_entry_t;
+
+typedef struct gs_platform_archive_t
+{
+    uint8_t* data;                  // Mapped archive
+    size_t size;
+    const gs_platform_archive_header_t* header;
+    const gs_platform_archive_entry_t* toc;
+    const char* names;
+    uint32_t fanout[257];           // Toc range per top hash byte
+    void* file_handle;
+    void* map_handle;
+    bool mapped;                    // Otherwise data was read into memory
+} gs_platform_archive_t;
+
+typedef struct gs_platform_archive_build_entry_t
+{
+    const char* path;               // File on disk
+    const char* name;               // Name in archive (defaults to path)
+    bool compress;                  // Kept uncompressed if it doesn't shrink
+} gs_platform_archive_build_entry_t;
+
+GS_API_DECL gs_result                           gs_platform_archive_build(const char* out_path, const gs_platform_archive_build_entry_t* entries, uint32_t count);
+GS_API_DECL gs_platform_archive_t*              gs_platform_archive_open(const char* path);
+GS_API_DECL void                                gs_platform_archive_close(gs_platform_archive_t* ar);
+GS_API_DECL const gs_platform_archive_entry_t*  gs_platform_archive_find(const gs_platform_archive_t* ar, const char* name);
+GS_API_DECL const void*                         gs_platform_archive_view(const gs_platform_archive_t* ar, const char* name, size_t* sz);   // Zero copy, NULL if missing or compressed
+GS_API_DECL char*                               gs_platform_archive_read(const gs_platform_archive_t* ar, const char* name, size_t* sz);   // Allocated and null terminated, free with gs_free
+GS_API_DECL gs_platform_archive_t*              gs_platform_archive_mount(const char* path);
+GS_API_DECL void                                gs_platform_archive_unmount(gs_platform_archive_t* ar);
+GS_API_DECL void                                gs_platform_archive_unmount_all();
+GS_API_DECL const gs_platform_archive_entry_t*  gs_platform_archive_find_mounted(const char* name, const gs_platform_archive_t** out_ar);
+
 /* == Platform Dependent API == */
 
 GS_API_DECL void            gs_platform_init(gs_platform_t* platform);      // Initialize platform layer
@@ -6087,7 +7137,8 @@ GS_API_DECL void            gs_platform_shutdown(gs_platform_t* platform);  // S
 GS_API_DECL void gs_platform_update_internal(gs_platform_t* platform);
 
 // Platform Util
-GS_API_DECL double gs_platform_elapsed_time();  // Returns time in ms since initialization of platform
+GS_API_DECL double   gs_platform_elapsed_time();     // Returns time in ms since initialization of platform
+GS_API_DECL uint64_t gs_platform_elapsed_time_ns();  // Returns time in ns since initialization of platform (monotonic)
 GS_API_DECL void   gs_platform_sleep(float ms); // Sleeps platform for time in ms
 
 // Platform Video
@@ -6164,6 +7215,8 @@ typedef struct gs_audio_source_t
     int32_t sample_rate;
     void* samples;
     int32_t sample_count;
+    char* stream_path;                  // Set for streaming sources, which leave samples NULL and decode while playing
+    gs_audio_file_type file_type;
 } gs_audio_source_t;
 
 gs_handle_decl(gs_audio_source_t);
@@ -6185,6 +7238,125 @@ gs_handle_decl(gs_audio_instance_t);
 
 typedef void (* gs_audio_commit)(int16_t* output, uint32_t num_channels, uint32_t sample_rate, uint32_t frame_count);
 
+/*==================
+// Audio Commands
+==================*/
+
+// Max number of live instances. Instance handle ids index directly into the voice array owned by the audio thread.
+#ifndef GS_AUDIO_MAX_VOICES
+    #define GS_AUDIO_MAX_VOICES     1024
+#endif
+
+// Frames buffered per playing stream, refilled half at a time by the decode thread (must be power of two)
+#ifndef GS_AUDIO_STREAM_FRAMES
+    #define GS_AUDIO_STREAM_FRAMES      16384
+#endif
+
+// Must be power of two
+#ifndef GS_AUDIO_COMMAND_QUEUE_SIZE
+    #define GS_AUDIO_COMMAND_QUEUE_SIZE     1024
+#endif
+
+typedef enum gs_audio_command_type
+{
+    GS_AUDIO_COMMAND_SET_DATA = 0x00,   // Assign instance data (and cached source) to voice, activating it
+    GS_AUDIO_COMMAND_PLAY,
+    GS_AUDIO_COMMAND_PAUSE,
+    GS_AUDIO_COMMAND_STOP,
+    GS_AUDIO_COMMAND_RESTART,
+    GS_AUDIO_COMMAND_SET_VOLUME,
+    GS_AUDIO_COMMAND_SET_PITCH
+} gs_audio_command_type;
+
+// Decode state for one playing instance of a streaming source. Decode thread produces frames, audio thread consumes.
+typedef struct gs_audio_stream_t
+{
+    gs_audio_source_t src;
+    void* decoder;
+    int16_t* ring;                      // GS_AUDIO_STREAM_FRAMES interleaved frames
+    uint64_t start_frame;
+    bool32_t loop;                      // Decoder wraps back to start at end of data
+    bool32_t failed;
+    volatile uint32_t write;            // Frames decoded (decode thread)
+    volatile uint32_t read;             // Frames consumed (audio thread)
+    volatile uint32_t end;              // Write count at end of data, UINT32_MAX while more remains
+    volatile uint32_t seek;             // Restart requests (audio thread)
+    volatile uint32_t seek_ack;         // Last restart handled, ring reset (decode thread)
+    volatile uint32_t released;         // No longer referenced by audio thread, decode thread frees
+} gs_audio_stream_t;
+
+typedef struct gs_audio_command_t
+{
+    gs_audio_command_type type;
+    uint32_t id;                        // Instance handle id
+    uint32_t seq;                       // Per-instance sequence, used to discard stale events on game thread
+    float value;                        // Volume/pitch
+    gs_audio_instance_decl_t decl;      // SET_DATA only
+    gs_audio_source_t src;              // SET_DATA only
+    gs_audio_stream_t* stream;          // SET_DATA only, for streaming sources
+    uint32_t generation;                // SET_DATA only, echoed back on release so stale releases are dropped
+} gs_audio_command_t;
+
+typedef struct gs_audio_event_t
+{
+    uint32_t id;
+    uint32_t seq;
+    uint32_t generation;                // Voice data generation the event was raised for
+    bool32_t released;                  // Voice was released (non-persistent instance finished), otherwise just stopped
+} gs_audio_event_t;
+
+// Wait-free single-producer/single-consumer ring. Head/tail are free-running counters, capacity is a power of two.
+typedef struct gs_audio_queue_t
+{
+    uint8_t* data;
+    uint32_t stride;
+    uint32_t capacity;
+    volatile uint32_t head;             // Written by consumer only
+    volatile uint32_t tail;             // Written by producer only
+} gs_audio_queue_t;
+
+// Audio thread view of an instance
+typedef struct gs_audio_voice_t
+{
+    gs_audio_instance_t inst;
+    gs_audio_source_t src;              // Cached so the audio thread never touches the sources slot array
+    gs_audio_stream_t* stream;
+    double stream_pos;                  // Frame position relative to stream read counter
+    volatile uint32_t position;         // Whole sample position, published for game thread reads
+    uint32_t seq;
+    uint32_t generation;
+    uint32_t active_idx;
+    bool32_t active;
+    bool32_t notify_pending;
+    bool32_t notify_release;
+} gs_audio_voice_t;
+
+/*==================
+// Audio Mixer
+==================*/
+
+// Frames mixed per pass through the float bus (callbacks larger than this are mixed in chunks)
+#ifndef GS_AUDIO_MIX_CHUNK_FRAMES
+    #define GS_AUDIO_MIX_CHUNK_FRAMES   1024
+#endif
+
+#define GS_AUDIO_SINC_TAPS      8
+#define GS_AUDIO_SINC_PHASES    256
+
+typedef enum gs_audio_resample_quality
+{
+    GS_AUDIO_RESAMPLE_LINEAR = 0x00,
+    GS_AUDIO_RESAMPLE_SINC              // 8-tap Lanczos windowed sinc
+} gs_audio_resample_quality;
+
+typedef struct gs_audio_mixer_t
+{
+    float* bus;                         // Stereo float accumulation bus, saturated to s16 once per chunk
+    float* scratch;                     // Resampled output of a single voice
+    float* sinc_table;                  // GS_AUDIO_SINC_PHASES x GS_AUDIO_SINC_TAPS coefficients
+    volatile uint32_t quality;          // gs_audio_resample_quality, read once per mix
+} gs_audio_mixer_t;
+
 /*=============================
 // Audio Interface
 =============================*/
@@ -6209,6 +7381,32 @@ typedef struct gs_audio_t
     // Custom user commit function
     gs_audio_commit commit;
 
+    // Game -> audio thread commands, with game thread overflow for when the ring is full
+    gs_audio_queue_t commands;
+    gs_dyn_array(gs_audio_command_t) command_overflow;
+
+    // Audio -> game thread notifications for instances stopped/released during mixing
+    gs_audio_queue_t events;
+
+    // Audio thread owned voices (indexed by instance id) and dense list of active voice ids
+    gs_audio_voice_t* voices;
+    uint32_t* active_voices;
+    uint32_t active_voice_count;
+    uint32_t* pending_events;
+    uint32_t pending_event_count;
+
+    // Game thread sequence and SET_DATA generation per instance id
+    uint32_t* seq;
+    uint32_t* generation;
+
+    // Float mixing bus and resampler state (audio thread)
+    gs_audio_mixer_t mixer;
+
+    // Streams created by game thread (guarded by gs_audio_mutex_lock), picked up into decode thread's list
+    gs_dyn_array(gs_audio_stream_t*) stream_pending;
+    gs_dyn_array(gs_audio_stream_t*) streams;
+    bool32_t stream_thread;             // Backend decodes streams on its own thread, otherwise done in gs_audio_update
+
     // User data for custom impl
     void* user_data;
 } gs_audio_t;
@@ -6226,13 +7424,23 @@ GS_API_DECL gs_result   gs_audio_shutdown(gs_audio_t* audio);
 // Register commit function
 GS_API_DECL void gs_audio_register_commit(gs_audio_commit commit);
 
+/* Mix all playing instances into interleaved stereo s16 output at sample_rate. Called from device callback, or headless. */
+GS_API_DECL void gs_audio_mix(gs_audio_t* audio, int16_t* output, uint32_t sample_rate, uint32_t frame_count);
+/* Game thread, once per frame. Applies audio thread notifications and decodes streams if the backend has no decode thread.
+   gs_frame calls it for the default backend only, GS_AUDIO_IMPL_CUSTOM backends don't need to define it. */
+GS_API_DECL void gs_audio_update(gs_audio_t* audio);
+GS_API_DECL void gs_audio_set_resample_quality(gs_audio_resample_quality quality);
+
 /* Audio create source */
 GS_API_DECL gs_handle(gs_audio_source_t) gs_audio_load_from_file(const char* file_path);
+GS_API_DECL bool32_t gs_audio_decode_from_file(const char* file_path, gs_audio_source_t* src);   // Decode only, safe to call from worker threads
+GS_API_DECL gs_handle(gs_audio_source_t) gs_audio_source_create(const gs_audio_source_t* src);  // Takes ownership of decoded samples
+GS_API_DECL gs_handle(gs_audio_source_t) gs_audio_load_stream_from_file(const char* file_path);   // Decoded incrementally while playing, archive entries need their archive mounted until the stream is freed
 
 /* Audio create instance */
 GS_API_DECL gs_handle(gs_audio_instance_t) gs_audio_instance_create(gs_audio_instance_decl_t* decl);
 
-/* Locking audio thread (optional) */
+/* Locking audio thread (optional, for user commit data. Mixer itself is lock-free and fed via command queue) */
 GS_API_DECL void gs_audio_mutex_lock(gs_audio_t* audio);
 GS_API_DECL void gs_audio_mutex_unlock(gs_audio_t* audio);
 
@@ -6250,6 +7458,8 @@ GS_API_DECL void                     gs_audio_set_instance_data(gs_handle(gs_aud
 GS_API_DECL gs_audio_instance_decl_t gs_audio_get_instance_data(gs_handle(gs_audio_instance_t) inst);
 GS_API_DECL float                    gs_audio_get_volume(gs_handle(gs_audio_instance_t) inst);
 GS_API_DECL void                     gs_audio_set_volume(gs_handle(gs_audio_instance_t) inst, float volume);
+GS_API_DECL float                    gs_audio_get_pitch(gs_handle(gs_audio_instance_t) inst);
+GS_API_DECL void                     gs_audio_set_pitch(gs_handle(gs_audio_instance_t) inst, float pitch);
 
 /* Audio source data */
 GS_API_DECL gs_audio_source_t* gs_audio_get_source_data(gs_handle(gs_audio_source_t) src);
@@ -6278,6 +7488,7 @@ GS_API_DECL bool32_t gs_audio_load_mp3_data_from_file(const char* file_path, int
     #define gsa_submit   gs_audio_submit
     /* Source */
     #define gsa_load     gs_audio_load_from_file            
+    #define gsa_load_stream gs_audio_load_stream_from_file
     /* Instance */
     #define gsa_make_inst gs_audio_instance_create
 
@@ -6423,7 +7634,11 @@ gs_enum_decl(gs_graphics_vertex_attribute_type,
     GS_GRAPHICS_VERTEX_ATTRIBUTE_BYTE4,
     GS_GRAPHICS_VERTEX_ATTRIBUTE_BYTE3,
     GS_GRAPHICS_VERTEX_ATTRIBUTE_BYTE2,
-    GS_GRAPHICS_VERTEX_ATTRIBUTE_BYTE
+    GS_GRAPHICS_VERTEX_ATTRIBUTE_BYTE,
+    GS_GRAPHICS_VERTEX_ATTRIBUTE_HALF4,     // 16-bit floats
+    GS_GRAPHICS_VERTEX_ATTRIBUTE_HALF2,
+    GS_GRAPHICS_VERTEX_ATTRIBUTE_SHORT2N,   // Signed normalized 16-bit, [-1, 1]
+    GS_GRAPHICS_VERTEX_ATTRIBUTE_USHORT2N   // Unsigned normalized 16-bit, [0, 1]
 );
 
 /* Buffer Type */
@@ -6599,6 +7814,9 @@ typedef struct gs_graphics_shader_desc_t
     gs_graphics_shader_source_desc_t* sources;  // Array of shader source descriptions
     size_t size;                    // Size in bytes of shader source desc array
     char name[64];               // Optional (for logging and debugging mainly)
+    const void* binary;             // Optional linked program from gs_graphics_shader_get_binary, sources are compiled if it's rejected
+    size_t binary_size;             // Size in bytes of binary
+    uint32_t binary_format;         // Format returned with binary
 } gs_graphics_shader_desc_t;
 
 #define GS_GRAPHICS_TEXTURE_DATA_MAX  6
@@ -6912,6 +8130,7 @@ typedef struct gs_graphics_info_t
     uint32_t minor_version;
     uint32_t max_texture_units;
     uint32_t max_ssbo_block_size;
+    bool32 program_binary;          // Linked shaders can be retrieved and recreated from binaries
     struct {
         bool32 available;
         uint32_t max_work_group_count[3];
@@ -6920,6 +8139,29 @@ typedef struct gs_graphics_info_t
     } compute;
 } gs_graphics_info_t;
 
+/* Per-frame command stream statistics (reset each frame, collected by backends that support it) */
+typedef struct gs_graphics_stats_t
+{
+    uint32_t commands;              // Total ops submitted
+    uint32_t draws;                 // Draw calls
+    uint32_t dispatches;            // Compute dispatches
+    uint32_t renderpasses;          // Render passes begun
+    uint32_t pipeline_binds;        // Pipeline binds
+    uint32_t bindings;              // Individual bindings applied (buffers, uniforms, images)
+    uint32_t vertices;              // Vertices/indices submitted through draws (count * instances)
+    size_t uniform_bytes;           // Uniform data applied through bindings
+    size_t upload_bytes;            // Buffer and texture data uploaded through update requests
+    struct {
+        uint32_t pipelines;         // Pipeline already bound
+        uint32_t buffers;           // Vertex/index buffer already bound
+        uint32_t uniforms;          // Uniform data identical to what is already set
+        uint32_t viewports;         // Viewport/scissor rect already set
+    } redundant;                    // State changes that could have been filtered
+    uint32_t calls_saved;           // Api calls skipped by redundant state filtering
+    uint32_t sorted_packets;        // Keyed packets reordered by sort key
+    uint32_t errors;                // Invalid handles and out of range draws
+} gs_graphics_stats_t;
+
 /*==========================
 // Graphics Interface
 ==========================*/
@@ -6928,6 +8170,7 @@ typedef struct gs_graphics_t
 {
     void* user_data;                // For internal use
     gs_graphics_info_t info;        // Used for querying by user for features 
+    gs_graphics_stats_t stats;      // Per-frame command stream statistics 
     struct { 
 
         // Create
@@ -6966,6 +8209,7 @@ typedef struct gs_graphics_t
         void* (* storage_buffer_lock)(gs_handle(gs_graphics_storage_buffer_t) hndl, size_t offset, size_t sz);
         void  (* storage_buffer_unlock)(gs_handle(gs_graphics_storage_buffer_t) hndl); 
         void  (* storage_buffer_get_data)(gs_handle(gs_graphics_storage_buffer_t) hndl, size_t offset, size_t stride, void* out);
+        size_t (* shader_get_binary)(gs_handle(gs_graphics_shader_t) hndl, void* out, size_t sz, uint32_t* format);
 
         // Submission (Main Thread)
         void (* command_buffer_submit)(gs_command_buffer_t* cb);
@@ -6988,6 +8232,9 @@ GS_API_DECL void           gs_graphics_shutdown(gs_graphics_t* graphics);
 // Graphics Info Object Query
 GS_API_DECL                gs_graphics_info_t* gs_graphics_info();
 
+// Graphics Stats Object Query
+GS_API_DECL                gs_graphics_stats_t* gs_graphics_stats();
+
 // Resource Creation 
 // Create
 GS_API_DECL gs_handle(gs_graphics_texture_t)        gs_graphics_texture_create(const gs_graphics_texture_desc_t* desc);
@@ -7030,6 +8277,7 @@ GS_API_DECL void* gs_graphics_storage_buffer_map_get(gs_handle(gs_graphics_stora
 GS_API_DECL void* gs_graphics_storage_buffer_lock(gs_handle(gs_graphics_storage_buffer_t) hndl, size_t offset, size_t sz);
 GS_API_DECL void  gs_graphics_storage_buffer_unlock(gs_handle(gs_graphics_storage_buffer_t) hndl); 
 GS_API_DECL void  gs_graphics_storage_buffer_get_data(gs_handle(gs_graphics_storage_buffer_t) hndl, size_t offset, size_t stride, void* out);
+GS_API_DECL size_t gs_graphics_shader_get_binary(gs_handle(gs_graphics_shader_t) hndl, void* out, size_t sz, uint32_t* format);  // Returns binary size (0 if unsupported), copies it when out holds sz >= size
 
 // Resource In-Flight Update
 GS_API_DECL void gs_graphics_texture_request_update(gs_command_buffer_t* cb, gs_handle(gs_graphics_texture_t) hndl, gs_graphics_texture_desc_t* desc);
@@ -7049,6 +8297,24 @@ GS_API_DECL void gs_graphics_apply_bindings(gs_command_buffer_t* cb, gs_graphics
 GS_API_DECL void gs_graphics_draw(gs_command_buffer_t* cb, gs_graphics_draw_desc_t* desc);
 GS_API_DECL void gs_graphics_dispatch_compute(gs_command_buffer_t* cb, uint32_t num_x_groups, uint32_t num_y_groups, uint32_t num_z_groups);
 
+/*
+    Draw Sorting (opt-in): 
+
+    A sort key starts a packet: every op recorded after it, up to the next key or the end of the render pass, 
+    is moved as a unit. On submit, keyed packets within a pass are radix sorted by key (stable) and replayed after 
+    any unkeyed ops recorded at the start of the pass. Packets must therefore be self-contained (bind pipeline, 
+    apply bindings, draw). Sorting by pipeline then material lets redundant state filtering drop most binds.
+*/
+GS_API_DECL void gs_graphics_sort_key(gs_command_buffer_t* cb, uint64_t key);
+
+// Default key layout: pipeline (16 bits) | material (24 bits) | depth in [0, 1] (24 bits)
+gs_inline uint64_t 
+gs_graphics_sort_key_make(uint32_t pipeline, uint32_t material, float depth)
+{
+    depth = depth < 0.f ? 0.f : depth > 1.f ? 1.f : depth;
+    return ((uint64_t)(pipeline & 0xFFFF) << 48) | ((uint64_t)(material & 0xFFFFFF) << 24) | (uint64_t)(depth * (float)0xFFFFFF);
+}
+
 // Submission (Main Thread)
 #define gs_graphics_command_buffer_submit(CB)  gs_graphics()->api.command_buffer_submit((CB))
 
@@ -7096,11 +8362,27 @@ typedef struct gs_baked_char_t
 	uint32_t width, height;
 } gs_baked_char_t;
 
+/*
+    Glyph atlas:
+        ASCII 32..127 is baked at load into glyphs[]. Every other codepoint is rasterized into the same 
+        texture the first time it's looked up (gs_asset_font_glyph), shelf packed below the baked glyphs
+        and found again through a codepoint hash table. Rasterized rows are uploaded as one sub-rectangle
+        on gs_asset_font_atlas_flush (main thread, gsi_text flushes for you).
+
+        When full, the atlas doubles in height up to GS_ASSET_FONT_ATLAS_MAX_HEIGHT, then drops every 
+        rasterized (non ASCII) glyph and starts over. Both change glyph texture coordinates and bump 
+        gs_asset_font_atlas_version, so geometry built from earlier lookups must be rebuilt.
+*/
+
+#ifndef GS_ASSET_FONT_ATLAS_MAX_HEIGHT
+    #define GS_ASSET_FONT_ATLAS_MAX_HEIGHT 4096
+#endif
+
 typedef struct gs_asset_font_t
 {
-    void* font_info;
-    gs_baked_char_t glyphs[96];
-    gs_asset_texture_t texture;
+    void* font_info;                // Glyph atlas state, NULL if the font can't rasterize glyphs on demand
+    gs_baked_char_t glyphs[96];     // ASCII 32..127
+    gs_asset_texture_t texture;     // desc keeps the baked size, the glyph atlas may grow past it
 	float ascent;
 	float descent;
 	float line_gap;
@@ -7108,6 +8390,13 @@ typedef struct gs_asset_font_t
 
 GS_API_DECL bool gs_asset_font_load_from_file(const char* path, void* out, uint32_t point_size);
 GS_API_DECL bool gs_asset_font_load_from_memory(const void* memory, size_t sz, void* out, uint32_t point_size);
+GS_API_DECL bool gs_asset_font_bake_from_memory(const void* memory, size_t sz, void* out, uint32_t point_size);   // Glyphs + RGBA bitmap in texture.desc (no texture created, caller frees data)
+GS_API_DECL void gs_asset_font_free(gs_asset_font_t* font);                                                       // Releases glyph atlas and texture
+GS_API_DECL void gs_asset_font_atlas_free(gs_asset_font_t* font);                                                 // Releases glyph atlas only, no graphics calls (fonts baked but never uploaded)
+GS_API_DECL bool gs_asset_font_glyph(const gs_asset_font_t* font, uint32_t codepoint, gs_baked_char_t* out);     // False if the font has no glyph for codepoint
+GS_API_DECL void gs_asset_font_glyph_quad(const gs_asset_font_t* font, const gs_baked_char_t* glyph, float* x, float* y, gs_vec4* pos, gs_vec4* uv);  // Screen rect (x0, y0, x1, y1) and texture coordinates of glyph at pen position, advances pen
+GS_API_DECL void gs_asset_font_atlas_flush(const gs_asset_font_t* font);                                         // Uploads glyphs rasterized since the last flush
+GS_API_DECL uint32_t gs_asset_font_atlas_version(const gs_asset_font_t* font);                                   // Changes whenever existing glyph texture coordinates do
 GS_API_DECL gs_vec2 gs_asset_font_text_dimensions(const gs_asset_font_t* font, const char* text, int32_t len);
 GS_API_DECL gs_vec2 gs_asset_font_text_dimensions_ex(const gs_asset_font_t* fp, const char* text, int32_t len, bool32_t include_past_baseline);
 GS_API_DECL float gs_asset_font_max_height(const gs_asset_font_t* font);
@@ -7215,7 +8504,10 @@ typedef struct gs_app_desc_t
     void (* init)();
     void (* update)();
     void (* shutdown)();
+    void (* fixed_update)();    // Optional, called at fixed_rate before update, see gs_platform_time_t.alpha
+    float fixed_rate;           // Fixed updates per second, defaults to 60
     gs_platform_window_desc_t window;
+    gs_jobs_desc_t jobs;
     bool32 is_running;
     bool32 debug_gfx;
     void* user_data;
@@ -7244,6 +8536,7 @@ typedef struct gs_context_t
     gs_platform_t* platform;
     gs_graphics_t* graphics;
     gs_audio_t* audio;
+    gs_jobs_t* jobs;
     gs_app_desc_t app; 
     gs_os_api_t os;
     gs_atomic_int_t lock;
@@ -7337,7 +8630,7 @@ gs_main(int32_t argc, char** argv);
 // GS_GRAPHICS
 =============================*/
 
-#ifndef GS_GRAPHICS_IMPL_CUSTOM
+#if (!defined GS_GRAPHICS_IMPL_CUSTOM && !defined GS_GRAPHICS_IMPL_NULL)
 
 #if (defined GS_PLATFORM_WIN || defined GS_PLATFORM_APPLE || defined GS_PLATFORM_LINUX)
 
@@ -7530,6 +8823,13 @@ gs_graphics_storage_buffer_get_data(gs_handle(gs_graphics_storage_buffer_t) hndl
     return gs_graphics()->api.storage_buffer_get_data(hndl, offset, sz, out);
 }
 
+GS_API_DECL size_t
+gs_graphics_shader_get_binary(gs_handle(gs_graphics_shader_t) hndl, void* out, size_t sz, uint32_t* format)
+{
+    if (!gs_graphics()->api.shader_get_binary) return 0;
+    return gs_graphics()->api.shader_get_binary(hndl, out, sz, format);
+}
+
 /*=============================
 // GS_AUDIO
 =============================*/
@@ -7830,6 +9130,57 @@ __gs_hash_table_init_impl(void** ht, size_t sz)
     *ht = gs_malloc(sz);
 }
 
+GS_API_DECL void
+__gs_hash_table_ctrl_rehash(void** data, uint8_t** ctrl, uint32_t* tombstones, size_t stride, size_t klpvl, uint32_t new_cap)
+{
+    gs_assert(new_cap && (new_cap & (new_cap - 1)) == 0);
+
+    uint32_t capacity = gs_dyn_array_capacity(*data);
+    uint32_t size = gs_dyn_array_size(*data);
+    uint32_t mask = new_cap - 1;
+
+    void* nd = gs_dyn_array_resize_impl(NULL, stride, 0);
+    nd = gs_dyn_array_resize_impl(nd, stride, new_cap);
+    uint8_t* nc = (uint8_t*)gs_malloc(new_cap);
+    memset(nc, GS_HASH_TABLE_CTRL_EMPTY, new_cap);
+    for (uint32_t i = 0; i < new_cap; ++i) {
+        *(gs_hash_table_entry_state*)((char*)nd + i * stride + klpvl) = GS_HASH_TABLE_ENTRY_INACTIVE;
+    }
+
+    // Reinsert live entries using their stored hashes (no key rehashing)
+    if (*ctrl) {
+        for (uint32_t i = 0; i < capacity; ++i) {
+            if ((*ctrl)[i] & 0x80) continue;
+            char* src = (char*)(*data) + i * stride;
+            size_t hash = *(size_t*)(src + klpvl - sizeof(size_t));
+            uint32_t j = (uint32_t)(hash & mask);
+            while (nc[j] != GS_HASH_TABLE_CTRL_EMPTY) j = (j + 1) & mask;
+            memcpy((char*)nd + j * stride, src, stride);
+            nc[j] = (*ctrl)[i];
+        }
+        gs_free(*ctrl);
+    }
+    else {
+        gs_assert(size == 0);
+    }
+
+    gs_dyn_array_head(nd)->size = size;
+    if (*data) gs_free(gs_dyn_array_head(*data));
+    *data = nd;
+    *ctrl = nc;
+    *tombstones = 0;
+}
+
+GS_API_DECL void
+__gs_hash_table_ctrl_reserve(void** data, uint8_t** ctrl, uint32_t* tombstones, size_t stride, size_t klpvl, uint32_t count)
+{
+    uint32_t cap = GS_HASH_TABLE_CTRL_MIN_CAPACITY;
+    while ((float)count >= (float)cap * GS_HASH_TABLE_CTRL_MAX_LOAD_FACTOR) cap <<= 1;
+    if (cap > (uint32_t)gs_dyn_array_capacity(*data)) {
+        __gs_hash_table_ctrl_rehash(data, ctrl, tombstones, stride, klpvl, cap);
+    }
+}
+
 /*========================
 // Hash Set
 ========================*/
@@ -7857,6 +9208,95 @@ gs_slot_array_init(void** sa, size_t sz)
     }
 }
 
+/*========================
+// Slot Pool
+========================*/
+
+GS_API_DECL void** 
+gs_slot_pool_init(void** sp, size_t sz)
+{
+    if (*sp == NULL) {
+        *sp = gs_malloc(sz);
+        memset(*sp, 0, sz);
+        ((__gs_slot_pool_dummy_header*)*sp)->free_head = GS_SLOT_POOL_FREE_LIST_END;
+        return sp;
+    }
+    return NULL;
+}
+
+GS_API_DECL gs_slot_pool_handle 
+gs_slot_pool_insert_func(void* sp, void* val, size_t val_len)
+{
+    __gs_slot_pool_dummy_header* h = (__gs_slot_pool_dummy_header*)sp;
+    uint32_t di = (uint32_t)gs_dyn_array_size(h->data);
+
+    // Pop free slot, otherwise append new one (generations start at 1 so handle 0 is never valid)
+    uint32_t slot = h->free_head;
+    if (slot != GS_SLOT_POOL_FREE_LIST_END) {
+        h->free_head = h->indices[slot];
+        h->indices[slot] = di;
+    }
+    else {
+        uint32_t gen = 1;
+        slot = (uint32_t)gs_dyn_array_size(h->indices);
+        gs_dyn_array_push(h->indices, di);
+        gs_dyn_array_push(h->gens, gen);
+    }
+
+    gs_dyn_array_push_data(&h->data, val, val_len);
+    gs_dyn_array_push(h->slots, slot);
+
+    return gs_slot_pool_handle_make(slot, h->gens[slot]);
+}
+
+GS_API_DECL bool 
+gs_slot_pool_erase_func(void* sp, gs_slot_pool_handle hndl, size_t val_len)
+{
+    __gs_slot_pool_dummy_header* h = (__gs_slot_pool_dummy_header*)sp;
+    uint32_t slot = gs_slot_pool_handle_index(hndl);
+    if (slot >= (uint32_t)gs_dyn_array_size(h->gens) || h->gens[slot] != gs_slot_pool_handle_gen(hndl)) {
+        return false;
+    }
+
+    // Swap and pop, fixing up the moved element's slot through the back-pointer
+    uint32_t di = h->indices[slot];
+    uint32_t last = (uint32_t)gs_dyn_array_size(h->data) - 1;
+    if (di != last) {
+        memcpy((uint8_t*)h->data + di * val_len, (uint8_t*)h->data + last * val_len, val_len);
+        h->slots[di] = h->slots[last];
+        h->indices[h->slots[di]] = di;
+    }
+    gs_dyn_array_head(h->data)->size--;
+    gs_dyn_array_head(h->slots)->size--;
+
+    // Invalidate outstanding handles and push slot onto free list (skip 0 on wrap)
+    if (++h->gens[slot] == 0) h->gens[slot] = 1;
+    h->indices[slot] = h->free_head;
+    h->free_head = slot;
+
+    return true;
+}
+
+GS_API_DECL void 
+gs_slot_pool_clear_func(void* sp)
+{
+    __gs_slot_pool_dummy_header* h = (__gs_slot_pool_dummy_header*)sp;
+
+    // Bump generations of live slots, then rebuild free list over all slots (lowest index first)
+    for (uint32_t i = 0; i < (uint32_t)gs_dyn_array_size(h->slots); ++i) {
+        uint32_t slot = h->slots[i];
+        if (++h->gens[slot] == 0) h->gens[slot] = 1;
+    }
+    uint32_t ct = (uint32_t)gs_dyn_array_size(h->indices);
+    for (uint32_t i = 0; i < ct; ++i) {
+        h->indices[i] = i + 1 < ct ? i + 1 : GS_SLOT_POOL_FREE_LIST_END;
+    }
+    h->free_head = ct ? 0 : GS_SLOT_POOL_FREE_LIST_END;
+
+    gs_dyn_array_clear(h->data);
+    gs_dyn_array_clear(h->slots);
+}
+
 /*========================
 // Slot Map
 ========================*/
@@ -8448,6 +9888,8 @@ gs_rand_gen_color(gs_mt_rand_t* rand)
     #pragma intrinsic(_ReadWriteBarrier)
     #pragma intrinsic(_InterlockedCompareExchange)
     #pragma intrinsic(_InterlockedExchangeAdd)
+    #pragma intrinsic(_InterlockedExchange)
+    #pragma intrinsic(_InterlockedOr)
 #endif
 
 GS_API_DECL uint32_t
@@ -8466,14 +9908,214 @@ gs_atomic_cmp_swp(volatile uint32_t *dst, uint32_t swap, uint32_t cmp)
 GS_API_DECL gs_atomic_int_t
 gs_atomic_add(volatile gs_atomic_int_t *dst, int32_t value)
 {
-/* Atomically performs: tmp = *dst: *dst += value; return tmp; */
+/* Atomically performs: *dst += value; return *dst; */
 #if defined(_WIN32) && !(defined(__MINGW32__) || defined(__MINGW64__))
-    return _InterlockedExchangeAdd((long*)dst, value);
+    return _InterlockedExchangeAdd((long*)dst, value) + value;
 #else
     return (sched_int)__sync_add_and_fetch(dst, value);
 #endif
 }
 
+GS_API_DECL uint32_t
+gs_atomic_load(volatile uint32_t* src)
+{
+#if defined(_WIN32) && !(defined(__MINGW32__) || defined(__MINGW64__))
+    return (uint32_t)_InterlockedOr((volatile long*)src, 0);
+#else
+    return __atomic_load_n(src, __ATOMIC_ACQUIRE);
+#endif
+}
+
+GS_API_DECL void
+gs_atomic_store(volatile uint32_t* dst, uint32_t value)
+{
+#if defined(_WIN32) && !(defined(__MINGW32__) || defined(__MINGW64__))
+    _InterlockedExchange((volatile long*)dst, (long)value);
+#else
+    __atomic_store_n(dst, value, __ATOMIC_RELEASE);
+#endif
+}
+
+/*================================================================================
+// Jobs
+================================================================================*/
+
+GS_API_DECL gs_jobs_t*
+gs_jobs_create(const gs_jobs_desc_t* desc)
+{
+    gs_jobs_desc_t def = gs_default_val();
+    if (!desc) desc = &def;
+
+    gs_jobs_t* jobs = (gs_jobs_t*)gs_malloc(sizeof(gs_jobs_t));
+    memset(jobs, 0, sizeof(gs_jobs_t));
+
+    sched_size mem_size = 0;
+    gs_scheduler_init(&jobs->sched, &mem_size, desc->thread_count ? (sched_int)desc->thread_count : GS_SCHED_DEFAULT, NULL);
+    jobs->thread_count = jobs->sched.threads_num;
+
+    // Arenas are allocated in one block, each thread on its own cache lines
+    size_t scratch_size = desc->scratch_size ? desc->scratch_size : GS_JOBS_SCRATCH_SIZE_DEFAULT;
+    scratch_size = (scratch_size + 63) & ~(size_t)63;
+    jobs->scratch = (gs_jobs_scratch_t*)gs_malloc(sizeof(gs_jobs_scratch_t) * jobs->thread_count + scratch_size * jobs->thread_count + 64);
+    uint8_t* base = (uint8_t*)(((uintptr_t)(jobs->scratch + jobs->thread_count) + 63) & ~(uintptr_t)63);
+    for (uint32_t i = 0; i < jobs->thread_count; ++i) {
+        jobs->scratch[i].data = base + scratch_size * i;
+        jobs->scratch[i].capacity = scratch_size;
+        jobs->scratch[i].offset = 0;
+    }
+
+    jobs->sched_memory = gs_malloc(mem_size);
+    gs_scheduler_start(&jobs->sched, jobs->sched_memory);
+    return jobs;
+}
+
+GS_API_DECL void
+gs_jobs_destroy(gs_jobs_t* jobs)
+{
+    if (!jobs) return;
+    gs_scheduler_stop(&jobs->sched, 1);
+    gs_free(jobs->sched_memory);
+    gs_free(jobs->scratch);
+    gs_free(jobs);
+}
+
+GS_API_DECL void
+gs_job_init(gs_job_t* job, gs_job_func_t func, void* user_data, uint32_t count, uint32_t grain)
+{
+    memset(job, 0, sizeof(gs_job_t));
+    job->func = func;
+    job->user_data = user_data;
+    job->count = count;
+    job->grain = grain ? grain : 1;
+    job->remaining = (gs_atomic_int_t)count + 1;
+    job->dependencies = 1;
+}
+
+GS_API_DECL void
+gs_jobs_depend(gs_job_t* job, gs_job_t* dependency)
+{
+    gs_assert(dependency->continuation_count < GS_JOBS_MAX_CONTINUATIONS);
+    gs_assert(job->depends_on_count < GS_JOBS_MAX_DEPENDENCIES);
+    dependency->continuations[dependency->continuation_count++] = job;
+    job->depends_on[job->depends_on_count++] = dependency;
+    gs_atomic_add(&job->dependencies, 1);
+}
+
+GS_API_PRIVATE void _gs_jobs_kick(gs_job_t* job);
+
+// Called once by whichever thread finishes the last items of a job
+GS_API_PRIVATE void
+_gs_jobs_finish(gs_job_t* job)
+{
+    gs_jobs_t* jobs = job->jobs;    // Job may be reused by its waiter once remaining hits zero
+    for (uint32_t i = 0; i < job->continuation_count; ++i) {
+        gs_job_t* next = job->continuations[i];
+        if (gs_atomic_add(&next->dependencies, -1) == 0) {
+            _gs_jobs_kick(next);
+        }
+    }
+
+    // Release waiters only after continuations no longer need this job
+    gs_atomic_add(&job->remaining, -1);
+    gs_atomic_add(&jobs->pending, -1);
+}
+
+GS_API_PRIVATE void
+_gs_jobs_exec(void* data, gs_scheduler_t* sched, gs_sched_task_partition_t p, sched_uint thread)
+{
+    gs_job_t* job = (gs_job_t*)data;
+    job->func(job->user_data, p.start, p.end, thread);
+    if (gs_atomic_add(&job->remaining, -(gs_atomic_int_t)(p.end - p.start)) == 1) {
+        _gs_jobs_finish(job);
+    }
+}
+
+GS_API_PRIVATE void
+_gs_jobs_kick(gs_job_t* job)
+{
+    if (job->count) gs_scheduler_add(&job->jobs->sched, &job->task, _gs_jobs_exec, job, job->count, job->grain);
+    else            _gs_jobs_finish(job);
+}
+
+GS_API_DECL void
+gs_jobs_submit(gs_jobs_t* jobs, gs_job_t* job)
+{
+    job->jobs = jobs;
+    gs_atomic_add(&jobs->pending, 1);
+    if (gs_atomic_add(&job->dependencies, -1) == 0) {
+        _gs_jobs_kick(job);
+    }
+}
+
+GS_API_DECL bool32_t
+gs_jobs_done(const gs_job_t* job)
+{
+    return gs_atomic_load((volatile uint32_t*)&job->remaining) == 0 && gs_sched_task_done(&job->task);
+}
+
+GS_API_DECL uint32_t
+gs_jobs_pending(gs_jobs_t* jobs)
+{
+    return gs_atomic_load((volatile uint32_t*)&jobs->pending);
+}
+
+// The scheduler still touches a task briefly after its last partition has run, so a finished
+// job (and every job it depended on) is only safe to reuse once its task has been joined
+GS_API_PRIVATE void
+_gs_jobs_release(gs_jobs_t* jobs, gs_job_t* job)
+{
+    gs_scheduler_join(&jobs->sched, &job->task);
+    for (uint32_t i = 0; i < job->depends_on_count; ++i) {
+        _gs_jobs_release(jobs, job->depends_on[i]);
+    }
+    job->depends_on_count = 0;  // Ancestors released, skip when reached again through another path
+}
+
+GS_API_DECL void
+gs_jobs_wait(gs_jobs_t* jobs, gs_job_t* job)
+{
+    // Run other work until the job finishes
+    while (gs_atomic_load((volatile uint32_t*)&job->remaining)) {
+        gs_scheduler_join(&jobs->sched, NULL);
+    }
+    _gs_jobs_release(jobs, job);
+}
+
+GS_API_DECL void
+gs_jobs_parallel_for(gs_jobs_t* jobs, gs_job_func_t func, void* user_data, uint32_t count, uint32_t grain)
+{
+    if (!count) return;
+
+    // Nothing to split, run inline
+    if (jobs->thread_count <= 1 || count <= grain) {
+        func(user_data, 0, count, gtl_thread_num);
+        return;
+    }
+
+    gs_job_t job = gs_default_val();
+    gs_job_init(&job, func, user_data, count, grain);
+    gs_jobs_submit(jobs, &job);
+    gs_jobs_wait(jobs, &job);
+}
+
+GS_API_DECL void*
+gs_jobs_scratch_alloc(gs_jobs_t* jobs, uint32_t thread, size_t sz)
+{
+    gs_jobs_scratch_t* s = &jobs->scratch[thread];
+    size_t off = (s->offset + 15) & ~(size_t)15;
+    if (off + sz > s->capacity) return NULL;
+    s->offset = off + sz;
+    return s->data + off;
+}
+
+GS_API_DECL void
+gs_jobs_scratch_reset(gs_jobs_t* jobs)
+{
+    for (uint32_t i = 0; i < jobs->thread_count; ++i) {
+        jobs->scratch[i].offset = 0;
+    }
+}
+
 
 /*================================================================================
 // Noise
@@ -8800,16 +10442,32 @@ bool32_t gs_util_load_texture_data_from_file(const char* file_path, int32_t* wid
     return ret;
 }
 
+// Flips rows in place. Used instead of stbi_set_flip_vertically_on_load(), which is global state and would race with decodes on worker threads.
+GS_API_PRIVATE void 
+__gs_util_texture_data_flip_y(uint8_t* data, uint32_t width, uint32_t height, uint32_t bytes_per_pixel)
+{
+    size_t stride = (size_t)width * bytes_per_pixel;
+    for (uint32_t y = 0; y < height / 2; ++y) {
+        uint8_t* a = data + stride * y;
+        uint8_t* b = data + stride * (height - 1 - y);
+        for (size_t i = 0; i < stride; ++i) {
+            uint8_t t = a[i]; a[i] = b[i]; b[i] = t;
+        }
+    }
+}
+
 GS_API_DECL bool32_t 
 gs_util_load_texture_data_from_memory(const void* memory, size_t sz, int32_t* width, int32_t* height, uint32_t* num_comps, void** data, bool32_t flip_vertically_on_load)
 {
     // Load texture data
-    stbi_set_flip_vertically_on_load(flip_vertically_on_load);
     *data =  stbi_load_from_memory((const stbi_uc*)memory, (int32_t)sz, (int32_t*)width, (int32_t*)height, (int32_t*)num_comps, STBI_rgb_alpha);
     if (!*data) {
         gs_free(*data);
         return false;
     }
+    if (flip_vertically_on_load) {
+        __gs_util_texture_data_flip_y((uint8_t*)*data, *width, *height, 4);
+    }
     return true;
 }
 
@@ -8835,18 +10493,19 @@ gs_asset_texture_load_from_file(const char* path, void* out, gs_graphics_texture
         t->desc.wrap_t = GS_GRAPHICS_TEXTURE_WRAP_REPEAT;
     }
 
-    // Load texture data
-    FILE* f = fopen(path, "rb");
-    if (!f) {
+    // Load texture data (goes through gs_platform_read_file_contents so mounted archives are checked first)
+    size_t len = 0;
+    char* file_data = gs_platform_read_file_contents(path, "rb", &len);
+    if (!file_data) {
         return false;
     }
 
-    int32_t comp = 0;
-    stbi_set_flip_vertically_on_load(t->desc.flip_y);
-    *t->desc.data = (uint8_t*)stbi_load_from_file(f, (int32_t*)&t->desc.width, (int32_t*)&t->desc.height, (int32_t*)&comp, STBI_rgb_alpha);
+    uint32_t comp = 0;
+    bool32_t loaded = gs_util_load_texture_data_from_memory(file_data, len, (int32_t*)&t->desc.width, 
+        (int32_t*)&t->desc.height, &comp, t->desc.data, t->desc.flip_y);
+    gs_free(file_data);
 
-    if (!*t->desc.data) {
-        fclose(f);
+    if (!loaded) {
         return false;
     }
 
@@ -8857,7 +10516,6 @@ gs_asset_texture_load_from_file(const char* path, void* out, gs_graphics_texture
         *t->desc.data = NULL;
     }
 
-    fclose(f);
     return true;
 }
 
@@ -8927,6 +10585,42 @@ bool gs_asset_font_load_from_file(const char* path, void* out, uint32_t point_si
 }
 
 bool gs_asset_font_load_from_memory(const void* memory, size_t sz, void* out, uint32_t point_size)
+{ 
+    gs_asset_font_t* f = (gs_asset_font_t*)out;
+    bool success = gs_asset_font_bake_from_memory(memory, sz, out, point_size);
+
+    // Generate atlas texture for bitmap with bitmap data
+    void* bitmap = *f->texture.desc.data;
+    f->texture.hndl = gs_graphics_texture_create(&f->texture.desc);
+    *f->texture.desc.data = NULL;
+    gs_free(bitmap);
+
+    return success;
+}
+
+// Glyph atlas state behind gs_asset_font_t.font_info
+typedef struct gs_asset_font_shelf_t
+{
+    uint32_t x, y, h;
+} gs_asset_font_shelf_t;
+
+typedef struct gs_asset_font_atlas_t
+{
+    stbtt_fontinfo info;
+    uint8_t* ttf;                                       // Font file, referenced by info
+    float scale;                                        // Font units to pixels for the point size
+    uint8_t* alpha;                                     // Coverage, width x height
+    uint32_t width;
+    uint32_t height;
+    uint32_t base_y;                                    // First row below the baked ASCII glyphs
+    gs_dyn_array(gs_asset_font_shelf_t) shelves;
+    gs_hash_table(uint32_t, gs_baked_char_t) glyphs;    // Codepoint -> glyph for everything outside glyphs[]
+    uint32_t dirty_y0, dirty_y1;                        // Rows changed since last flush
+    bool resized;                                       // Texture has to be reallocated on next flush
+    uint32_t version;
+} gs_asset_font_atlas_t;
+
+bool gs_asset_font_bake_from_memory(const void* memory, size_t sz, void* out, uint32_t point_size)
 { 
     gs_asset_font_t* f = (gs_asset_font_t*)out;
 
@@ -8945,7 +10639,20 @@ bool gs_asset_font_load_from_memory(const void* memory, size_t sz, void* out, ui
     u8* flipmap = (uint8_t*)gs_malloc(w * h * num_comps);
     memset(alpha_bitmap, 0, w * h);
     memset(flipmap, 0, w * h * num_comps);
-    s32 v = stbtt_BakeFontBitmap((u8*)memory, 0, (float)point_size, alpha_bitmap, w, h, 32, 96, (stbtt_bakedchar*)f->glyphs); // no guarantee this fits!
+    stbtt_bakedchar baked[96] = gs_default_val();
+    s32 v = stbtt_BakeFontBitmap((u8*)memory, 0, (float)point_size, alpha_bitmap, w, h, 32, 96, baked); // no guarantee this fits!
+
+    for (u32 i = 0; i < 96; ++i)
+    {
+        gs_baked_char_t* g = &f->glyphs[i];
+        g->codepoint = 32 + i;
+        g->x0 = baked[i].x0; g->y0 = baked[i].y0;
+        g->x1 = baked[i].x1; g->y1 = baked[i].y1;
+        g->xoff = baked[i].xoff; g->yoff = baked[i].yoff;
+        g->advance = baked[i].xadvance;
+        g->width = baked[i].x1 - baked[i].x0;
+        g->height = baked[i].y1 - baked[i].y0;
+    }
 
     // Flip texture
     u32 r = h - 1;
@@ -8971,26 +10678,233 @@ bool gs_asset_font_load_from_memory(const void* memory, size_t sz, void* out, ui
     desc.format = GS_GRAPHICS_TEXTURE_FORMAT_RGBA8;
     desc.min_filter = GS_GRAPHICS_TEXTURE_FILTER_NEAREST;
     desc.mag_filter = GS_GRAPHICS_TEXTURE_FILTER_NEAREST;
-
-    // Generate atlas texture for bitmap with bitmap data
-    f->texture.hndl = gs_graphics_texture_create(&desc);
     f->texture.desc = desc;
-    *f->texture.desc.data = NULL;
+    f->texture.hndl = gs_handle_invalid(gs_graphics_texture_t);   // Created by the caller
 
     bool success = false;
     if (v <= 0) {
         gs_println("Font Failed to Load, Baked Texture Was Too Small: %d", v);
+        gs_free(alpha_bitmap);
+        return success;
     }
-    else {
-        gs_println("Font Successfully Loaded: %d", v);
-        success = true;
+
+    gs_println("Font Successfully Loaded: %d", v);
+    success = true;
+
+    // Keep the font program and coverage around to rasterize the rest on demand
+    gs_asset_font_atlas_t* atlas = (gs_asset_font_atlas_t*)gs_malloc(sizeof(gs_asset_font_atlas_t));
+    memset(atlas, 0, sizeof(gs_asset_font_atlas_t));
+    atlas->ttf = (uint8_t*)gs_malloc(sz);
+    memcpy(atlas->ttf, memory, sz);
+    if (!stbtt_InitFont(&atlas->info, atlas->ttf, stbtt_GetFontOffsetForIndex(atlas->ttf, 0))) {
+        gs_free(atlas->ttf);
+        gs_free(atlas);
+        gs_free(alpha_bitmap);
+        return success;
     }
+    atlas->scale = stbtt_ScaleForPixelHeight(&atlas->info, (float)point_size);
+    atlas->alpha = alpha_bitmap;
+    atlas->width = w;
+    atlas->height = h;
+    atlas->base_y = (uint32_t)v;
+    gs_hash_table_init_ctrl(atlas->glyphs, uint32_t, gs_baked_char_t);   // Mostly misses while text is new, which linear mode scans for
+    f->font_info = atlas;
 
-    gs_free(alpha_bitmap);
-    gs_free(flipmap);
     return success;
 }
 
+GS_API_DECL void gs_asset_font_atlas_free(gs_asset_font_t* fp)
+{
+    gs_asset_font_atlas_t* atlas = (gs_asset_font_atlas_t*)fp->font_info;
+    if (atlas) {
+        gs_free(atlas->ttf);
+        gs_free(atlas->alpha);
+        gs_dyn_array_free(atlas->shelves);
+        gs_hash_table_free(atlas->glyphs);
+        gs_free(atlas);
+        fp->font_info = NULL;
+    }
+}
+
+GS_API_DECL void gs_asset_font_free(gs_asset_font_t* fp)
+{
+    if (!fp) return;
+    gs_asset_font_atlas_free(fp);
+    if (gs_handle_is_valid(fp->texture.hndl)) {
+        gs_graphics_texture_destroy(fp->texture.hndl);
+        fp->texture.hndl = gs_handle_invalid(gs_graphics_texture_t);
+    }
+}
+
+// Find room for a w x h rect: the best fitting shelf with space left, else a new shelf at the bottom
+bool __gs_asset_font_atlas_pack(gs_asset_font_atlas_t* atlas, uint32_t w, uint32_t h, uint32_t* x, uint32_t* y)
+{
+    if (w > atlas->width) return false;
+
+    int32_t best = -1;
+    for (uint32_t i = 0; i < (uint32_t)gs_dyn_array_size(atlas->shelves); ++i)
+    {
+        gs_asset_font_shelf_t* s = &atlas->shelves[i];
+        if (h <= s->h && s->x + w <= atlas->width && (best < 0 || s->h < atlas->shelves[best].h)) {
+            best = (int32_t)i;
+        }
+    }
+
+    if (best < 0)
+    {
+        uint32_t sy = atlas->base_y;
+        if (gs_dyn_array_size(atlas->shelves)) {
+            gs_asset_font_shelf_t* last = &gs_dyn_array_back(atlas->shelves);
+            sy = last->y + last->h;
+        }
+        uint32_t sh = (h + 3) & ~3u;   // Round up so similar glyphs share shelves
+        if (sy + sh > atlas->height) return false;
+        gs_asset_font_shelf_t shelf = {0, sy, sh};
+        gs_dyn_array_push(atlas->shelves, shelf);
+        best = (int32_t)gs_dyn_array_size(atlas->shelves) - 1;
+    }
+
+    gs_asset_font_shelf_t* s = &atlas->shelves[best];
+    *x = s->x;
+    *y = s->y;
+    s->x += w;
+    return true;
+}
+
+void __gs_asset_font_atlas_dirty(gs_asset_font_atlas_t* atlas, uint32_t y0, uint32_t y1)
+{
+    if (atlas->dirty_y1 <= atlas->dirty_y0) {
+        atlas->dirty_y0 = y0;
+        atlas->dirty_y1 = y1;
+    } else {
+        atlas->dirty_y0 = gs_min(atlas->dirty_y0, y0);
+        atlas->dirty_y1 = gs_max(atlas->dirty_y1, y1);
+    }
+}
+
+GS_API_DECL bool gs_asset_font_glyph(const gs_asset_font_t* fp, uint32_t codepoint, gs_baked_char_t* out)
+{
+    if (!fp || codepoint < 32) return false;
+    if (codepoint <= 127) {
+        *out = fp->glyphs[codepoint - 32];
+        return true;
+    }
+
+    gs_asset_font_atlas_t* atlas = (gs_asset_font_atlas_t*)fp->font_info;
+    if (!atlas) return false;
+
+    if (gs_hash_table_exists(atlas->glyphs, codepoint)) {
+        *out = gs_hash_table_get(atlas->glyphs, codepoint);
+        return out->codepoint != 0;   // Zeroed entries cache missing glyphs
+    }
+
+    gs_baked_char_t g = gs_default_val();
+    int32_t gi = stbtt_FindGlyphIndex(&atlas->info, (int32_t)codepoint);
+    if (gi)
+    {
+        int32_t advance = 0, lsb = 0, x0 = 0, y0 = 0, x1 = 0, y1 = 0;
+        stbtt_GetGlyphHMetrics(&atlas->info, gi, &advance, &lsb);
+        stbtt_GetGlyphBitmapBox(&atlas->info, gi, atlas->scale, atlas->scale, &x0, &y0, &x1, &y1);
+        const uint32_t gw = (uint32_t)(x1 - x0), gh = (uint32_t)(y1 - y0);
+
+        // One pixel of padding right and below, same as the baked glyphs
+        uint32_t px = 0, py = 0;
+        bool packed = !gw || !gh;
+        while (!packed && !(packed = __gs_asset_font_atlas_pack(atlas, gw + 1, gh + 1, &px, &py)))
+        {
+            if (atlas->height * 2 <= GS_ASSET_FONT_ATLAS_MAX_HEIGHT)
+            {
+                // Grow
+                uint32_t h = atlas->height * 2;
+                atlas->alpha = (uint8_t*)gs_realloc(atlas->alpha, atlas->width * h);
+                memset(atlas->alpha + atlas->width * atlas->height, 0, atlas->width * (h - atlas->height));
+                atlas->height = h;
+                atlas->resized = true;
+            }
+            else if (gs_dyn_array_size(atlas->shelves))
+            {
+                // Evict every rasterized glyph
+                gs_dyn_array_clear(atlas->shelves);
+                gs_hash_table_clear(atlas->glyphs);
+                memset(atlas->alpha + atlas->width * atlas->base_y, 0, atlas->width * (atlas->height - atlas->base_y));
+                __gs_asset_font_atlas_dirty(atlas, atlas->base_y, atlas->height);
+            }
+            else break;   // Larger than the atlas can ever hold
+            atlas->version++;
+        }
+
+        if (packed)
+        {
+            if (gw && gh) {
+                stbtt_MakeGlyphBitmap(&atlas->info, atlas->alpha + py * atlas->width + px, (int32_t)gw, (int32_t)gh, (int32_t)atlas->width, atlas->scale, atlas->scale, gi);
+                __gs_asset_font_atlas_dirty(atlas, py, py + gh);
+            }
+            g.codepoint = codepoint;
+            g.x0 = (uint16_t)px; g.y0 = (uint16_t)py;
+            g.x1 = (uint16_t)(px + gw); g.y1 = (uint16_t)(py + gh);
+            g.xoff = (float)x0;
+            g.yoff = (float)y0;
+            g.advance = atlas->scale * (float)advance;
+            g.width = gw;
+            g.height = gh;
+        }
+    }
+
+    gs_hash_table_insert(atlas->glyphs, codepoint, g);
+    *out = g;
+    return g.codepoint != 0;
+}
+
+GS_API_DECL void gs_asset_font_glyph_quad(const gs_asset_font_t* fp, const gs_baked_char_t* g, float* x, float* y, gs_vec4* pos, gs_vec4* uv)
+{
+    // Same placement as stbtt_GetBakedQuad (opengl fill rule)
+    const gs_asset_font_atlas_t* atlas = (const gs_asset_font_atlas_t*)fp->font_info;
+    const float iw = 1.f / (float)(atlas ? atlas->width : fp->texture.desc.width);
+    const float ih = 1.f / (float)(atlas ? atlas->height : fp->texture.desc.height);
+    const float rx = floorf(*x + g->xoff + 0.5f);
+    const float ry = floorf(*y + g->yoff + 0.5f);
+    *pos = gs_v4(rx, ry, rx + (float)(g->x1 - g->x0), ry + (float)(g->y1 - g->y0));
+    *uv = gs_v4((float)g->x0 * iw, (float)g->y0 * ih, (float)g->x1 * iw, (float)g->y1 * ih);
+    *x += g->advance;
+}
+
+GS_API_DECL void gs_asset_font_atlas_flush(const gs_asset_font_t* fp)
+{
+    gs_asset_font_atlas_t* atlas = fp ? (gs_asset_font_atlas_t*)fp->font_info : NULL;
+    if (!atlas || atlas->dirty_y1 <= atlas->dirty_y0 || !gs_handle_is_valid(fp->texture.hndl)) return;
+
+    // Whole texture after growing (reallocates it), otherwise just the changed rows
+    const uint32_t y0 = atlas->resized ? 0 : atlas->dirty_y0;
+    const uint32_t y1 = atlas->resized ? atlas->height : atlas->dirty_y1;
+    const uint32_t n = atlas->width * (y1 - y0);
+    uint8_t* rgba = (uint8_t*)gs_malloc(n * 4);
+    const uint8_t* src = atlas->alpha + atlas->width * y0;
+    for (uint32_t i = 0; i < n; ++i) {
+        rgba[i * 4 + 0] = 255;
+        rgba[i * 4 + 1] = 255;
+        rgba[i * 4 + 2] = 255;
+        rgba[i * 4 + 3] = src[i];
+    }
+
+    gs_graphics_texture_desc_t desc = fp->texture.desc;
+    desc.width = atlas->width;
+    desc.height = y1 - y0;
+    desc.offset = gs_v2(0.f, (float)y0);
+    memset(desc.data, 0, sizeof(desc.data));
+    *desc.data = rgba;
+    gs_graphics_texture_update(fp->texture.hndl, &desc);
+    gs_free(rgba);
+
+    atlas->dirty_y0 = atlas->dirty_y1 = 0;
+    atlas->resized = false;
+}
+
+GS_API_DECL uint32_t gs_asset_font_atlas_version(const gs_asset_font_t* fp)
+{
+    const gs_asset_font_atlas_t* atlas = fp ? (const gs_asset_font_atlas_t*)fp->font_info : NULL;
+    return atlas ? atlas->version : 0;
+}
+
 GS_API_DECL float gs_asset_font_max_height(const gs_asset_font_t* fp)
 {
     if (!fp) return 0.f;
@@ -8998,12 +10912,12 @@ GS_API_DECL float gs_asset_font_max_height(const gs_asset_font_t* fp)
     const char* txt = "1l`'f()ABCDEFGHIJKLMNOjPQqSTU!";
     while (txt[0] != '\0')
     {
-        char c = txt[0];
-        if (c >= 32 && c <= 127)
+        gs_baked_char_t g = gs_default_val();
+        if (gs_asset_font_glyph(fp, (uint32_t)txt[0], &g))
         {
-            stbtt_aligned_quad q = gs_default_val();
-            stbtt_GetBakedQuad((stbtt_bakedchar*)fp->glyphs, fp->texture.desc.width, fp->texture.desc.height, c - 32, &x, &y, &q, 1);
-            h = gs_max(gs_max(h, fabsf(q.y0)), fabsf(q.y1));
+            gs_vec4 q = gs_default_val(), uv = gs_default_val();
+            gs_asset_font_glyph_quad(fp, &g, &x, &y, &q, &uv);
+            h = gs_max(gs_max(h, fabsf(q.y)), fabsf(q.w));
         }
         txt++;
     };
@@ -9024,19 +10938,23 @@ GS_API_DECL gs_vec2 gs_asset_font_text_dimensions_ex(const gs_asset_font_t* fp,
     float y = 0.f;
     float y_under = 0;
 
-    while (text[0] != '\0' && len--)
+    // len counts bytes, negative for the whole string
+    while (text[0] != '\0' && len != 0)
     {
-        char c = text[0];
-        if (c >= 32 && c <= 127)
+        const char* at = text;
+        uint32_t c = gs_util_utf8_next(&text);
+        if (len > 0) len = gs_max(len - (int32_t)(text - at), 0);
+
+        gs_baked_char_t g = gs_default_val();
+        if (gs_asset_font_glyph(fp, c, &g))
         {
-            stbtt_aligned_quad q = gs_default_val();
-            stbtt_GetBakedQuad((stbtt_bakedchar*)fp->glyphs, fp->texture.desc.width, fp->texture.desc.height, c - 32, &x, &y, &q, 1);
+            gs_vec4 q = gs_default_val(), uv = gs_default_val();
+            gs_asset_font_glyph_quad(fp, &g, &x, &y, &q, &uv);
             dimensions.x = gs_max(dimensions.x, x);
-            dimensions.y = gs_max(dimensions.y, fabsf(q.y0));
+            dimensions.y = gs_max(dimensions.y, fabsf(q.y));
             if (include_past_baseline)
-                y_under = gs_max(y_under, fabsf(q.y1));
+                y_under = gs_max(y_under, fabsf(q.w));
         }
-        text++;
     };
 
     if (include_past_baseline)
@@ -9938,6 +11856,10 @@ gs_create(gs_app_desc_t app_desc)
         if (app_desc.update == NULL)            app_desc.update = &gs_default_app_func;
         if (app_desc.shutdown == NULL)          app_desc.shutdown = &gs_default_app_func;
         if (app_desc.init == NULL)              app_desc.init = &gs_default_app_func; 
+        if (app_desc.fixed_rate <= 0.f)         app_desc.fixed_rate = 60.f;
+        #ifdef GS_PLATFORM_WEB
+            app_desc.jobs.thread_count = 1;     // No worker threads without pthreads
+        #endif
 
         // Set up os api before all?
         gs_os_api_t os = gs_os_api_new();
@@ -9957,6 +11879,9 @@ gs_create(gs_app_desc_t app_desc)
         // Set up function pointers
         gs_instance()->shutdown  = &gs_destroy;
 
+        // Construct job system first so every subsystem can use it
+        gs_subsystem(jobs) = gs_jobs_create(&app_desc.jobs);
+
         // Need to have video settings passed down from user
         gs_subsystem(platform) = gs_platform_create();
 
@@ -9968,6 +11893,7 @@ gs_create(gs_app_desc_t app_desc)
 
         // Set frame rate for application
         gs_subsystem(platform)->time.max_fps = app_desc.window.frame_rate;
+        gs_subsystem(platform)->time.fixed_delta = 1.0 / (double)app_desc.fixed_rate;
 
         // Construct main window 
         gs_platform_window_create(&app_desc.window);
@@ -10026,18 +11952,24 @@ gs_app()
 GS_API_DECL void 
 gs_frame()
 {
-    // Remove these...
-    static uint32_t curr_ticks = 0; 
-    static uint32_t prev_ticks = 0;
-
     // Cache platform pointer
     gs_platform_t* platform = gs_subsystem(platform);
 
     // Cache times at start of frame
-    platform->time.elapsed  = (float)gs_platform_elapsed_time();
+    platform->time.elapsed  = gs_platform_elapsed_time();
     platform->time.update   = platform->time.elapsed - platform->time.previous;
     platform->time.previous = platform->time.elapsed;
 
+    // Per-thread job scratch is per frame, kept while async jobs (asset decodes etc.) are still running on it
+    if (!gs_jobs_pending(gs_subsystem(jobs))) {
+        gs_jobs_scratch_reset(gs_subsystem(jobs));
+    }
+
+    // Graphics stats are per frame
+    if (gs_subsystem(graphics)) {
+        memset(&gs_subsystem(graphics)->stats, 0, sizeof(gs_graphics_stats_t));
+    }
+
     // Update platform and process input
     gs_platform_update(platform);
     if (!gs_instance()->ctx.app.is_running) {
@@ -10045,6 +11977,29 @@ gs_frame()
         return;
     }
 
+    // Audio notifications and stream decoding (default backend only, custom backends drive their own)
+#ifndef GS_AUDIO_IMPL_CUSTOM
+    gs_audio_update(gs_subsystem(audio));
+#endif
+
+    // Fixed timestep: consume last frame's delta in fixed_delta sized steps, carrying the remainder
+    if (gs_instance()->ctx.app.fixed_update)
+    {
+        gs_platform_time_t* t = &platform->time;
+        const double max_acc = t->fixed_delta * GS_PLATFORM_MAX_FIXED_STEPS;
+        t->accumulator = gs_min(t->accumulator + t->delta, max_acc);
+        while (t->accumulator >= t->fixed_delta)
+        {
+            gs_instance()->ctx.app.fixed_update();
+            if (!gs_instance()->ctx.app.is_running) {
+                gs_instance()->shutdown();
+                return;
+            }
+            t->accumulator -= t->fixed_delta;
+        }
+        t->alpha = t->accumulator / t->fixed_delta;
+    }
+
     // Process application context
     gs_instance()->ctx.app.update();
     if (!gs_instance()->ctx.app.is_running) {
@@ -10068,23 +12023,23 @@ gs_frame()
     }
 
     // Frame locking (not sure if this should be done here, but it is what it is)
-    platform->time.elapsed  = (float)gs_platform_elapsed_time();
+    platform->time.elapsed  = gs_platform_elapsed_time();
     platform->time.render   = platform->time.elapsed - platform->time.previous;
     platform->time.previous = platform->time.elapsed;
     platform->time.frame    = platform->time.update + platform->time.render;            // Total frame time
-    platform->time.delta    = platform->time.frame / 1000.f;
+    platform->time.delta    = platform->time.frame / 1000.0;
 
-    float target = (1000.f / platform->time.max_fps);
+    double target = (1000.0 / (double)platform->time.max_fps);
 
     if (platform->time.frame < target)
     {
-        gs_platform_sleep((float)(target - platform->time.frame));
+        gs_platform_sleep_precise(target - platform->time.frame);
         
-        platform->time.elapsed = (float)gs_platform_elapsed_time();
+        platform->time.elapsed = gs_platform_elapsed_time();
         double wait_time = platform->time.elapsed - platform->time.previous;
         platform->time.previous = platform->time.elapsed;
         platform->time.frame += wait_time;
-        platform->time.delta = platform->time.frame / 1000.f;
+        platform->time.delta = platform->time.frame / 1000.0;
     }
 }
 
@@ -10103,6 +12058,9 @@ void gs_destroy()
 
     gs_platform_shutdown(gs_subsystem(platform)); 
     gs_platform_destroy(gs_subsystem(platform));
+
+    gs_jobs_destroy(gs_subsystem(jobs));
+    gs_subsystem(jobs) = NULL;
 }
 
 GS_API_DECL void 
@@ -48,6 +48,582 @@
 #include "../external/dr_libs/dr_wav.h"
 #include "../external/dr_libs/dr_mp3.h"
 
+// SIMD for mixing bus (define GS_AUDIO_NO_SIMD to force scalar path)
+#ifndef GS_AUDIO_NO_SIMD
+    #if (defined __AVX__)
+        #define GS_AUDIO_SIMD_AVX
+        #define GS_AUDIO_SIMD_SSE
+        #include <immintrin.h>
+    #elif (defined __SSE2__ || defined _M_X64 || (defined _M_IX86_FP && _M_IX86_FP >= 2))
+        #define GS_AUDIO_SIMD_SSE
+        #include <emmintrin.h>
+    #elif (defined __ARM_NEON || defined __ARM_NEON__)
+        #define GS_AUDIO_SIMD_NEON
+        #include <arm_neon.h>
+    #endif
+#endif
+
+/* Command/Event Queues */
+void __gs_audio_queue_init(gs_audio_queue_t* q, uint32_t stride, uint32_t capacity)
+{
+    gs_assert(capacity && (capacity & (capacity - 1)) == 0);
+    q->data = (uint8_t*)gs_malloc(stride * capacity);
+    q->stride = stride;
+    q->capacity = capacity;
+    q->head = 0;
+    q->tail = 0;
+}
+
+void __gs_audio_queue_free(gs_audio_queue_t* q)
+{
+    if (q->data) gs_free(q->data);
+    q->data = NULL;
+}
+
+// Producer only. Returns false if full, never blocks.
+bool32_t __gs_audio_queue_push(gs_audio_queue_t* q, const void* item)
+{
+    uint32_t tail = q->tail;
+    uint32_t head = gs_atomic_load(&q->head);
+    if (tail - head >= q->capacity) return false;
+    memcpy(q->data + (tail & (q->capacity - 1)) * q->stride, item, q->stride);
+    gs_atomic_store(&q->tail, tail + 1);
+    return true;
+}
+
+// Consumer only. Returns false if empty, never blocks.
+bool32_t __gs_audio_queue_pop(gs_audio_queue_t* q, void* item)
+{
+    uint32_t head = q->head;
+    uint32_t tail = gs_atomic_load(&q->tail);
+    if (head == tail) return false;
+    memcpy(item, q->data + (head & (q->capacity - 1)) * q->stride, q->stride);
+    gs_atomic_store(&q->head, head + 1);
+    return true;
+}
+
+/* Mixer */
+void __gs_audio_mixer_init(gs_audio_mixer_t* mixer)
+{
+    mixer->bus = (float*)gs_malloc(GS_AUDIO_MIX_CHUNK_FRAMES * 2 * sizeof(float));
+    mixer->scratch = (float*)gs_malloc(GS_AUDIO_MIX_CHUNK_FRAMES * 2 * sizeof(float));
+    mixer->sinc_table = (float*)gs_malloc(GS_AUDIO_SINC_PHASES * GS_AUDIO_SINC_TAPS * sizeof(float));
+    mixer->quality = GS_AUDIO_RESAMPLE_LINEAR;
+
+    // Lanczos (a = TAPS / 2) kernel per fractional phase, taps cover frames [i - a + 1, i + a], normalized to unity gain
+    const int32_t a = GS_AUDIO_SINC_TAPS / 2;
+    for (uint32_t p = 0; p < GS_AUDIO_SINC_PHASES; ++p)
+    {
+        float* k = mixer->sinc_table + p * GS_AUDIO_SINC_TAPS;
+        double t = (double)p / (double)GS_AUDIO_SINC_PHASES;
+        double sum = 0.0;
+        for (int32_t j = 0; j < GS_AUDIO_SINC_TAPS; ++j)
+        {
+            double x = (double)(j - a + 1) - t;
+            double w = 1.0;
+            if (fabs(x) > 1e-9) {
+                double px = GS_PI * x;
+                w = (sin(px) / px) * (sin(px / a) / (px / a));
+            }
+            k[j] = (float)w;
+            sum += w;
+        }
+        for (int32_t j = 0; j < GS_AUDIO_SINC_TAPS; ++j) {
+            k[j] = (float)(k[j] / sum);
+        }
+    }
+}
+
+// Frame fetch with loop wrap/silence past end (slow path for resampler edges)
+gs_force_inline
+void __gs_audio_fetch_frame(const gs_audio_source_t* src, int64_t frame, int64_t frames, bool32_t loop, float* l, float* r)
+{
+    if (frame < 0 || frame >= frames) {
+        if (!loop || !frames) { *l = 0.f; *r = 0.f; return; }
+        frame %= frames;
+        if (frame < 0) frame += frames;
+    }
+    const s16* smp = (const s16*)src->samples + frame * src->channels;
+    *l = (float)smp[0] * (1.f / 32768.f);
+    *r = (float)smp[src->channels > 1 ? 1 : 0] * (1.f / 32768.f);
+}
+
+// Resample voice into interleaved stereo float output, returns frames written (fewer if a non-looping source finished)
+uint32_t __gs_audio_voice_render(gs_audio_mixer_t* mixer, gs_audio_voice_t* voice, float* out, uint32_t frame_count,
+    uint32_t sample_rate, uint32_t quality, bool32_t* finished)
+{
+    gs_audio_instance_t* inst = &voice->inst;
+    const gs_audio_source_t* src = &voice->src;
+    const int32_t channels = src->channels;
+    const int64_t frames = src->sample_count / channels;
+    const s16* samples = (const s16*)src->samples;
+    const uint32_t rc = channels > 1 ? 1 : 0;
+    const float norm = 1.f / 32768.f;
+    const int32_t a = GS_AUDIO_SINC_TAPS / 2;
+
+    // Source frames to step per output frame
+    f64 step = ((f64)src->sample_rate / (f64)sample_rate) * (f64)inst->pitch;
+    f64 pos = inst->sample_position / (f64)channels;
+    uint32_t f = 0;
+    *finished = false;
+
+    for (; f < frame_count; ++f)
+    {
+        if (pos >= (f64)frames) {
+            if (!inst->loop) {
+                *finished = true;
+                break;
+            }
+            pos = fmod(pos, (f64)frames);
+        }
+
+        int64_t i = (int64_t)pos;
+        float t = (float)(pos - (f64)i);
+        float l = 0.f, r = 0.f;
+
+        if (quality == GS_AUDIO_RESAMPLE_SINC)
+        {
+            const float* k = mixer->sinc_table + (uint32_t)(t * GS_AUDIO_SINC_PHASES) * GS_AUDIO_SINC_TAPS;
+            int64_t first = i - a + 1;
+            if (first >= 0 && first + GS_AUDIO_SINC_TAPS <= frames) {
+                const s16* smp = samples + first * channels;
+                for (int32_t j = 0; j < GS_AUDIO_SINC_TAPS; ++j, smp += channels) {
+                    l += k[j] * (float)smp[0];
+                    r += k[j] * (float)smp[rc];
+                }
+                l *= norm;
+                r *= norm;
+            }
+            else {
+                for (int32_t j = 0; j < GS_AUDIO_SINC_TAPS; ++j) {
+                    float sl, sr;
+                    __gs_audio_fetch_frame(src, first + j, frames, inst->loop, &sl, &sr);
+                    l += k[j] * sl;
+                    r += k[j] * sr;
+                }
+            }
+        }
+        else
+        {
+            float l0, r0, l1, r1;
+            if (i + 1 < frames) {
+                const s16* smp = samples + i * channels;
+                l0 = (float)smp[0] * norm; r0 = (float)smp[rc] * norm;
+                l1 = (float)smp[channels] * norm; r1 = (float)smp[channels + rc] * norm;
+            }
+            else {
+                __gs_audio_fetch_frame(src, i, frames, inst->loop, &l0, &r0);
+                __gs_audio_fetch_frame(src, i + 1, frames, inst->loop, &l1, &r1);
+            }
+            l = l0 + (l1 - l0) * t;
+            r = r0 + (r1 - r0) * t;
+        }
+
+        out[f * 2 + 0] = l;
+        out[f * 2 + 1] = r;
+        pos += step;
+    }
+
+    inst->sample_position = pos * (f64)channels;
+    return f;
+}
+
+// bus += src * volume over n floats
+gs_force_inline
+void __gs_audio_mix_f32(float* bus, const float* src, float volume, uint32_t n)
+{
+    uint32_t i = 0;
+#if (defined GS_AUDIO_SIMD_AVX)
+    __m256 v8 = _mm256_set1_ps(volume);
+    for (; i + 8 <= n; i += 8) {
+        _mm256_storeu_ps(bus + i, _mm256_add_ps(_mm256_loadu_ps(bus + i), _mm256_mul_ps(_mm256_loadu_ps(src + i), v8)));
+    }
+#endif
+#if (defined GS_AUDIO_SIMD_SSE)
+    __m128 v4 = _mm_set1_ps(volume);
+    for (; i + 4 <= n; i += 4) {
+        _mm_storeu_ps(bus + i, _mm_add_ps(_mm_loadu_ps(bus + i), _mm_mul_ps(_mm_loadu_ps(src + i), v4)));
+    }
+#elif (defined GS_AUDIO_SIMD_NEON)
+    for (; i + 4 <= n; i += 4) {
+        vst1q_f32(bus + i, vmlaq_n_f32(vld1q_f32(bus + i), vld1q_f32(src + i), volume));
+    }
+#endif
+    for (; i < n; ++i) {
+        bus[i] += src[i] * volume;
+    }
+}
+
+// Saturate float bus to s16 (single clamp at end of mix instead of wrapping per voice)
+gs_force_inline
+void __gs_audio_bus_to_s16(const float* bus, s16* out, uint32_t n)
+{
+    uint32_t i = 0;
+#if (defined GS_AUDIO_SIMD_SSE)
+    const __m128 lo = _mm_set1_ps(-1.f), hi = _mm_set1_ps(1.f), scl = _mm_set1_ps(32767.f);
+    for (; i + 8 <= n; i += 8) {
+        __m128 a = _mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(bus + i), lo), hi), scl);
+        __m128 b = _mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(bus + i + 4), lo), hi), scl);
+        _mm_storeu_si128((__m128i*)(out + i), _mm_packs_epi32(_mm_cvtps_epi32(a), _mm_cvtps_epi32(b)));
+    }
+#elif (defined GS_AUDIO_SIMD_NEON)
+    const float32x4_t lo = vdupq_n_f32(-1.f), hi = vdupq_n_f32(1.f);
+    for (; i + 4 <= n; i += 4) {
+        float32x4_t a = vmulq_n_f32(vminq_f32(vmaxq_f32(vld1q_f32(bus + i), lo), hi), 32767.f);
+        vst1_s16(out + i, vqmovn_s32(vcvtq_s32_f32(a)));
+    }
+#endif
+    for (; i < n; ++i) {
+        float v = gs_clamp(bus[i], -1.f, 1.f) * 32767.f;
+        out[i] = (s16)(v < 0.f ? v - 0.5f : v + 0.5f);
+    }
+}
+
+/* Streaming */
+typedef struct __gs_audio_decoder_t
+{
+    union {
+        drwav wav;
+        drmp3 mp3;
+        stb_vorbis* ogg;
+    };
+    char* owned_data;   // Decompressed archive entry, kept alive while the decoder is open
+} __gs_audio_decoder_t;
+
+bool32_t __gs_audio_decoder_open(__gs_audio_decoder_t* d, gs_audio_file_type type, const char* path, 
+    int32_t* channels, int32_t* sample_rate, uint64_t* frames)
+{
+    // Streams in a mounted archive decode from a view of the mapped archive (or a decompressed copy), 
+    // loose files keep streaming from disk
+    const void* mem = NULL;
+    size_t sz = 0;
+    d->owned_data = NULL;
+    const gs_platform_archive_t* ar = NULL;
+    const gs_platform_archive_entry_t* e = gs_platform_archive_find_mounted(path, &ar);
+    if (e) {
+        mem = gs_platform_archive_view(ar, path, &sz);
+        if (!mem) mem = d->owned_data = gs_platform_archive_read(ar, path, &sz);
+        if (!mem) return false;
+    }
+
+    bool32_t ok = true;
+    switch (type)
+    {
+        case GS_WAV:
+        {
+            if (!(mem ? drwav_init_memory(&d->wav, mem, sz, NULL) : drwav_init_file(&d->wav, path, NULL))) {ok = false; break;}
+            *channels = d->wav.channels;
+            *sample_rate = d->wav.sampleRate;
+            *frames = d->wav.totalPCMFrameCount;
+        } break;
+
+        case GS_MP3:
+        {
+            if (!(mem ? drmp3_init_memory(&d->mp3, mem, sz, NULL) : drmp3_init_file(&d->mp3, path, NULL))) {ok = false; break;}
+            *channels = d->mp3.channels;
+            *sample_rate = d->mp3.sampleRate;
+            *frames = 0;    // Unknown without scanning whole file, see gs_audio_load_stream_from_file
+        } break;
+
+        case GS_OGG:
+        {
+            int32_t err = 0;
+            d->ogg = mem ? stb_vorbis_open_memory((const unsigned char*)mem, (int32_t)sz, &err, NULL) : stb_vorbis_open_filename(path, &err, NULL);
+            if (!d->ogg) {ok = false; break;}
+            stb_vorbis_info info = stb_vorbis_get_info(d->ogg);
+            *channels = info.channels;
+            *sample_rate = info.sample_rate;
+            *frames = stb_vorbis_stream_length_in_samples(d->ogg);
+        } break;
+
+        default: ok = false; break;
+    }
+
+    if (!ok && d->owned_data) {
+        gs_free(d->owned_data);
+        d->owned_data = NULL;
+    }
+    return ok;
+}
+
+void __gs_audio_decoder_close(__gs_audio_decoder_t* d, gs_audio_file_type type)
+{
+    switch (type)
+    {
+        case GS_WAV: drwav_uninit(&d->wav); break;
+        case GS_MP3: drmp3_uninit(&d->mp3); break;
+        case GS_OGG: stb_vorbis_close(d->ogg); break;
+        default: break;
+    }
+    if (d->owned_data) {
+        gs_free(d->owned_data);
+        d->owned_data = NULL;
+    }
+}
+
+// Returns frames decoded, fewer than requested at end of data
+uint32_t __gs_audio_decoder_read(__gs_audio_decoder_t* d, gs_audio_file_type type, int32_t channels, s16* out, uint32_t frames)
+{
+    switch (type)
+    {
+        case GS_WAV: return (uint32_t)drwav_read_pcm_frames_s16(&d->wav, frames, out);
+        case GS_MP3: return (uint32_t)drmp3_read_pcm_frames_s16(&d->mp3, frames, out);
+        case GS_OGG: return (uint32_t)stb_vorbis_get_samples_short_interleaved(d->ogg, channels, out, frames * channels);
+        default: return 0;
+    }
+}
+
+bool32_t __gs_audio_decoder_seek(__gs_audio_decoder_t* d, gs_audio_file_type type, uint64_t frame)
+{
+    switch (type)
+    {
+        case GS_WAV: return drwav_seek_to_pcm_frame(&d->wav, frame);
+        case GS_MP3: return drmp3_seek_to_pcm_frame(&d->mp3, frame);
+        case GS_OGG: return stb_vorbis_seek(d->ogg, (uint32_t)frame);
+        default: return false;
+    }
+}
+
+/* Game thread: create decode state for a new voice of a streaming source, handed to audio thread with SET_DATA */
+gs_audio_stream_t* __gs_audio_stream_create(gs_audio_t* audio, const gs_audio_source_t* src, const gs_audio_instance_decl_t* decl)
+{
+    gs_audio_stream_t* s = gs_malloc_init(gs_audio_stream_t);
+    s->src = *src;
+    s->ring = (s16*)gs_malloc(GS_AUDIO_STREAM_FRAMES * src->channels * sizeof(s16));
+    s->start_frame = (uint64_t)(decl->sample_position / (f64)src->channels);
+    s->loop = decl->loop;
+    s->end = UINT32_MAX;
+
+    gs_audio_mutex_lock(audio);
+    gs_dyn_array_push(audio->stream_pending, s);
+    gs_audio_mutex_unlock(audio);
+    return s;
+}
+
+void __gs_audio_stream_free(gs_audio_stream_t* s)
+{
+    if (s->decoder) {
+        __gs_audio_decoder_close((__gs_audio_decoder_t*)s->decoder, s->src.file_type);
+        gs_free(s->decoder);
+    }
+    gs_free(s->ring);
+    gs_free(s);
+}
+
+/* Decode thread: handle restarts and top up ring in half-ring blocks */
+void __gs_audio_stream_fill(gs_audio_stream_t* s)
+{
+    const uint32_t cap = GS_AUDIO_STREAM_FRAMES;
+    const uint32_t half = cap / 2;
+    const int32_t channels = s->src.channels;
+    const gs_audio_file_type type = s->src.file_type;
+    __gs_audio_decoder_t* d = (__gs_audio_decoder_t*)s->decoder;
+
+    // Nothing to decode, just acknowledge restarts so the voice finishes
+    if (s->failed) {
+        uint32_t seek = gs_atomic_load(&s->seek);
+        if (seek != s->seek_ack) {
+            uint32_t read = gs_atomic_load(&s->read);
+            gs_atomic_store(&s->end, read);
+            gs_atomic_store(&s->write, read);
+            gs_atomic_store(&s->seek_ack, seek);
+        }
+        return;
+    }
+
+    // Open lazily, so game thread only pays for allocation
+    if (!d)
+    {
+        int32_t c = 0, sr = 0;
+        uint64_t frames = 0;
+        d = (__gs_audio_decoder_t*)gs_malloc(sizeof(__gs_audio_decoder_t));
+        if (!__gs_audio_decoder_open(d, type, s->src.stream_path, &c, &sr, &frames) || c != channels) {
+            gs_println("WARNING: Could not open audio stream: %s", s->src.stream_path);
+            gs_free(d);
+            s->failed = true;
+            gs_atomic_store(&s->end, s->write);
+            return;
+        }
+        if (s->start_frame) __gs_audio_decoder_seek(d, type, s->start_frame);
+        s->decoder = d;
+    }
+
+    // Restart requested by audio thread. It won't touch the ring until acknowledged.
+    uint32_t seek = gs_atomic_load(&s->seek);
+    if (seek != s->seek_ack)
+    {
+        __gs_audio_decoder_seek(d, type, 0);
+        gs_atomic_store(&s->end, UINT32_MAX);
+        gs_atomic_store(&s->write, gs_atomic_load(&s->read));
+        gs_atomic_store(&s->seek_ack, seek);
+    }
+
+    while (s->end == UINT32_MAX)
+    {
+        uint32_t write = s->write;
+        if (cap - (write - gs_atomic_load(&s->read)) < half) break;
+
+        uint32_t off = write & (cap - 1);
+        uint32_t n = gs_min(half, cap - off);
+        uint32_t got = __gs_audio_decoder_read(d, type, channels, s->ring + off * channels, n);
+
+        // End of data, wrap to start for looping streams
+        bool32_t wrapped = false;
+        if (got < n && s->loop) {
+            wrapped = __gs_audio_decoder_seek(d, type, 0);
+            if (wrapped && !got) got = __gs_audio_decoder_read(d, type, channels, s->ring + off * channels, n);
+        }
+
+        gs_atomic_store(&s->write, write + got);
+        if (!got || (got < n && !wrapped)) {
+            gs_atomic_store(&s->end, write + got);
+        }
+    }
+}
+
+/* Decode thread: pick up new streams, free released ones, fill the rest */
+void __gs_audio_stream_update(gs_audio_t* audio)
+{
+    gs_audio_mutex_lock(audio);
+    for (int32_t i = 0; i < gs_dyn_array_size(audio->stream_pending); ++i) {
+        gs_dyn_array_push(audio->streams, audio->stream_pending[i]);
+    }
+    gs_dyn_array_clear(audio->stream_pending);
+    gs_audio_mutex_unlock(audio);
+
+    for (uint32_t i = gs_dyn_array_size(audio->streams); i > 0; --i)
+    {
+        gs_audio_stream_t* s = audio->streams[i - 1];
+        if (gs_atomic_load(&s->released)) {
+            __gs_audio_stream_free(s);
+            audio->streams[i - 1] = gs_dyn_array_back(audio->streams);
+            gs_dyn_array_pop(audio->streams);
+            continue;
+        }
+        __gs_audio_stream_fill(s);
+    }
+}
+
+/* Audio thread: hand stream back to decode thread for freeing */
+gs_force_inline
+void __gs_audio_stream_release(gs_audio_voice_t* voice)
+{
+    if (voice->stream) {
+        gs_atomic_store(&voice->stream->released, 1);
+        voice->stream = NULL;
+    }
+}
+
+/* Audio thread: request decoder restart from beginning, voice is silent until acknowledged */
+gs_force_inline
+void __gs_audio_stream_rewind(gs_audio_voice_t* voice)
+{
+    if (voice->stream) {
+        gs_atomic_store(&voice->stream->seek, voice->stream->seek + 1);
+        voice->stream_pos = 0.0;
+    }
+}
+
+// Ring frame relative to read counter, silent outside [0, limit)
+gs_force_inline
+void __gs_audio_stream_frame(const gs_audio_stream_t* s, uint32_t read, int64_t k, int64_t limit, float* l, float* r)
+{
+    if (k < 0 || k >= limit) { *l = 0.f; *r = 0.f; return; }
+    const int32_t channels = s->src.channels;
+    const s16* smp = s->ring + ((read + (uint32_t)k) & (GS_AUDIO_STREAM_FRAMES - 1)) * channels;
+    *l = (float)smp[0] * (1.f / 32768.f);
+    *r = (float)smp[channels > 1 ? 1 : 0] * (1.f / 32768.f);
+}
+
+// Resample streaming voice from its ring, same interpolation as resident voices. Underruns play silence.
+uint32_t __gs_audio_stream_render(gs_audio_mixer_t* mixer, gs_audio_voice_t* voice, float* out, uint32_t frame_count,
+    uint32_t sample_rate, uint32_t quality, bool32_t* finished)
+{
+    gs_audio_instance_t* inst = &voice->inst;
+    gs_audio_stream_t* s = voice->stream;
+    const int32_t a = GS_AUDIO_SINC_TAPS / 2;
+    const int64_t ahead = quality == GS_AUDIO_RESAMPLE_SINC ? a : 1;
+    *finished = false;
+
+    if (gs_atomic_load(&s->seek_ack) != s->seek) {
+        memset(out, 0, frame_count * 2 * sizeof(float));
+        return frame_count;
+    }
+
+    const uint32_t read = s->read;
+    const uint32_t end = gs_atomic_load(&s->end);
+    const uint32_t write = gs_atomic_load(&s->write);
+    const int64_t avail = (int64_t)((end != UINT32_MAX ? end : write) - read);
+    f64 step = ((f64)s->src.sample_rate / (f64)sample_rate) * (f64)inst->pitch;
+    f64 pos = voice->stream_pos;
+    uint32_t f = 0;
+
+    for (; f < frame_count; ++f)
+    {
+        int64_t i = (int64_t)pos;
+        if (end != UINT32_MAX) {
+            if (i >= avail) { *finished = true; break; }
+        }
+        else if (i + ahead >= avail) {
+            break;
+        }
+
+        float t = (float)(pos - (f64)i);
+        float l = 0.f, r = 0.f;
+
+        if (quality == GS_AUDIO_RESAMPLE_SINC)
+        {
+            const float* k = mixer->sinc_table + (uint32_t)(t * GS_AUDIO_SINC_PHASES) * GS_AUDIO_SINC_TAPS;
+            for (int32_t j = 0; j < GS_AUDIO_SINC_TAPS; ++j) {
+                float sl, sr;
+                __gs_audio_stream_frame(s, read, i - a + 1 + j, avail, &sl, &sr);
+                l += k[j] * sl;
+                r += k[j] * sr;
+            }
+        }
+        else
+        {
+            float l0, r0, l1, r1;
+            __gs_audio_stream_frame(s, read, i, avail, &l0, &r0);
+            __gs_audio_stream_frame(s, read, i + 1, avail, &l1, &r1);
+            l = l0 + (l1 - l0) * t;
+            r = r0 + (r1 - r0) * t;
+        }
+
+        out[f * 2 + 0] = l;
+        out[f * 2 + 1] = r;
+        pos += step;
+    }
+
+    // Reported position, wrapped for looping streams
+    const f64 samples = (f64)s->src.sample_count;
+    inst->sample_position += (f64)f * step * (f64)s->src.channels;
+    if (inst->loop && samples > 0.0 && inst->sample_position >= samples) {
+        inst->sample_position = fmod(inst->sample_position, samples);
+    }
+
+    // Underrun, decoder hasn't caught up
+    if (f < frame_count && !*finished) {
+        memset(out + f * 2, 0, (frame_count - f) * 2 * sizeof(float));
+        f = frame_count;
+    }
+
+    // Release consumed frames to decoder, keeping history for the sinc taps
+    int64_t consumed = (int64_t)pos - (a - 1);
+    if (consumed > 0) {
+        pos -= (f64)consumed;
+        gs_atomic_store(&s->read, read + (uint32_t)consumed);
+    }
+    voice->stream_pos = pos;
+
+    return f;
+}
+
+void gs_audio_set_resample_quality(gs_audio_resample_quality quality)
+{
+    gs_atomic_store(&gs_subsystem(audio)->mixer.quality, (uint32_t)quality);
+}
+
 /* Audio Create, Destroy, Init, Shutdown, Submit */
 gs_audio_t* gs_audio_create()
 {
@@ -61,6 +637,17 @@ gs_audio_t* gs_audio_create()
     audio->max_audio_volume = 1.f;
     /* Min global volume setting */
     audio->min_audio_volume = 0.f;
+    /* Command queue to audio thread, event queue back from it (at most one outstanding event per voice) */
+    __gs_audio_queue_init(&audio->commands, sizeof(gs_audio_command_t), GS_AUDIO_COMMAND_QUEUE_SIZE);
+    __gs_audio_queue_init(&audio->events, sizeof(gs_audio_event_t), GS_AUDIO_MAX_VOICES);
+    /* Voices owned by audio thread */
+    audio->voices = (gs_audio_voice_t*)gs_calloc(GS_AUDIO_MAX_VOICES, sizeof(gs_audio_voice_t));
+    audio->active_voices = (uint32_t*)gs_calloc(GS_AUDIO_MAX_VOICES, sizeof(uint32_t));
+    audio->pending_events = (uint32_t*)gs_calloc(GS_AUDIO_MAX_VOICES, sizeof(uint32_t));
+    audio->seq = (uint32_t*)gs_calloc(GS_AUDIO_MAX_VOICES, sizeof(uint32_t));
+    audio->generation = (uint32_t*)gs_calloc(GS_AUDIO_MAX_VOICES, sizeof(uint32_t));
+    /* Mixing bus and resampler */
+    __gs_audio_mixer_init(&audio->mixer);
     /* Set user data to null */
     audio->user_data = NULL;
 
@@ -74,11 +661,182 @@ void gs_audio_destroy(gs_audio_t* audio)
     {
         gs_slot_array_free(audio->sources);
         gs_slot_array_free(audio->instances);
+        __gs_audio_queue_free(&audio->commands);
+        __gs_audio_queue_free(&audio->events);
+        gs_dyn_array_free(audio->command_overflow);
+        for (int32_t i = 0; i < gs_dyn_array_size(audio->stream_pending); ++i) __gs_audio_stream_free(audio->stream_pending[i]);
+        for (int32_t i = 0; i < gs_dyn_array_size(audio->streams); ++i) __gs_audio_stream_free(audio->streams[i]);
+        gs_dyn_array_free(audio->stream_pending);
+        gs_dyn_array_free(audio->streams);
+        gs_free(audio->voices);
+        gs_free(audio->active_voices);
+        gs_free(audio->pending_events);
+        gs_free(audio->seq);
+        gs_free(audio->generation);
+        gs_free(audio->mixer.bus);
+        gs_free(audio->mixer.scratch);
+        gs_free(audio->mixer.sinc_table);
         gs_free(audio);
         audio = NULL;
     }
 }
 
+/* Game thread: flush commands that didn't fit in the ring previously, preserving order */
+void __gs_audio_flush_overflow(gs_audio_t* audio)
+{
+    uint32_t flushed = 0;
+    uint32_t overflow = gs_dyn_array_size(audio->command_overflow);
+    while (flushed < overflow && __gs_audio_queue_push(&audio->commands, &audio->command_overflow[flushed])) {
+        ++flushed;
+    }
+    if (flushed) {
+        memmove(audio->command_overflow, audio->command_overflow + flushed, (overflow - flushed) * sizeof(gs_audio_command_t));
+        gs_dyn_array_head(audio->command_overflow)->size -= flushed;
+    }
+}
+
+/* Game thread: flush overflow and apply stop/release notifications from audio thread */
+void __gs_audio_sync(gs_audio_t* audio)
+{
+    __gs_audio_flush_overflow(audio);
+
+    gs_audio_event_t evt = gs_default_val();
+    while (__gs_audio_queue_pop(&audio->events, &evt))
+    {
+        if (!gs_slot_array_handle_valid(audio->instances, evt.id)) continue;
+        if (evt.released) {
+            // Voice data has been replaced since (ie. set_instance_data after it finished), instance lives on
+            if (evt.generation != audio->generation[evt.id]) continue;
+            gs_slot_array_erase(audio->instances, evt.id);
+            continue;
+        }
+        // Ignore stop if game has issued commands since (ie. replayed the instance)
+        if (evt.seq != audio->seq[evt.id]) continue;
+        gs_audio_instance_t* ip = gs_slot_array_getp(audio->instances, evt.id);
+        ip->playing = false;
+        ip->sample_position = 0;
+    }
+}
+
+/* Game thread: queue command for audio thread. Never blocks. */
+void __gs_audio_command_push(gs_audio_t* audio, gs_audio_command_type type, uint32_t id, float value)
+{
+    gs_audio_command_t cmd = gs_default_val();
+    cmd.type = type;
+    cmd.id = id;
+    cmd.seq = ++audio->seq[id];
+    cmd.value = value;
+    if (type == GS_AUDIO_COMMAND_SET_DATA) {
+        cmd.decl = gs_slot_array_get(audio->instances, id);
+        cmd.generation = ++audio->generation[id];
+        gs_audio_source_t* src = gs_slot_array_handle_valid(audio->sources, cmd.decl.src.id) ?
+            gs_slot_array_getp(audio->sources, cmd.decl.src.id) : NULL;
+        if (src) cmd.src = *src;
+        if (src && src->stream_path) cmd.stream = __gs_audio_stream_create(audio, src, &cmd.decl);
+    }
+
+    __gs_audio_flush_overflow(audio);
+    if (gs_dyn_array_empty(audio->command_overflow) && __gs_audio_queue_push(&audio->commands, &cmd)) {
+        return;
+    }
+    gs_dyn_array_push(audio->command_overflow, cmd);
+}
+
+/* Audio thread: voice bookkeeping */
+void __gs_audio_voice_activate(gs_audio_t* audio, uint32_t id)
+{
+    gs_audio_voice_t* v = &audio->voices[id];
+    if (v->active) return;
+    v->active = true;
+    v->active_idx = audio->active_voice_count;
+    audio->active_voices[audio->active_voice_count++] = id;
+}
+
+void __gs_audio_voice_stop(gs_audio_t* audio, uint32_t id, bool32_t release)
+{
+    gs_audio_voice_t* v = &audio->voices[id];
+    v->inst.playing = false;
+    v->inst.sample_position = 0;
+    gs_atomic_store(&v->position, 0);
+
+    if (release) __gs_audio_stream_release(v);
+    else __gs_audio_stream_rewind(v);
+
+    if (release && v->active) {
+        // Swap and pop from active list
+        uint32_t last = audio->active_voices[--audio->active_voice_count];
+        audio->active_voices[v->active_idx] = last;
+        audio->voices[last].active_idx = v->active_idx;
+        v->active = false;
+    }
+
+    // Notifications coalesce per voice. If the event ring is full, retry on following callbacks.
+    v->notify_release |= release;
+    if (!v->notify_pending) {
+        v->notify_pending = true;
+        audio->pending_events[audio->pending_event_count++] = id;
+    }
+}
+
+/* Audio thread: push pending stop/release notifications back to game thread. Never blocks. */
+void __gs_audio_flush_events(gs_audio_t* audio)
+{
+    uint32_t sent = 0;
+    for (; sent < audio->pending_event_count; ++sent)
+    {
+        uint32_t id = audio->pending_events[sent];
+        gs_audio_voice_t* v = &audio->voices[id];
+        gs_audio_event_t evt = gs_default_val();
+        evt.id = id;
+        evt.seq = v->seq;
+        evt.generation = v->generation;
+        evt.released = v->notify_release;
+        if (!__gs_audio_queue_push(&audio->events, &evt)) break;
+        v->notify_pending = false;
+        v->notify_release = false;
+    }
+    if (sent) {
+        memmove(audio->pending_events, audio->pending_events + sent, (audio->pending_event_count - sent) * sizeof(uint32_t));
+        audio->pending_event_count -= sent;
+    }
+}
+
+/* Audio thread: apply all pending commands at start of callback. Never blocks. */
+void __gs_audio_process_commands(gs_audio_t* audio)
+{
+    gs_audio_command_t cmd = gs_default_val();
+    while (__gs_audio_queue_pop(&audio->commands, &cmd))
+    {
+        gs_audio_voice_t* v = &audio->voices[cmd.id];
+
+        if (cmd.type == GS_AUDIO_COMMAND_SET_DATA) {
+            __gs_audio_stream_release(v);
+            v->inst = cmd.decl;
+            v->src = cmd.src;
+            v->stream = cmd.stream;
+            v->stream_pos = 0.0;
+            v->generation = cmd.generation;
+            __gs_audio_voice_activate(audio, cmd.id);
+        }
+
+        // Commands for released voices are stale
+        if (!v->active) continue;
+        v->seq = cmd.seq;
+
+        switch (cmd.type)
+        {
+            case GS_AUDIO_COMMAND_PLAY:       v->inst.playing = true; break;
+            case GS_AUDIO_COMMAND_PAUSE:      v->inst.playing = false; break;
+            case GS_AUDIO_COMMAND_STOP:       v->inst.playing = false; v->inst.sample_position = 0; __gs_audio_stream_rewind(v); break;
+            case GS_AUDIO_COMMAND_RESTART:    v->inst.sample_position = 0; __gs_audio_stream_rewind(v); break;
+            case GS_AUDIO_COMMAND_SET_VOLUME: v->inst.volume = cmd.value; break;
+            case GS_AUDIO_COMMAND_SET_PITCH:  v->inst.pitch = cmd.value; break;
+            default: break;
+        }
+        gs_atomic_store(&v->position, (uint32_t)v->inst.sample_position);
+    }
+}
+
 /* Resource Loading */
 bool32_t gs_audio_load_ogg_data_from_file
 (
@@ -166,14 +924,32 @@ bool32_t gs_audio_load_mp3_data_from_file
 /* Audio create source */
 gs_handle(gs_audio_source_t) gs_audio_load_from_file(const char* file_path)
 {
-    gs_audio_t* audio = gs_subsystem(audio);
     gs_audio_source_t src = gs_default_val();
     gs_handle(gs_audio_source_t) handle = gs_handle_invalid(gs_audio_source_t);
+
+    // Load raw source into memory and return handle id
+    if (gs_audio_decode_from_file(file_path, &src))
+    {
+        gs_println("SUCCESS: Audio source loaded: %s", file_path);
+
+        // Add to resource cache
+        handle = gs_audio_source_create(&src);
+    }
+    else
+    {
+        gs_println("WARNING: Could not load audio source data: %s", file_path);
+    }
+
+    return handle;
+}
+
+bool32_t gs_audio_decode_from_file(const char* file_path, gs_audio_source_t* src)
+{
     bool32_t load_successful = false;
 
     if(!gs_platform_file_exists(file_path)) {
         gs_println("WARNING: Could not open file: %s", file_path);
-        return handle;
+        return false;
     }
 
     char ext[64] = gs_default_val();
@@ -186,10 +962,10 @@ gs_handle(gs_audio_source_t) gs_audio_load_from_file(const char* file_path)
     {
         load_successful = gs_audio_load_ogg_data_from_file (
             file_path, 
-            &src.sample_count, 
-            &src.channels,
-            &src.sample_rate, 
-            &src.samples
+            &src->sample_count, 
+            &src->channels,
+            &src->sample_rate, 
+            &src->samples
         );
     }
 
@@ -199,10 +975,10 @@ gs_handle(gs_audio_source_t) gs_audio_load_from_file(const char* file_path)
         gs_println("Audio: Loading Wav");
         load_successful = gs_audio_load_wav_data_from_file (
             file_path, 
-            &src.sample_count, 
-            &src.channels,
-            &src.sample_rate, 
-            &src.samples
+            &src->sample_count, 
+            &src->channels,
+            &src->sample_rate, 
+            &src->samples
         );
     }
 
@@ -210,26 +986,64 @@ gs_handle(gs_audio_source_t) gs_audio_load_from_file(const char* file_path)
     {
         load_successful = gs_audio_load_mp3_data_from_file (
             file_path, 
-            &src.sample_count, 
-            &src.channels,
-            &src.sample_rate, 
-            &src.samples
+            &src->sample_count, 
+            &src->channels,
+            &src->sample_rate, 
+            &src->samples
         );
     }
 
-    // Load raw source into memory and return handle id
-    if (load_successful)
-    {
-        gs_println("SUCCESS: Audio source loaded: %s", file_path);
+    return load_successful;
+}
 
-        // Add to resource cache
-        handle.id = gs_slot_array_insert(audio->sources, src);
+gs_handle(gs_audio_source_t) gs_audio_source_create(const gs_audio_source_t* src)
+{
+    gs_audio_t* audio = gs_subsystem(audio);
+    gs_handle(gs_audio_source_t) handle = gs_handle_invalid(gs_audio_source_t);
+    handle.id = gs_slot_array_insert(audio->sources, *src);
+    return handle;
+}
+
+gs_handle(gs_audio_source_t) gs_audio_load_stream_from_file(const char* file_path)
+{
+    gs_audio_t* audio = gs_subsystem(audio);
+    gs_audio_source_t src = gs_default_val();
+    gs_handle(gs_audio_source_t) handle = gs_handle_invalid(gs_audio_source_t);
+
+    if(!gs_platform_file_exists(file_path)) {
+        gs_println("WARNING: Could not open file: %s", file_path);
+        return handle;
     }
-    else
-    {
-        gs_println("WARNING: Could not load audio source data: %s", file_path);
+
+    char ext[64] = gs_default_val();
+    gs_platform_file_extension(ext, sizeof(ext), file_path);
+    gs_util_str_to_lower(ext, ext, sizeof(ext));
+
+    if      (gs_string_compare_equal(ext, "ogg")) src.file_type = GS_OGG;
+    else if (gs_string_compare_equal(ext, "wav")) src.file_type = GS_WAV;
+    else if (gs_string_compare_equal(ext, "mp3")) src.file_type = GS_MP3;
+    else {
+        gs_println("WARNING: Unsupported audio stream format: %s", file_path);
+        return handle;
+    }
+
+    // Only read header info here, data is decoded per instance while playing
+    __gs_audio_decoder_t d = gs_default_val();
+    uint64_t frames = 0;
+    if (!__gs_audio_decoder_open(&d, src.file_type, file_path, &src.channels, &src.sample_rate, &frames)) {
+        gs_println("WARNING: Could not load audio stream: %s", file_path);
+        return handle;
     }
+    if (src.file_type == GS_MP3) frames = drmp3_get_pcm_frame_count(&d.mp3);
+    __gs_audio_decoder_close(&d, src.file_type);
+
+    size_t len = gs_string_length(file_path) + 1;
+    src.stream_path = (char*)gs_malloc(len);
+    memcpy(src.stream_path, file_path, len);
+    src.sample_count = (int32_t)(frames * src.channels);
 
+    gs_println("SUCCESS: Audio stream loaded: %s", file_path);
+    handle.id = gs_slot_array_insert(audio->sources, src);
     return handle;
 }
 
@@ -237,9 +1051,14 @@ gs_handle(gs_audio_source_t) gs_audio_load_from_file(const char* file_path)
 gs_handle(gs_audio_instance_t) gs_audio_instance_create(gs_audio_instance_decl_t* decl)
 {
     gs_audio_t* audio = gs_subsystem(audio);
-    gs_audio_mutex_lock(audio);
+    __gs_audio_sync(audio);
     gs_handle(gs_audio_instance_t) hndl = gs_handle_create(gs_audio_instance_t, gs_slot_array_insert(audio->instances, *decl));
-    gs_audio_mutex_unlock(audio);
+    if (hndl.id >= GS_AUDIO_MAX_VOICES) {
+        gs_println("WARNING: Audio instance limit reached (%zu)", (size_t)GS_AUDIO_MAX_VOICES);
+        gs_slot_array_erase(audio->instances, hndl.id);
+        return gs_handle_invalid(gs_audio_instance_t);
+    }
+    __gs_audio_command_push(audio, GS_AUDIO_COMMAND_SET_DATA, hndl.id, 0.f);
     return hndl;
 }
 
@@ -269,75 +1088,84 @@ void gs_audio_play_source(gs_handle(gs_audio_source_t) src, float volume)
 #define __gs_audio_src_valid(SRC)\
     gs_slot_array_handle_valid(gs_subsystem(audio)->sources, SRC.id)
 
+// All instance state below is the game thread's copy. Changes are mirrored to the audio thread via the command queue.
+
 void gs_audio_play(gs_handle(gs_audio_instance_t) inst)
 {
     gs_audio_t* audio = gs_subsystem(audio);
-    gs_audio_mutex_lock(audio);
+    __gs_audio_sync(audio);
     if (__gs_audio_inst_valid(inst)) {
         gs_slot_array_getp(audio->instances, inst.id)->playing = true;
+        __gs_audio_command_push(audio, GS_AUDIO_COMMAND_PLAY, inst.id, 0.f);
     }
-    gs_audio_mutex_unlock(audio);
 }
 
 void gs_audio_pause(gs_handle(gs_audio_instance_t) inst)
 {
     gs_audio_t* audio = gs_subsystem(audio);
-    gs_audio_mutex_lock(audio);
+    __gs_audio_sync(audio);
     if (__gs_audio_inst_valid(inst)) 
     {
         gs_slot_array_getp(audio->instances, inst.id)->playing = false;
+        __gs_audio_command_push(audio, GS_AUDIO_COMMAND_PAUSE, inst.id, 0.f);
     }
-    gs_audio_mutex_unlock(audio);
 }
 
 void gs_audio_stop(gs_handle(gs_audio_instance_t) inst)
 {
     gs_audio_t* audio = gs_subsystem(audio);
-    gs_audio_mutex_lock(audio);
+    __gs_audio_sync(audio);
     if (__gs_audio_inst_valid(inst)) {
         gs_audio_instance_t* ip = gs_slot_array_getp(audio->instances, inst.id);
         ip->playing = false;
         ip->sample_position = 0;
+        __gs_audio_command_push(audio, GS_AUDIO_COMMAND_STOP, inst.id, 0.f);
     }
-    gs_audio_mutex_unlock(audio);
 }
 
 void gs_audio_restart(gs_handle(gs_audio_instance_t) inst)
 {
     gs_audio_t* audio = gs_subsystem(audio);
-    gs_audio_mutex_lock(audio);
+    __gs_audio_sync(audio);
     if (__gs_audio_inst_valid(inst)) 
     {
         gs_slot_array_getp(audio->instances, inst.id)->sample_position = 0;
+        __gs_audio_command_push(audio, GS_AUDIO_COMMAND_RESTART, inst.id, 0.f);
     }
-    gs_audio_mutex_unlock(audio);
 }
 
 bool32_t gs_audio_is_playing(gs_handle(gs_audio_instance_t) inst)
 {
     bool32_t playing = false;
     gs_audio_t* audio = gs_subsystem(audio);
-    gs_audio_mutex_lock(audio);
+    __gs_audio_sync(audio);
     if (__gs_audio_inst_valid(inst)) 
     {
         playing = gs_slot_array_getp(audio->instances, inst.id)->playing;
     }
-    gs_audio_mutex_unlock(audio);
     return playing;
 }
 
 /* Audio instance data */
 void gs_audio_set_instance_data(gs_handle(gs_audio_instance_t) inst, gs_audio_instance_decl_t decl)
 {
+    gs_audio_t* audio = gs_subsystem(audio);
+    __gs_audio_sync(audio);
     if (__gs_audio_inst_valid(inst)) {
-        *gs_slot_array_getp(gs_subsystem(audio)->instances, inst.id) = decl;
+        *gs_slot_array_getp(audio->instances, inst.id) = decl;
+        __gs_audio_command_push(audio, GS_AUDIO_COMMAND_SET_DATA, inst.id, 0.f);
     }
 }
 
 gs_audio_instance_decl_t gs_audio_get_instance_data(gs_handle(gs_audio_instance_t) inst)
 {
+    gs_audio_t* audio = gs_subsystem(audio);
+    __gs_audio_sync(audio);
     if (__gs_audio_inst_valid(inst)) {
-        return gs_slot_array_get(gs_subsystem(audio)->instances, inst.id);
+        gs_audio_instance_decl_t decl = gs_slot_array_get(audio->instances, inst.id);
+        // Playback position is only advanced by the audio thread, which publishes it after each render (may be a callback behind)
+        decl.sample_position = (double)gs_atomic_load(&audio->voices[inst.id].position);
+        return decl;
     }
     gs_audio_instance_decl_t decl = gs_default_val();
     return decl;
@@ -353,8 +1181,30 @@ float gs_audio_get_volume(gs_handle(gs_audio_instance_t) inst)
 
 void gs_audio_set_volume(gs_handle(gs_audio_instance_t) inst, float volume)
 {
+    gs_audio_t* audio = gs_subsystem(audio);
+    __gs_audio_sync(audio);
+    if (__gs_audio_inst_valid(inst)) {
+        gs_slot_array_getp(audio->instances, inst.id)->volume = volume;
+        __gs_audio_command_push(audio, GS_AUDIO_COMMAND_SET_VOLUME, inst.id, volume);
+    }
+}
+
+float gs_audio_get_pitch(gs_handle(gs_audio_instance_t) inst)
+{
+    if (__gs_audio_inst_valid(inst)) {
+        return gs_slot_array_getp(gs_subsystem(audio)->instances, inst.id)->pitch;
+    }
+    return 0.f;
+}
+
+void gs_audio_set_pitch(gs_handle(gs_audio_instance_t) inst, float pitch)
+{
+    gs_audio_t* audio = gs_subsystem(audio);
+    __gs_audio_sync(audio);
     if (__gs_audio_inst_valid(inst)) {
-        gs_slot_array_getp(gs_subsystem(audio)->instances, inst.id)->volume = volume;
+        pitch = gs_max(pitch, 0.f);
+        gs_slot_array_getp(audio->instances, inst.id)->pitch = pitch;
+        __gs_audio_command_push(audio, GS_AUDIO_COMMAND_SET_PITCH, inst.id, pitch);
     }
 }
 
@@ -432,6 +1282,81 @@ int32_t gs_audio_get_num_channels(gs_handle(gs_audio_source_t) src)
     return 0;
 }
 
+/* Mixing */
+void gs_audio_mix(gs_audio_t* audio, int16_t* output, uint32_t sample_rate, uint32_t frame_count)
+{
+    if (!audio->voices) 
+        return;
+
+    // Apply everything queued by the game thread since last mix. Audio thread never takes a lock.
+    __gs_audio_process_commands(audio);
+
+    // Call user commit function (writes straight into output, which seeds the bus below)
+    if (audio->commit)
+    {
+        audio->commit(output, 2, sample_rate, frame_count);
+    } 
+
+    gs_audio_mixer_t* mixer = &audio->mixer;
+    uint32_t quality = gs_atomic_load(&mixer->quality);
+
+    for (uint32_t chunk = 0; chunk < frame_count; chunk += GS_AUDIO_MIX_CHUNK_FRAMES)
+    {
+        uint32_t frames = gs_min(frame_count - chunk, GS_AUDIO_MIX_CHUNK_FRAMES);
+        s16* out = output + chunk * 2;
+        float* bus = mixer->bus;
+
+        if (audio->commit) {
+            for (uint32_t i = 0; i < frames * 2; ++i) bus[i] = (float)out[i] * (1.f / 32768.f);
+        } else {
+            memset(bus, 0, frames * 2 * sizeof(float));
+        }
+
+        // Iterate backwards, since released voices are swapped out of the active list
+        for (uint32_t a = audio->active_voice_count; a > 0; --a)
+        {
+            uint32_t id = audio->active_voices[a - 1];
+            gs_audio_voice_t* voice = &audio->voices[id];
+            gs_audio_instance_t* inst = &voice->inst;
+
+            // Easy out if the instance is not playing currently or the source is invalid
+            if ((!voice->src.samples && !voice->stream) || !voice->src.channels || (!inst->playing && !inst->persistent)) {
+                __gs_audio_voice_stop(audio, id, true);
+                continue;
+            }
+            if (!inst->playing) continue;
+
+            bool32_t finished = false;
+            uint32_t written = voice->stream ? 
+                __gs_audio_stream_render(mixer, voice, mixer->scratch, frames, sample_rate, quality, &finished) :
+                __gs_audio_voice_render(mixer, voice, mixer->scratch, frames, sample_rate, quality, &finished);
+            __gs_audio_mix_f32(bus, mixer->scratch, inst->volume, written * 2);
+            gs_atomic_store(&voice->position, (uint32_t)inst->sample_position);
+
+            // Finished, release non-persistent instances and let game thread know
+            if (finished) {
+                __gs_audio_voice_stop(audio, id, !inst->persistent);
+            }
+        }
+
+        __gs_audio_bus_to_s16(bus, out, frames * 2);
+    }
+
+    // Notify game thread of stopped/released instances
+    __gs_audio_flush_events(audio);
+}
+
+void gs_audio_update(gs_audio_t* audio)
+{
+    if (!audio) return;
+    __gs_audio_sync(audio);
+
+    // No decode thread on this backend, keep streams topped up from the game thread. Mixer only reads the rings.
+    if (!audio->stream_thread && (audio->streams || audio->stream_pending)) {
+        __gs_audio_stream_update(audio);
+    }
+}
+
 #undef GS_AUDIO_IMPL_DEFAULT
 #endif // GS_AUDIO_IMPL_DEFAULT
 
@@ -450,6 +1375,8 @@ typedef struct miniaudio_data_t
     ma_device device;
     ma_device_config device_config;
     ma_mutex lock;
+    ma_thread stream_thread;
+    volatile uint32_t stream_running;
 } miniaudio_data_t;
 
 void gs_audio_mutex_lock(gs_audio_t* audio)
@@ -469,140 +1396,38 @@ void ma_audio_commit(ma_device* device, void* output, const void* input, ma_uint
     gs_audio_t* audio = gs_subsystem(audio);
     miniaudio_data_t* ma = (miniaudio_data_t*)audio->user_data;
     memset(output, 0, frame_count * device->playback.channels * ma_get_bytes_per_sample(device->playback.format));
+    gs_audio_mix(audio, (int16_t*)output, ma->device_config.sampleRate, frame_count);
+}
 
-    // Only destroy 32 at a time
-    u32 destroy_count = 0;
-    uint32_t handles_to_destroy[32];
-
-    if (!audio->instances) 
-        return;
-
-
-    // Call user commit function
-    if (audio->commit)
-    {
-        audio->commit((int16_t*)output, 2, ma->device_config.sampleRate, frame_count);
-    } 
-
-    gs_audio_mutex_lock(audio);
-    {
-        for (
-            gs_slot_array_iter it = gs_slot_array_iter_new(audio->instances);
-            gs_slot_array_iter_valid(audio->instances, it);
-            gs_slot_array_iter_advance(audio->instances, it)
-        )
-        {
-            if (!gs_slot_array_handle_valid(audio->instances, it)) {
-                continue;
-            }
-
-            gs_audio_instance_t* inst = gs_slot_array_iter_getp(audio->instances, it);
-
-            // Get raw audio source from instance
-            gs_audio_source_t* src = gs_slot_array_getp(audio->sources, inst->src.id);
-
-            // Easy out if the instance is not playing currently or the source is invalid
-            if (!src || (!inst->playing && !inst->persistent)) {
-                if (destroy_count < gs_array_size(handles_to_destroy))
-                    handles_to_destroy[destroy_count++] = it;
-                continue;
-            }
-            if (!inst->playing) continue;
-
-            s16* sample_out = (s16*)output;
-            s16* samples = (s16*)src->samples;
-
-            u64 samples_to_write = (u64)frame_count;
-            f64 sample_volume = inst->volume;
-
-            // Write to channels
-            for (u64 write_sample = 0; write_sample < samples_to_write; ++write_sample)
-            {
-                s32 channels = src->channels;
-                f64 start_sample_position = inst->sample_position;
-                s16 start_left_sample;
-                s16 start_right_sample;
-
-                // Not sure about this line of code...
-                f64 target_sample_position = start_sample_position + (f64)channels * (f64)inst->pitch;
-
-                if (target_sample_position >= src->sample_count)
-                {
-                    target_sample_position -= src->sample_count;
-                }
-
-                s16 target_left_sample = 0;
-                s16 target_right_sample = 0;
-
-                {
-                    u64 left_idx = (u64)start_sample_position;
-                    if (channels > 1)
-                    {
-                        left_idx &= ~((u64)(0x01));
-                    }
-                    u64 right_idx = left_idx + (channels - 1);
-
-                    s16 first_left_sample = samples[left_idx];
-                    s16 first_right_sample = samples[right_idx];
-                    s16 second_left_sample = samples[left_idx + channels];
-                    s16 second_right_sample = samples[right_idx + channels];
-
-                    start_left_sample = (s16)(first_left_sample + (second_left_sample - first_left_sample) * (start_sample_position / channels - (u64)(start_sample_position / channels)));
-                    start_right_sample = (s16)(first_right_sample + (second_right_sample - first_right_sample) * (start_sample_position / channels - (u64)(start_sample_position / channels)));
-                } 
-
-                s16 left_sample = (s16)((((s64)start_left_sample + (s64)target_left_sample) / 2) * sample_volume);
-                s16 right_sample = (s16)((((s64)start_right_sample + (s64)target_right_sample) / 2) * sample_volume);
-
-                *sample_out++ += left_sample;  // Left
-                *sample_out++ += right_sample; // Right
-
-                // Possibly need fixed sampling instead
-                inst->sample_position = target_sample_position;
-
-                // Loop sound if necessary
-                if(inst->sample_position >= src->sample_count - channels - 1)
-                {
-                    if(inst->loop)
-                    {
-                        // inst->sample_position -= src->sample_count;
-                        inst->sample_position = 0;
-                    }
-                    else
-                    {
-                        // Need to destroy the instance at this point...
-                        inst->playing = false;
-                        inst->sample_position = 0;
-                        if (!inst->persistent && destroy_count < gs_array_size(handles_to_destroy))
-                            handles_to_destroy[destroy_count++] = it;
-                        break;
-                    }
-                }
-            }
-        }
-
-        // Destroy instances
-        for (uint32_t i = 0; i < destroy_count; ++i) {
-            gs_slot_array_erase(audio->instances, handles_to_destroy[i]);
-        }
+static ma_thread_result MA_THREADCALL ma_audio_stream_thread(void* data)
+{
+    gs_audio_t* audio = (gs_audio_t*)data;
+    miniaudio_data_t* ma = (miniaudio_data_t*)audio->user_data;
+    while (gs_atomic_load(&ma->stream_running)) {
+        __gs_audio_stream_update(audio);
+        ma_sleep(5);
     }
-
-    gs_audio_mutex_unlock(audio);
+    return (ma_thread_result)0;
 }
 
-// Change this to fix sized audio instance buffer, then just use that internally.
-// The slot array isn't working across threads.
-// Or copy data over from one thread to another at a guaranteed sync point.
-
 gs_result gs_audio_init(gs_audio_t* audio)
 {
     // Set user data of audio to be miniaudio data
     audio->user_data = gs_malloc_init(miniaudio_data_t);
-    gs_slot_array_reserve(audio->instances, 1024);
+    gs_slot_array_reserve(audio->instances, GS_AUDIO_MAX_VOICES);
     miniaudio_data_t* output = (miniaudio_data_t*)audio->user_data;
 
     ma_result result = gs_default_val();
 
+    // Initialize the mutex, ya dummy (before the device or decode thread can use it)
+    if (ma_mutex_init(&output->lock) != MA_SUCCESS) {
+        gs_assert(false);
+    }
+
+    // Decode thread for streaming sources. Falls back to decoding in gs_audio_update if unavailable.
+    output->stream_running = 1;
+    audio->stream_thread = ma_thread_create(&output->stream_thread, ma_thread_priority_default, 0, ma_audio_stream_thread, audio) == MA_SUCCESS;
+
      // Init audio context
     ma_context_config ctx_config = ma_context_config_init();
 
@@ -653,11 +1478,6 @@ gs_result gs_audio_init(gs_audio_t* audio)
         gs_assert(false);
     }
 
-    // Initialize the mutex, ya dummy
-    if (ma_mutex_init(&output->lock) != MA_SUCCESS) {
-        gs_assert(false);
-    }
-
     return GS_RESULT_SUCCESS;
 }
 
@@ -672,6 +1492,12 @@ gs_result gs_audio_shutdown(gs_audio_t* audio)
 {
     miniaudio_data_t* ma = (miniaudio_data_t*)audio->user_data; 
 
+    if (audio->stream_thread) {
+        gs_atomic_store(&ma->stream_running, 0);
+        ma_thread_wait(&ma->stream_thread);
+        audio->stream_thread = false;
+    }
+
     ma_context_uninit(&ma->context);
     ma_device_uninit(&ma->device);
     ma_mutex_uninit(&ma->lock);
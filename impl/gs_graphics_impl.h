@@ -45,16 +45,50 @@ gs_graphics_info_t* gs_graphics_info()
     return &gs_subsystem(graphics)->info;
 }
 
+/* Graphics Stats Object Query */
+gs_graphics_stats_t* gs_graphics_stats()
+{
+    return &gs_subsystem(graphics)->stats;
+}
+
 #endif
 
-#if (defined GS_GRAPHICS_IMPL_OPENGL_CORE || defined GS_GRAPHICS_IMPL_OPENGL_ES)
+/* Command buffer encoding shared between the OpenGL and null backends */
+#if (defined GS_GRAPHICS_IMPL_OPENGL_CORE || defined GS_GRAPHICS_IMPL_OPENGL_ES || defined GS_GRAPHICS_IMPL_NULL)
 
-#ifdef GS_GRAPHICS_IMPL_OPENGL_CORE
+#if (defined GS_GRAPHICS_IMPL_OPENGL_CORE || defined GS_GRAPHICS_IMPL_NULL)
     #define CHECK_GL_CORE(...) __VA_ARGS__
 #else
     #define CHECK_GL_CORE(...) gs_empty_instruction(void)
 #endif
 
+/* Internal OGL Command Buffer Op Code */
+typedef enum gs_opengl_op_code_type
+{
+    GS_OPENGL_OP_BEGIN_RENDER_PASS = 0x00,
+    GS_OPENGL_OP_END_RENDER_PASS,
+    GS_OPENGL_OP_SET_VIEWPORT,
+    GS_OPENGL_OP_SET_VIEW_SCISSOR,
+    GS_OPENGL_OP_CLEAR,
+    GS_OPENGL_OP_REQUEST_BUFFER_UPDATE,
+    GS_OPENGL_OP_REQUEST_TEXTURE_UPDATE,
+    GS_OPENGL_OP_BIND_PIPELINE,
+    GS_OPENGL_OP_APPLY_BINDINGS,
+    GS_OPENGL_OP_DISPATCH_COMPUTE,
+    GS_OPENGL_OP_DRAW,
+    GS_OPENGL_OP_SORT_KEY,
+} gs_opengl_op_code_type;
+
+// Total size in bytes of data for a uniform handle (defined by each backend)
+size_t __gs_graphics_uniform_data_size(uint32_t id);
+
+// Reorders keyed packets within each render pass by sort key (called at the start of submission)
+void __gs_graphics_command_buffer_sort(gs_command_buffer_t* cb);
+
+#endif
+
+#if (defined GS_GRAPHICS_IMPL_OPENGL_CORE || defined GS_GRAPHICS_IMPL_OPENGL_ES)
+
 typedef enum gsgl_uniform_type
 {
     GSGL_UNIFORMTYPE_FLOAT,
@@ -139,6 +173,10 @@ typedef struct gsgl_vertex_buffer_decl_t {
     size_t offset;
 } gsgl_vertex_buffer_decl_t;
 
+#ifndef GSGL_TEXTURE_UNIT_MAX
+    #define GSGL_TEXTURE_UNIT_MAX 32
+#endif
+
 /* Cached data between draws */
 typedef struct gsgl_data_cache_t
 {
@@ -147,6 +185,13 @@ typedef struct gsgl_data_cache_t
     size_t ibo_elem_sz;
     gs_dyn_array(gsgl_vertex_buffer_decl_t) vdecls;
     gs_handle(gs_graphics_pipeline_t) pipeline;
+
+    // Bound gl state, used to filter redundant calls (UINT32_MAX when unknown)
+    uint32_t bound_pipeline;                                // Pipeline whose state is currently applied
+    uint32_t bound_ibo;                                     // Buffer bound to GL_ELEMENT_ARRAY_BUFFER
+    uint32_t attrib_pipeline;                               // Pipeline vertex attributes were last set up for
+    gs_dyn_array(gsgl_vertex_buffer_decl_t) attrib_vdecls;  // Vertex buffers vertex attributes were last set up with
+    uint32_t texture_units[GSGL_TEXTURE_UNIT_MAX];          // Texture bound to each unit
 } gsgl_data_cache_t;
 
 /* Internal Opengl Data */
@@ -177,23 +222,10 @@ typedef struct gsgl_data_t
     // Cached data between draw calls (to minimize state changes)
     gsgl_data_cache_t cache;
 
-} gsgl_data_t;
+    // Hash of data last uploaded to each (shader, uniform location)
+    gs_hash_table(uint64_t, uint64_t) uniform_hashes;
 
-/* Internal OGL Command Buffer Op Code */
-typedef enum gs_opengl_op_code_type
-{
-    GS_OPENGL_OP_BEGIN_RENDER_PASS = 0x00,
-    GS_OPENGL_OP_END_RENDER_PASS,
-    GS_OPENGL_OP_SET_VIEWPORT,
-    GS_OPENGL_OP_SET_VIEW_SCISSOR,
-    GS_OPENGL_OP_CLEAR,
-    GS_OPENGL_OP_REQUEST_BUFFER_UPDATE,
-    GS_OPENGL_OP_REQUEST_TEXTURE_UPDATE,
-    GS_OPENGL_OP_BIND_PIPELINE,
-    GS_OPENGL_OP_APPLY_BINDINGS,
-    GS_OPENGL_OP_DISPATCH_COMPUTE,
-    GS_OPENGL_OP_DRAW,
-} gs_opengl_op_code_type;
+} gsgl_data_t;
 
 void gsgl_reset_data_cache(gsgl_data_cache_t* cache)
 {
@@ -203,6 +235,29 @@ void gsgl_reset_data_cache(gsgl_data_cache_t* cache)
     gs_dyn_array_clear(cache->vdecls);
 }
 
+// Forget all bound gl state tracked for filtering (whenever state may have changed outside of the filter)
+void gsgl_reset_state_filter(gsgl_data_t* ogl)
+{
+    ogl->cache.bound_pipeline = UINT32_MAX;
+    ogl->cache.bound_ibo = UINT32_MAX;
+    ogl->cache.attrib_pipeline = UINT32_MAX;
+    memset(ogl->cache.texture_units, 0xff, sizeof(ogl->cache.texture_units));
+    gs_hash_table_clear(ogl->uniform_hashes);
+}
+
+// Number of gl calls issued by binding a pipeline (used to count calls saved by filtering)
+uint32_t gsgl_pipeline_bind_call_count(gsgl_pipeline_t* pip)
+{
+    uint32_t ct = 8;                                                    // Buffer, texture and state resets
+    CHECK_GL_CORE(ct += 2 + (gs_graphics_info()->compute.available ? 1 : 0););
+    if (pip->compute.shader.id) return ct + 1;                          // Program
+    ct += (pip->depth.func ? 2 : 1) + 1;                                // Depth test, func, mask
+    ct += pip->stencil.func ? 4 : 1;                                    // Stencil test, func, mask, op
+    ct += pip->blend.func ? 3 : 1;                                      // Blend, equation, func
+    ct += (pip->raster.face_culling ? 2 : 1) + 1;                       // Culling, front face
+    return ct + 1;                                                      // Program
+}
+
 void gsgl_pipeline_state()
 {
     glBindBuffer(GL_ARRAY_BUFFER, 0);
@@ -226,6 +281,11 @@ void gsgl_pipeline_state()
             glBindImageTexture(0, 0, 0, GL_FALSE, 0, GL_READ_WRITE, GL_RGBA32F);
         }
     )
+
+    // Element buffer now unbound, textures unbound from the active unit
+    gsgl_data_t* ogl = (gsgl_data_t*)gs_subsystem(graphics)->user_data;
+    ogl->cache.bound_ibo = 0;
+    memset(ogl->cache.texture_units, 0xff, sizeof(ogl->cache.texture_units));
 }
 
 void GLAPIENTRY
@@ -547,6 +607,10 @@ size_t gsgl_get_byte_size_of_vertex_attribute(gs_graphics_vertex_attribute_type
         case GS_GRAPHICS_VERTEX_ATTRIBUTE_BYTE3:    { byte_size = sizeof(uint8_t) * 3; } break;
         case GS_GRAPHICS_VERTEX_ATTRIBUTE_BYTE2:    { byte_size = sizeof(uint8_t) * 2; } break;
         case GS_GRAPHICS_VERTEX_ATTRIBUTE_BYTE:     { byte_size = sizeof(uint8_t) * 1; } break;
+        case GS_GRAPHICS_VERTEX_ATTRIBUTE_HALF4:    { byte_size = sizeof(uint16_t) * 4; } break;
+        case GS_GRAPHICS_VERTEX_ATTRIBUTE_HALF2:    { byte_size = sizeof(uint16_t) * 2; } break;
+        case GS_GRAPHICS_VERTEX_ATTRIBUTE_SHORT2N:  { byte_size = sizeof(int16_t) * 2; } break;
+        case GS_GRAPHICS_VERTEX_ATTRIBUTE_USHORT2N: { byte_size = sizeof(uint16_t) * 2; } break;
     } 
 
     return byte_size;
@@ -672,6 +736,8 @@ gs_graphics_destroy(gs_graphics_t* graphics)
 
     // Free data cache
     gs_dyn_array_free(ogl->cache.vdecls);
+    gs_dyn_array_free(ogl->cache.attrib_vdecls);
+    gs_hash_table_free(ogl->uniform_hashes);
 
     gs_free(graphics);
     graphics = NULL;
@@ -693,6 +759,9 @@ gsgl_texture_t gl_texture_update_internal(const gs_graphics_texture_desc_t* desc
     uint32_t height = desc->height;
     void* data = NULL;
 
+    // Updates that fit the existing storage are sub-image writes at desc->offset
+    const bool32_t alloc = tex.desc.width * tex.desc.height < width * height;
+
     if (!hndl)
     {
         glGenTextures(1, &tex.id);
@@ -725,7 +794,7 @@ gsgl_texture_t gl_texture_update_internal(const gs_graphics_texture_desc_t* desc
             case GS_GRAPHICS_TEXTURE_CUBEMAP:   {itarget = GL_TEXTURE_CUBE_MAP_POSITIVE_X + i;} break;
         }
 
-        if (tex.desc.width * tex.desc.height < width * height)
+        if (alloc)
         {
             // Construct texture based on appropriate format
             switch(desc->format) 
@@ -821,8 +890,8 @@ gsgl_texture_t gl_texture_update_internal(const gs_graphics_texture_desc_t* desc
     glBindTexture(target, 0);
     glBindRenderbuffer(GL_RENDERBUFFER, 0);
 
-    // Set description
-    tex.desc = *desc;
+    // Set description, keeping the allocated size across sub-image updates
+    if (alloc) tex.desc = *desc;
 
     // Add texture to internal resource pool and return handle
     return tex;
@@ -1050,6 +1119,30 @@ gs_graphics_shader_create_impl(const gs_graphics_shader_desc_t* desc)
     shader = glCreateProgram();
 
     uint32_t ct = (uint32_t)desc->size / (uint32_t)sizeof(gs_graphics_shader_source_desc_t);
+
+    // Previously linked binary, rejected when the driver or GPU changed (compile sources instead, if any)
+    const bool32 program_binary = gs_subsystem(graphics)->info.program_binary;
+    if (desc->binary && desc->binary_size && program_binary)
+    {
+        GLint linked = 0;
+        glProgramBinary(shader, (GLenum)desc->binary_format, desc->binary, (GLsizei)desc->binary_size);
+        glGetProgramiv(shader, GL_LINK_STATUS, &linked);
+        if (linked) {
+            return (gs_handle_create(gs_graphics_shader_t, gs_slot_array_insert(ogl->shaders, shader)));
+        }
+
+        glDeleteProgram(shader);
+        if (!ct) {
+            return gs_handle_invalid(gs_graphics_shader_t);
+        }
+        shader = glCreateProgram();
+    }
+
+    // Keep the linked program retrievable through gs_graphics_shader_get_binary
+    if (program_binary) {
+        glProgramParameteri(shader, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    }
+
     for (uint32_t i = 0; i < ct; ++i) 
     {
         if (desc->sources[i].type == GS_GRAPHICS_SHADER_STAGE_VERTEX) pip |= GSGL_GRAPHICS_SHADER_PIPELINE_GFX;
@@ -1164,6 +1257,30 @@ gs_graphics_shader_create_impl(const gs_graphics_shader_desc_t* desc)
     return (gs_handle_create(gs_graphics_shader_t, gs_slot_array_insert(ogl->shaders, shader)));
 }
 
+GS_API_DECL size_t
+gs_graphics_shader_get_binary_impl(gs_handle(gs_graphics_shader_t) hndl, void* out, size_t sz, uint32_t* format)
+{
+    gsgl_data_t* ogl = (gsgl_data_t*)gs_subsystem(graphics)->user_data;
+    if (!gs_subsystem(graphics)->info.program_binary || !gs_slot_array_handle_valid(ogl->shaders, hndl.id)) {
+        return 0;
+    }
+
+    gsgl_shader_t shader = gs_slot_array_get(ogl->shaders, hndl.id);
+    GLint len = 0;
+    glGetProgramiv(shader, GL_PROGRAM_BINARY_LENGTH, &len);
+    if (len <= 0) {
+        return 0;
+    }
+    if (!out || sz < (size_t)len) {
+        return (size_t)len;
+    }
+
+    GLenum fmt = 0;
+    glGetProgramBinary(shader, (GLsizei)sz, &len, &fmt, out);
+    if (format) *format = (uint32_t)fmt;
+    return (size_t)len;
+}
+
 GS_API_DECL gs_handle(gs_graphics_renderpass_t) 
 gs_graphics_renderpass_create_impl(const gs_graphics_renderpass_desc_t* desc)
 {
@@ -1380,6 +1497,12 @@ gs_graphics_uniform_size_query(gs_handle(gs_graphics_uniform_t) hndl)
     return u->uniforms[0].size;
 }
 
+size_t __gs_graphics_uniform_data_size(uint32_t id)
+{
+    gsgl_data_t* ogl = (gsgl_data_t*)gs_subsystem(graphics)->user_data; 
+    return gs_slot_array_getp(ogl->uniforms, id)->size;
+}
+
 // Resource Updates (main thread only) 
 GS_API_DECL void 
 gs_graphics_texture_update_impl(gs_handle(gs_graphics_texture_t) hndl, gs_graphics_texture_desc_t* desc)
@@ -1392,7 +1515,7 @@ gs_graphics_texture_update_impl(gs_handle(gs_graphics_texture_t) hndl, gs_graphi
         gs_log_warning("Texture handle invalid: %zu", hndl.id);
         return;
     }
-    gl_texture_update_internal(desc, hndl.id);
+    gs_slot_array_get(ogl->textures, hndl.id) = gl_texture_update_internal(desc, hndl.id);
 }
 
 GS_API_DECL void 
@@ -1611,368 +1734,83 @@ gs_storage_buffer_get_data_impl(gs_handle(gs_graphics_storage_buffer_t) hndl, si
     glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
 }
 
-#define __ogl_push_command(CB, OP_CODE, ...)\
-do {\
-    gsgl_data_t* DATA = (gsgl_data_t*)gs_subsystem(graphics)->user_data;\
-    gs_byte_buffer_write(&CB->commands, u32, (u32)OP_CODE);\
-    __VA_ARGS__\
-    CB->num_commands++;\
-} while (0)
-
-/* Command Buffer Ops: Pipeline / Pass / Bind / Draw */
-GS_API_DECL void 
-gs_graphics_renderpass_begin(gs_command_buffer_t* cb, gs_handle(gs_graphics_renderpass_t) hndl)
-{
-    __ogl_push_command(cb, GS_OPENGL_OP_BEGIN_RENDER_PASS, {
-        gs_byte_buffer_write(&cb->commands, uint32_t, hndl.id);
-    });
-}
-
-GS_API_DECL void 
-gs_graphics_renderpass_end(gs_command_buffer_t* cb)
+/* Submission (Main Thread) */
+void gs_graphics_command_buffer_submit_impl(gs_command_buffer_t* cb)
 {
-    __ogl_push_command(cb, GS_OPENGL_OP_END_RENDER_PASS, {
-        // Nothing...
-    });
-}
+    /*
+        // Structure of command: 
+            - Op code
+            - Data packet
+    */
 
-GS_API_DECL void 
-gs_graphics_clear(gs_command_buffer_t* cb, gs_graphics_clear_desc_t* desc)
-{
-    __ogl_push_command(cb, GS_OPENGL_OP_CLEAR, {
-        uint32_t count = !desc->actions ? 0 : !desc->size ? 1 : (uint32_t)((size_t)desc->size / (size_t)sizeof(gs_graphics_clear_action_t));
-        gs_byte_buffer_write(&cb->commands, uint32_t, count);
-        for (uint32_t i = 0; i < count; ++i) {
-            gs_byte_buffer_write(&cb->commands, gs_graphics_clear_action_t, desc->actions[i]);
-        }
-    });
-}
+    gsgl_data_t* ogl = (gsgl_data_t*)gs_subsystem(graphics)->user_data;
+    gs_graphics_stats_t* stats = &gs_subsystem(graphics)->stats;
 
-GS_API_DECL void 
-gs_graphics_set_viewport(gs_command_buffer_t* cb, uint32_t x, uint32_t y, uint32_t w, uint32_t h)
-{
-    __ogl_push_command(cb, GS_OPENGL_OP_SET_VIEWPORT, {
-        gs_byte_buffer_write(&cb->commands, uint32_t, x);
-        gs_byte_buffer_write(&cb->commands, uint32_t, y);
-        gs_byte_buffer_write(&cb->commands, uint32_t, w);
-        gs_byte_buffer_write(&cb->commands, uint32_t, h);
-    });
-}
+    // Reorder keyed packets (if any were recorded)
+    __gs_graphics_command_buffer_sort(cb);
 
-GS_API_DECL void 
-gs_graphics_set_view_scissor(gs_command_buffer_t* cb, uint32_t x, uint32_t y, uint32_t w, uint32_t h)
-{ 
-    __ogl_push_command(cb, GS_OPENGL_OP_SET_VIEW_SCISSOR, {
-        gs_byte_buffer_write(&cb->commands, uint32_t, x);
-        gs_byte_buffer_write(&cb->commands, uint32_t, y);
-        gs_byte_buffer_write(&cb->commands, uint32_t, w);
-        gs_byte_buffer_write(&cb->commands, uint32_t, h);
-    }); 
-}
+    // Gl state could have been changed by anything since the last submission
+    gsgl_reset_state_filter(ogl);
 
-GS_API_DECL void 
-gs_graphics_texture_request_update(gs_command_buffer_t* cb, gs_handle(gs_graphics_texture_t) hndl, gs_graphics_texture_desc_t* desc)
-{
-    // Write command
-    gs_byte_buffer_write(&cb->commands, uint32_t, (uint32_t)GS_OPENGL_OP_REQUEST_TEXTURE_UPDATE);
-    cb->num_commands++;
+    // Set read position of buffer to beginning
+    gs_byte_buffer_seek_to_beg(&cb->commands);
 
-    uint32_t num_comps = 0;
-    size_t data_type_size = 0;
-    size_t total_size = 0;
-    switch(desc->format) 
+    // For each command in buffer
+    gs_for_range(cb->num_commands)
     {
-        default:
-        case GS_GRAPHICS_TEXTURE_FORMAT_RGBA8:              num_comps = 4; data_type_size = sizeof(uint8_t); break;
-        case GS_GRAPHICS_TEXTURE_FORMAT_RGB8:               num_comps = 3; data_type_size = sizeof(uint8_t); break;
-        case GS_GRAPHICS_TEXTURE_FORMAT_A8:                 num_comps = 1; data_type_size = sizeof(uint8_t); break;
-        case GS_GRAPHICS_TEXTURE_FORMAT_R8:                 num_comps = 1; data_type_size = sizeof(uint8_t); break;
-        case GS_GRAPHICS_TEXTURE_FORMAT_R32UI:              num_comps = 1; data_type_size = sizeof(uint32_t); break;
-        case GS_GRAPHICS_TEXTURE_FORMAT_R16UI:              num_comps = 1; data_type_size = sizeof(uint16_t); break;
-        case GS_GRAPHICS_TEXTURE_FORMAT_RGBA16F:            num_comps = 4; data_type_size = sizeof(float); break;
-        case GS_GRAPHICS_TEXTURE_FORMAT_RGBA32F:            num_comps = 4; data_type_size = sizeof(float); break;
-        case GS_GRAPHICS_TEXTURE_FORMAT_DEPTH8:             num_comps = 1; data_type_size = sizeof(float); break;
-        case GS_GRAPHICS_TEXTURE_FORMAT_DEPTH16:            num_comps = 1; data_type_size = sizeof(float); break;
-        case GS_GRAPHICS_TEXTURE_FORMAT_DEPTH24:            num_comps = 1; data_type_size = sizeof(float); break;
-        case GS_GRAPHICS_TEXTURE_FORMAT_DEPTH32F:           num_comps = 1; data_type_size = sizeof(float); break;
-        case GS_GRAPHICS_TEXTURE_FORMAT_DEPTH24_STENCIL8:   num_comps = 1; data_type_size = sizeof(uint32_t); break;
-        case GS_GRAPHICS_TEXTURE_FORMAT_DEPTH32F_STENCIL8:  num_comps = 1; data_type_size = sizeof(float) + sizeof(uint8_t); break;
+        // Read in op code of command
+        gs_byte_buffer_readc(&cb->commands, gs_opengl_op_code_type, op_code);
+        stats->commands++;
 
-        // NOTE(john): Because Apple is a shit company, I have to section this off and provide support for 4.1 only features.
-        // case GS_GRAPHICS_TEXTURE_FORMAT_STENCIL8:            glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT8, width, height, 0, GL_DEPTH_COMPONENT, GL_FLOAT, data); break;
-    }
-    total_size = desc->width * desc->height * num_comps * data_type_size;
-    gs_byte_buffer_write(&cb->commands, uint32_t, hndl.id);
-    gs_byte_buffer_write(&cb->commands, gs_graphics_texture_desc_t, *desc);
-    gs_byte_buffer_write(&cb->commands, size_t, total_size);
-    gs_byte_buffer_write_bulk(&cb->commands, *desc->data, total_size);
-}
+        switch (op_code)
+        {
+            case GS_OPENGL_OP_BEGIN_RENDER_PASS:
+            {
+                // Bind render pass stuff
+                gs_byte_buffer_readc(&cb->commands, uint32_t, rpid);
+                stats->renderpasses++;
 
-void __gs_graphics_update_buffer_internal(gs_command_buffer_t* cb, 
-    uint32_t id, 
-    gs_graphics_buffer_type type,
-    gs_graphics_buffer_usage_type usage, 
-    size_t sz, 
-    size_t offset, 
-    gs_graphics_buffer_update_type update_type,
-    void* data)
-{
-    // Write command
-    gs_byte_buffer_write(&cb->commands, u32, (u32)GS_OPENGL_OP_REQUEST_BUFFER_UPDATE);
-    cb->num_commands++;
+                // If render pass exists, then we'll bind frame buffer and attachments 
+                if (rpid && gs_slot_array_exists(ogl->renderpasses, rpid)) 
+                {
+                    gsgl_renderpass_t* rp = gs_slot_array_getp(ogl->renderpasses, rpid);
 
-    // Write handle id
-    gs_byte_buffer_write(&cb->commands, uint32_t, id);
-    // Write type
-    gs_byte_buffer_write(&cb->commands, gs_graphics_buffer_type, type);
-    // Write usage
-    gs_byte_buffer_write(&cb->commands, gs_graphics_buffer_usage_type, usage);
-    // Write data size
-    gs_byte_buffer_write(&cb->commands, size_t, sz);
-    // Write data offset
-    gs_byte_buffer_write(&cb->commands, size_t, offset);
-    // Write data update type
-    gs_byte_buffer_write(&cb->commands, gs_graphics_buffer_update_type, update_type);
-    // Write data
-    gs_byte_buffer_write_bulk(&cb->commands, data, sz);
-}
+                    // Bind frame buffer since it actually exists
+                    if (rp->fbo.id && gs_slot_array_exists(ogl->frame_buffers, rp->fbo.id)) 
+                    {
+                        // Bind frame buffer
+                        glBindFramebuffer(GL_FRAMEBUFFER, gs_slot_array_get(ogl->frame_buffers, rp->fbo.id));
 
-GS_API_DECL void 
-gs_graphics_vertex_buffer_request_update(gs_command_buffer_t* cb, gs_handle(gs_graphics_vertex_buffer_t) hndl, gs_graphics_vertex_buffer_desc_t* desc)
-{
-    gsgl_data_t* ogl = (gsgl_data_t*)gs_subsystem(graphics)->user_data;
+                        // Bind color attachments
+                        for (uint32_t r = 0; r < gs_dyn_array_size(rp->color); ++r)
+                        {
+                            uint32_t cid = rp->color[r].id;
+                            if (cid && gs_slot_array_exists(ogl->textures, cid)) 
+                            {
+                                gsgl_texture_t* rt = gs_slot_array_getp(ogl->textures, cid);
 
-    // Return if handle not valid
-    if (!hndl.id) return;
+                                glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + r, GL_TEXTURE_2D, rt->id, 0);
+                            }
+                        }
 
-    __gs_graphics_update_buffer_internal(cb, hndl.id, GS_GRAPHICS_BUFFER_VERTEX, desc->usage, desc->size, desc->update.offset, desc->update.type, desc->data);
-}
-
-GS_API_DECL void 
-gs_graphics_index_buffer_request_update(gs_command_buffer_t* cb, gs_handle(gs_graphics_index_buffer_t) hndl, gs_graphics_index_buffer_desc_t* desc)
-{
-    gsgl_data_t* ogl = (gsgl_data_t*)gs_subsystem(graphics)->user_data;
-
-    // Return if handle not valid
-    if (!hndl.id) return;
-
-    __gs_graphics_update_buffer_internal(cb, hndl.id, GS_GRAPHICS_BUFFER_INDEX, desc->usage, desc->size, desc->update.offset, desc->update.type, desc->data);
-}
-
-GS_API_DECL void 
-gs_graphics_uniform_buffer_request_update(gs_command_buffer_t* cb, gs_handle(gs_graphics_uniform_buffer_t) hndl, gs_graphics_uniform_buffer_desc_t* desc)
-{
-    gsgl_data_t* ogl = (gsgl_data_t*)gs_subsystem(graphics)->user_data;
-
-    // Return if handle not valid
-    if (!hndl.id) return;
-
-    __gs_graphics_update_buffer_internal(cb, hndl.id, GS_GRAPHICS_BUFFER_UNIFORM, desc->usage, desc->size, desc->update.offset, desc->update.type, desc->data);
-}
-
-GS_API_DECL void 
-gs_graphics_storage_buffer_request_update(gs_command_buffer_t* cb, gs_handle(gs_graphics_storage_buffer_t) hndl, gs_graphics_storage_buffer_desc_t* desc)
-{
-    gsgl_data_t* ogl = (gsgl_data_t*)gs_subsystem(graphics)->user_data;
-
-    // Return if handle not valid
-    if (!hndl.id) return;
-
-    __gs_graphics_update_buffer_internal(cb, hndl.id, GS_GRAPHICS_BUFFER_SHADER_STORAGE, desc->usage, desc->size, desc->update.offset, desc->update.type, desc->data);
-}
-
-void gs_graphics_apply_bindings(gs_command_buffer_t* cb, gs_graphics_bind_desc_t* binds)
-{
-    gsgl_data_t* ogl = (gsgl_data_t*)gs_subsystem(graphics)->user_data;
-
-    // Increment commands
-    gs_byte_buffer_write(&cb->commands, u32, (u32)GS_OPENGL_OP_APPLY_BINDINGS);
-    cb->num_commands++;
- 
-    // __ogl_push_command(cb, GS_OPENGL_OP_APPLY_BINDINGS,
-    {
-        // Get counts from buffers
-        uint32_t vct = binds->vertex_buffers.desc ? binds->vertex_buffers.size ? binds->vertex_buffers.size / sizeof(gs_graphics_bind_vertex_buffer_desc_t) : 1 : 0;
-        uint32_t ict = binds->index_buffers.desc ? binds->index_buffers.size ? binds->index_buffers.size / sizeof(gs_graphics_bind_index_buffer_desc_t) : 1 : 0;
-        uint32_t uct = binds->uniform_buffers.desc ? binds->uniform_buffers.size ? binds->uniform_buffers.size / sizeof(gs_graphics_bind_uniform_buffer_desc_t) : 1 : 0;
-        uint32_t pct = binds->uniforms.desc ? binds->uniforms.size ? binds->uniforms.size / sizeof(gs_graphics_bind_uniform_desc_t) : 1 : 0;
-        uint32_t ibc = binds->image_buffers.desc ? binds->image_buffers.size ? binds->image_buffers.size / sizeof(gs_graphics_bind_image_buffer_desc_t) : 1 : 0;
-        uint32_t sbc = binds->storage_buffers.desc ? binds->storage_buffers.size ? binds->storage_buffers.size / sizeof(gs_graphics_bind_storage_buffer_desc_t) : 1 : 0;
-
-        // Determine total count to write into command buffer
-        uint32_t ct = vct + ict + uct + pct + ibc + sbc;
-        gs_byte_buffer_write(&cb->commands, uint32_t, ct);
-
-        // Determine if need to clear any previous vertex buffers (if vct != 0)
-        gs_byte_buffer_write(&cb->commands, bool, (vct != 0));
-
-        // Vertex buffers
-        for (uint32_t i = 0; i < vct; ++i)
-        {
-            gs_graphics_bind_vertex_buffer_desc_t* decl = &binds->vertex_buffers.desc[i];
-            gs_byte_buffer_write(&cb->commands, gs_graphics_bind_type, GS_GRAPHICS_BIND_VERTEX_BUFFER);
-            gs_byte_buffer_write(&cb->commands, uint32_t, decl->buffer.id);
-            gs_byte_buffer_write(&cb->commands, size_t, decl->offset);
-            gs_byte_buffer_write(&cb->commands, gs_graphics_vertex_data_type, decl->data_type);
-        }
-
-        // Index buffers
-        for (uint32_t i = 0; i < ict; ++i)
-        {
-            gs_graphics_bind_index_buffer_desc_t* decl = &binds->index_buffers.desc[i];
-            gs_byte_buffer_write(&cb->commands, gs_graphics_bind_type, GS_GRAPHICS_BIND_INDEX_BUFFER);
-            gs_byte_buffer_write(&cb->commands, uint32_t, decl->buffer.id);
-        }
-
-        // Uniform buffers
-        for (uint32_t i = 0; i < uct; ++i)
-        {
-            gs_graphics_bind_uniform_buffer_desc_t* decl = &binds->uniform_buffers.desc[i];
-
-            uint32_t id = decl->buffer.id;
-            size_t sz = (size_t)(gs_slot_array_getp(ogl->uniform_buffers, id))->size;
-            gs_byte_buffer_write(&cb->commands, gs_graphics_bind_type, GS_GRAPHICS_BIND_UNIFORM_BUFFER);
-            gs_byte_buffer_write(&cb->commands, uint32_t, decl->buffer.id);
-            gs_byte_buffer_write(&cb->commands, uint32_t, decl->binding);
-            gs_byte_buffer_write(&cb->commands, size_t, decl->range.offset);
-            gs_byte_buffer_write(&cb->commands, size_t, decl->range.size);
-        }
-
-        // Image buffers
-        for (uint32_t i = 0; i < ibc; ++i)
-        {
-            gs_graphics_bind_image_buffer_desc_t* decl = &binds->image_buffers.desc[i];
-            gs_byte_buffer_write(&cb->commands, gs_graphics_bind_type, GS_GRAPHICS_BIND_IMAGE_BUFFER);
-            gs_byte_buffer_write(&cb->commands, uint32_t, decl->tex.id);
-            gs_byte_buffer_write(&cb->commands, uint32_t, decl->binding);
-            gs_byte_buffer_write(&cb->commands, gs_graphics_access_type, decl->access);
-        }
-
-        // Uniforms
-        for (uint32_t i = 0; i < pct; ++i)
-        {
-            gs_graphics_bind_uniform_desc_t* decl = &binds->uniforms.desc[i];
-
-            // Get size from uniform list
-            size_t sz = gs_slot_array_getp(ogl->uniforms, decl->uniform.id)->size;
-            gs_byte_buffer_write(&cb->commands, gs_graphics_bind_type, GS_GRAPHICS_BIND_UNIFORM);
-            gs_byte_buffer_write(&cb->commands, uint32_t, decl->uniform.id);
-            gs_byte_buffer_write(&cb->commands, size_t, sz);
-            gs_byte_buffer_write(&cb->commands, uint32_t, decl->binding);
-            gs_byte_buffer_write_bulk(&cb->commands, decl->data, sz);
-        }
-
-        // Storage buffers
-        CHECK_GL_CORE(
-            for (uint32_t i = 0; i < sbc; ++i)
-            {
-                gs_graphics_bind_storage_buffer_desc_t* decl = &binds->storage_buffers.desc[i];
-                gs_byte_buffer_write(&cb->commands, gs_graphics_bind_type, GS_GRAPHICS_BIND_STORAGE_BUFFER);
-                gs_byte_buffer_write(&cb->commands, uint32_t, decl->buffer.id);
-                gs_byte_buffer_write(&cb->commands, uint32_t, decl->binding);
-                gs_byte_buffer_write(&cb->commands, size_t, decl->range.offset);
-                gs_byte_buffer_write(&cb->commands, size_t, decl->range.size);
-            }
-        );
-    };
-}
-
-void gs_graphics_pipeline_bind(gs_command_buffer_t* cb, gs_handle(gs_graphics_pipeline_t) hndl)
-{
-    // NOTE(john): Not sure if this is safe in the future, since the data for pipelines is on the main thread and MIGHT be tampered with on a separate thread.
-    __ogl_push_command(cb, GS_OPENGL_OP_BIND_PIPELINE, {
-        gs_byte_buffer_write(&cb->commands, uint32_t, hndl.id);
-    });
-}
-
-void gs_graphics_draw(gs_command_buffer_t* cb, gs_graphics_draw_desc_t* desc)
-{
-    __ogl_push_command(cb, GS_OPENGL_OP_DRAW, {
-        gs_byte_buffer_write(&cb->commands, uint32_t, desc->start);
-        gs_byte_buffer_write(&cb->commands, uint32_t, desc->count);
-        gs_byte_buffer_write(&cb->commands, uint32_t, desc->instances);
-        gs_byte_buffer_write(&cb->commands, uint32_t, desc->base_vertex);
-        gs_byte_buffer_write(&cb->commands, uint32_t, desc->range.start);
-        gs_byte_buffer_write(&cb->commands, uint32_t, desc->range.end);
-    });
-}
-
-void gs_graphics_dispatch_compute(gs_command_buffer_t* cb, uint32_t num_x_groups, uint32_t num_y_groups, uint32_t num_z_groups)
-{
-    __ogl_push_command(cb, GS_OPENGL_OP_DISPATCH_COMPUTE, {
-        gs_byte_buffer_write(&cb->commands, uint32_t, num_x_groups);
-        gs_byte_buffer_write(&cb->commands, uint32_t, num_y_groups);
-        gs_byte_buffer_write(&cb->commands, uint32_t, num_z_groups);
-    });
-}
-
-/* Submission (Main Thread) */
-void gs_graphics_command_buffer_submit_impl(gs_command_buffer_t* cb)
-{
-    /*
-        // Structure of command: 
-            - Op code
-            - Data packet
-    */
-
-    gsgl_data_t* ogl = (gsgl_data_t*)gs_subsystem(graphics)->user_data;
-
-    // Set read position of buffer to beginning
-    gs_byte_buffer_seek_to_beg(&cb->commands);
-
-    // For each command in buffer
-    gs_for_range(cb->num_commands)
-    {
-        // Read in op code of command
-        gs_byte_buffer_readc(&cb->commands, gs_opengl_op_code_type, op_code);
-
-        switch (op_code)
-        {
-            case GS_OPENGL_OP_BEGIN_RENDER_PASS:
-            {
-                // Bind render pass stuff
-                gs_byte_buffer_readc(&cb->commands, uint32_t, rpid);
-
-                // If render pass exists, then we'll bind frame buffer and attachments 
-                if (rpid && gs_slot_array_exists(ogl->renderpasses, rpid)) 
-                {
-                    gsgl_renderpass_t* rp = gs_slot_array_getp(ogl->renderpasses, rpid);
-
-                    // Bind frame buffer since it actually exists
-                    if (rp->fbo.id && gs_slot_array_exists(ogl->frame_buffers, rp->fbo.id)) 
-                    {
-                        // Bind frame buffer
-                        glBindFramebuffer(GL_FRAMEBUFFER, gs_slot_array_get(ogl->frame_buffers, rp->fbo.id));
-
-                        // Bind color attachments
-                        for (uint32_t r = 0; r < gs_dyn_array_size(rp->color); ++r)
-                        {
-                            uint32_t cid = rp->color[r].id;
-                            if (cid && gs_slot_array_exists(ogl->textures, cid)) 
-                            {
-                                gsgl_texture_t* rt = gs_slot_array_getp(ogl->textures, cid);
-
-                                glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + r, GL_TEXTURE_2D, rt->id, 0);
-                            }
-                        }
-
-                        // Bind depth attachment
-                        {
-                            uint32_t depth_id = rp->depth.id;
-                            if (depth_id && gs_slot_array_exists(ogl->textures, depth_id))
-                            {
-                                gsgl_texture_t* rt = gs_slot_array_getp(ogl->textures, depth_id);
-                                glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, rt->id, 0);
-                            }
-                        }
-                    }
-                }
-            } break;
+                        // Bind depth attachment
+                        {
+                            uint32_t depth_id = rp->depth.id;
+                            if (depth_id && gs_slot_array_exists(ogl->textures, depth_id))
+                            {
+                                gsgl_texture_t* rt = gs_slot_array_getp(ogl->textures, depth_id);
+                                glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, rt->id, 0);
+                            }
+                        }
+                    }
+                }
+            } break;
 
             case GS_OPENGL_OP_END_RENDER_PASS:
             {
                 gsgl_data_t* ogl = (gsgl_data_t*)gs_subsystem(graphics)->user_data;
                 gsgl_reset_data_cache(&ogl->cache);
+                gsgl_reset_state_filter(ogl);
 
                 glBindFramebuffer(GL_FRAMEBUFFER, 0);
                 glBindBuffer(GL_ARRAY_BUFFER, 0);
@@ -2011,6 +1849,9 @@ void gs_graphics_command_buffer_submit_impl(gs_command_buffer_t* cb)
                     if (action.flag & GS_GRAPHICS_CLEAR_STENCIL || action.flag == 0x00) {
                         bit |= GL_STENCIL_BUFFER_BIT;
                         glStencilMask(~0);
+
+                        // Stencil write mask no longer matches the bound pipeline, so it has to be re-applied on next bind
+                        ogl->cache.bound_pipeline = UINT32_MAX;
                     }
 
                     glClear(bit);
@@ -2185,6 +2026,23 @@ void gs_graphics_command_buffer_submit_impl(gs_command_buffer_t* cb)
                                     u->sid = pip->raster.shader.id;
                                 }
 
+                                // Skip upload if this location of the program already holds the same data
+                                if (u->type != GSGL_UNIFORMTYPE_SAMPLER2D && u->type != GSGL_UNIFORMTYPE_SAMPLERCUBE && u->location < UINT32_MAX - 1)
+                                {
+                                    size_t usz = (u->count ? u->count : 1) * u->size;
+                                    uint64_t key = ((uint64_t)sid << 32) | (uint64_t)u->location;
+                                    uint64_t hash = (uint64_t)gs_hash_bytes(cb->commands.data + cb->commands.position, usz, GS_HASH_TABLE_HASH_SEED);
+                                    uint64_t* prev = gs_hash_table_exists(ogl->uniform_hashes, key) ? gs_hash_table_getp(ogl->uniform_hashes, key) : NULL;
+                                    if (prev && *prev == hash) {
+                                        gs_byte_buffer_advance_position(&cb->commands, usz);
+                                        stats->redundant.uniforms++;
+                                        stats->calls_saved++;
+                                        continue;
+                                    }
+                                    if (prev) *prev = hash;
+                                    else      gs_hash_table_insert(ogl->uniform_hashes, key, hash);
+                                }
+
                                 // Switch on uniform type to upload data
                                 switch (u->type) 
                                 {
@@ -2280,6 +2138,17 @@ void gs_graphics_command_buffer_submit_impl(gs_command_buffer_t* cb)
                                             // Get texture, also need binding, but will worry about that in a bit
                                             gsgl_texture_t* tex = gs_slot_array_getp(ogl->textures, v.id);
 
+                                            // Texture already bound to this unit
+                                            if (binding < GSGL_TEXTURE_UNIT_MAX && ogl->cache.texture_units[binding] == tex->id) {
+                                                stats->redundant.buffers++;
+                                                stats->calls_saved += 2;
+                                                binds[i] = (int32_t)binding++;
+                                                continue;
+                                            }
+                                            if (binding < GSGL_TEXTURE_UNIT_MAX) {
+                                                ogl->cache.texture_units[binding] = tex->id;
+                                            }
+
                                             // Activate texture slot
                                             glActiveTexture(GL_TEXTURE0 + binding);
 
@@ -2510,18 +2379,27 @@ void gs_graphics_command_buffer_submit_impl(gs_command_buffer_t* cb)
                     */
                     continue;
                 }
+                stats->pipeline_binds++;
                 
                 // Reset cache
                 gsgl_reset_data_cache(&ogl->cache);
 
-               // Reset state as well
-                gsgl_pipeline_state();
-
                 /* Cache pipeline id */
                 ogl->cache.pipeline = gs_handle_create(gs_graphics_pipeline_t, pipid);
 
                 gsgl_pipeline_t* pip = gs_slot_array_getp(ogl->pipelines, pipid);
 
+                // Pipeline state already applied, only bindings need to be reset (done above)
+                if (ogl->cache.bound_pipeline == pipid) {
+                    stats->redundant.pipelines++;
+                    stats->calls_saved += gsgl_pipeline_bind_call_count(pip);
+                    continue;
+                }
+                ogl->cache.bound_pipeline = pipid;
+
+               // Reset state as well
+                gsgl_pipeline_state();
+
                 /* Compute */ 
                 // Early out if compute, since we're not doing a rasterization stage
                 if (pip->compute.shader.id)
@@ -2607,6 +2485,7 @@ void gs_graphics_command_buffer_submit_impl(gs_command_buffer_t* cb)
                 gs_byte_buffer_readc(&cb->commands, uint32_t, num_x_groups);
                 gs_byte_buffer_readc(&cb->commands, uint32_t, num_y_groups);
                 gs_byte_buffer_readc(&cb->commands, uint32_t, num_z_groups);
+                stats->dispatches++;
 
                 // Grab currently bound pipeline (TODO(john): assert if this isn't valid)
                 if (ogl->cache.pipeline.id == 0 || !gs_slot_array_exists(ogl->pipelines, ogl->cache.pipeline.id)) {
@@ -2655,8 +2534,31 @@ void gs_graphics_command_buffer_submit_impl(gs_command_buffer_t* cb)
                 // Keep track whether or not the data is to be instanced
                 bool is_instanced = false;
 
+                // Attribute pointers live in the vao, so they only need setting up when the pipeline or vertex buffers change
+                bool attribs_bound = ogl->cache.attrib_pipeline == ogl->cache.pipeline.id && 
+                    gs_dyn_array_size(ogl->cache.attrib_vdecls) == gs_dyn_array_size(ogl->cache.vdecls);
+                for (uint32_t i = 0; attribs_bound && i < (uint32_t)gs_dyn_array_size(ogl->cache.vdecls); ++i) {
+                    gsgl_vertex_buffer_decl_t* a = &ogl->cache.attrib_vdecls[i], *b = &ogl->cache.vdecls[i];
+                    attribs_bound = a->vbo == b->vbo && a->data_type == b->data_type && a->offset == b->offset;
+                }
+                if (attribs_bound) {
+                    stats->redundant.buffers++;
+                    stats->calls_saved += 5 * gs_dyn_array_size(pip->layout) + gs_dyn_array_size(ogl->cache.vdecls);
+                }
+                else {
+                    ogl->cache.attrib_pipeline = ogl->cache.pipeline.id;
+                    gs_dyn_array_clear(ogl->cache.attrib_vdecls);
+                    for (uint32_t i = 0; i < gs_dyn_array_size(ogl->cache.vdecls); ++i) {
+                        gs_dyn_array_push(ogl->cache.attrib_vdecls, ogl->cache.vdecls[i]);
+                    }
+                }
+
                 for (uint32_t i = 0; i < gs_dyn_array_size(pip->layout); ++i)
                 {
+                    // If there is a vertex divisor for this layout, then we'll draw instanced
+                    is_instanced |= (pip->layout[i].divisor != 0);
+                    if (attribs_bound) continue;
+
                     // Vertex buffer to bind
                     uint32_t vbo_idx = i; //pip->layout[i].buffer_idx;
                     gsgl_vertex_buffer_decl_t vdecl = vbo_idx < gs_dyn_array_size(ogl->cache.vdecls) ? ogl->cache.vdecls[vbo_idx] : ogl->cache.vdecls[0];
@@ -2676,9 +2578,6 @@ void gs_graphics_command_buffer_submit_impl(gs_command_buffer_t* cb)
                     size_t offset = vdecl.data_type == GS_GRAPHICS_VERTEX_DATA_NONINTERLEAVED ? vdecl.offset : is_manual ? pip->layout[i].offset : 
                                         gsgl_get_vertex_attr_byte_offest(pip->layout, i);
 
-                    // If there is a vertex divisor for this layout, then we'll draw instanced
-                    is_instanced |= (pip->layout[i].divisor != 0);
-
                     // Enable the vertex attribute pointer
                     glEnableVertexAttribArray(i);
 
@@ -2696,6 +2595,10 @@ void gs_graphics_command_buffer_submit_impl(gs_command_buffer_t* cb)
                         case GS_GRAPHICS_VERTEX_ATTRIBUTE_BYTE2:  glVertexAttribPointer(i, 2, GL_UNSIGNED_BYTE, GL_TRUE, stride, gs_int2voidp(offset)); break;
                         case GS_GRAPHICS_VERTEX_ATTRIBUTE_BYTE3:  glVertexAttribPointer(i, 3, GL_UNSIGNED_BYTE, GL_TRUE, stride, gs_int2voidp(offset)); break;
                         case GS_GRAPHICS_VERTEX_ATTRIBUTE_BYTE4:  glVertexAttribPointer(i, 4, GL_UNSIGNED_BYTE, GL_TRUE, stride, gs_int2voidp(offset)); break;
+                        case GS_GRAPHICS_VERTEX_ATTRIBUTE_HALF4:  glVertexAttribPointer(i, 4, GL_HALF_FLOAT, GL_FALSE, stride, gs_int2voidp(offset)); break;
+                        case GS_GRAPHICS_VERTEX_ATTRIBUTE_HALF2:  glVertexAttribPointer(i, 2, GL_HALF_FLOAT, GL_FALSE, stride, gs_int2voidp(offset)); break;
+                        case GS_GRAPHICS_VERTEX_ATTRIBUTE_SHORT2N:  glVertexAttribPointer(i, 2, GL_SHORT, GL_TRUE, stride, gs_int2voidp(offset)); break;
+                        case GS_GRAPHICS_VERTEX_ATTRIBUTE_USHORT2N: glVertexAttribPointer(i, 2, GL_UNSIGNED_SHORT, GL_TRUE, stride, gs_int2voidp(offset)); break;
 
                         // Shouldn't get here
                         default: {
@@ -2708,7 +2611,7 @@ void gs_graphics_command_buffer_submit_impl(gs_command_buffer_t* cb)
                 } 
 
                 // Bind all vertex buffers after setting up data and pointers
-                for (uint32_t i = 0; i < gs_dyn_array_size(ogl->cache.vdecls); ++i) {
+                for (uint32_t i = 0; !attribs_bound && i < (uint32_t)gs_dyn_array_size(ogl->cache.vdecls); ++i) {
                     glBindBuffer(GL_ARRAY_BUFFER, ogl->cache.vdecls[i].vbo);
                 } 
 
@@ -2722,9 +2625,20 @@ void gs_graphics_command_buffer_submit_impl(gs_command_buffer_t* cb)
 
                 range_end = (range_end && range_end > range_start) ? range_end : start + count;
 
+                stats->draws++;
+                stats->vertices += count * (instance_count ? instance_count : 1);
+
                 // Bind element buffer ranged
                 if (ogl->cache.ibo) {
-                    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, gs_slot_array_get(ogl->index_buffers, ogl->cache.ibo));
+                    gsgl_buffer_t ibo = gs_slot_array_get(ogl->index_buffers, ogl->cache.ibo);
+                    if (ogl->cache.bound_ibo != ibo) {
+                        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ibo);
+                        ogl->cache.bound_ibo = ibo;
+                    }
+                    else {
+                        stats->redundant.buffers++;
+                        stats->calls_saved++;
+                    }
                 }
 
                 // If instance count > 1, do instanced drawing
@@ -2773,6 +2687,9 @@ void gs_graphics_command_buffer_submit_impl(gs_command_buffer_t* cb)
                 *desc.data = (cb->commands.data + cb->commands.position);
                 *tex = gl_texture_update_internal(&desc, tex_slot_id);
 
+                // Texture was bound to (then unbound from) the active unit
+                memset(ogl->cache.texture_units, 0xff, sizeof(ogl->cache.texture_units));
+
                 // Bind texture
                 // glBindTexture(GL_TEXTURE_2D, tex->id);
                 // // Update texture data
@@ -2826,6 +2743,7 @@ void gs_graphics_command_buffer_submit_impl(gs_command_buffer_t* cb)
                             default:                                glBufferData(GL_ELEMENT_ARRAY_BUFFER, sz, (cb->commands.data + cb->commands.position), glusage); break;
                         }
                         glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+                        ogl->cache.bound_ibo = 0;
                     } break;
 
                     case GS_GRAPHICS_BUFFER_UNIFORM:
@@ -2873,6 +2791,12 @@ void gs_graphics_command_buffer_submit_impl(gs_command_buffer_t* cb)
 
             } break;
 
+            case GS_OPENGL_OP_SORT_KEY:
+            {
+                // Keys are consumed by sorting, nothing to replay
+                gs_byte_buffer_advance_position(&cb->commands, sizeof(uint64_t));
+            } break;
+
             default:
             {
                 // Op code not supported yet!
@@ -2920,6 +2844,7 @@ gs_graphics_init(gs_graphics_t* graphics)
 
     // Reset data cache for rendering ops
     gsgl_reset_data_cache(&ogl->cache);
+    gsgl_reset_state_filter(ogl);
 
     // Init info object
     gs_graphics_info_t* info = &gs_subsystem(graphics)->info;
@@ -2949,6 +2874,12 @@ gs_graphics_init(gs_graphics_t* graphics)
         glGetIntegerv(GL_MAX_SHADER_STORAGE_BLOCK_SIZE, (int32_t*)&info->max_ssbo_block_size);
     ) 
 
+    // Program binaries (GL 4.1 or ARB_get_program_binary, ES 3.0), WebGL reports no formats
+    GLint binary_formats = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &binary_formats);
+    info->program_binary = binary_formats > 0;
+    CHECK_GL_CORE(info->program_binary = info->program_binary && glGetProgramBinary && glProgramBinary && glProgramParameteri;);
+
     const GLubyte* glslv = glGetString(GL_SHADING_LANGUAGE_VERSION);
     gs_println("GLSL Version: %s", glslv);
 
@@ -2990,6 +2921,7 @@ gs_graphics_init(gs_graphics_t* graphics)
     graphics->api.storage_buffer_lock = gs_grapics_storage_buffer_lock_impl;
     graphics->api.storage_buffer_unlock = gs_grapics_storage_buffer_unlock_impl; 
     graphics->api.storage_buffer_get_data = gs_storage_buffer_get_data_impl;
+    graphics->api.shader_get_binary = gs_graphics_shader_get_binary_impl;
 
     // Submission (Main Thread)
     graphics->api.command_buffer_submit = gs_graphics_command_buffer_submit_impl; 
@@ -3001,5 +2933,1386 @@ gs_graphics_init(gs_graphics_t* graphics)
 
 
 #endif // GS_GRAPHICS_IMPL_OPENGL
+
+/*==========================
+// Null Backend
+==========================*/
+
+#ifdef GS_GRAPHICS_IMPL_NULL
+
+/*
+    Tracks just enough resource state to validate handles and ranges. Submission decodes the full command
+    stream, mirrors the bind cache of the opengl backend and records statistics instead of issuing api calls.
+*/
+
+/* Buffer */
+typedef struct gsnull_buffer_t {
+    size_t size;
+    gs_graphics_buffer_usage_type usage;
+} gsnull_buffer_t;
+
+/* Storage Buffer (cpu backing store for map/lock/readback) */
+typedef struct gsnull_storage_buffer_t {
+    size_t size;
+    uint8_t* data;
+} gsnull_storage_buffer_t;
+
+/* Uniform */
+typedef struct gsnull_uniform_t {
+    size_t size;                    // Total data size of uniform list
+    uint32_t sid;                   // Shader data was last applied with
+    gs_dyn_array(uint8_t) data;     // Data last applied (for redundancy checks)
+} gsnull_uniform_t;
+
+/* Pipeline */
+typedef struct gsnull_pipeline_t {
+    gs_graphics_blend_state_desc_t blend;
+    gs_graphics_depth_state_desc_t depth;
+    gs_graphics_raster_state_desc_t raster;
+    gs_graphics_stencil_state_desc_t stencil;
+    gs_graphics_compute_state_desc_t compute;
+    gs_dyn_array(gs_graphics_vertex_attribute_desc_t) layout;
+} gsnull_pipeline_t;
+
+/* Render Pass */
+typedef struct gsnull_renderpass_t {
+    gs_handle(gs_graphics_framebuffer_t) fbo;
+    gs_dyn_array(gs_handle(gs_graphics_texture_t)) color;
+    gs_handle(gs_graphics_texture_t) depth;
+    gs_handle(gs_graphics_texture_t) stencil;
+} gsnull_renderpass_t;
+
+typedef struct gsnull_vertex_buffer_decl_t {
+    uint32_t vbo;
+    gs_graphics_vertex_data_type data_type;
+    size_t offset;
+} gsnull_vertex_buffer_decl_t;
+
+/* Cached data between draws */
+typedef struct gsnull_data_cache_t
+{
+    uint32_t ibo;
+    gs_dyn_array(gsnull_vertex_buffer_decl_t) vdecls;
+    gs_handle(gs_graphics_pipeline_t) pipeline;
+    uint32_t viewport[4];
+    uint32_t scissor[4];
+} gsnull_data_cache_t;
+
+/* Internal Null Data */
+typedef struct gsnull_data_t
+{
+    gs_slot_array(uint32_t)                     shaders;
+    gs_slot_array(gs_graphics_texture_desc_t)   textures;
+    gs_slot_array(gsnull_buffer_t)              vertex_buffers;
+    gs_slot_array(gsnull_buffer_t)              index_buffers;
+    gs_slot_array(gsnull_buffer_t)              uniform_buffers;
+    gs_slot_array(gsnull_storage_buffer_t)      storage_buffers;
+    gs_slot_array(uint32_t)                     frame_buffers;
+    gs_slot_array(gsnull_uniform_t)             uniforms;
+    gs_slot_array(gsnull_pipeline_t)            pipelines;
+    gs_slot_array(gsnull_renderpass_t)          renderpasses;
+
+    // Cached data between draw calls (to count redundant state changes)
+    gsnull_data_cache_t cache;
+
+} gsnull_data_t;
+
+#define gsnull_data() ((gsnull_data_t*)gs_subsystem(graphics)->user_data)
+
+// Counted every time, logged on the first and every 1000th occurrence per call site
+#define gsnull_error(...)\
+    do {\
+        static uint32_t gs_macro_cat(__gsnull_err, __LINE__) = 0;\
+        gs_subsystem(graphics)->stats.errors++;\
+        if (gs_macro_cat(__gsnull_err, __LINE__)++ % 1000 == 0) {\
+            gs_log_warning(__VA_ARGS__);\
+        }\
+    } while (0)
+
+void gsnull_reset_data_cache(gsnull_data_cache_t* cache)
+{
+    cache->ibo = 0;
+    cache->pipeline = gs_handle_invalid(gs_graphics_pipeline_t);
+    memset(cache->viewport, 0xff, sizeof(cache->viewport));
+    memset(cache->scissor, 0xff, sizeof(cache->scissor));
+    if (cache->vdecls) memset(cache->vdecls, 0, gs_dyn_array_capacity(cache->vdecls) * sizeof(*cache->vdecls));
+    gs_dyn_array_clear(cache->vdecls);
+}
+
+size_t gsnull_uniform_data_size_in_bytes(gs_graphics_uniform_type type)
+{
+    switch (type) {
+        case GS_GRAPHICS_UNIFORM_FLOAT:         return sizeof(float);
+        case GS_GRAPHICS_UNIFORM_INT:           return sizeof(int32_t);
+        case GS_GRAPHICS_UNIFORM_VEC2:          return 2 * sizeof(float);
+        case GS_GRAPHICS_UNIFORM_VEC3:          return 3 * sizeof(float);
+        case GS_GRAPHICS_UNIFORM_VEC4:          return 4 * sizeof(float);
+        case GS_GRAPHICS_UNIFORM_MAT4:          return 16 * sizeof(float);
+        case GS_GRAPHICS_UNIFORM_SAMPLER2D:
+        case GS_GRAPHICS_UNIFORM_USAMPLER2D:
+        case GS_GRAPHICS_UNIFORM_SAMPLERCUBE:   return sizeof(gs_handle(gs_graphics_texture_t));
+        default:                                return 0;
+    }
+}
+
+/* Graphics Interface Creation / Initialization / Shutdown / Destruction */
+GS_API_DECL gs_graphics_t* 
+gs_graphics_create()
+{
+    gs_graphics_t* gfx = gs_malloc_init(gs_graphics_t);
+    gfx->user_data = gs_malloc_init(gsnull_data_t);
+    return gfx;
+}
+
+GS_API_DECL void 
+gs_graphics_destroy(gs_graphics_t* graphics)
+{
+    if (graphics == NULL) return;
+
+    gsnull_data_t* null = (gsnull_data_t*)graphics->user_data;
+
+    // Free resources which own memory
+    for (gs_slot_array_iter it = 1; gs_slot_array_iter_valid(null->storage_buffers, it); gs_slot_array_iter_advance(null->storage_buffers, it)) {
+        gs_free(gs_slot_array_getp(null->storage_buffers, it)->data);
+    }
+    for (gs_slot_array_iter it = 1; gs_slot_array_iter_valid(null->uniforms, it); gs_slot_array_iter_advance(null->uniforms, it)) {
+        gs_dyn_array_free(gs_slot_array_getp(null->uniforms, it)->data);
+    }
+    for (gs_slot_array_iter it = 1; gs_slot_array_iter_valid(null->pipelines, it); gs_slot_array_iter_advance(null->pipelines, it)) {
+        gs_dyn_array_free(gs_slot_array_getp(null->pipelines, it)->layout);
+    }
+    for (gs_slot_array_iter it = 1; gs_slot_array_iter_valid(null->renderpasses, it); gs_slot_array_iter_advance(null->renderpasses, it)) {
+        gs_dyn_array_free(gs_slot_array_getp(null->renderpasses, it)->color);
+    }
+
+    gs_slot_array_free(null->shaders);
+    gs_slot_array_free(null->textures);
+    gs_slot_array_free(null->vertex_buffers);
+    gs_slot_array_free(null->index_buffers);
+    gs_slot_array_free(null->uniform_buffers);
+    gs_slot_array_free(null->storage_buffers);
+    gs_slot_array_free(null->frame_buffers);
+    gs_slot_array_free(null->uniforms);
+    gs_slot_array_free(null->pipelines);
+    gs_slot_array_free(null->renderpasses);
+    gs_dyn_array_free(null->cache.vdecls);
+
+    gs_free(null);
+    gs_free(graphics);
+}
+
+GS_API_DECL void 
+gs_graphics_shutdown(gs_graphics_t* graphics)
+{ 
+}
+
+// Resource Creation
+GS_API_DECL gs_handle(gs_graphics_texture_t) 
+gs_graphics_texture_create_impl(const gs_graphics_texture_desc_t* desc)
+{
+    gs_graphics_texture_desc_t tex = *desc;
+    memset(tex.data, 0, sizeof(tex.data));
+    return gs_handle_create(gs_graphics_texture_t, gs_slot_array_insert(gsnull_data()->textures, tex));
+}
+
+GS_API_DECL gs_handle(gs_graphics_uniform_t) 
+gs_graphics_uniform_create_impl(const gs_graphics_uniform_desc_t* desc)
+{
+    uint32_t ct = !desc->layout ? 0 : !desc->layout_size ? 1 : (uint32_t)desc->layout_size / (uint32_t)sizeof(gs_graphics_uniform_layout_desc_t);
+    if (ct < 1) {
+        gs_println("Warning: Uniform layout description must not be empty for: %s.", desc->name);
+        return gs_handle_invalid(gs_graphics_uniform_t);
+    }
+
+    gsnull_uniform_t u = gs_default_val();
+    for (uint32_t i = 0; i < ct; ++i) {
+        u.size += gsnull_uniform_data_size_in_bytes(desc->layout[i].type) * (desc->layout[i].count ? desc->layout[i].count : 1);
+    }
+
+    return gs_handle_create(gs_graphics_uniform_t, gs_slot_array_insert(gsnull_data()->uniforms, u));
+}
+
+GS_API_DECL gs_handle(gs_graphics_shader_t) 
+gs_graphics_shader_create_impl(const gs_graphics_shader_desc_t* desc)
+{
+    return gs_handle_create(gs_graphics_shader_t, gs_slot_array_insert(gsnull_data()->shaders, 1));
+}
+
+GS_API_DECL gs_handle(gs_graphics_vertex_buffer_t) 
+gs_graphics_vertex_buffer_create_impl(const gs_graphics_vertex_buffer_desc_t* desc)
+{
+    if (desc->usage == GS_GRAPHICS_BUFFER_USAGE_STATIC && !desc->data) {
+        gs_println("Error: Vertex buffer desc must contain data when GS_GRAPHICS_BUFFER_USAGE_STATIC set.");
+        gs_assert(false);
+    } 
+    gsnull_buffer_t buffer = {.size = desc->size, .usage = desc->usage};
+    return gs_handle_create(gs_graphics_vertex_buffer_t, gs_slot_array_insert(gsnull_data()->vertex_buffers, buffer));
+}
+
+GS_API_DECL gs_handle(gs_graphics_index_buffer_t) 
+gs_graphics_index_buffer_create_impl(const gs_graphics_index_buffer_desc_t* desc)
+{
+    gsnull_buffer_t buffer = {.size = desc->size, .usage = desc->usage};
+    return gs_handle_create(gs_graphics_index_buffer_t, gs_slot_array_insert(gsnull_data()->index_buffers, buffer));
+}
+
+GS_API_DECL gs_handle(gs_graphics_uniform_buffer_t) 
+gs_graphics_uniform_buffer_create_impl(const gs_graphics_uniform_buffer_desc_t* desc)
+{
+    gsnull_buffer_t buffer = {.size = desc->size, .usage = desc->usage};
+    return gs_handle_create(gs_graphics_uniform_buffer_t, gs_slot_array_insert(gsnull_data()->uniform_buffers, buffer));
+}
+
+GS_API_DECL gs_handle(gs_graphics_storage_buffer_t) 
+gs_graphics_storage_buffer_create_impl(const gs_graphics_storage_buffer_desc_t* desc)
+{
+    gsnull_storage_buffer_t sbo = gs_default_val();
+    sbo.size = desc->size;
+    sbo.data = (uint8_t*)gs_malloc(desc->size ? desc->size : 1);
+    if (desc->data) memcpy(sbo.data, desc->data, desc->size);
+    else            memset(sbo.data, 0, desc->size);
+    return gs_handle_create(gs_graphics_storage_buffer_t, gs_slot_array_insert(gsnull_data()->storage_buffers, sbo));
+}
+
+GS_API_DECL gs_handle(gs_graphics_framebuffer_t) 
+gs_graphics_framebuffer_create_impl(const gs_graphics_framebuffer_desc_t* desc)
+{
+    return gs_handle_create(gs_graphics_framebuffer_t, gs_slot_array_insert(gsnull_data()->frame_buffers, 1));
+}
+
+GS_API_DECL gs_handle(gs_graphics_renderpass_t) 
+gs_graphics_renderpass_create_impl(const gs_graphics_renderpass_desc_t* desc)
+{
+    gsnull_renderpass_t pass = gs_default_val();
+    pass.fbo = desc->fbo;
+    pass.depth = desc->depth;
+    pass.stencil = desc->stencil;
+    uint32_t ct = (uint32_t)(desc->color_size / sizeof(gs_handle(gs_graphics_texture_t)));
+    for (uint32_t i = 0; i < ct; ++i) {
+        gs_dyn_array_push(pass.color, desc->color[i]);
+    }
+    return gs_handle_create(gs_graphics_renderpass_t, gs_slot_array_insert(gsnull_data()->renderpasses, pass));
+}
+
+GS_API_DECL gs_handle(gs_graphics_pipeline_t) 
+gs_graphics_pipeline_create_impl(const gs_graphics_pipeline_desc_t* desc)
+{
+    gsnull_pipeline_t pip = gs_default_val();
+    pip.blend = desc->blend;
+    pip.depth = desc->depth;
+    pip.raster = desc->raster;
+    pip.stencil = desc->stencil;
+    pip.compute = desc->compute;
+    pip.raster.index_buffer_element_size = desc->raster.index_buffer_element_size ? desc->raster.index_buffer_element_size : sizeof(uint32_t);
+    uint32_t ct = (uint32_t)(desc->layout.size / sizeof(gs_graphics_vertex_attribute_desc_t));
+    for (uint32_t i = 0; i < ct; ++i) {
+        gs_dyn_array_push(pip.layout, desc->layout.attrs[i]);
+    }
+    return gs_handle_create(gs_graphics_pipeline_t, gs_slot_array_insert(gsnull_data()->pipelines, pip));
+}
+
+// Resource Destruction
+#define GSNULL_DESTROY(SA, ID, ...)\
+    do {\
+        if (!gs_slot_array_exists(SA, ID)) return;\
+        __VA_ARGS__\
+        gs_slot_array_erase(SA, ID);\
+    } while (0)
+
+GS_API_DECL void 
+gs_graphics_texture_destroy_impl(gs_handle(gs_graphics_texture_t) hndl)
+{
+    GSNULL_DESTROY(gsnull_data()->textures, hndl.id, {});
+}
+
+GS_API_DECL void 
+gs_graphics_uniform_destroy_impl(gs_handle(gs_graphics_uniform_t) hndl)
+{
+    GSNULL_DESTROY(gsnull_data()->uniforms, hndl.id, {
+        gs_dyn_array_free(gs_slot_array_getp(gsnull_data()->uniforms, hndl.id)->data);
+    });
+}
+
+GS_API_DECL void 
+gs_graphics_shader_destroy_impl(gs_handle(gs_graphics_shader_t) hndl)
+{
+    GSNULL_DESTROY(gsnull_data()->shaders, hndl.id, {});
+}
+
+GS_API_DECL void 
+gs_graphics_vertex_buffer_destroy_impl(gs_handle(gs_graphics_vertex_buffer_t) hndl)
+{
+    GSNULL_DESTROY(gsnull_data()->vertex_buffers, hndl.id, {});
+}
+
+GS_API_DECL void 
+gs_graphics_index_buffer_destroy_impl(gs_handle(gs_graphics_index_buffer_t) hndl)
+{
+    GSNULL_DESTROY(gsnull_data()->index_buffers, hndl.id, {});
+}
+
+GS_API_DECL void 
+gs_graphics_uniform_buffer_destroy_impl(gs_handle(gs_graphics_uniform_buffer_t) hndl)
+{
+    GSNULL_DESTROY(gsnull_data()->uniform_buffers, hndl.id, {});
+}
+
+GS_API_DECL void 
+gs_graphics_storage_buffer_destroy_impl(gs_handle(gs_graphics_storage_buffer_t) hndl)
+{
+    GSNULL_DESTROY(gsnull_data()->storage_buffers, hndl.id, {
+        gs_free(gs_slot_array_getp(gsnull_data()->storage_buffers, hndl.id)->data);
+    });
+}
+
+GS_API_DECL void 
+gs_graphics_framebuffer_destroy_impl(gs_handle(gs_graphics_framebuffer_t) hndl)
+{
+    GSNULL_DESTROY(gsnull_data()->frame_buffers, hndl.id, {});
+}
+
+GS_API_DECL void 
+gs_graphics_renderpass_destroy_impl(gs_handle(gs_graphics_renderpass_t) hndl)
+{
+    GSNULL_DESTROY(gsnull_data()->renderpasses, hndl.id, {
+        gs_dyn_array_free(gs_slot_array_getp(gsnull_data()->renderpasses, hndl.id)->color);
+    });
+}
+
+GS_API_DECL void 
+gs_graphics_pipeline_destroy_impl(gs_handle(gs_graphics_pipeline_t) hndl)
+{
+    GSNULL_DESTROY(gsnull_data()->pipelines, hndl.id, {
+        gs_dyn_array_free(gs_slot_array_getp(gsnull_data()->pipelines, hndl.id)->layout);
+    });
+}
+
+// Resource Query
+GS_API_DECL void 
+gs_graphics_pipeline_desc_query(gs_handle(gs_graphics_pipeline_t) hndl, gs_graphics_pipeline_desc_t* out)
+{
+    if (!out || !gs_slot_array_exists(gsnull_data()->pipelines, hndl.id)) return;
+
+    gsnull_pipeline_t* pip = gs_slot_array_getp(gsnull_data()->pipelines, hndl.id);
+    out->blend = pip->blend;
+    out->depth = pip->depth;
+    out->raster = pip->raster;
+    out->stencil = pip->stencil;
+    out->compute = pip->compute;
+    for (uint32_t i = 0; i < (uint32_t)gs_dyn_array_size(pip->layout); ++i) {
+        gs_dyn_array_push(out->layout.attrs, pip->layout[i]);
+    }
+}
+
+GS_API_DECL void 
+gs_graphics_texture_desc_query(gs_handle(gs_graphics_texture_t) hndl, gs_graphics_texture_desc_t* out)
+{
+    if (!out || !gs_slot_array_exists(gsnull_data()->textures, hndl.id)) return;
+    *out = gs_slot_array_get(gsnull_data()->textures, hndl.id);
+}
+
+GS_API_DECL size_t 
+gs_graphics_uniform_size_query(gs_handle(gs_graphics_uniform_t) hndl)
+{ 
+    if (!gs_slot_array_exists(gsnull_data()->uniforms, hndl.id)) return 0;
+    return gs_slot_array_getp(gsnull_data()->uniforms, hndl.id)->size;
+}
+
+size_t __gs_graphics_uniform_data_size(uint32_t id)
+{
+    if (!gs_slot_array_exists(gsnull_data()->uniforms, id)) return 0;
+    return gs_slot_array_getp(gsnull_data()->uniforms, id)->size;
+}
+
+// Resource Updates (main thread only) 
+void gsnull_buffer_update(gsnull_buffer_t* buffer, gs_graphics_buffer_update_type type, size_t offset, size_t sz)
+{
+    gs_subsystem(graphics)->stats.upload_bytes += sz;
+    switch (type) {
+        case GS_GRAPHICS_BUFFER_UPDATE_SUBDATA: {
+            if (offset + sz > buffer->size) {
+                gsnull_error("Buffer update out of range: offset %zu + size %zu > %zu", offset, sz, buffer->size);
+            }
+        } break;
+        default: {
+            buffer->size = sz;
+        } break;
+    }
+}
+
+GS_API_DECL void 
+gs_graphics_vertex_buffer_update_impl(gs_handle(gs_graphics_vertex_buffer_t) hndl, gs_graphics_vertex_buffer_desc_t* desc)
+{
+    if (!gs_slot_array_exists(gsnull_data()->vertex_buffers, hndl.id)) {
+        gsnull_error("Vertex buffer handle invalid: %zu", hndl.id);
+        return;
+    }
+    gsnull_buffer_update(gs_slot_array_getp(gsnull_data()->vertex_buffers, hndl.id), desc->update.type, desc->update.offset, desc->size);
+}
+
+GS_API_DECL void 
+gs_graphics_index_buffer_update_impl(gs_handle(gs_graphics_index_buffer_t) hndl, gs_graphics_index_buffer_desc_t* desc)
+{
+    if (!gs_slot_array_exists(gsnull_data()->index_buffers, hndl.id)) {
+        gsnull_error("Index buffer handle invalid: %zu", hndl.id);
+        return;
+    }
+    gsnull_buffer_update(gs_slot_array_getp(gsnull_data()->index_buffers, hndl.id), desc->update.type, desc->update.offset, desc->size);
+}
+
+GS_API_DECL void 
+gs_graphics_storage_buffer_update_impl(gs_handle(gs_graphics_storage_buffer_t) hndl, gs_graphics_storage_buffer_desc_t* desc)
+{
+    if (!gs_slot_array_exists(gsnull_data()->storage_buffers, hndl.id)) {
+        gsnull_error("Storage buffer handle invalid: %zu", hndl.id);
+        return;
+    }
+
+    gsnull_storage_buffer_t* sbo = gs_slot_array_getp(gsnull_data()->storage_buffers, hndl.id);
+    gs_subsystem(graphics)->stats.upload_bytes += desc->size;
+    switch (desc->update.type) {
+        case GS_GRAPHICS_BUFFER_UPDATE_SUBDATA: {
+            if (desc->update.offset + desc->size > sbo->size) {
+                gsnull_error("Storage buffer update out of range: offset %zu + size %zu > %zu", desc->update.offset, desc->size, sbo->size);
+                return;
+            }
+        } break;
+        default: {
+            sbo->data = (uint8_t*)gs_realloc(sbo->data, desc->size ? desc->size : 1);
+            sbo->size = desc->size;
+        } break;
+    }
+    if (desc->data) memcpy(sbo->data + desc->update.offset, desc->data, desc->size);
+}
+
+GS_API_DECL void 
+gs_graphics_texture_update_impl(gs_handle(gs_graphics_texture_t) hndl, gs_graphics_texture_desc_t* desc)
+{
+    if (!desc) return;
+    if (!gs_slot_array_exists(gsnull_data()->textures, hndl.id)) {
+        gsnull_error("Texture handle invalid: %zu", hndl.id);
+        return;
+    }
+    gs_graphics_texture_desc_t tex = *desc;
+    memset(tex.data, 0, sizeof(tex.data));
+    gs_slot_array_get(gsnull_data()->textures, hndl.id) = tex;
+}
+
+GS_API_DECL void 
+gs_graphics_texture_read_impl(gs_handle(gs_graphics_texture_t) hndl, gs_graphics_texture_desc_t* desc)
+{
+    if (!desc) return;
+    if (!gs_slot_array_exists(gsnull_data()->textures, hndl.id)) {
+        gsnull_error("Texture handle invalid: %zu", hndl.id);
+        return;
+    }
+    // No texels to read back, so hand out zeroes
+    if (*desc->data && desc->read.size) memset(*desc->data, 0, desc->read.size);
+}
+
+// Util
+GS_API_DECL void* 
+gs_graphics_storage_buffer_map_get_impl(gs_handle(gs_graphics_storage_buffer_t) hndl)
+{
+    if (!gs_slot_array_exists(gsnull_data()->storage_buffers, hndl.id)) {
+        gsnull_error("Storage buffer handle invalid: %zu", hndl.id);
+        return NULL;
+    }
+    return gs_slot_array_getp(gsnull_data()->storage_buffers, hndl.id)->data;
+}
+
+GS_API_DECL void* 
+gs_graphics_storage_buffer_lock_impl(gs_handle(gs_graphics_storage_buffer_t) hndl, size_t offset, size_t sz)
+{
+    uint8_t* data = (uint8_t*)gs_graphics_storage_buffer_map_get_impl(hndl);
+    return data ? data + offset : NULL;
+}
+
+GS_API_DECL void 
+gs_graphics_storage_buffer_unlock_impl(gs_handle(gs_graphics_storage_buffer_t) hndl)
+{
+}
+
+GS_API_DECL void 
+gs_graphics_storage_buffer_get_data_impl(gs_handle(gs_graphics_storage_buffer_t) hndl, size_t offset, size_t stride, void* out)
+{
+    uint8_t* data = (uint8_t*)gs_graphics_storage_buffer_map_get_impl(hndl);
+    if (data) memcpy(out, data + offset, stride);
+}
+
+/* Submission (Main Thread) */
+void gs_graphics_command_buffer_submit_impl(gs_command_buffer_t* cb)
+{
+    gsnull_data_t* null = gsnull_data();
+    gs_graphics_stats_t* stats = &gs_subsystem(graphics)->stats;
+
+    // Reorder keyed packets (if any were recorded)
+    __gs_graphics_command_buffer_sort(cb);
+
+    // Set read position of buffer to beginning
+    gs_byte_buffer_seek_to_beg(&cb->commands);
+
+    gs_for_range(cb->num_commands)
+    {
+        gs_byte_buffer_readc(&cb->commands, gs_opengl_op_code_type, op_code);
+        stats->commands++;
+
+        switch (op_code)
+        {
+            case GS_OPENGL_OP_BEGIN_RENDER_PASS:
+            {
+                gs_byte_buffer_readc(&cb->commands, uint32_t, rpid);
+                stats->renderpasses++;
+                if (rpid && !gs_slot_array_exists(null->renderpasses, rpid)) {
+                    gsnull_error("Begin Render Pass: Render pass %zu does not exist.", rpid);
+                }
+            } break;
+
+            case GS_OPENGL_OP_END_RENDER_PASS:
+            {
+                gsnull_reset_data_cache(&null->cache);
+            } break;
+
+            case GS_OPENGL_OP_CLEAR:
+            {
+                gs_byte_buffer_readc(&cb->commands, uint32_t, action_count);
+                gs_byte_buffer_advance_position(&cb->commands, action_count * sizeof(gs_graphics_clear_action_t));
+            } break;
+
+            case GS_OPENGL_OP_SET_VIEWPORT:
+            case GS_OPENGL_OP_SET_VIEW_SCISSOR:
+            {
+                gs_byte_buffer_readc(&cb->commands, uint32_t, x);
+                gs_byte_buffer_readc(&cb->commands, uint32_t, y);
+                gs_byte_buffer_readc(&cb->commands, uint32_t, w);
+                gs_byte_buffer_readc(&cb->commands, uint32_t, h);
+                uint32_t rect[4] = {x, y, w, h};
+                uint32_t* curr = op_code == GS_OPENGL_OP_SET_VIEWPORT ? null->cache.viewport : null->cache.scissor;
+                if (memcmp(curr, rect, sizeof(rect)) == 0) stats->redundant.viewports++;
+                memcpy(curr, rect, sizeof(rect));
+            } break;
+
+            case GS_OPENGL_OP_APPLY_BINDINGS:
+            {
+                gs_byte_buffer_readc(&cb->commands, uint32_t, ct);
+                gs_byte_buffer_readc(&cb->commands, bool, clear_vertex_buffers);
+                if (clear_vertex_buffers) {
+                    gs_dyn_array_clear(null->cache.vdecls);
+                }
+
+                for (uint32_t i = 0; i < ct; ++i)
+                {
+                    gs_byte_buffer_readc(&cb->commands, gs_graphics_bind_type, type);
+                    stats->bindings++;
+
+                    switch (type)
+                    {
+                        case GS_GRAPHICS_BIND_VERTEX_BUFFER:
+                        {
+                            gs_byte_buffer_readc(&cb->commands, uint32_t, id);
+                            gs_byte_buffer_readc(&cb->commands, size_t, offset);
+                            gs_byte_buffer_readc(&cb->commands, gs_graphics_vertex_data_type, data_type);
+
+                            if (!id || !gs_slot_array_exists(null->vertex_buffers, id)) {
+                                gsnull_error("Bind Vertex Buffer: Vertex buffer %zu does not exist.", id);
+                                continue;
+                            }
+
+                            // Same buffer in the same slot as the previous bindings
+                            uint32_t slot = (uint32_t)gs_dyn_array_size(null->cache.vdecls);
+                            if (slot < (uint32_t)gs_dyn_array_capacity(null->cache.vdecls)) {
+                                gsnull_vertex_buffer_decl_t* prev = &null->cache.vdecls[slot];
+                                if (prev->vbo == id && prev->offset == offset && prev->data_type == data_type) {
+                                    stats->redundant.buffers++;
+                                }
+                            }
+
+                            gsnull_vertex_buffer_decl_t decl = {.vbo = id, .data_type = data_type, .offset = offset};
+                            gs_dyn_array_push(null->cache.vdecls, decl);
+                        } break;
+
+                        case GS_GRAPHICS_BIND_INDEX_BUFFER:
+                        {
+                            gs_byte_buffer_readc(&cb->commands, uint32_t, id);
+                            if (!id || !gs_slot_array_exists(null->index_buffers, id)) {
+                                gsnull_error("Bind Index Buffer: Index buffer %zu does not exist.", id);
+                                continue;
+                            }
+                            if (null->cache.ibo == id) stats->redundant.buffers++;
+                            null->cache.ibo = id;
+                        } break;
+
+                        case GS_GRAPHICS_BIND_UNIFORM:
+                        {
+                            gs_byte_buffer_readc(&cb->commands, uint32_t, id);
+                            gs_byte_buffer_readc(&cb->commands, size_t, sz);
+                            gs_byte_buffer_readc(&cb->commands, uint32_t, binding);
+
+                            uint8_t* data = cb->commands.data + cb->commands.position;
+                            gs_byte_buffer_advance_position(&cb->commands, sz);
+                            stats->uniform_bytes += sz;
+
+                            if (!id || !gs_slot_array_exists(null->uniforms, id)) {
+                                gsnull_error("Bind Uniform: Uniform %zu does not exist.", id);
+                                continue;
+                            }
+                            if (!null->cache.pipeline.id || !gs_slot_array_exists(null->pipelines, null->cache.pipeline.id)) {
+                                gsnull_error("Bind Uniform: No pipeline bound for uniform %zu.", id);
+                                continue;
+                            }
+
+                            // Uniform state lives with the program, so data is only redundant for the same shader
+                            gsnull_uniform_t* u = gs_slot_array_getp(null->uniforms, id);
+                            uint32_t sid = gs_slot_array_getp(null->pipelines, null->cache.pipeline.id)->raster.shader.id;
+                            if (u->sid == sid && (size_t)gs_dyn_array_size(u->data) == sz && memcmp(u->data, data, sz) == 0) {
+                                stats->redundant.uniforms++;
+                            }
+                            else {
+                                gs_dyn_array_clear(u->data);
+                                gs_dyn_array_reserve(u->data, sz);
+                                memcpy(u->data, data, sz);
+                                gs_dyn_array_head(u->data)->size = (int32_t)sz;
+                                u->sid = sid;
+                            }
+                        } break;
+
+                        case GS_GRAPHICS_BIND_UNIFORM_BUFFER:
+                        {
+                            gs_byte_buffer_readc(&cb->commands, uint32_t, id);
+                            gs_byte_buffer_readc(&cb->commands, uint32_t, binding);
+                            gs_byte_buffer_readc(&cb->commands, size_t, range_offset);
+                            gs_byte_buffer_readc(&cb->commands, size_t, range_size);
+                            if (!id || !gs_slot_array_exists(null->uniform_buffers, id)) {
+                                gsnull_error("Bind Uniform Buffer: Uniform buffer %zu does not exist.", id);
+                                continue;
+                            }
+                            gsnull_buffer_t* ubo = gs_slot_array_getp(null->uniform_buffers, id);
+                            if (range_offset + range_size > ubo->size) {
+                                gsnull_error("Bind Uniform Buffer: Range [%zu, %zu) exceeds buffer %zu of size %zu.", range_offset, range_offset + range_size, id, ubo->size);
+                            }
+                        } break;
+
+                        case GS_GRAPHICS_BIND_STORAGE_BUFFER:
+                        {
+                            gs_byte_buffer_readc(&cb->commands, uint32_t, id);
+                            gs_byte_buffer_readc(&cb->commands, uint32_t, binding);
+                            gs_byte_buffer_readc(&cb->commands, size_t, range_offset);
+                            gs_byte_buffer_readc(&cb->commands, size_t, range_size);
+                            if (!id || !gs_slot_array_exists(null->storage_buffers, id)) {
+                                gsnull_error("Bind Storage Buffer: Storage buffer %zu does not exist.", id);
+                                continue;
+                            }
+                            gsnull_storage_buffer_t* sbo = gs_slot_array_getp(null->storage_buffers, id);
+                            if (range_offset + range_size > sbo->size) {
+                                gsnull_error("Bind Storage Buffer: Range [%zu, %zu) exceeds buffer %zu of size %zu.", range_offset, range_offset + range_size, id, sbo->size);
+                            }
+                        } break;
+
+                        case GS_GRAPHICS_BIND_IMAGE_BUFFER:
+                        {
+                            gs_byte_buffer_readc(&cb->commands, uint32_t, id);
+                            gs_byte_buffer_readc(&cb->commands, uint32_t, binding);
+                            gs_byte_buffer_readc(&cb->commands, gs_graphics_access_type, access);
+                            if (!id || !gs_slot_array_exists(null->textures, id)) {
+                                gsnull_error("Bind Image Buffer: Texture %zu does not exist.", id);
+                            }
+                        } break;
+
+                        default: 
+                        {
+                            gs_println("Invalid bind type: %zu", (uint32_t)type);
+                            gs_assert(false);
+                        } break;
+                    }
+                }
+            } break;
+
+            case GS_OPENGL_OP_BIND_PIPELINE:
+            {
+                gs_byte_buffer_readc(&cb->commands, uint32_t, pipid);
+                stats->pipeline_binds++;
+                if (!pipid || !gs_slot_array_exists(null->pipelines, pipid)) {
+                    gsnull_error("Bind Pipeline: Pipeline %zu does not exist.", pipid);
+                    continue;
+                }
+                if (null->cache.pipeline.id == pipid) stats->redundant.pipelines++;
+                null->cache.pipeline = gs_handle_create(gs_graphics_pipeline_t, pipid);
+            } break;
+
+            case GS_OPENGL_OP_DISPATCH_COMPUTE:
+            {
+                gs_byte_buffer_readc(&cb->commands, uint32_t, num_x_groups);
+                gs_byte_buffer_readc(&cb->commands, uint32_t, num_y_groups);
+                gs_byte_buffer_readc(&cb->commands, uint32_t, num_z_groups);
+                stats->dispatches++;
+                if (!null->cache.pipeline.id || !gs_slot_array_exists(null->pipelines, null->cache.pipeline.id)) {
+                    gsnull_error("Dispatch Compute: No pipeline bound.");
+                }
+            } break;
+
+            case GS_OPENGL_OP_DRAW:
+            {
+                gs_byte_buffer_readc(&cb->commands, uint32_t, start);
+                gs_byte_buffer_readc(&cb->commands, uint32_t, count);
+                gs_byte_buffer_readc(&cb->commands, uint32_t, instance_count);
+                gs_byte_buffer_readc(&cb->commands, uint32_t, base_vertex);
+                gs_byte_buffer_readc(&cb->commands, uint32_t, range_start);
+                gs_byte_buffer_readc(&cb->commands, uint32_t, range_end);
+
+                stats->draws++;
+                stats->vertices += count * (instance_count ? instance_count : 1);
+
+                if (!null->cache.pipeline.id || !gs_slot_array_exists(null->pipelines, null->cache.pipeline.id)) {
+                    gsnull_error("Draw: No pipeline bound.");
+                    continue;
+                }
+                if (gs_dyn_array_empty(null->cache.vdecls)) {
+                    gsnull_error("Draw: No vertex buffer bound.");
+                }
+
+                // Indexed draws take a byte offset into the bound index buffer
+                if (null->cache.ibo) {
+                    gsnull_pipeline_t* pip = gs_slot_array_getp(null->pipelines, null->cache.pipeline.id);
+                    gsnull_buffer_t* ibo = gs_slot_array_getp(null->index_buffers, null->cache.ibo);
+                    size_t end = (size_t)start + (size_t)count * pip->raster.index_buffer_element_size;
+                    if (end > ibo->size) {
+                        gsnull_error("Draw: Index range [%zu, %zu) exceeds index buffer %zu of size %zu.", start, end, null->cache.ibo, ibo->size);
+                    }
+                }
+            } break;
+
+            case GS_OPENGL_OP_REQUEST_TEXTURE_UPDATE:
+            {
+                gs_byte_buffer_readc(&cb->commands, uint32_t, tex_slot_id);
+                gs_byte_buffer_readc(&cb->commands, gs_graphics_texture_desc_t, desc);
+                gs_byte_buffer_readc(&cb->commands, size_t, data_size);
+                gs_byte_buffer_advance_position(&cb->commands, data_size);
+                stats->upload_bytes += data_size;
+
+                if (!tex_slot_id || !gs_slot_array_exists(null->textures, tex_slot_id)) {
+                    gsnull_error("Request Texture Update: Texture %zu does not exist.", tex_slot_id);
+                    continue;
+                }
+                memset(desc.data, 0, sizeof(desc.data));
+                gs_slot_array_get(null->textures, tex_slot_id) = desc;
+            } break;
+
+            case GS_OPENGL_OP_REQUEST_BUFFER_UPDATE:
+            {
+                gs_byte_buffer_readc(&cb->commands, uint32_t, id);
+                gs_byte_buffer_readc(&cb->commands, gs_graphics_buffer_type, type);
+                gs_byte_buffer_readc(&cb->commands, gs_graphics_buffer_usage_type, usage);
+                gs_byte_buffer_readc(&cb->commands, size_t, sz);
+                gs_byte_buffer_readc(&cb->commands, size_t, offset);
+                gs_byte_buffer_readc(&cb->commands, gs_graphics_buffer_update_type, update_type);
+                uint8_t* data = cb->commands.data + cb->commands.position;
+                gs_byte_buffer_advance_position(&cb->commands, sz);
+
+                switch (type)
+                {
+                    case GS_GRAPHICS_BUFFER_VERTEX:
+                    case GS_GRAPHICS_BUFFER_INDEX:
+                    case GS_GRAPHICS_BUFFER_UNIFORM:
+                    {
+                        gsnull_buffer_t* buffer = NULL;
+                        switch (type) {
+                            case GS_GRAPHICS_BUFFER_VERTEX: if (gs_slot_array_exists(null->vertex_buffers, id)) buffer = gs_slot_array_getp(null->vertex_buffers, id); break;
+                            case GS_GRAPHICS_BUFFER_INDEX:  if (gs_slot_array_exists(null->index_buffers, id)) buffer = gs_slot_array_getp(null->index_buffers, id); break;
+                            default:                        if (gs_slot_array_exists(null->uniform_buffers, id)) buffer = gs_slot_array_getp(null->uniform_buffers, id); break;
+                        }
+                        if (!id || !buffer) {
+                            gsnull_error("Request Buffer Update: Buffer %zu does not exist.", id);
+                            continue;
+                        }
+                        gsnull_buffer_update(buffer, update_type, offset, sz);
+                    } break;
+
+                    case GS_GRAPHICS_BUFFER_SHADER_STORAGE:
+                    {
+                        gs_graphics_storage_buffer_desc_t desc = {
+                            .data = data,
+                            .size = sz,
+                            .usage = usage,
+                            .update = {
+                                .type = update_type,
+                                .offset = offset,
+                            },
+                        };
+                        gs_graphics_storage_buffer_update_impl(gs_handle_create(gs_graphics_storage_buffer_t, id), &desc);
+                    } break;
+
+                    default: break;
+                }
+            } break;
+
+            case GS_OPENGL_OP_SORT_KEY:
+            {
+                gs_byte_buffer_advance_position(&cb->commands, sizeof(uint64_t));
+            } break;
+
+            default:
+            {
+                gs_println("Op code not supported yet: %zu", (uint32_t)op_code);
+                gs_assert(false);
+            }
+        }
+    }
+
+    // Clear byte buffer of commands
+    gs_byte_buffer_clear(&cb->commands);
+
+    // Set num commands to 0
+    cb->num_commands = 0;
+}
+
+GS_API_DECL void 
+gs_graphics_init(gs_graphics_t* graphics)
+{
+    gsnull_data_t* null = (gsnull_data_t*)graphics->user_data;
+
+    // Push back 0 handles into slot arrays (for 0 init validation)
+    gs_graphics_texture_desc_t tex = gs_default_val();
+    gsnull_buffer_t buffer = gs_default_val();
+    gsnull_storage_buffer_t sbo = gs_default_val();
+    gsnull_uniform_t u = gs_default_val();
+    gsnull_pipeline_t pip = gs_default_val();
+    gsnull_renderpass_t rp = gs_default_val();
+
+    gs_slot_array_insert(null->shaders, 0);
+    gs_slot_array_insert(null->frame_buffers, 0);
+    gs_slot_array_insert(null->textures, tex);
+    gs_slot_array_insert(null->vertex_buffers, buffer);
+    gs_slot_array_insert(null->index_buffers, buffer);
+    gs_slot_array_insert(null->uniform_buffers, buffer);
+    gs_slot_array_insert(null->storage_buffers, sbo);
+    gs_slot_array_insert(null->uniforms, u);
+    gs_slot_array_insert(null->pipelines, pip);
+    gs_slot_array_insert(null->renderpasses, rp);
+
+    gsnull_reset_data_cache(&null->cache);
+
+    // Report a compute capable 4.3 device so feature checks pass
+    graphics->info.major_version = 4;
+    graphics->info.minor_version = 3;
+    graphics->info.max_texture_units = 32;
+    graphics->info.max_ssbo_block_size = UINT32_MAX;
+    graphics->info.compute.available = true;
+    for (uint32_t i = 0; i < 3; ++i) {
+        graphics->info.compute.max_work_group_count[i] = UINT16_MAX;
+        graphics->info.compute.max_work_group_size[i] = 1024;
+    }
+    graphics->info.compute.max_work_group_invocations = 1024;
+
+    // Create
+    graphics->api.texture_create = gs_graphics_texture_create_impl;
+    graphics->api.uniform_create = gs_graphics_uniform_create_impl;
+    graphics->api.shader_create = gs_graphics_shader_create_impl;
+    graphics->api.vertex_buffer_create = gs_graphics_vertex_buffer_create_impl;
+    graphics->api.index_buffer_create = gs_graphics_index_buffer_create_impl;
+    graphics->api.uniform_buffer_create = gs_graphics_uniform_buffer_create_impl;
+    graphics->api.storage_buffer_create = gs_graphics_storage_buffer_create_impl;
+    graphics->api.framebuffer_create = gs_graphics_framebuffer_create_impl;
+    graphics->api.renderpass_create = gs_graphics_renderpass_create_impl;
+    graphics->api.pipeline_create = gs_graphics_pipeline_create_impl; 
+
+    // Destroy
+    graphics->api.texture_destroy = gs_graphics_texture_destroy_impl; 
+    graphics->api.uniform_destroy = gs_graphics_uniform_destroy_impl;
+    graphics->api.shader_destroy = gs_graphics_shader_destroy_impl;
+    graphics->api.vertex_buffer_destroy = gs_graphics_vertex_buffer_destroy_impl;
+    graphics->api.index_buffer_destroy = gs_graphics_index_buffer_destroy_impl;
+    graphics->api.uniform_buffer_destroy = gs_graphics_uniform_buffer_destroy_impl;
+    graphics->api.storage_buffer_destroy = gs_graphics_storage_buffer_destroy_impl;
+    graphics->api.framebuffer_destroy = gs_graphics_framebuffer_destroy_impl;
+    graphics->api.renderpass_destroy = gs_graphics_renderpass_destroy_impl;
+    graphics->api.pipeline_destroy = gs_graphics_pipeline_destroy_impl; 
+
+    // Resource Updates (main thread only) 
+    graphics->api.vertex_buffer_update = gs_graphics_vertex_buffer_update_impl; 
+    graphics->api.index_buffer_update = gs_graphics_index_buffer_update_impl;
+    graphics->api.storage_buffer_update = gs_graphics_storage_buffer_update_impl;
+    graphics->api.texture_update = gs_graphics_texture_update_impl;
+    graphics->api.texture_read = gs_graphics_texture_read_impl;
+
+    // Util
+    graphics->api.storage_buffer_map_get = gs_graphics_storage_buffer_map_get_impl; 
+    graphics->api.storage_buffer_lock = gs_graphics_storage_buffer_lock_impl;
+    graphics->api.storage_buffer_unlock = gs_graphics_storage_buffer_unlock_impl; 
+    graphics->api.storage_buffer_get_data = gs_graphics_storage_buffer_get_data_impl;
+
+    // Submission (Main Thread)
+    graphics->api.command_buffer_submit = gs_graphics_command_buffer_submit_impl; 
+}
+
+#endif // GS_GRAPHICS_IMPL_NULL
+
+#if (defined GS_GRAPHICS_IMPL_OPENGL_CORE || defined GS_GRAPHICS_IMPL_OPENGL_ES || defined GS_GRAPHICS_IMPL_NULL)
+
+#define __ogl_push_command(CB, OP_CODE, ...)\
+do {\
+    gs_byte_buffer_write(&CB->commands, u32, (u32)OP_CODE);\
+    __VA_ARGS__\
+    CB->num_commands++;\
+} while (0)
+
+/* Command Buffer Ops: Pipeline / Pass / Bind / Draw */
+GS_API_DECL void 
+gs_graphics_renderpass_begin(gs_command_buffer_t* cb, gs_handle(gs_graphics_renderpass_t) hndl)
+{
+    __ogl_push_command(cb, GS_OPENGL_OP_BEGIN_RENDER_PASS, {
+        gs_byte_buffer_write(&cb->commands, uint32_t, hndl.id);
+    });
+}
+
+GS_API_DECL void 
+gs_graphics_renderpass_end(gs_command_buffer_t* cb)
+{
+    __ogl_push_command(cb, GS_OPENGL_OP_END_RENDER_PASS, {
+        // Nothing...
+    });
+}
+
+GS_API_DECL void 
+gs_graphics_clear(gs_command_buffer_t* cb, gs_graphics_clear_desc_t* desc)
+{
+    __ogl_push_command(cb, GS_OPENGL_OP_CLEAR, {
+        uint32_t count = !desc->actions ? 0 : !desc->size ? 1 : (uint32_t)((size_t)desc->size / (size_t)sizeof(gs_graphics_clear_action_t));
+        gs_byte_buffer_write(&cb->commands, uint32_t, count);
+        for (uint32_t i = 0; i < count; ++i) {
+            gs_byte_buffer_write(&cb->commands, gs_graphics_clear_action_t, desc->actions[i]);
+        }
+    });
+}
+
+GS_API_DECL void 
+gs_graphics_set_viewport(gs_command_buffer_t* cb, uint32_t x, uint32_t y, uint32_t w, uint32_t h)
+{
+    __ogl_push_command(cb, GS_OPENGL_OP_SET_VIEWPORT, {
+        gs_byte_buffer_write(&cb->commands, uint32_t, x);
+        gs_byte_buffer_write(&cb->commands, uint32_t, y);
+        gs_byte_buffer_write(&cb->commands, uint32_t, w);
+        gs_byte_buffer_write(&cb->commands, uint32_t, h);
+    });
+}
+
+GS_API_DECL void 
+gs_graphics_set_view_scissor(gs_command_buffer_t* cb, uint32_t x, uint32_t y, uint32_t w, uint32_t h)
+{ 
+    __ogl_push_command(cb, GS_OPENGL_OP_SET_VIEW_SCISSOR, {
+        gs_byte_buffer_write(&cb->commands, uint32_t, x);
+        gs_byte_buffer_write(&cb->commands, uint32_t, y);
+        gs_byte_buffer_write(&cb->commands, uint32_t, w);
+        gs_byte_buffer_write(&cb->commands, uint32_t, h);
+    }); 
+}
+
+GS_API_DECL void 
+gs_graphics_texture_request_update(gs_command_buffer_t* cb, gs_handle(gs_graphics_texture_t) hndl, gs_graphics_texture_desc_t* desc)
+{
+    // Write command
+    gs_byte_buffer_write(&cb->commands, uint32_t, (uint32_t)GS_OPENGL_OP_REQUEST_TEXTURE_UPDATE);
+    cb->num_commands++;
+
+    uint32_t num_comps = 0;
+    size_t data_type_size = 0;
+    size_t total_size = 0;
+    switch(desc->format) 
+    {
+        default:
+        case GS_GRAPHICS_TEXTURE_FORMAT_RGBA8:              num_comps = 4; data_type_size = sizeof(uint8_t); break;
+        case GS_GRAPHICS_TEXTURE_FORMAT_RGB8:               num_comps = 3; data_type_size = sizeof(uint8_t); break;
+        case GS_GRAPHICS_TEXTURE_FORMAT_A8:                 num_comps = 1; data_type_size = sizeof(uint8_t); break;
+        case GS_GRAPHICS_TEXTURE_FORMAT_R8:                 num_comps = 1; data_type_size = sizeof(uint8_t); break;
+        case GS_GRAPHICS_TEXTURE_FORMAT_R32UI:              num_comps = 1; data_type_size = sizeof(uint32_t); break;
+        case GS_GRAPHICS_TEXTURE_FORMAT_R16UI:              num_comps = 1; data_type_size = sizeof(uint16_t); break;
+        case GS_GRAPHICS_TEXTURE_FORMAT_RGBA16F:            num_comps = 4; data_type_size = sizeof(float); break;
+        case GS_GRAPHICS_TEXTURE_FORMAT_RGBA32F:            num_comps = 4; data_type_size = sizeof(float); break;
+        case GS_GRAPHICS_TEXTURE_FORMAT_DEPTH8:             num_comps = 1; data_type_size = sizeof(float); break;
+        case GS_GRAPHICS_TEXTURE_FORMAT_DEPTH16:            num_comps = 1; data_type_size = sizeof(float); break;
+        case GS_GRAPHICS_TEXTURE_FORMAT_DEPTH24:            num_comps = 1; data_type_size = sizeof(float); break;
+        case GS_GRAPHICS_TEXTURE_FORMAT_DEPTH32F:           num_comps = 1; data_type_size = sizeof(float); break;
+        case GS_GRAPHICS_TEXTURE_FORMAT_DEPTH24_STENCIL8:   num_comps = 1; data_type_size = sizeof(uint32_t); break;
+        case GS_GRAPHICS_TEXTURE_FORMAT_DEPTH32F_STENCIL8:  num_comps = 1; data_type_size = sizeof(float) + sizeof(uint8_t); break;
+
+        // NOTE(john): Because Apple is a shit company, I have to section this off and provide support for 4.1 only features.
+        // case GS_GRAPHICS_TEXTURE_FORMAT_STENCIL8:            glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT8, width, height, 0, GL_DEPTH_COMPONENT, GL_FLOAT, data); break;
+    }
+    total_size = desc->width * desc->height * num_comps * data_type_size;
+    gs_byte_buffer_write(&cb->commands, uint32_t, hndl.id);
+    gs_byte_buffer_write(&cb->commands, gs_graphics_texture_desc_t, *desc);
+    gs_byte_buffer_write(&cb->commands, size_t, total_size);
+    gs_byte_buffer_write_bulk(&cb->commands, *desc->data, total_size);
+}
+
+void __gs_graphics_update_buffer_internal(gs_command_buffer_t* cb, 
+    uint32_t id, 
+    gs_graphics_buffer_type type,
+    gs_graphics_buffer_usage_type usage, 
+    size_t sz, 
+    size_t offset, 
+    gs_graphics_buffer_update_type update_type,
+    void* data)
+{
+    // Write command
+    gs_byte_buffer_write(&cb->commands, u32, (u32)GS_OPENGL_OP_REQUEST_BUFFER_UPDATE);
+    cb->num_commands++;
+
+    // Write handle id
+    gs_byte_buffer_write(&cb->commands, uint32_t, id);
+    // Write type
+    gs_byte_buffer_write(&cb->commands, gs_graphics_buffer_type, type);
+    // Write usage
+    gs_byte_buffer_write(&cb->commands, gs_graphics_buffer_usage_type, usage);
+    // Write data size
+    gs_byte_buffer_write(&cb->commands, size_t, sz);
+    // Write data offset
+    gs_byte_buffer_write(&cb->commands, size_t, offset);
+    // Write data update type
+    gs_byte_buffer_write(&cb->commands, gs_graphics_buffer_update_type, update_type);
+    // Write data
+    gs_byte_buffer_write_bulk(&cb->commands, data, sz);
+}
+
+GS_API_DECL void 
+gs_graphics_vertex_buffer_request_update(gs_command_buffer_t* cb, gs_handle(gs_graphics_vertex_buffer_t) hndl, gs_graphics_vertex_buffer_desc_t* desc)
+{
+    // Return if handle not valid
+    if (!hndl.id) return;
+
+    __gs_graphics_update_buffer_internal(cb, hndl.id, GS_GRAPHICS_BUFFER_VERTEX, desc->usage, desc->size, desc->update.offset, desc->update.type, desc->data);
+}
+
+GS_API_DECL void 
+gs_graphics_index_buffer_request_update(gs_command_buffer_t* cb, gs_handle(gs_graphics_index_buffer_t) hndl, gs_graphics_index_buffer_desc_t* desc)
+{
+    // Return if handle not valid
+    if (!hndl.id) return;
+
+    __gs_graphics_update_buffer_internal(cb, hndl.id, GS_GRAPHICS_BUFFER_INDEX, desc->usage, desc->size, desc->update.offset, desc->update.type, desc->data);
+}
+
+GS_API_DECL void 
+gs_graphics_uniform_buffer_request_update(gs_command_buffer_t* cb, gs_handle(gs_graphics_uniform_buffer_t) hndl, gs_graphics_uniform_buffer_desc_t* desc)
+{
+    // Return if handle not valid
+    if (!hndl.id) return;
+
+    __gs_graphics_update_buffer_internal(cb, hndl.id, GS_GRAPHICS_BUFFER_UNIFORM, desc->usage, desc->size, desc->update.offset, desc->update.type, desc->data);
+}
+
+GS_API_DECL void 
+gs_graphics_storage_buffer_request_update(gs_command_buffer_t* cb, gs_handle(gs_graphics_storage_buffer_t) hndl, gs_graphics_storage_buffer_desc_t* desc)
+{
+    // Return if handle not valid
+    if (!hndl.id) return;
+
+    __gs_graphics_update_buffer_internal(cb, hndl.id, GS_GRAPHICS_BUFFER_SHADER_STORAGE, desc->usage, desc->size, desc->update.offset, desc->update.type, desc->data);
+}
+
+void gs_graphics_apply_bindings(gs_command_buffer_t* cb, gs_graphics_bind_desc_t* binds)
+{
+    // Increment commands
+    gs_byte_buffer_write(&cb->commands, u32, (u32)GS_OPENGL_OP_APPLY_BINDINGS);
+    cb->num_commands++;
+ 
+    // __ogl_push_command(cb, GS_OPENGL_OP_APPLY_BINDINGS,
+    {
+        // Get counts from buffers
+        uint32_t vct = binds->vertex_buffers.desc ? binds->vertex_buffers.size ? binds->vertex_buffers.size / sizeof(gs_graphics_bind_vertex_buffer_desc_t) : 1 : 0;
+        uint32_t ict = binds->index_buffers.desc ? binds->index_buffers.size ? binds->index_buffers.size / sizeof(gs_graphics_bind_index_buffer_desc_t) : 1 : 0;
+        uint32_t uct = binds->uniform_buffers.desc ? binds->uniform_buffers.size ? binds->uniform_buffers.size / sizeof(gs_graphics_bind_uniform_buffer_desc_t) : 1 : 0;
+        uint32_t pct = binds->uniforms.desc ? binds->uniforms.size ? binds->uniforms.size / sizeof(gs_graphics_bind_uniform_desc_t) : 1 : 0;
+        uint32_t ibc = binds->image_buffers.desc ? binds->image_buffers.size ? binds->image_buffers.size / sizeof(gs_graphics_bind_image_buffer_desc_t) : 1 : 0;
+        uint32_t sbc = binds->storage_buffers.desc ? binds->storage_buffers.size ? binds->storage_buffers.size / sizeof(gs_graphics_bind_storage_buffer_desc_t) : 1 : 0;
+
+        // Determine total count to write into command buffer
+        uint32_t ct = vct + ict + uct + pct + ibc + sbc;
+        gs_byte_buffer_write(&cb->commands, uint32_t, ct);
+
+        // Determine if need to clear any previous vertex buffers (if vct != 0)
+        gs_byte_buffer_write(&cb->commands, bool, (vct != 0));
+
+        // Vertex buffers
+        for (uint32_t i = 0; i < vct; ++i)
+        {
+            gs_graphics_bind_vertex_buffer_desc_t* decl = &binds->vertex_buffers.desc[i];
+            gs_byte_buffer_write(&cb->commands, gs_graphics_bind_type, GS_GRAPHICS_BIND_VERTEX_BUFFER);
+            gs_byte_buffer_write(&cb->commands, uint32_t, decl->buffer.id);
+            gs_byte_buffer_write(&cb->commands, size_t, decl->offset);
+            gs_byte_buffer_write(&cb->commands, gs_graphics_vertex_data_type, decl->data_type);
+        }
+
+        // Index buffers
+        for (uint32_t i = 0; i < ict; ++i)
+        {
+            gs_graphics_bind_index_buffer_desc_t* decl = &binds->index_buffers.desc[i];
+            gs_byte_buffer_write(&cb->commands, gs_graphics_bind_type, GS_GRAPHICS_BIND_INDEX_BUFFER);
+            gs_byte_buffer_write(&cb->commands, uint32_t, decl->buffer.id);
+        }
+
+        // Uniform buffers
+        for (uint32_t i = 0; i < uct; ++i)
+        {
+            gs_graphics_bind_uniform_buffer_desc_t* decl = &binds->uniform_buffers.desc[i];
+
+            gs_byte_buffer_write(&cb->commands, gs_graphics_bind_type, GS_GRAPHICS_BIND_UNIFORM_BUFFER);
+            gs_byte_buffer_write(&cb->commands, uint32_t, decl->buffer.id);
+            gs_byte_buffer_write(&cb->commands, uint32_t, decl->binding);
+            gs_byte_buffer_write(&cb->commands, size_t, decl->range.offset);
+            gs_byte_buffer_write(&cb->commands, size_t, decl->range.size);
+        }
+
+        // Image buffers
+        for (uint32_t i = 0; i < ibc; ++i)
+        {
+            gs_graphics_bind_image_buffer_desc_t* decl = &binds->image_buffers.desc[i];
+            gs_byte_buffer_write(&cb->commands, gs_graphics_bind_type, GS_GRAPHICS_BIND_IMAGE_BUFFER);
+            gs_byte_buffer_write(&cb->commands, uint32_t, decl->tex.id);
+            gs_byte_buffer_write(&cb->commands, uint32_t, decl->binding);
+            gs_byte_buffer_write(&cb->commands, gs_graphics_access_type, decl->access);
+        }
+
+        // Uniforms
+        for (uint32_t i = 0; i < pct; ++i)
+        {
+            gs_graphics_bind_uniform_desc_t* decl = &binds->uniforms.desc[i];
+
+            // Get size from uniform list
+            size_t sz = __gs_graphics_uniform_data_size(decl->uniform.id);
+            gs_byte_buffer_write(&cb->commands, gs_graphics_bind_type, GS_GRAPHICS_BIND_UNIFORM);
+            gs_byte_buffer_write(&cb->commands, uint32_t, decl->uniform.id);
+            gs_byte_buffer_write(&cb->commands, size_t, sz);
+            gs_byte_buffer_write(&cb->commands, uint32_t, decl->binding);
+            gs_byte_buffer_write_bulk(&cb->commands, decl->data, sz);
+        }
+
+        // Storage buffers
+        CHECK_GL_CORE(
+            for (uint32_t i = 0; i < sbc; ++i)
+            {
+                gs_graphics_bind_storage_buffer_desc_t* decl = &binds->storage_buffers.desc[i];
+                gs_byte_buffer_write(&cb->commands, gs_graphics_bind_type, GS_GRAPHICS_BIND_STORAGE_BUFFER);
+                gs_byte_buffer_write(&cb->commands, uint32_t, decl->buffer.id);
+                gs_byte_buffer_write(&cb->commands, uint32_t, decl->binding);
+                gs_byte_buffer_write(&cb->commands, size_t, decl->range.offset);
+                gs_byte_buffer_write(&cb->commands, size_t, decl->range.size);
+            }
+        );
+    };
+}
+
+void gs_graphics_pipeline_bind(gs_command_buffer_t* cb, gs_handle(gs_graphics_pipeline_t) hndl)
+{
+    // NOTE(john): Not sure if this is safe in the future, since the data for pipelines is on the main thread and MIGHT be tampered with on a separate thread.
+    __ogl_push_command(cb, GS_OPENGL_OP_BIND_PIPELINE, {
+        gs_byte_buffer_write(&cb->commands, uint32_t, hndl.id);
+    });
+}
+
+void gs_graphics_draw(gs_command_buffer_t* cb, gs_graphics_draw_desc_t* desc)
+{
+    __ogl_push_command(cb, GS_OPENGL_OP_DRAW, {
+        gs_byte_buffer_write(&cb->commands, uint32_t, desc->start);
+        gs_byte_buffer_write(&cb->commands, uint32_t, desc->count);
+        gs_byte_buffer_write(&cb->commands, uint32_t, desc->instances);
+        gs_byte_buffer_write(&cb->commands, uint32_t, desc->base_vertex);
+        gs_byte_buffer_write(&cb->commands, uint32_t, desc->range.start);
+        gs_byte_buffer_write(&cb->commands, uint32_t, desc->range.end);
+    });
+}
+
+void gs_graphics_dispatch_compute(gs_command_buffer_t* cb, uint32_t num_x_groups, uint32_t num_y_groups, uint32_t num_z_groups)
+{
+    __ogl_push_command(cb, GS_OPENGL_OP_DISPATCH_COMPUTE, {
+        gs_byte_buffer_write(&cb->commands, uint32_t, num_x_groups);
+        gs_byte_buffer_write(&cb->commands, uint32_t, num_y_groups);
+        gs_byte_buffer_write(&cb->commands, uint32_t, num_z_groups);
+    });
+}
+
+GS_API_DECL void 
+gs_graphics_sort_key(gs_command_buffer_t* cb, uint64_t key)
+{
+    __ogl_push_command(cb, GS_OPENGL_OP_SORT_KEY, {
+        gs_byte_buffer_write(&cb->commands, uint64_t, key);
+    });
+    cb->num_sort_keys++;
+}
+
+// Advances buffer past the data packet of op (op code already read)
+void __gs_graphics_op_skip(gs_byte_buffer_t* buffer, gs_opengl_op_code_type op)
+{
+    switch (op)
+    {
+        case GS_OPENGL_OP_BEGIN_RENDER_PASS:        gs_byte_buffer_advance_position(buffer, sizeof(uint32_t)); break;
+        case GS_OPENGL_OP_END_RENDER_PASS:          break;
+        case GS_OPENGL_OP_SET_VIEWPORT:
+        case GS_OPENGL_OP_SET_VIEW_SCISSOR:         gs_byte_buffer_advance_position(buffer, 4 * sizeof(uint32_t)); break;
+        case GS_OPENGL_OP_BIND_PIPELINE:            gs_byte_buffer_advance_position(buffer, sizeof(uint32_t)); break;
+        case GS_OPENGL_OP_DISPATCH_COMPUTE:         gs_byte_buffer_advance_position(buffer, 3 * sizeof(uint32_t)); break;
+        case GS_OPENGL_OP_DRAW:                     gs_byte_buffer_advance_position(buffer, 6 * sizeof(uint32_t)); break;
+        case GS_OPENGL_OP_SORT_KEY:                 gs_byte_buffer_advance_position(buffer, sizeof(uint64_t)); break;
+
+        case GS_OPENGL_OP_CLEAR:
+        {
+            gs_byte_buffer_readc(buffer, uint32_t, count);
+            gs_byte_buffer_advance_position(buffer, count * sizeof(gs_graphics_clear_action_t));
+        } break;
+
+        case GS_OPENGL_OP_REQUEST_BUFFER_UPDATE:
+        {
+            gs_byte_buffer_advance_position(buffer, sizeof(uint32_t) + sizeof(gs_graphics_buffer_type) + sizeof(gs_graphics_buffer_usage_type));
+            gs_byte_buffer_readc(buffer, size_t, sz);
+            gs_byte_buffer_advance_position(buffer, sizeof(size_t) + sizeof(gs_graphics_buffer_update_type) + sz);
+        } break;
+
+        case GS_OPENGL_OP_REQUEST_TEXTURE_UPDATE:
+        {
+            gs_byte_buffer_advance_position(buffer, sizeof(uint32_t) + sizeof(gs_graphics_texture_desc_t));
+            gs_byte_buffer_readc(buffer, size_t, sz);
+            gs_byte_buffer_advance_position(buffer, sz);
+        } break;
+
+        case GS_OPENGL_OP_APPLY_BINDINGS:
+        {
+            gs_byte_buffer_readc(buffer, uint32_t, ct);
+            gs_byte_buffer_advance_position(buffer, sizeof(bool));
+            for (uint32_t i = 0; i < ct; ++i)
+            {
+                gs_byte_buffer_readc(buffer, gs_graphics_bind_type, type);
+                switch (type)
+                {
+                    case GS_GRAPHICS_BIND_VERTEX_BUFFER:    gs_byte_buffer_advance_position(buffer, sizeof(uint32_t) + sizeof(size_t) + sizeof(gs_graphics_vertex_data_type)); break;
+                    case GS_GRAPHICS_BIND_INDEX_BUFFER:     gs_byte_buffer_advance_position(buffer, sizeof(uint32_t)); break;
+                    case GS_GRAPHICS_BIND_UNIFORM_BUFFER:
+                    case GS_GRAPHICS_BIND_STORAGE_BUFFER:   gs_byte_buffer_advance_position(buffer, 2 * sizeof(uint32_t) + 2 * sizeof(size_t)); break;
+                    case GS_GRAPHICS_BIND_IMAGE_BUFFER:     gs_byte_buffer_advance_position(buffer, 2 * sizeof(uint32_t) + sizeof(gs_graphics_access_type)); break;
+                    case GS_GRAPHICS_BIND_UNIFORM:
+                    {
+                        gs_byte_buffer_advance_position(buffer, sizeof(uint32_t));
+                        gs_byte_buffer_readc(buffer, size_t, sz);
+                        gs_byte_buffer_advance_position(buffer, sizeof(uint32_t) + sz);
+                    } break;
+                    default: break;
+                }
+            }
+        } break;
+
+        default: break;
+    }
+}
+
+typedef struct __gs_graphics_sort_packet_t
+{
+    uint64_t key;
+    uint32_t offset;    // Byte offset of sort key op in source buffer
+    uint32_t size;      // Byte size of packet (sort key op included)
+    uint32_t count;     // Number of ops in packet (sort key op included)
+} __gs_graphics_sort_packet_t;
+
+// Stable LSD radix sort of packets by key, 8 bits per pass (passes with a uniform digit are skipped)
+void __gs_graphics_sort_packets(__gs_graphics_sort_packet_t* packets, __gs_graphics_sort_packet_t* tmp, uint32_t ct)
+{
+    __gs_graphics_sort_packet_t* src = packets;
+    __gs_graphics_sort_packet_t* dst = tmp;
+    for (uint32_t shift = 0; shift < 64; shift += 8)
+    {
+        uint32_t offsets[256] = gs_default_val();
+        for (uint32_t i = 0; i < ct; ++i) offsets[(src[i].key >> shift) & 0xff]++;
+        if (offsets[(src[0].key >> shift) & 0xff] == ct) continue;
+        for (uint32_t i = 0, sum = 0; i < 256; ++i) {
+            uint32_t c = offsets[i]; offsets[i] = sum; sum += c;
+        }
+        for (uint32_t i = 0; i < ct; ++i) dst[offsets[(src[i].key >> shift) & 0xff]++] = src[i];
+        __gs_graphics_sort_packet_t* t = src; src = dst; dst = t;
+    }
+    if (src != packets) memcpy(packets, src, ct * sizeof(__gs_graphics_sort_packet_t));
+}
+
+void __gs_graphics_command_buffer_sort(gs_command_buffer_t* cb)
+{
+    if (!cb->num_sort_keys) return;
+
+    gs_byte_buffer_t* src = &cb->commands;
+    gs_byte_buffer_t dst = gs_byte_buffer_new();
+    gs_byte_buffer_resize(&dst, src->capacity);
+    gs_graphics_stats_t* stats = &gs_subsystem(graphics)->stats;
+    uint32_t num_commands = 0;
+
+    // Packets are gathered per render pass, then flushed in key order
+    gs_dyn_array(__gs_graphics_sort_packet_t) packets = NULL;
+    gs_dyn_array(__gs_graphics_sort_packet_t) tmp = NULL;
+
+    #define __GS_GRAPHICS_SORT_FLUSH()\
+    do {\
+        uint32_t __CT = gs_dyn_array_size(packets);\
+        if (!__CT) break;\
+        gs_dyn_array_reserve(tmp, __CT);\
+        __gs_graphics_sort_packets(packets, tmp, __CT);\
+        for (uint32_t __I = 0; __I < __CT; ++__I) {\
+            gs_byte_buffer_write_bulk(&dst, src->data + packets[__I].offset, packets[__I].size);\
+            num_commands += packets[__I].count;\
+        }\
+        stats->sorted_packets += __CT;\
+        gs_dyn_array_clear(packets);\
+    } while (0)
+
+    gs_byte_buffer_seek_to_beg(src);
+    while (src->position < src->size)
+    {
+        uint32_t beg = src->position;
+        gs_byte_buffer_readc(src, uint32_t, op_code);
+        __gs_graphics_op_skip(src, (gs_opengl_op_code_type)op_code);
+        uint32_t sz = src->position - beg;
+
+        switch (op_code)
+        {
+            case GS_OPENGL_OP_SORT_KEY:
+            {
+                __gs_graphics_sort_packet_t packet = gs_default_val();
+                packet.key = *(uint64_t*)(src->data + beg + sizeof(uint32_t));
+                packet.offset = beg;
+                packet.size = sz;
+                packet.count = 1;
+                gs_dyn_array_push(packets, packet);
+            } break;
+
+            case GS_OPENGL_OP_BEGIN_RENDER_PASS:
+            case GS_OPENGL_OP_END_RENDER_PASS:
+            {
+                __GS_GRAPHICS_SORT_FLUSH();
+                gs_byte_buffer_write_bulk(&dst, src->data + beg, sz);
+                num_commands++;
+            } break;
+
+            default:
+            {
+                // Extend open packet, otherwise pass through unkeyed op
+                if (gs_dyn_array_size(packets)) {
+                    __gs_graphics_sort_packet_t* packet = &packets[gs_dyn_array_size(packets) - 1];
+                    packet->size += sz;
+                    packet->count++;
+                } else {
+                    gs_byte_buffer_write_bulk(&dst, src->data + beg, sz);
+                    num_commands++;
+                }
+            } break;
+        }
+    }
+    __GS_GRAPHICS_SORT_FLUSH();
+    #undef __GS_GRAPHICS_SORT_FLUSH
+
+    gs_dyn_array_free(packets);
+    gs_dyn_array_free(tmp);
+
+    // Swap in sorted stream
+    gs_byte_buffer_free(src);
+    *src = dst;
+    cb->num_commands = num_commands;
+    cb->num_sort_keys = 0;
+}
+
+#endif // Command buffer encoding
+
 #endif // GS_GRAPHICS_IMPL_H
 
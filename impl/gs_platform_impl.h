@@ -50,6 +50,11 @@
     #include <sys/stat.h>
     #include <dirent.h>
     #include <dlfcn.h>  // dlopen, RTLD_LAZY, dlsym
+    #if (defined GS_PLATFORM_LINUX || defined GS_PLATFORM_APPLE || defined GS_PLATFORM_ANDROID)
+        #include <sys/mman.h>   // mmap, munmap
+        #include <fcntl.h>
+        #include <unistd.h>
+    #endif
 #else
 	#include "../external/dirent/dirent.h"
     #include <direct.h>
@@ -79,6 +84,10 @@ gs_platform_destroy(gs_platform_t* platform)
 
     // Free all resources
     gs_slot_array_free(platform->windows);
+    for (uint32_t i = 0; i < (uint32_t)gs_dyn_array_size(platform->archives); ++i) {
+        gs_platform_archive_close(platform->archives[i]);
+    }
+    gs_dyn_array_free(platform->archives);
 
     // Free platform
     gs_free(platform);
@@ -123,6 +132,30 @@ gs_platform_frame_time()
     return gs_platform_time()->frame;
 }
 
+GS_API_DECL double 
+gs_platform_fixed_alpha()
+{
+    return gs_platform_time()->alpha;
+}
+
+GS_API_DECL void 
+gs_platform_sleep_precise(double ms)
+{
+    const uint64_t start = gs_platform_elapsed_time_ns();
+    const uint64_t end = start + (uint64_t)(gs_max(ms, 0.0) * 1000000.0);
+
+    // Coarse OS sleep for everything outside the spin window
+    double coarse = ms - GS_PLATFORM_SPIN_THRESHOLD;
+    if (coarse >= 1.0 || (GS_PLATFORM_SPIN_THRESHOLD <= 0.0 && coarse > 0.0)) {
+        gs_platform_sleep((float)coarse);
+    }
+
+    // Spin on the clock for the remainder
+    if (GS_PLATFORM_SPIN_THRESHOLD > 0.0) {
+        while (gs_platform_elapsed_time_ns() < end);
+    }
+}
+
 /*== Platform UUID ==*/
 
 GS_API_DECL struct gs_uuid_t 
@@ -651,7 +684,10 @@ void gs_platform_release_key(gs_platform_keycode code)
 }
 
 // Platform File IO
-char* gs_platform_read_file_contents_default_impl(const char* file_path, const char* mode, size_t* sz)
+GS_API_PRIVATE char* __gs_platform_archive_read_entry(const gs_platform_archive_t* ar, const gs_platform_archive_entry_t* e, size_t* sz);
+
+GS_API_PRIVATE char* 
+__gs_platform_read_file_loose(const char* file_path, const char* mode, size_t* sz)
 {
     const char* path = file_path;
 
@@ -663,22 +699,33 @@ char* gs_platform_read_file_contents_default_impl(const char* file_path, const c
 
     char* buffer = 0;
     FILE* fp = fopen(path, mode);
-    size_t read_sz = 0;
     if (fp)
     {
-        read_sz = gs_platform_file_size_in_bytes(file_path);
+        // Size from the open handle instead of a second lookup by path
+        fseek(fp, 0, SEEK_END);
+        long end = ftell(fp);
+        fseek(fp, 0, SEEK_SET);
+        size_t read_sz = end > 0 ? (size_t)end : 0;
         buffer = (char*)gs_malloc(read_sz + 1);
         if (buffer) {
-           size_t _r = fread(buffer, 1, read_sz, fp);
+            read_sz = fread(buffer, 1, read_sz, fp);
+            buffer[read_sz] = '\0';
+            if (sz) *sz = read_sz;
         }
-        buffer[read_sz] = '\0';
         fclose(fp);
-        if (sz) *sz = read_sz;
     }
 
     return buffer;
 }
 
+char* gs_platform_read_file_contents_default_impl(const char* file_path, const char* mode, size_t* sz)
+{
+    const gs_platform_archive_t* ar = NULL;
+    const gs_platform_archive_entry_t* entry = gs_platform_archive_find_mounted(file_path, &ar);
+    if (entry) return __gs_platform_archive_read_entry(ar, entry, sz);
+    return __gs_platform_read_file_loose(file_path, mode, sz);
+}
+
 gs_result gs_platform_write_file_contents_default_impl(const char* file_path, const char* mode, void* data, size_t sz)
 {
     const char* path = file_path;
@@ -725,6 +772,8 @@ GS_API_DECL int32_t gs_platform_mkdir_default_impl(const char* dir_path, int32_t
 
 bool gs_platform_file_exists_default_impl(const char* file_path)
 {
+    if (gs_platform_archive_find_mounted(file_path, NULL)) return true;
+
     const char* path = file_path;
 
     #ifdef GS_PLATFORM_ANDROID
@@ -743,6 +792,9 @@ bool gs_platform_file_exists_default_impl(const char* file_path)
 
 int32_t gs_platform_file_size_in_bytes_default_impl(const char* file_path)
 {
+    const gs_platform_archive_entry_t* entry = gs_platform_archive_find_mounted(file_path, NULL);
+    if (entry) return gs_util_safe_truncate_u64(entry->size);
+
     #ifdef GS_PLATFORM_WIN
 
         HANDLE hFile = CreateFile(file_path, GENERIC_READ, 
@@ -924,6 +976,472 @@ gs_platform_library_proc_address_default_impl(void* lib, const char* func)
     return NULL;
 }
 
+/*== Platform Archive ==*/
+
+GS_API_PRIVATE uint64_t 
+__gs_platform_archive_hash(const char* name, char* normalized, size_t normalized_sz)
+{
+    // Paths match regardless of separator and leading "./"
+    while (name[0] == '.' && (name[1] == '/' || name[1] == '\\')) name += 2;
+
+    uint64_t hash = UINT64_C(0xcbf29ce484222325);
+    size_t i = 0;
+    for (; name[i]; ++i) 
+    {
+        char c = name[i] == '\\' ? '/' : name[i];
+        if (normalized && i + 1 < normalized_sz) normalized[i] = c;
+        hash = (hash ^ (uint8_t)c) * UINT64_C(0x100000001b3);
+    }
+    if (normalized && normalized_sz) normalized[gs_min(i, normalized_sz - 1)] = '\0';
+    return hash;
+}
+
+gs_force_inline uint32_t 
+__gs_platform_archive_read32(const uint8_t* p) 
+{
+    uint32_t v; memcpy(&v, p, sizeof(v)); return v;
+}
+
+// LZ4 block format: [token: lit len | match len - 4][lit len ext][literals][offset u16][match len ext], 
+// last sequence is literals only and the last 5 bytes are always literals.
+#define GS_PLATFORM_ARCHIVE_LZ_HASH_BITS    14
+
+GS_API_PRIVATE size_t 
+__gs_platform_archive_lz_compress(const uint8_t* src, size_t sz, uint8_t* dst, size_t cap)
+{
+    uint32_t* table = (uint32_t*)gs_malloc(sizeof(uint32_t) << GS_PLATFORM_ARCHIVE_LZ_HASH_BITS);
+    memset(table, 0, sizeof(uint32_t) << GS_PLATFORM_ARCHIVE_LZ_HASH_BITS);
+
+    const uint8_t* ip = src;
+    const uint8_t* anchor = src;
+    const uint8_t* end = src + sz;
+    uint8_t* op = dst;
+    uint8_t* oend = dst + cap;
+
+    if (sz >= 13) 
+    {
+        const uint8_t* mflimit = end - 12;      // Last match start
+        const uint8_t* mlimit = end - 5;        // Last match end
+        while (ip < mflimit) 
+        {
+            uint32_t seq = __gs_platform_archive_read32(ip);
+            uint32_t h = (seq * 2654435761u) >> (32 - GS_PLATFORM_ARCHIVE_LZ_HASH_BITS);
+            const uint8_t* ref = src + table[h];
+            table[h] = (uint32_t)(ip - src);
+            if (ref >= ip || ip - ref > 0xFFFF || __gs_platform_archive_read32(ref) != seq) {
+                ip += 1 + ((ip - anchor) >> 6);     // Skip faster through incompressible data
+                continue;
+            }
+
+            const uint8_t* m = ip + 4; 
+            const uint8_t* r = ref + 4;
+            while (m < mlimit && *m == *r) {++m; ++r;}
+
+            size_t lit = (size_t)(ip - anchor);
+            size_t ml = (size_t)(m - ip) - 4;
+            if ((size_t)(oend - op) < lit + lit / 255 + ml / 255 + 8) {gs_free(table); return 0;}
+
+            uint8_t* token = op++;
+            *token = (uint8_t)((lit >= 15 ? 15 : lit) << 4);
+            if (lit >= 15) {size_t l = lit - 15; for (; l >= 255; l -= 255) *op++ = 255; *op++ = (uint8_t)l;}
+            memcpy(op, anchor, lit); op += lit;
+            uint16_t off = (uint16_t)(ip - ref);
+            *op++ = (uint8_t)(off & 0xFF); *op++ = (uint8_t)(off >> 8);
+            *token |= (uint8_t)(ml >= 15 ? 15 : ml);
+            if (ml >= 15) {size_t l = ml - 15; for (; l >= 255; l -= 255) *op++ = 255; *op++ = (uint8_t)l;}
+
+            ip = m;
+            anchor = ip;
+        }
+    }
+
+    // Trailing literals
+    size_t lit = (size_t)(end - anchor);
+    if ((size_t)(oend - op) < lit + lit / 255 + 2) {gs_free(table); return 0;}
+    *op++ = (uint8_t)((lit >= 15 ? 15 : lit) << 4);
+    if (lit >= 15) {size_t l = lit - 15; for (; l >= 255; l -= 255) *op++ = 255; *op++ = (uint8_t)l;}
+    memcpy(op, anchor, lit); op += lit;
+
+    gs_free(table);
+    return (size_t)(op - dst);
+}
+
+GS_API_PRIVATE bool 
+__gs_platform_archive_lz_decompress(const uint8_t* src, size_t sz, uint8_t* dst, size_t dst_sz)
+{
+    const uint8_t* ip = src;
+    const uint8_t* iend = src + sz;
+    uint8_t* op = dst;
+    uint8_t* oend = dst + dst_sz;
+
+    while (ip < iend) 
+    {
+        uint8_t token = *ip++;
+        size_t lit = token >> 4;
+        if (lit == 15) {
+            uint8_t b;
+            do {if (ip >= iend) return false; b = *ip++; lit += b;} while (b == 255);
+        }
+        if (lit > (size_t)(iend - ip) || lit > (size_t)(oend - op)) return false;
+        memcpy(op, ip, lit); op += lit; ip += lit;
+        if (ip == iend) break;
+
+        if (iend - ip < 2) return false;
+        size_t off = (size_t)ip[0] | ((size_t)ip[1] << 8); ip += 2;
+        if (!off || off > (size_t)(op - dst)) return false;
+        size_t ml = token & 15;
+        if (ml == 15) {
+            uint8_t b;
+            do {if (ip >= iend) return false; b = *ip++; ml += b;} while (b == 255);
+        }
+        ml += 4;
+        if (ml > (size_t)(oend - op)) return false;
+
+        const uint8_t* m = op - off;
+        if (off >= ml) {memcpy(op, m, ml); op += ml;}
+        else {while (ml--) *op++ = *m++;}     // Overlapping run
+    }
+    return op == oend;
+}
+
+typedef struct __gs_platform_archive_build_item_t
+{
+    gs_platform_archive_entry_t entry;
+    const char* name;
+} __gs_platform_archive_build_item_t;
+
+GS_API_PRIVATE int 
+__gs_platform_archive_build_item_cmp(const void* a, const void* b)
+{
+    const __gs_platform_archive_build_item_t* ia = (const __gs_platform_archive_build_item_t*)a;
+    const __gs_platform_archive_build_item_t* ib = (const __gs_platform_archive_build_item_t*)b;
+    if (ia->entry.hash != ib->entry.hash) return ia->entry.hash < ib->entry.hash ? -1 : 1;
+    return strcmp(ia->name, ib->name);
+}
+
+GS_API_DECL gs_result 
+gs_platform_archive_build(const char* out_path, const gs_platform_archive_build_entry_t* entries, uint32_t count)
+{
+    FILE* fp = fopen(out_path, "wb");
+    if (!fp) {
+        gs_println("Warning: Archive: could not open %s for writing", out_path);
+        return GS_RESULT_FAILURE;
+    }
+
+    gs_result res = GS_RESULT_SUCCESS;
+    gs_platform_archive_header_t header = gs_default_val();
+    header.magic = GS_PLATFORM_ARCHIVE_MAGIC;
+    header.version = GS_PLATFORM_ARCHIVE_VERSION;
+    header.entry_count = count;
+    fwrite(&header, sizeof(header), 1, fp);
+
+    __gs_platform_archive_build_item_t* items = (__gs_platform_archive_build_item_t*)gs_malloc(sizeof(__gs_platform_archive_build_item_t) * gs_max(count, 1));
+    char* names = NULL;
+    uint32_t names_size = 0;
+    uint64_t offset = sizeof(header);
+    const uint8_t pad[GS_PLATFORM_ARCHIVE_ALIGNMENT] = gs_default_val();
+
+    for (uint32_t i = 0; i < count; ++i) 
+    {
+        const gs_platform_archive_build_entry_t* be = &entries[i];
+        const char* name = be->name ? be->name : be->path;
+        __gs_platform_archive_build_item_t* it = &items[i];
+        memset(it, 0, sizeof(*it));
+
+        // Normalized name into the name block
+        size_t len = gs_string_length(name);
+        names = (char*)gs_realloc(names, names_size + len + 1);
+        it->entry.hash = __gs_platform_archive_hash(name, names + names_size, len + 1);
+        it->entry.name_offset = names_size;
+        names_size += (uint32_t)gs_string_length(names + names_size) + 1;
+
+        size_t sz = 0;
+        uint8_t* data = (uint8_t*)__gs_platform_read_file_loose(be->path, "rb", &sz);
+        if (!data) {
+            gs_println("Warning: Archive: could not read %s", be->path);
+            res = GS_RESULT_FAILURE;
+            break;
+        }
+
+        const uint8_t* stored = data;
+        size_t stored_sz = sz;
+        uint8_t* packed = NULL;
+        if (be->compress && sz) {
+            size_t cap = sz + sz / 255 + 16;
+            packed = (uint8_t*)gs_malloc(cap);
+            size_t psz = __gs_platform_archive_lz_compress(data, sz, packed, cap);
+            if (psz && psz < sz - sz / 16) {
+                stored = packed;
+                stored_sz = psz;
+                it->entry.flags |= GS_PLATFORM_ARCHIVE_ENTRY_COMPRESSED;
+            }
+        }
+
+        // Align so uncompressed data can be viewed in place
+        size_t padding = (size_t)((GS_PLATFORM_ARCHIVE_ALIGNMENT - (offset % GS_PLATFORM_ARCHIVE_ALIGNMENT)) % GS_PLATFORM_ARCHIVE_ALIGNMENT);
+        fwrite(pad, 1, padding, fp);
+        offset += padding;
+        it->entry.offset = offset;
+        it->entry.size = sz;
+        it->entry.stored_size = stored_sz;
+        if (stored_sz) fwrite(stored, 1, stored_sz, fp);
+        offset += stored_sz;
+
+        if (packed) gs_free(packed);
+        gs_free(data);
+    }
+
+    if (res == GS_RESULT_SUCCESS) 
+    {
+        for (uint32_t i = 0; i < count; ++i) items[i].name = names + items[i].entry.name_offset;
+        qsort(items, count, sizeof(__gs_platform_archive_build_item_t), __gs_platform_archive_build_item_cmp);
+        for (uint32_t i = 1; i < count; ++i) {
+            if (items[i].entry.hash == items[i - 1].entry.hash && !strcmp(items[i].name, items[i - 1].name)) {
+                gs_println("Warning: Archive: duplicate entry %s", items[i].name);
+                res = GS_RESULT_FAILURE;
+            }
+        }
+    }
+
+    if (res == GS_RESULT_SUCCESS) 
+    {
+        size_t padding = (size_t)((8 - (offset % 8)) % 8);
+        fwrite(pad, 1, padding, fp);
+        offset += padding;
+        header.toc_offset = offset;
+        for (uint32_t i = 0; i < count; ++i) fwrite(&items[i].entry, sizeof(gs_platform_archive_entry_t), 1, fp);
+        offset += (uint64_t)count * sizeof(gs_platform_archive_entry_t);
+        header.names_offset = offset;
+        header.names_size = names_size;
+        if (names_size) fwrite(names, 1, names_size, fp);
+
+        fseek(fp, 0, SEEK_SET);
+        fwrite(&header, sizeof(header), 1, fp);
+    }
+
+    fclose(fp);
+    gs_free(items);
+    if (names) gs_free(names);
+    if (res != GS_RESULT_SUCCESS) remove(out_path);
+    return res;
+}
+
+GS_API_DECL gs_platform_archive_t* 
+gs_platform_archive_open(const char* path)
+{
+    gs_platform_archive_t* ar = gs_malloc_init(gs_platform_archive_t);
+
+    #if (defined GS_PLATFORM_WIN)
+
+        HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+        if (file != INVALID_HANDLE_VALUE) {
+            LARGE_INTEGER size;
+            HANDLE map = GetFileSizeEx(file, &size) && size.QuadPart ? CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL) : NULL;
+            void* view = map ? MapViewOfFile(map, FILE_MAP_READ, 0, 0, 0) : NULL;
+            if (view) {
+                ar->data = (uint8_t*)view;
+                ar->size = (size_t)size.QuadPart;
+                ar->file_handle = (void*)file;
+                ar->map_handle = (void*)map;
+                ar->mapped = true;
+            }
+            else {
+                if (map) CloseHandle(map);
+                CloseHandle(file);
+            }
+        }
+
+    #elif (defined GS_PLATFORM_LINUX || defined GS_PLATFORM_APPLE || defined GS_PLATFORM_ANDROID)
+
+        const char* fpath = path;
+        #ifdef GS_PLATFORM_ANDROID
+            const char* internal_data_path = gs_app()->android.internal_data_path;
+            gs_snprintfc(tmp_path, 1024, "%s/%s", internal_data_path, path);
+            fpath = tmp_path;
+        #endif
+
+        int fd = open(fpath, O_RDONLY);
+        if (fd >= 0) {
+            struct stat st;
+            if (fstat(fd, &st) == 0 && st.st_size > 0) {
+                void* view = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+                if (view != MAP_FAILED) {
+                    ar->data = (uint8_t*)view;
+                    ar->size = (size_t)st.st_size;
+                    ar->mapped = true;
+                }
+            }
+            close(fd);  // Mapping holds its own reference
+        }
+
+    #endif
+
+    // No mapping available, read whole archive
+    if (!ar->data) {
+        ar->data = (uint8_t*)__gs_platform_read_file_loose(path, "rb", &ar->size);
+    }
+
+    // Validate
+    const gs_platform_archive_header_t* h = (const gs_platform_archive_header_t*)ar->data;
+    if (
+        !ar->data || ar->size < sizeof(gs_platform_archive_header_t) || 
+        h->magic != GS_PLATFORM_ARCHIVE_MAGIC || h->version != GS_PLATFORM_ARCHIVE_VERSION ||
+        h->toc_offset > ar->size || (ar->size - h->toc_offset) / sizeof(gs_platform_archive_entry_t) < h->entry_count ||
+        h->names_offset > ar->size || ar->size - h->names_offset < h->names_size
+    )
+    {
+        gs_println("Warning: Archive: invalid archive %s", path);
+        gs_platform_archive_close(ar);
+        return NULL;
+    }
+
+    ar->header = h;
+    ar->toc = (const gs_platform_archive_entry_t*)(ar->data + h->toc_offset);
+    ar->names = (const char*)(ar->data + h->names_offset);
+
+    // Fan out on top hash byte to narrow the binary search
+    uint32_t e = 0;
+    for (uint32_t b = 0; b < 256; ++b) {
+        ar->fanout[b] = e;
+        while (e < h->entry_count && (ar->toc[e].hash >> 56) == b) ++e;
+    }
+    ar->fanout[256] = h->entry_count;
+
+    return ar;
+}
+
+GS_API_DECL void 
+gs_platform_archive_close(gs_platform_archive_t* ar)
+{
+    if (!ar) return;
+    if (ar->mapped) 
+    {
+        #if (defined GS_PLATFORM_WIN)
+            UnmapViewOfFile(ar->data);
+            CloseHandle((HANDLE)ar->map_handle);
+            CloseHandle((HANDLE)ar->file_handle);
+        #elif (defined GS_PLATFORM_LINUX || defined GS_PLATFORM_APPLE || defined GS_PLATFORM_ANDROID)
+            munmap(ar->data, ar->size);
+        #endif
+    }
+    else if (ar->data) {
+        gs_free(ar->data);
+    }
+    gs_free(ar);
+}
+
+GS_API_DECL const gs_platform_archive_entry_t* 
+gs_platform_archive_find(const gs_platform_archive_t* ar, const char* name)
+{
+    if (!ar || !name) return NULL;
+
+    char normalized[1024];
+    uint64_t hash = __gs_platform_archive_hash(name, normalized, sizeof(normalized));
+
+    // Lower bound in fan out range
+    uint32_t lo = ar->fanout[hash >> 56]; 
+    uint32_t hi = ar->fanout[(hash >> 56) + 1];
+    while (lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        if (ar->toc[mid].hash < hash) lo = mid + 1;
+        else hi = mid;
+    }
+
+    // Resolve collisions by name
+    for (uint32_t i = lo; i < ar->header->entry_count && ar->toc[i].hash == hash; ++i) {
+        const gs_platform_archive_entry_t* e = &ar->toc[i];
+        if (e->name_offset < ar->header->names_size && !strcmp(ar->names + e->name_offset, normalized)) {
+            return e;
+        }
+    }
+    return NULL;
+}
+
+GS_API_DECL const void* 
+gs_platform_archive_view(const gs_platform_archive_t* ar, const char* name, size_t* sz)
+{
+    const gs_platform_archive_entry_t* e = gs_platform_archive_find(ar, name);
+    if (!e || (e->flags & GS_PLATFORM_ARCHIVE_ENTRY_COMPRESSED) || e->offset + e->stored_size > ar->size) return NULL;
+    if (sz) *sz = (size_t)e->size;
+    return ar->data + e->offset;
+}
+
+GS_API_PRIVATE char* 
+__gs_platform_archive_read_entry(const gs_platform_archive_t* ar, const gs_platform_archive_entry_t* e, size_t* sz)
+{
+    if (!e || e->offset > ar->size || ar->size - e->offset < e->stored_size) return NULL;
+
+    char* buffer = (char*)gs_malloc((size_t)e->size + 1);
+    if (!buffer) return NULL;
+    const uint8_t* src = ar->data + e->offset;
+    if (e->flags & GS_PLATFORM_ARCHIVE_ENTRY_COMPRESSED) {
+        if (!__gs_platform_archive_lz_decompress(src, (size_t)e->stored_size, (uint8_t*)buffer, (size_t)e->size)) {
+            gs_println("Warning: Archive: corrupt entry %s", ar->names + e->name_offset);
+            gs_free(buffer);
+            return NULL;
+        }
+    }
+    else {
+        memcpy(buffer, src, (size_t)e->size);
+    }
+    buffer[e->size] = '\0';
+    if (sz) *sz = (size_t)e->size;
+    return buffer;
+}
+
+GS_API_DECL char* 
+gs_platform_archive_read(const gs_platform_archive_t* ar, const char* name, size_t* sz)
+{
+    return __gs_platform_archive_read_entry(ar, gs_platform_archive_find(ar, name), sz);
+}
+
+GS_API_DECL gs_platform_archive_t* 
+gs_platform_archive_mount(const char* path)
+{
+    gs_assert(gs_instance() != NULL);
+    gs_platform_archive_t* ar = gs_platform_archive_open(path);
+    if (ar) gs_dyn_array_push(gs_subsystem(platform)->archives, ar);
+    return ar;
+}
+
+GS_API_DECL void 
+gs_platform_archive_unmount(gs_platform_archive_t* ar)
+{
+    gs_platform_t* platform = gs_subsystem(platform);
+    for (uint32_t i = 0; i < (uint32_t)gs_dyn_array_size(platform->archives); ++i) {
+        if (platform->archives[i] != ar) continue;
+        for (; i + 1 < (uint32_t)gs_dyn_array_size(platform->archives); ++i) platform->archives[i] = platform->archives[i + 1];
+        gs_dyn_array_pop(platform->archives);
+        gs_platform_archive_close(ar);
+        return;
+    }
+}
+
+GS_API_DECL void 
+gs_platform_archive_unmount_all()
+{
+    gs_platform_t* platform = gs_subsystem(platform);
+    for (uint32_t i = 0; i < (uint32_t)gs_dyn_array_size(platform->archives); ++i) {
+        gs_platform_archive_close(platform->archives[i]);
+    }
+    gs_dyn_array_clear(platform->archives);
+}
+
+GS_API_DECL const gs_platform_archive_entry_t* 
+gs_platform_archive_find_mounted(const char* name, const gs_platform_archive_t** out_ar)
+{
+    gs_platform_t* platform = gs_instance() ? gs_subsystem(platform) : NULL;
+    if (!platform) return NULL;
+    for (int32_t i = (int32_t)gs_dyn_array_size(platform->archives) - 1; i >= 0; --i) {
+        const gs_platform_archive_entry_t* e = gs_platform_archive_find(platform->archives[i], name);
+        if (e) {
+            if (out_ar) *out_ar = platform->archives[i];
+            return e;
+        }
+    }
+    return NULL;
+}
+
 #undef GS_PLATFORM_IMPL_DEFAULT
 #endif // GS_PLATFORM_IMPL_DEFAULT
 
@@ -966,6 +1484,9 @@ void __glfw_drop_callback(GLFWwindow* window);
     ((GLFWwindow*)(gs_slot_array_get((platform)->windows, (handle))))
 */
 
+// Timer value at init, elapsed time is reported relative to it
+gs_global uint64_t __glfw_timer_start = 0;
+
 /*== Platform Init / Shutdown == */
 
 void gs_platform_init(gs_platform_t* pf)
@@ -974,6 +1495,7 @@ void gs_platform_init(gs_platform_t* pf)
 
     gs_println("Initializing GLFW");
     glfwInit();
+    __glfw_timer_start = glfwGetTimerValue();
 
     switch (pf->settings.video.driver)
     {
@@ -1038,7 +1560,7 @@ GS_API_DECL void gs_platform_update_internal(gs_platform_t* platform)
     gs_platform_input_t* input = &platform->input; 
 
     // Platform time
-    platform->time.elapsed = (glfwGetTime() * 1000.0);
+    platform->time.elapsed = gs_platform_elapsed_time();
 
     // Update all window/framebuffer state
     for (
@@ -1672,8 +2194,9 @@ void  gs_platform_sleep(float ms)
 
 	    struct timespec ts = gs_default_val();
 	    int32_t res = 0;
-	    ts.tv_sec = ms / 1000.f;
-	    ts.tv_nsec = ((uint64_t)ms % 1000) * 1000000;
+	    uint64_t ns = (uint64_t)((double)ms * 1000000.0);
+	    ts.tv_sec = ns / 1000000000;
+	    ts.tv_nsec = ns % 1000000000;
 	    do {
 		res = nanosleep(&ts, &ts);
 	    } while (res && errno == EINTR);
@@ -1682,11 +2205,22 @@ void  gs_platform_sleep(float ms)
     #endif
 }
 
+GS_API_DECL uint64_t 
+gs_platform_elapsed_time_ns()
+{
+    // Frequency is 0 before glfwInit
+    const uint64_t freq = glfwGetTimerFrequency();
+    if (!freq) return 0;
+
+    // Counter since init split into whole seconds and remainder so the ns scale can't overflow
+    const uint64_t ticks = glfwGetTimerValue() - __glfw_timer_start;
+    return (ticks / freq) * 1000000000 + ((ticks % freq) * 1000000000) / freq;
+}
+
 GS_API_DECL double 
 gs_platform_elapsed_time()
 { 
-    gs_platform_t* platform = gs_subsystem(platform);
-    return platform->time.elapsed;
+    return (double)gs_platform_elapsed_time_ns() / 1000000.0;
 }
 
 /*== Platform Video == */
@@ -2647,6 +3181,12 @@ gs_platform_elapsed_time()
     return emscripten_performance_now(); 
 }
 
+GS_API_DECL uint64_t 
+gs_platform_elapsed_time_ns()
+{
+    return (uint64_t)(emscripten_performance_now() * 1000000.0);
+}
+
 // Platform Video
 GS_API_DECL void 
 gs_platform_enable_vsync(int32_t enabled)
@@ -3622,11 +4162,22 @@ gs_platform_shutdown(gs_platform_t* platform)
 }
 
 // Platform Util
+GS_API_DECL uint64_t
+gs_platform_elapsed_time_ns()
+{
+    // Monotonic wall clock (clock() is process cpu time, which stalls while sleeping)
+    static uint64_t start = 0;
+    struct timespec ts = gs_default_val();
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    uint64_t now = (uint64_t)ts.tv_sec * 1000000000 + (uint64_t)ts.tv_nsec;
+    if (!start) start = now;
+    return now - start;
+}
+
 GS_API_DECL double
 gs_platform_elapsed_time()
 {
-    gs_android_t* android = GS_PLATFORM_ANDROID_DATA();
-    return ((double)clock() / (double)CLOCKS_PER_SEC) * 1000.0;
+    return (double)gs_platform_elapsed_time_ns() / 1000000.0;
 }
 
 GS_API_DECL void   
@@ -77,15 +77,73 @@ typedef struct gs_asset_s
 
 GS_API_DECL gs_asset_t __gs_asset_handle_create_impl(uint64_t type_id, uint32_t asset_id, uint32_t importer_id);
 
+/*
+	Type ids: gs_hash_str64() of the type name, resolved without hashing at the call site. 
+	C++ evaluates the hash at compile time. C caches ids by string literal address 
+	(identical literals are pooled by the compiler), so lookups only hash on a cache miss.
+*/
+#ifdef __cplusplus
+	constexpr uint32_t __gs_asset_hash_str32_ct(const char* str, size_t i, uint32_t hash)
+	{
+		return i ? __gs_asset_hash_str32_ct(str, i - 1, (hash * 33) ^ (uint32_t)str[i - 1]) : hash;
+	}
+
+	constexpr uint64_t __gs_asset_hash_str64_ct(const char* str, size_t len)
+	{
+		return (uint64_t)(uint32_t)(__gs_asset_hash_str32_ct(str, len, 5381) * 4096 + __gs_asset_hash_str32_ct(str, len, 52711));
+	}
+
+	template <uint64_t ID>
+	struct __gs_asset_type_id_ct {static const uint64_t value = ID;};
+
+	#define gs_asset_type_id(T)\
+		(__gs_asset_type_id_ct<__gs_asset_hash_str64_ct(#T, sizeof(#T) - 1)>::value)
+#else
+	#ifndef GS_ASSET_TYPE_ID_CACHE_SIZE
+		#define GS_ASSET_TYPE_ID_CACHE_SIZE 64
+	#endif
+
+	// Per thread, so importer jobs running on workers never race on an entry
+	gs_force_inline uint64_t 
+	__gs_asset_type_id_cached(const char* name)
+	{
+		static gs_thread_local struct {const char* name; uint64_t id;} cache[GS_ASSET_TYPE_ID_CACHE_SIZE];
+		uint32_t i = (uint32_t)(((uintptr_t)name >> 3) % GS_ASSET_TYPE_ID_CACHE_SIZE);
+		if (cache[i].name != name) {
+			cache[i].id = gs_hash_str64(name);
+			cache[i].name = name;
+		}
+		return cache[i].id;
+	}
+
+	#define gs_asset_type_id(T)\
+		__gs_asset_type_id_cached(gs_to_str(T))
+#endif
+
 #define gs_asset_handle_create(T, ID, IMPID)\
-	__gs_asset_handle_create_impl(gs_hash_str64(gs_to_str(T)), ID, IMPID)
+	__gs_asset_handle_create_impl(gs_asset_type_id(T), ID, IMPID)
 
 typedef void (* gs_asset_load_func)(const char *,void *,...);
 typedef gs_asset_t (* gs_asset_default_func)(void *);
 
+/*
+	Async loading (optional per importer): 
+		decode: 		Worker thread. File io + decode, returns payload (NULL on failure) and bytes to upload.
+		upload: 		Main thread. Creates resources from payload into out, consumes payload.
+		free_decoded: 	Main thread. Releases a payload that won't be uploaded.
+		params_size: 	Size of the load params struct copied per request (params are NULL if none given).
+*/
+typedef void* (* gs_asset_decode_func)(const char* path, const void* params, size_t* upload_bytes);
+typedef bool (* gs_asset_upload_func)(void* decoded, void* out, const void* params);
+typedef void (* gs_asset_free_decoded_func)(void* decoded);
+
 typedef struct gs_asset_importer_desc_t {
 	void (* load_from_file)(const char* path, void* out, ...);
 	gs_asset_t (* default_asset)(void* out);
+	gs_asset_decode_func decode;
+	gs_asset_upload_func upload;
+	gs_asset_free_decoded_func free_decoded;
+	size_t params_size;
 } gs_asset_importer_desc_t;
 
 typedef struct gs_asset_importer_t 
@@ -98,7 +156,9 @@ typedef struct gs_asset_importer_t
 	size_t data_size;
 	gs_asset_importer_desc_t desc;
 	uint32_t importer_id;
+	uint64_t type_id;
 	gs_asset_t default_asset;
+	gs_dyn_array(uint32_t) redirects;	// Asset id -> default asset id while an async load is pending or failed, UINT32_MAX otherwise
 } gs_asset_importer_t;
 
 GS_API_DECL void gs_asset_default_load_from_file( const char* path, void* out );
@@ -106,7 +166,7 @@ GS_API_DECL gs_asset_t gs_asset_default_asset();
 GS_API_DECL void gs_asset_importer_set_desc(gs_asset_importer_t* imp, gs_asset_importer_desc_t* desc);
 
 #define gs_assets_get_importerp(AM, T)\
-	(gs_hash_table_getp((AM)->importers, gs_hash_str64(gs_to_str(T))))
+	(&(AM)->importers[gs_hash_table_get((AM)->importer_ids, gs_asset_type_id(T))])
 
 #ifdef __cplusplus
 	#define gsa_imsa(IMPORTER, T)\
@@ -121,6 +181,7 @@ GS_API_DECL void gs_asset_importer_set_desc(gs_asset_importer_t* imp, gs_asset_i
 		gs_asset_importer_t ai = gs_default_val();\
 		ai.data_size = sizeof(T);\
 		ai.importer_id = (AM)->free_importer_id++;\
+		ai.type_id = gs_asset_type_id(T);\
 		gs_asset_importer_set_desc(&ai, (gs_asset_importer_desc_t*)DESC);\
 		size_t sz = 2 * sizeof(void*) + sizeof(T);\
 		gs_slot_array(T) sa = NULL;\
@@ -132,14 +193,14 @@ GS_API_DECL void gs_asset_importer_set_desc(gs_asset_importer_t* imp, gs_asset_i
 		ai.slot_array_indices_ptr = (void*)sa->indices;\
 		ai.slot_array_data_ptr = (void*)sa->data;\
 		if (!ai.desc.load_from_file) {ai.desc.load_from_file = (gs_asset_load_func)&gs_asset_default_load_from_file;}\
-		gs_hash_table_insert((AM)->importers, gs_hash_str64(gs_to_str(T)), ai);\
+		gs_hash_table_insert((AM)->importer_ids, ai.type_id, ai.importer_id);\
+		gs_dyn_array_push((AM)->importers, ai);\
 	} while(0)
 
 // Need a way to be able to print upon assert
 #define gs_assets_load_from_file(AM, T, PATH, ...)\
 	(\
-		/*gs_assert(gs_hash_table_key_exists((AM)->importers, gs_hash_str64(gs_to_str(T)))),*/\
-		(AM)->tmpi = gs_hash_table_getp((AM)->importers, gs_hash_str64(gs_to_str(T))),\
+		(AM)->tmpi = gs_assets_get_importerp(AM, T),\
 		(AM)->tmpi->desc.load_from_file(PATH, (AM)->tmpi->tmp_ptr, ## __VA_ARGS__),\
 		(AM)->tmpi->tmpid = gs_slot_array_insert_func(&(AM)->tmpi->slot_array_indices_ptr, &(AM)->tmpi->slot_array_data_ptr, (AM)->tmpi->tmp_ptr, (AM)->tmpi->data_size, NULL),\
 		gs_asset_handle_create(T, (AM)->tmpi->tmpid, (AM)->tmpi->importer_id)\
@@ -147,36 +208,135 @@ GS_API_DECL void gs_asset_importer_set_desc(gs_asset_importer_t* imp, gs_asset_i
 
 #define gs_assets_create_asset(AM, T, DATA)\
 	(\
-		/*gs_assert(gs_hash_table_key_exists((AM)->importers, gs_hash_str64(gs_to_str(T)))),*/\
-		(AM)->tmpi = gs_hash_table_getp((AM)->importers, gs_hash_str64(gs_to_str(T))),\
+		(AM)->tmpi = gs_assets_get_importerp(AM, T),\
 		(AM)->tmpi->tmp_ptr = (DATA),\
 		(AM)->tmpi->tmpid = gs_slot_array_insert_func(&(AM)->tmpi->slot_array_indices_ptr, &(AM)->tmpi->slot_array_data_ptr, (AM)->tmpi->tmp_ptr, (AM)->tmpi->data_size, NULL),\
 		gs_asset_handle_create(T, (AM)->tmpi->tmpid, (AM)->tmpi->importer_id)\
 	)
 
+gs_enum_decl(gs_asset_load_status,
+	GS_ASSET_LOAD_STATUS_DECODING,		// Queued or decoding on a worker, handle points to default asset
+	GS_ASSET_LOAD_STATUS_UPLOADING,		// Decoded, waiting for upload budget on the main thread
+	GS_ASSET_LOAD_STATUS_LOADED,		// Resident (also reported for synchronously loaded/created assets)
+	GS_ASSET_LOAD_STATUS_FAILED			// Decode or upload failed, handle keeps pointing to default asset
+);
+
+struct gs_asset_manager_t;
+
+// Called on the main thread (from gs_assets_update) once an async load is loaded or failed
+typedef void (* gs_asset_load_callback)(struct gs_asset_manager_t* am, gs_asset_t hndl, gs_asset_load_status status, void* user_data);
+
+typedef struct gs_asset_load_request_t
+{
+	gs_job_t job;
+	gs_asset_t hndl;
+	char* path;
+	void* params;
+	void* decoded;
+	size_t upload_bytes;
+	gs_asset_decode_func decode;
+	gs_asset_load_callback callback;
+	void* user_data;
+} gs_asset_load_request_t;
+
+#ifndef GS_ASSETS_UPLOAD_BUDGET_DEFAULT
+	#define GS_ASSETS_UPLOAD_BUDGET_DEFAULT (8 * 1024 * 1024)
+#endif
+
 typedef struct gs_asset_manager_t
 {
-	gs_hash_table(uint64_t, gs_asset_importer_t) importers;	// Maps hashed types to importer
+	gs_dyn_array(gs_asset_importer_t) importers;			// Importers, indexed by importer id
+	gs_hash_table(uint64_t, uint32_t) importer_ids;			// Maps type ids to importer id (registration/load only)
 	gs_asset_importer_t* tmpi;								// Temporary importer for caching 
 	uint32_t free_importer_id;
+
+	// Async loading
+	gs_jobs_t* jobs;										// Decode workers (engine job system if NULL, decoded in gs_assets_update if none)
+	size_t upload_budget;									// Max bytes uploaded per gs_assets_update (at least one asset is always uploaded)
+	gs_dyn_array(gs_asset_load_request_t*) decoding;		// In flight on workers
+	gs_dyn_array(gs_asset_load_request_t*) uploads;			// Decoded, FIFO
+	uint32_t upload_head;
+	gs_hash_table(uint64_t, gs_asset_load_status) load_status;	// Async loads not yet loaded (missing = loaded)
 } gs_asset_manager_t;
 
 GS_API_DECL gs_asset_manager_t gs_asset_manager_new();
 GS_API_DECL void gs_asset_manager_free(gs_asset_manager_t* am);
-GS_API_DECL void* __gs_assets_getp_impl(gs_asset_manager_t* am, uint64_t type_id, gs_asset_t hndl);
+GS_API_DECL void* __gs_assets_getp_invalid(gs_asset_manager_t* am, uint64_t type_id, gs_asset_t hndl);
+
+// Hot path: direct index by handle's importer id, type checked against importer
+gs_force_inline void* 
+__gs_assets_getp_impl(gs_asset_manager_t* am, uint64_t type_id, gs_asset_t hndl)
+{
+	if (hndl.importer_id >= (uint32_t)gs_dyn_array_size(am->importers) || 
+		am->importers[hndl.importer_id].type_id != type_id || hndl.type_id != type_id) {
+		return __gs_assets_getp_invalid(am, type_id, hndl);
+	}
+
+	gs_asset_importer_t* imp = &am->importers[hndl.importer_id];
+	uint32_t id = hndl.asset_id;
+	if (id < (uint32_t)gs_dyn_array_size(imp->redirects) && imp->redirects[id] != UINT32_MAX) {
+		id = imp->redirects[id];
+	}
+	uint32_t idx = ((uint32_t*)imp->slot_array_indices_ptr)[id];
+	return ((char*)imp->slot_array_data_ptr + imp->data_size * idx);
+}
 
 #define gs_assets_getp(AM, T, HNDL)\
-	(T*)(__gs_assets_getp_impl(AM, gs_hash_str64(gs_to_str(T)), HNDL))
+	((T*)(__gs_assets_getp_impl(AM, gs_asset_type_id(T), HNDL)))
 
 #define gs_assets_get(AM, T, HNDL)\
 	*(gs_assets_getp(AM, T, HNDL));
 
+/*
+	Async loading: 
+
+		gs_asset_t tex = gs_assets_load_async(&am, gs_asset_texture_t, "tex.png", NULL);	// Returns immediately
+		gs_assets_update(&am);																// Once per frame, main thread
+		if (gs_assets_load_status(&am, tex) == GS_ASSET_LOAD_STATUS_LOADED) {...}
+
+	Until loaded (or if the load fails), the handle resolves to the importer's default asset itself (see 
+	gs_assets_set_default), while its own slot holds zeroed data until the upload fills it. PARAMS points to the importer's params struct (copied), or NULL for defaults:
+		gs_asset_texture_t: 	gs_graphics_texture_desc_t
+		gs_asset_font_t: 		uint32_t point size
+		gs_asset_mesh_t: 		gs_asset_mesh_decl_t (layout array must stay alive until loaded)
+		gs_asset_audio_t: 		none
+*/
+GS_API_DECL gs_asset_t __gs_assets_load_async_impl(gs_asset_manager_t* am, gs_asset_importer_t* imp, const char* path, const void* params, gs_asset_load_callback cb, void* user_data);
+GS_API_DECL void gs_assets_update(gs_asset_manager_t* am);
+GS_API_DECL gs_asset_load_status gs_assets_load_status(gs_asset_manager_t* am, gs_asset_t hndl);
+GS_API_DECL uint32_t gs_assets_loads_pending(gs_asset_manager_t* am);
+
+#define gs_assets_load_async(AM, T, PATH, PARAMS)\
+	__gs_assets_load_async_impl(AM, gs_assets_get_importerp(AM, T), PATH, PARAMS, NULL, NULL)
+
+#define gs_assets_load_async_ex(AM, T, PATH, PARAMS, CB, USER_DATA)\
+	__gs_assets_load_async_impl(AM, gs_assets_get_importerp(AM, T), PATH, PARAMS, CB, USER_DATA)
+
+// Asset whose data backs handles while they're loading
+#define gs_assets_set_default(AM, T, HNDL)\
+	(gs_assets_get_importerp(AM, T)->default_asset = (HNDL))
+
 /** @} */ // end of gs_asset_util
 
 /*==== Implementation ====*/
 
 #ifdef GS_ASSET_IMPL
 
+// Default async importers
+void* __gs_asset_texture_decode(const char* path, const void* params, size_t* upload_bytes);
+bool  __gs_asset_texture_upload(void* decoded, void* out, const void* params);
+void  __gs_asset_texture_free_decoded(void* decoded);
+void* __gs_asset_font_decode(const char* path, const void* params, size_t* upload_bytes);
+bool  __gs_asset_font_upload(void* decoded, void* out, const void* params);
+void  __gs_asset_font_free_decoded(void* decoded);
+void* __gs_asset_audio_decode(const char* path, const void* params, size_t* upload_bytes);
+bool  __gs_asset_audio_upload(void* decoded, void* out, const void* params);
+void  __gs_asset_audio_free_decoded(void* decoded);
+void* __gs_asset_mesh_decode(const char* path, const void* params, size_t* upload_bytes);
+bool  __gs_asset_mesh_upload(void* decoded, void* out, const void* params);
+void  __gs_asset_mesh_free_decoded(void* decoded);
+void  __gs_assets_load_request_free(gs_asset_load_request_t* req);
+
 gs_asset_t __gs_asset_handle_create_impl(uint64_t type_id, uint32_t asset_id, uint32_t importer_id)
 {
 	gs_asset_t asset = gs_default_val();
@@ -202,53 +362,432 @@ gs_asset_manager_t gs_asset_manager_new()
 	audio_desc.load_from_file = (gs_asset_load_func)&gs_asset_audio_load_from_file;
 	mesh_desc.load_from_file = (gs_asset_load_func)&gs_asset_mesh_load_from_file;
 
+	tex_desc.decode = __gs_asset_texture_decode;
+	tex_desc.upload = __gs_asset_texture_upload;
+	tex_desc.free_decoded = __gs_asset_texture_free_decoded;
+	tex_desc.params_size = sizeof(gs_graphics_texture_desc_t);
+
+	font_desc.decode = __gs_asset_font_decode;
+	font_desc.upload = __gs_asset_font_upload;
+	font_desc.free_decoded = __gs_asset_font_free_decoded;
+	font_desc.params_size = sizeof(uint32_t);
+
+	audio_desc.decode = __gs_asset_audio_decode;
+	audio_desc.upload = __gs_asset_audio_upload;
+	audio_desc.free_decoded = __gs_asset_audio_free_decoded;
+
+	mesh_desc.decode = __gs_asset_mesh_decode;
+	mesh_desc.upload = __gs_asset_mesh_upload;
+	mesh_desc.free_decoded = __gs_asset_mesh_free_decoded;
+	mesh_desc.params_size = sizeof(gs_asset_mesh_decl_t);
+
 	gs_assets_register_importer(&assets, gs_asset_t, &asset_desc);
 	gs_assets_register_importer(&assets, gs_asset_texture_t, &tex_desc);
 	gs_assets_register_importer(&assets, gs_asset_font_t, &font_desc);
 	gs_assets_register_importer(&assets, gs_asset_audio_t, &audio_desc);
 	gs_assets_register_importer(&assets, gs_asset_mesh_t, &mesh_desc);
 
+	assets.upload_budget = GS_ASSETS_UPLOAD_BUDGET_DEFAULT;
+
 	return assets;
 }
 
 void gs_asset_manager_free(gs_asset_manager_t* am)
 {
+	// Drain in-flight loads, dropping their payloads
+	for (uint32_t i = 0; i < (uint32_t)gs_dyn_array_size(am->decoding); ++i) {
+		gs_asset_load_request_t* req = am->decoding[i];
+		if (req->job.jobs) gs_jobs_wait(am->jobs, &req->job);
+		gs_dyn_array_push(am->uploads, req);
+	}
+	for (uint32_t i = am->upload_head; i < (uint32_t)gs_dyn_array_size(am->uploads); ++i) {
+		gs_asset_load_request_t* req = am->uploads[i];
+		gs_asset_importer_t* imp = &am->importers[req->hndl.importer_id];
+		if (req->decoded) imp->desc.free_decoded(req->decoded);
+		__gs_assets_load_request_free(req);
+	}
+
 	// Free all data	
+	for (uint32_t i = 0; i < (uint32_t)gs_dyn_array_size(am->importers); ++i) {
+		gs_dyn_array_free(am->importers[i].redirects);
+	}
+	gs_dyn_array_free(am->decoding);
+	gs_dyn_array_free(am->uploads);
+	gs_hash_table_free(am->load_status);
+	gs_dyn_array_free(am->importers);
+	gs_hash_table_free(am->importer_ids);
 }
 
-void* __gs_assets_getp_impl(gs_asset_manager_t* am, uint64_t type_id, gs_asset_t hndl)
+/*==== Async Loading ====*/
+
+void __gs_assets_load_request_free(gs_asset_load_request_t* req)
 {
-	if (type_id != hndl.type_id) { 
-		gs_println("Warning: Type id: %zu doesn't match handle type id: %zu.", type_id, hndl.type_id);
-		gs_assert(false);
+	gs_free(req->path);
+	if (req->params) gs_free(req->params);
+	gs_free(req);
+}
+
+void __gs_assets_decode_job(void* user_data, uint32_t start, uint32_t end, uint32_t thread)
+{
+	gs_asset_load_request_t* req = (gs_asset_load_request_t*)user_data;
+	req->decoded = req->decode(req->path, req->params, &req->upload_bytes);
+}
+
+gs_force_inline uint64_t 
+__gs_assets_status_key(gs_asset_t hndl)
+{
+	return ((uint64_t)hndl.importer_id << 32) | (uint64_t)hndl.asset_id;
+}
+
+void __gs_assets_set_load_status(gs_asset_manager_t* am, gs_asset_t hndl, gs_asset_load_status status)
+{
+	// Update in place, since insert can place a duplicate past an erased slot
+	uint64_t key = __gs_assets_status_key(hndl);
+	if (gs_hash_table_exists(am->load_status, key)) {
+		if (status == GS_ASSET_LOAD_STATUS_LOADED) gs_hash_table_erase(am->load_status, key);
+		else *gs_hash_table_getp(am->load_status, key) = status;
+	}
+	else if (status != GS_ASSET_LOAD_STATUS_LOADED) {
+		gs_hash_table_insert(am->load_status, key, status);
+	}
+}
+
+gs_asset_t __gs_assets_load_async_impl(gs_asset_manager_t* am, gs_asset_importer_t* imp, const char* path, const void* params, gs_asset_load_callback cb, void* user_data)
+{
+	gs_asset_t hndl = gs_default_val();
+	if (!imp->desc.decode || !imp->desc.upload || !imp->desc.free_decoded) {
+		gs_println("Warning: Importer %zu does not support async loading: %s", imp->importer_id, path);
+		return hndl;
+	}
+
+	// Default to engine job system
+	if (!am->jobs && gs_instance()) {
+		am->jobs = gs_subsystem(jobs);
+	}
+
+	// Insert zeroed placeholder. Lookups are redirected to the default asset (if set) rather than copying it, 
+	// since a copy would alias whatever the default owns.
+	void* placeholder = gs_malloc(imp->data_size);
+	memset(placeholder, 0, imp->data_size);
+	uint32_t id = gs_slot_array_insert_func(&imp->slot_array_indices_ptr, &imp->slot_array_data_ptr, placeholder, imp->data_size, NULL);
+	hndl = __gs_asset_handle_create_impl(imp->type_id, id, imp->importer_id);
+	gs_free(placeholder);
+
+	while ((uint32_t)gs_dyn_array_size(imp->redirects) <= id) {
+		gs_dyn_array_push(imp->redirects, UINT32_MAX);
+	}
+	bool has_default = imp->default_asset.type_id == imp->type_id && imp->default_asset.importer_id == imp->importer_id;
+	imp->redirects[id] = has_default ? imp->default_asset.asset_id : UINT32_MAX;
+
+	gs_asset_load_request_t* req = (gs_asset_load_request_t*)gs_malloc(sizeof(gs_asset_load_request_t));
+	memset(req, 0, sizeof(gs_asset_load_request_t));
+	size_t len = gs_string_length(path);
+	req->path = (char*)gs_malloc(len + 1);
+	memcpy(req->path, path, len + 1);
+	if (params && imp->desc.params_size) {
+		req->params = gs_malloc(imp->desc.params_size);
+		memcpy(req->params, params, imp->desc.params_size);
+	}
+	req->hndl = hndl;
+	req->decode = imp->desc.decode;
+	req->callback = cb;
+	req->user_data = user_data;
+
+	__gs_assets_set_load_status(am, hndl, GS_ASSET_LOAD_STATUS_DECODING);
+	gs_dyn_array_push(am->decoding, req);
+
+	// Without workers, decoding happens in gs_assets_update instead
+	if (am->jobs && am->jobs->thread_count > 1) {
+		gs_job_init(&req->job, __gs_assets_decode_job, req, 1, 1);
+		gs_jobs_submit(am->jobs, &req->job);
+	}
+
+	return hndl;
+}
+
+void __gs_assets_load_finish(gs_asset_manager_t* am, gs_asset_load_request_t* req, gs_asset_load_status status)
+{
+	__gs_assets_set_load_status(am, req->hndl, status);
+	if (req->callback) req->callback(am, req->hndl, status, req->user_data);
+	__gs_assets_load_request_free(req);
+}
+
+void gs_assets_update(gs_asset_manager_t* am)
+{
+	// Collect finished decodes (in order of submission, one inline decode per update without workers)
+	uint32_t w = 0;
+	bool inline_decoded = false;
+	for (uint32_t i = 0; i < (uint32_t)gs_dyn_array_size(am->decoding); ++i) 
+	{
+		gs_asset_load_request_t* req = am->decoding[i];
+		if (req->job.jobs) {
+			if (!gs_jobs_done(&req->job)) {am->decoding[w++] = req; continue;}
+			gs_jobs_wait(am->jobs, &req->job);
+		}
+		else if (!inline_decoded) {
+			__gs_assets_decode_job(req, 0, 1, 0);
+			inline_decoded = true;
+		}
+		else {am->decoding[w++] = req; continue;}
+
+		if (!req->decoded) {
+			gs_println("Warning: Failed to decode asset: %s", req->path);
+			__gs_assets_load_finish(am, req, GS_ASSET_LOAD_STATUS_FAILED);
+			continue;
+		}
+		__gs_assets_set_load_status(am, req->hndl, GS_ASSET_LOAD_STATUS_UPLOADING);
+		gs_dyn_array_push(am->uploads, req);
+	}
+	if (am->decoding) gs_dyn_array_head(am->decoding)->size = w;
+
+	// Upload within budget
+	size_t used = 0;
+	while (am->upload_head < (uint32_t)gs_dyn_array_size(am->uploads)) 
+	{
+		gs_asset_load_request_t* req = am->uploads[am->upload_head];
+		if (used && used + req->upload_bytes > am->upload_budget) break;
+		used += req->upload_bytes;
+		am->upload_head++;
+
+		// Upload into the handle's own slot, then stop redirecting it to the default asset
+		gs_asset_importer_t* imp = &am->importers[req->hndl.importer_id];
+		uint32_t idx = ((uint32_t*)imp->slot_array_indices_ptr)[req->hndl.asset_id];
+		void* out = (char*)imp->slot_array_data_ptr + imp->data_size * idx;
+		bool ok = imp->desc.upload(req->decoded, out, req->params);
+		if (ok) imp->redirects[req->hndl.asset_id] = UINT32_MAX;
+		else gs_println("Warning: Failed to upload asset: %s", req->path);
+		__gs_assets_load_finish(am, req, ok ? GS_ASSET_LOAD_STATUS_LOADED : GS_ASSET_LOAD_STATUS_FAILED);
+	}
+
+	// Drop uploaded requests, so the queue stays bounded when the budget never lets it drain fully
+	if (am->upload_head) {
+		uint32_t remaining = (uint32_t)gs_dyn_array_size(am->uploads) - am->upload_head;
+		memmove(am->uploads, am->uploads + am->upload_head, remaining * sizeof(gs_asset_load_request_t*));
+		gs_dyn_array_head(am->uploads)->size = remaining;
+		am->upload_head = 0;
+	}
+}
+
+gs_asset_load_status gs_assets_load_status(gs_asset_manager_t* am, gs_asset_t hndl)
+{
+	uint64_t key = __gs_assets_status_key(hndl);
+	return gs_hash_table_exists(am->load_status, key) ? gs_hash_table_get(am->load_status, key) : GS_ASSET_LOAD_STATUS_LOADED;
+}
+
+uint32_t gs_assets_loads_pending(gs_asset_manager_t* am)
+{
+	return (uint32_t)gs_dyn_array_size(am->decoding) + (uint32_t)gs_dyn_array_size(am->uploads) - am->upload_head;
+}
+
+/*==== Default Async Importers ====*/
+
+void* __gs_asset_texture_decode(const char* path, const void* params, size_t* upload_bytes)
+{
+	gs_asset_texture_t* t = (gs_asset_texture_t*)gs_malloc(sizeof(gs_asset_texture_t));
+	memset(t, 0, sizeof(gs_asset_texture_t));
+	if (params) {
+		t->desc = *(const gs_graphics_texture_desc_t*)params;
+	} else {
+		t->desc.format = GS_GRAPHICS_TEXTURE_FORMAT_RGBA8;
+		t->desc.min_filter = GS_GRAPHICS_TEXTURE_FILTER_LINEAR;
+		t->desc.mag_filter = GS_GRAPHICS_TEXTURE_FILTER_LINEAR;
+		t->desc.wrap_s = GS_GRAPHICS_TEXTURE_WRAP_REPEAT;
+		t->desc.wrap_t = GS_GRAPHICS_TEXTURE_WRAP_REPEAT;
+	}
+
+	size_t len = 0;
+	char* file_data = gs_platform_read_file_contents(path, "rb", &len);
+	uint32_t num_comps = 0;
+	bool32_t loaded = file_data && gs_util_load_texture_data_from_memory(file_data, len, (int32_t*)&t->desc.width, 
+		(int32_t*)&t->desc.height, &num_comps, t->desc.data, t->desc.flip_y);
+	if (file_data) gs_free(file_data);
+	if (!loaded) {
+		gs_free(t);
 		return NULL;
 	}
 
-	// Need to grab the appropriate importer based on type	
-	if (!gs_hash_table_key_exists(am->importers, type_id)) {
-		gs_println("Warning: Importer type %zu does not exist.", type_id);
-		gs_assert(false);
+	*upload_bytes = (size_t)t->desc.width * t->desc.height * 4;
+	return t;
+}
+
+bool __gs_asset_texture_upload(void* decoded, void* out, const void* params)
+{
+	gs_asset_texture_t* t = (gs_asset_texture_t*)decoded;
+	void* data = *t->desc.data;
+	t->hndl = gs_graphics_texture_create(&t->desc);
+	*t->desc.data = NULL;
+	*(gs_asset_texture_t*)out = *t;
+	gs_free(data);
+	gs_free(t);
+	return true;
+}
+
+void __gs_asset_texture_free_decoded(void* decoded)
+{
+	gs_asset_texture_t* t = (gs_asset_texture_t*)decoded;
+	gs_free(*t->desc.data);
+	gs_free(t);
+}
+
+void* __gs_asset_font_decode(const char* path, const void* params, size_t* upload_bytes)
+{
+	size_t len = 0;
+	char* ttf = gs_platform_read_file_contents(path, "rb", &len);
+	if (!ttf) return NULL;
+
+	gs_asset_font_t* f = (gs_asset_font_t*)gs_malloc(sizeof(gs_asset_font_t));
+	memset(f, 0, sizeof(gs_asset_font_t));
+	bool ok = gs_asset_font_bake_from_memory(ttf, len, f, params ? *(const uint32_t*)params : 16);
+	gs_free(ttf);
+	if (!ok) {
+		__gs_asset_font_free_decoded(f);
 		return NULL;
 	}
 
-	gs_asset_importer_t* imp = gs_hash_table_getp(am->importers, type_id);
+	*upload_bytes = (size_t)f->texture.desc.width * f->texture.desc.height * 4;
+	return f;
+}
 
-	// Vertify that importer id and handle importer id align
-	if (imp->importer_id != hndl.importer_id) {
-		gs_println("Warning: Importer id: %zu does not match handle importer id: %zu.", 
-			imp->importer_id, hndl.importer_id);
-		gs_assert(false);
+bool __gs_asset_font_upload(void* decoded, void* out, const void* params)
+{
+	gs_asset_font_t* f = (gs_asset_font_t*)decoded;
+	void* data = *f->texture.desc.data;
+	f->texture.hndl = gs_graphics_texture_create(&f->texture.desc);
+	*f->texture.desc.data = NULL;
+	*(gs_asset_font_t*)out = *f;
+	gs_free(data);
+	gs_free(f);
+	return true;
+}
+
+void __gs_asset_font_free_decoded(void* decoded)
+{
+	gs_asset_font_t* f = (gs_asset_font_t*)decoded;
+	gs_free(*f->texture.desc.data);
+	gs_asset_font_atlas_free(f);   // Never uploaded, may run on a worker
+	gs_free(f);
+}
+
+void* __gs_asset_audio_decode(const char* path, const void* params, size_t* upload_bytes)
+{
+	gs_audio_source_t* src = (gs_audio_source_t*)gs_malloc(sizeof(gs_audio_source_t));
+	memset(src, 0, sizeof(gs_audio_source_t));
+	if (!gs_audio_decode_from_file(path, src)) {
+		gs_free(src);
+		return NULL;
+	}
+
+	// No gpu upload, mixer reads samples directly
+	*upload_bytes = 0;
+	return src;
+}
+
+bool __gs_asset_audio_upload(void* decoded, void* out, const void* params)
+{
+	gs_audio_source_t* src = (gs_audio_source_t*)decoded;
+	gs_asset_audio_t* a = (gs_asset_audio_t*)out;
+	a->hndl = gs_audio_source_create(src);
+	gs_free(src);
+	return gs_handle_is_valid(a->hndl);
+}
+
+void __gs_asset_audio_free_decoded(void* decoded)
+{
+	gs_audio_source_t* src = (gs_audio_source_t*)decoded;
+	if (src->samples) gs_free(src->samples);
+	gs_free(src);
+}
+
+typedef struct __gs_asset_mesh_decoded_t 
+{
+	gs_asset_mesh_raw_data_t* meshes;
+	uint32_t mesh_count;
+} __gs_asset_mesh_decoded_t;
+
+void* __gs_asset_mesh_decode(const char* path, const void* params, size_t* upload_bytes)
+{
+	__gs_asset_mesh_decoded_t* m = (__gs_asset_mesh_decoded_t*)gs_malloc(sizeof(__gs_asset_mesh_decoded_t));
+	memset(m, 0, sizeof(__gs_asset_mesh_decoded_t));
+
+	// Same restrictions as gs_asset_mesh_load_from_file: gltf, single mesh
+	char file_ext[32] = gs_default_val();
+	gs_platform_file_extension(file_ext, sizeof(file_ext), path);
+	if (!gs_platform_file_exists(path) || !gs_string_compare_equal(file_ext, "gltf") ||
+		!gs_util_load_gltf_data_from_file(path, (gs_asset_mesh_decl_t*)params, &m->meshes, &m->mesh_count) || m->mesh_count != 1) {
+		__gs_asset_mesh_free_decoded(m);
 		return NULL;
 	}
 
-	// Need to get data index from slot array using hndl asset id
-	size_t offset = (((sizeof(uint32_t) * hndl.asset_id) + 3) & (~3));
-	uint32_t idx = *(uint32_t*)((char*)(imp->slot_array_indices_ptr) + offset);
-	// Then need to return pointer to data at index
-	size_t data_sz = imp->data_size;
-	size_t s = data_sz == 8 ? 7 : 3;
-	offset = (((data_sz * idx) + s) & (~s));
-	return ((char*)(imp->slot_array_data_ptr) + offset);
+	*upload_bytes = 0;
+	for (uint32_t p = 0; p < m->meshes[0].prim_count; ++p) {
+		*upload_bytes += m->meshes[0].vertex_sizes[p] + m->meshes[0].index_sizes[p];
+	}
+	return m;
+}
+
+bool __gs_asset_mesh_upload(void* decoded, void* out, const void* params)
+{
+	__gs_asset_mesh_decoded_t* m = (__gs_asset_mesh_decoded_t*)decoded;
+	gs_asset_mesh_t* mesh = (gs_asset_mesh_t*)out;
+	gs_asset_mesh_raw_data_t* raw = &m->meshes[0];
+	mesh->primitives = NULL;
+
+	for (uint32_t p = 0; p < raw->prim_count; ++p)
+	{
+		gs_asset_mesh_primitive_t prim = gs_default_val();
+		prim.count = raw->index_sizes[p] / sizeof(uint16_t);
+
+		gs_graphics_vertex_buffer_desc_t vdesc = gs_default_val();
+		vdesc.data = raw->vertices[p];
+		vdesc.size = raw->vertex_sizes[p];
+		prim.vbo = gs_graphics_vertex_buffer_create(&vdesc);
+
+		gs_graphics_index_buffer_desc_t idesc = gs_default_val();
+		idesc.data = raw->indices[p];
+		idesc.size = raw->index_sizes[p];
+		prim.ibo = gs_graphics_index_buffer_create(&idesc);
+
+		gs_dyn_array_push(mesh->primitives, prim);
+	}
+
+	__gs_asset_mesh_free_decoded(m);
+	return true;
+}
+
+void __gs_asset_mesh_free_decoded(void* decoded)
+{
+	__gs_asset_mesh_decoded_t* m = (__gs_asset_mesh_decoded_t*)decoded;
+	for (uint32_t i = 0; i < m->mesh_count; ++i) 
+	{
+		gs_asset_mesh_raw_data_t* raw = &m->meshes[i];
+		for (uint32_t p = 0; p < raw->prim_count; ++p) {
+			gs_free(raw->vertices[p]);
+			gs_free(raw->indices[p]);
+		}
+		gs_free(raw->vertex_sizes);
+		gs_free(raw->index_sizes);
+		gs_free(raw->vertices);
+		gs_free(raw->indices);
+	}
+	if (m->meshes) gs_free(m->meshes);
+	gs_free(m);
+}
+
+// Slow path of __gs_assets_getp_impl, reports why the lookup failed
+void* __gs_assets_getp_invalid(gs_asset_manager_t* am, uint64_t type_id, gs_asset_t hndl)
+{
+	if (type_id != hndl.type_id) { 
+		gs_println("Warning: Type id: %zu doesn't match handle type id: %zu.", type_id, hndl.type_id);
+	}
+	else if (!gs_hash_table_key_exists(am->importer_ids, type_id)) {
+		gs_println("Warning: Importer type %zu does not exist.", type_id);
+	}
+	else {
+		gs_println("Warning: Importer id: %zu does not match handle importer id: %zu.", 
+			gs_hash_table_get(am->importer_ids, type_id), hndl.importer_id);
+	}
+	gs_assert(false);
+	return NULL;
 }
 
 void gs_asset_importer_set_desc(gs_asset_importer_t* imp, gs_asset_importer_desc_t* desc)
@@ -162,6 +162,47 @@
     #define GS_GFXT_UNIFORM_TIME "U_TIME"
 #endif
 
+// Name/binding of the std140 block that .sf pipelines declare their non-opaque uniforms in
+#ifndef GS_GFXT_UNIFORM_BLOCK_NAME
+    #define GS_GFXT_UNIFORM_BLOCK_NAME "GS_GFXT_UBLOCK"
+#endif
+
+#ifndef GS_GFXT_UNIFORM_BLOCK_BINDING
+    #define GS_GFXT_UNIFORM_BLOCK_BINDING 0
+#endif
+
+// Ring buffer that material uniform blocks are streamed through, and the alignment of each allocation
+// (must be a multiple of GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, which is at most 256 on common hardware)
+#ifndef GS_GFXT_UNIFORM_RING_SIZE
+    #define GS_GFXT_UNIFORM_RING_SIZE (1024 * 1024)
+#endif
+
+#ifndef GS_GFXT_UNIFORM_RING_ALIGN
+    #define GS_GFXT_UNIFORM_RING_ALIGN 256
+#endif
+
+// Directory that pipelines loaded through gs_gfxt_pipeline_load_from_* are cached in, keyed by a hash of their source.
+// Entries hold the parsed pipeline description, the generated GLSL and the linked program binary (when the driver
+// exposes one), and are rebuilt when the source or any of its includes change. Undefined (or NULL) disables the cache.
+#ifndef GS_GFXT_PIPELINE_CACHE_DIR
+    #define GS_GFXT_PIPELINE_CACHE_DIR NULL
+#endif
+
+// Max renderables per scene BVH leaf (leaves are frustum tested 4 at a time)
+#ifndef GS_GFXT_SCENE_BVH_LEAF_SIZE
+    #define GS_GFXT_SCENE_BVH_LEAF_SIZE 16
+#endif
+
+// Scenes with fewer renderables than this are always culled on the calling thread
+#ifndef GS_GFXT_SCENE_CULL_PARALLEL_MIN
+    #define GS_GFXT_SCENE_CULL_PARALLEL_MIN 8192
+#endif
+
+// FIFO post-transform cache size used for ACMR reporting and overdraw cluster splits
+#ifndef GS_GFXT_MESH_CACHE_SIZE
+    #define GS_GFXT_MESH_CACHE_SIZE 16
+#endif
+
 typedef void* (*gs_gfxt_raw_data_func)(GS_GFXT_HNDL hndl, void* user_data);
 
 #define GS_GFXT_RAW_DATA(FUNC_DESC, T)\
@@ -194,6 +235,7 @@ typedef struct gs_gfxt_uniform_t {
 typedef struct gs_gfxt_uniform_block_desc_t {
     gs_gfxt_uniform_desc_t* layout;                 // Layout for all uniform data for this block to hold
     size_t size;                                    // Size of layout in bytes
+    bool32 block;                                   // Shader declares non-opaque uniforms in a std140 block named GS_GFXT_UNIFORM_BLOCK_NAME
 } gs_gfxt_uniform_block_desc_t;
 
 typedef struct gs_gfxt_uniform_block_lookup_key_t {
@@ -204,6 +246,7 @@ typedef struct gs_gfxt_uniform_block_t {
     gs_dyn_array(gs_gfxt_uniform_t) uniforms;    // Raw uniform handle array
     gs_hash_table(uint64_t, uint32_t) lookup;    // Index lookup table (used for byte buffer offsets in material uni. data)
     size_t size;                                 // Total size of material data for entire block
+    size_t block_size;                           // Size of std140 block at start of material data (0 if uniforms are bound individually)
 } gs_gfxt_uniform_block_t; 
 
 //=== Texture ===//
@@ -240,6 +283,45 @@ typedef struct
     size_t size;
 } gs_gfxt_mesh_vertex_attribute_t;
 
+// Axis aligned bounds, empty (min > max) when there was no position data
+typedef struct gs_gfxt_aabb_t {
+    gs_vec3 min;
+    gs_vec3 max;
+} gs_gfxt_aabb_t;
+
+// Import time index/vertex reordering, applied per triangle primitive in this order
+typedef enum gs_gfxt_mesh_optimize_flags
+{
+    GS_GFXT_MESH_OPTIMIZE_VERTEX_CACHE = 0x01,   // Reorder triangles for post-transform cache reuse (Forsyth)
+    GS_GFXT_MESH_OPTIMIZE_OVERDRAW     = 0x02,   // Reorder cache-coherent triangle clusters front to back from the mesh center
+    GS_GFXT_MESH_OPTIMIZE_VERTEX_FETCH = 0x04,   // Renumber vertices in first-use order, dropping unreferenced ones
+    GS_GFXT_MESH_OPTIMIZE_INDEX_16     = 0x08,   // Write 16-bit indices if every primitive fits, else 32-bit (see stats)
+    GS_GFXT_MESH_OPTIMIZE_ALL          = 0x0F
+} gs_gfxt_mesh_optimize_flags;
+
+// Import time attribute quantization, pipelines must declare the matching .sf mesh attributes
+typedef enum gs_gfxt_mesh_quantize_flags
+{
+    GS_GFXT_MESH_QUANTIZE_POSITION_HALF  = 0x01,  // half4 positions, w = 1 (POSITION_HALF)
+    GS_GFXT_MESH_QUANTIZE_NORMAL_OCT     = 0x02,  // Octahedral snorm16x2 normals (NORMAL_OCT)
+    GS_GFXT_MESH_QUANTIZE_TEXCOORD_UNORM = 0x04,  // unorm16x2 texcoords, clamped to [0, 1] (TEXCOORD_UNORM)
+    GS_GFXT_MESH_QUANTIZE_ALL            = 0x07
+} gs_gfxt_mesh_quantize_flags;
+
+// Import totals over all primitives, before and after optimization/quantization
+typedef struct gs_gfxt_mesh_import_stats_t {
+    uint32_t triangles;
+    uint32_t vertices_before;
+    uint32_t vertices_after;
+    float acmr_before;                    // Average cache miss ratio, vertex shader invocations per triangle
+    float acmr_after;
+    float bytes_per_vertex_before;        // Size of one vertex across all streams
+    float bytes_per_vertex_after;
+    size_t vertex_bytes_before;
+    size_t vertex_bytes_after;
+    size_t index_element_size;            // Index width written, pipelines must use the same index_buffer_element_size
+} gs_gfxt_mesh_import_stats_t;
+
 typedef struct 
 {
     gs_gfxt_mesh_vertex_attribute_t positions;         // All position data
@@ -252,6 +334,8 @@ typedef struct
     gs_gfxt_mesh_vertex_attribute_t custom_uint[GS_GFXT_CUSTOM_UINT_MAX];
     gs_gfxt_mesh_vertex_attribute_t indices;                           
     uint32_t count;                                                     // Total count of indices
+    uint32_t quantize;                                                  // gs_gfxt_mesh_quantize_flags the streams were written with
+    gs_gfxt_aabb_t aabb;                                                // Bounds of quantized positions (float3 positions are measured on create)
 } gs_gfxt_mesh_vertex_data_t;
 
 // Structured/packed raw mesh data
@@ -264,6 +348,10 @@ typedef struct gs_gfxt_mesh_import_options_t {
     gs_gfxt_mesh_layout_t* layout;        // Mesh attribute layout array
     size_t size;                          // Size of mesh attribute layout array in bytes
     size_t index_buffer_element_size;     // Size of index data size in bytes
+    uint32_t optimize;                    // gs_gfxt_mesh_optimize_flags, 0 keeps file order
+    uint32_t quantize;                    // gs_gfxt_mesh_quantize_flags, 0 keeps float streams
+    float overdraw_threshold;             // Max ACMR growth allowed when splitting overdraw clusters (0 uses 1.05)
+    gs_gfxt_mesh_import_stats_t* stats;   // Optional, filled on import
 } gs_gfxt_mesh_import_options_t;
 
 GS_API_DECL void gs_gfxt_mesh_import_options_free(gs_gfxt_mesh_import_options_t* opt);
@@ -290,17 +378,26 @@ typedef struct gs_gfxt_mesh_primitive_s {
     gs_gfxt_vertex_stream_t stream;                 // All vertex data streams
     gs_handle(gs_graphics_index_buffer_t) indices;  // Index buffer
     uint32_t count;                                 // Total number of vertices
+    gs_gfxt_aabb_t aabb;                            // Local bounds of positions
 } gs_gfxt_mesh_primitive_t;
 
 typedef struct gs_gfxt_mesh_s {
     gs_dyn_array(gs_gfxt_mesh_primitive_t) primitives;
     gs_gfxt_mesh_desc_t desc;
+    gs_gfxt_aabb_t aabb;                            // Union of primitive bounds
 } gs_gfxt_mesh_t;
 
 //=== Pipeline ===//
+// Per-instance model matrix, fed as 4 consecutive vec4 vertex attributes (divisor 1) following the mesh attributes
+typedef struct gs_gfxt_instance_layout_t {
+    bool32 enabled;                                  // Pipeline can be drawn instanced
+    uint32_t attr;                                   // Vertex attribute index of the first matrix column
+} gs_gfxt_instance_layout_t;
+
 typedef struct gs_gfxt_pipeline_desc_s {
     gs_graphics_pipeline_desc_t  pip_desc;           // Description for constructing pipeline object
     gs_gfxt_uniform_block_desc_t ublock_desc;        // Description for constructing uniform block object
+    gs_gfxt_instance_layout_t instance;              // Per-instance attribute layout (optional)
 } gs_gfxt_pipeline_desc_t;
 
 typedef struct gs_gfxt_pipeline_s {
@@ -308,6 +405,7 @@ typedef struct gs_gfxt_pipeline_s {
     gs_gfxt_uniform_block_t ublock;                                 // Uniform block for holding all uniform data
     gs_dyn_array(gs_gfxt_mesh_layout_t) mesh_layout;  
     gs_graphics_pipeline_desc_t desc;
+    gs_gfxt_instance_layout_t instance;
 } gs_gfxt_pipeline_t;
 
 //=== Material ===//
@@ -333,8 +431,68 @@ typedef struct gs_gfxt_renderable_s {
 } gs_gfxt_renderable_t;
 
 //=== Graphics scene ===//
+typedef struct gs_gfxt_scene_group_key_t {
+    gs_gfxt_mesh_t* mesh;
+    gs_gfxt_material_t* material;
+} gs_gfxt_scene_group_key_t;
+
+typedef struct gs_gfxt_scene_group_t {
+    gs_gfxt_mesh_t* mesh;
+    gs_gfxt_material_t* material;
+    uint32_t offset;                    // First instance in scene instance data
+    uint32_t count;                     // Number of renderables in group
+} gs_gfxt_scene_group_t;
+
+typedef struct gs_gfxt_scene_stats_t {
+    uint32_t renderables;               // Renderables drawn
+    uint32_t groups;                    // Unique (mesh, material) pairs
+    uint32_t draws;                     // Draw calls issued
+    uint32_t instanced;                 // Renderables drawn through instanced draws
+} gs_gfxt_scene_stats_t;
+
+typedef struct gs_gfxt_scene_bvh_node_t {
+    gs_gfxt_aabb_t aabb;
+    uint32_t first;                     // First entry of subtree in scene bounds
+    uint32_t count;                     // Entries in subtree
+    uint32_t left;                      // Left child (right is left + 1), 0 for leaves
+} gs_gfxt_scene_bvh_node_t;
+
+// World bounds of every renderable, SoA in BVH leaf order (padded to a multiple of 4)
+typedef struct gs_gfxt_scene_bounds_t {
+    gs_dyn_array(float) cx;             // Centers
+    gs_dyn_array(float) cy;
+    gs_dyn_array(float) cz;
+    gs_dyn_array(float) ex;             // Half extents
+    gs_dyn_array(float) ey;
+    gs_dyn_array(float) ez;
+    gs_dyn_array(uint32_t) hndl;        // Renderable slot handle of each entry
+    gs_dyn_array(gs_gfxt_scene_bvh_node_t) nodes;
+    uint32_t count;
+} gs_gfxt_scene_bounds_t;
+
+// Subtree culled by one job, writing its visible handles at the subtree's first entry
+typedef struct gs_gfxt_scene_cull_item_t {
+    uint32_t node;
+    uint32_t planes;                    // Frustum planes still straddled, 0 when fully inside
+    uint32_t count;                     // Visible handles written
+} gs_gfxt_scene_cull_item_t;
+
 typedef struct gs_gfxt_scene_s {
     gs_slot_array(gs_gfxt_renderable_t) renderables;
+
+    // Rebuilt by gs_gfxt_scene_update_bounds, filtered by gs_gfxt_scene_cull
+    gs_gfxt_scene_bounds_t bounds;
+    gs_dyn_array(uint32_t) visible;                         // Renderable handles that passed the last cull (last render's draw list)
+    gs_dyn_array(gs_gfxt_scene_cull_item_t) cull_items;     // Subtrees of the last cull
+    bool32 culled;                                          // Next render draws only visible, then resets
+
+    // Rebuilt every gs_gfxt_scene_render
+    gs_hash_table(gs_gfxt_scene_group_key_t, uint32_t) group_lookup;
+    gs_dyn_array(gs_gfxt_scene_group_t) groups;
+    gs_dyn_array(uint32_t) group_idx;                       // Group of each renderable, in iteration order
+    gs_dyn_array(gs_mat4) instance_data;                    // Model matrices, contiguous per group
+    gs_handle(gs_graphics_vertex_buffer_t) instance_vbo;    // Streamed copy of instance_data
+    gs_gfxt_scene_stats_t stats;                            // Stats for last render
 } gs_gfxt_scene_t;
 
 //==== API =====//
@@ -354,6 +512,8 @@ GS_API_DECL void gs_gfxt_material_destroy(gs_gfxt_material_t* material);
 GS_API_DECL void gs_gfxt_mesh_destroy(gs_gfxt_mesh_t* mesh);
 GS_API_DECL void gs_gfxt_uniform_block_destroy(gs_gfxt_uniform_block_t* ub);
 GS_API_DECL void gs_gfxt_pipeline_destroy(gs_gfxt_pipeline_t* pipeline);
+GS_API_DECL void gs_gfxt_scene_destroy(gs_gfxt_scene_t* scene);
+GS_API_DECL void gs_gfxt_uniform_ring_destroy();    // Frees the shared material uniform ring, recreated on next use
 
 //=== Resource Loading ===//
 GS_API_DECL gs_gfxt_pipeline_t gs_gfxt_pipeline_load_from_file(const char* path);
@@ -383,6 +543,20 @@ GS_API_DECL void gs_gfxt_mesh_draw_layout(gs_command_buffer_t* cb, gs_gfxt_mesh_
 GS_API_DECL gs_gfxt_mesh_t gs_gfxt_mesh_load_from_file(const char* file, gs_gfxt_mesh_import_options_t* options);
 GS_API_DECL bool gs_gfxt_load_gltf_data_from_file(const char* path, gs_gfxt_mesh_import_options_t* options, gs_gfxt_mesh_raw_data_t** out, uint32_t* mesh_count);
 
+//=== Mesh Optimization API ===//
+// Triangle lists only. dst may alias indices.
+GS_API_DECL float gs_gfxt_mesh_acmr(const uint32_t* indices, uint32_t index_count, uint32_t vertex_count, uint32_t cache_size);
+GS_API_DECL void gs_gfxt_mesh_optimize_vertex_cache(uint32_t* dst, const uint32_t* indices, uint32_t index_count, uint32_t vertex_count);
+GS_API_DECL void gs_gfxt_mesh_optimize_overdraw(uint32_t* dst, const uint32_t* indices, uint32_t index_count, const gs_vec3* positions, uint32_t vertex_count, float threshold);
+GS_API_DECL uint32_t gs_gfxt_mesh_optimize_vertex_fetch_remap(uint32_t* remap, uint32_t* indices, uint32_t index_count, uint32_t vertex_count);  // Rewrites indices, returns new vertex count
+GS_API_DECL void gs_gfxt_mesh_remap_vertex_buffer(void* dst, const void* src, size_t stride, const uint32_t* remap, uint32_t vertex_count);        // dst must not alias src
+
+//=== Scene API ===//
+GS_API_DECL void gs_gfxt_scene_render(gs_command_buffer_t* cb, gs_gfxt_scene_t* scene, const gs_mat4* view_projection);
+GS_API_DECL void gs_gfxt_scene_update_bounds(gs_gfxt_scene_t* scene);   // Rebuild world bounds/BVH after adding, removing or moving renderables
+GS_API_DECL uint32_t gs_gfxt_scene_cull(gs_gfxt_scene_t* scene, const gs_mat4* view_projection, gs_jobs_t* jobs);  // Jobs optional, returns visible count
+GS_API_DECL uint32_t gs_gfxt_scene_cull_camera(gs_gfxt_scene_t* scene, const gs_camera_t* cam, int32_t view_width, int32_t view_height, gs_jobs_t* jobs);
+
 // Util API
 GS_API_DECL void* gs_gfxt_raw_data_default_impl(GS_GFXT_HNDL hndl, void* user_data);
 
@@ -409,11 +583,28 @@ gs_gfxt_pipeline_create(const gs_gfxt_pipeline_desc_t* desc)
     pip.hndl = gs_graphics_pipeline_create(&desc->pip_desc);
     pip.ublock = gs_gfxt_uniform_block_create(&desc->ublock_desc);
     pip.desc = desc->pip_desc;
+    pip.instance = desc->instance;
 	pip.desc.layout.attrs = gs_malloc(desc->pip_desc.layout.size);
 	memcpy(pip.desc.layout.attrs, desc->pip_desc.layout.attrs, desc->pip_desc.layout.size);
     return pip;
 }
 
+// Non-opaque uniforms can be packed into a uniform block, samplers/images can't
+gs_inline bool 
+gs_gfxt_uniform_type_is_block_member(gs_graphics_uniform_type type)
+{
+    switch (type)
+    {
+        case GS_GRAPHICS_UNIFORM_FLOAT:
+        case GS_GRAPHICS_UNIFORM_INT:
+        case GS_GRAPHICS_UNIFORM_VEC2:
+        case GS_GRAPHICS_UNIFORM_VEC3:
+        case GS_GRAPHICS_UNIFORM_VEC4:
+        case GS_GRAPHICS_UNIFORM_MAT4: return true;
+        default: return false;
+    }
+}
+
 GS_API_DECL gs_gfxt_uniform_block_t 
 gs_gfxt_uniform_block_create(const gs_gfxt_uniform_block_desc_t* desc)
 {
@@ -425,10 +616,53 @@ gs_gfxt_uniform_block_create(const gs_gfxt_uniform_block_desc_t* desc)
     uint32_t offset = 0;
     uint32_t image2D_offset = 0;
     uint32_t ct = desc->size / sizeof(gs_gfxt_uniform_desc_t);
+
+    // Block members are packed std140 at the front of material data, so the whole range uploads as is.
+    // Samplers can't live in a block and are placed after it.
+    if (desc->block)
+    {
+        for (uint32_t i = 0; i < ct; ++i)
+        {
+            gs_gfxt_uniform_desc_t* ud = &desc->layout[i];
+            uint32_t align = 0, sz = 0;
+            switch (ud->type)
+            {
+                default: continue;
+                case GS_GRAPHICS_UNIFORM_FLOAT: align = 4;  sz = sizeof(float);   break;
+                case GS_GRAPHICS_UNIFORM_INT:   align = 4;  sz = sizeof(int32_t); break;
+                case GS_GRAPHICS_UNIFORM_VEC2:  align = 8;  sz = sizeof(gs_vec2); break;
+                case GS_GRAPHICS_UNIFORM_VEC3:  align = 16; sz = sizeof(gs_vec3); break;
+                case GS_GRAPHICS_UNIFORM_VEC4:  align = 16; sz = sizeof(gs_vec4); break;
+                case GS_GRAPHICS_UNIFORM_MAT4:  align = 16; sz = sizeof(gs_mat4); break;
+            }
+
+            // Same uniform declared in multiple stages is a single block member
+            uint64_t key = gs_hash_str64(ud->name);
+            if (gs_hash_table_exists(block.lookup, key)) continue;
+
+            gs_gfxt_uniform_t u = gs_default_val();
+            u.type = ud->type;
+            u.binding = ud->binding;
+            u.size = sz;
+            u.offset = (offset + align - 1) & ~(align - 1);
+            offset = u.offset + sz;
+
+            gs_dyn_array_push(block.uniforms, u);
+            gs_hash_table_insert(block.lookup, key, gs_dyn_array_size(block.uniforms) - 1);
+        }
+
+        block.block_size = (offset + 15) & ~15;
+        offset = block.block_size;
+    }
+
     for (uint32_t i = 0; i < ct; ++i)
     {
         gs_gfxt_uniform_desc_t* ud = &desc->layout[i];
 
+        // Already placed in block
+        uint64_t key = gs_hash_str64(ud->name);
+        if (desc->block && gs_hash_table_exists(block.lookup, key)) continue;
+
         gs_gfxt_uniform_t u = gs_default_val();
         gs_graphics_uniform_desc_t u_desc = gs_default_val();
         gs_graphics_uniform_layout_desc_t u_layout = gs_default_val();
@@ -471,7 +705,6 @@ gs_gfxt_uniform_block_create(const gs_gfxt_uniform_block_desc_t* desc)
         }
 
         // Add uniform to block with name as key
-        uint64_t key = gs_hash_str64(ud->name);
         gs_dyn_array_push(block.uniforms, u);
         gs_hash_table_insert(block.lookup, key, gs_dyn_array_size(block.uniforms) - 1);
     }
@@ -510,10 +743,42 @@ gs_gfxt_material_create(gs_gfxt_material_desc_t* desc)
     return mat;
 }
 
+gs_force_inline gs_gfxt_aabb_t
+__gs_gfxt_aabb_empty()
+{
+    gs_gfxt_aabb_t aabb = gs_default_val();
+    aabb.min = gs_v3s(FLT_MAX);
+    aabb.max = gs_v3s(-FLT_MAX);
+    return aabb;
+}
+
+gs_force_inline gs_gfxt_aabb_t
+__gs_gfxt_aabb_union(gs_gfxt_aabb_t a, gs_gfxt_aabb_t b)
+{
+    gs_gfxt_aabb_t aabb = gs_default_val();
+    aabb.min = gs_v3(gs_min(a.min.x, b.min.x), gs_min(a.min.y, b.min.y), gs_min(a.min.z, b.min.z));
+    aabb.max = gs_v3(gs_max(a.max.x, b.max.x), gs_max(a.max.y, b.max.y), gs_max(a.max.z, b.max.z));
+    return aabb;
+}
+
+// Positions are tightly packed float3
+gs_force_inline gs_gfxt_aabb_t
+__gs_gfxt_aabb_from_positions(const gs_vec3* positions, size_t count)
+{
+    gs_gfxt_aabb_t aabb = __gs_gfxt_aabb_empty();
+    for (size_t i = 0; i < count; ++i) {
+        const gs_vec3 p = positions[i];
+        aabb.min = gs_v3(gs_min(aabb.min.x, p.x), gs_min(aabb.min.y, p.y), gs_min(aabb.min.z, p.z));
+        aabb.max = gs_v3(gs_max(aabb.max.x, p.x), gs_max(aabb.max.y, p.y), gs_max(aabb.max.z, p.z));
+    }
+    return aabb;
+}
+
 GS_API_DECL gs_gfxt_mesh_t 
 gs_gfxt_mesh_create(const gs_gfxt_mesh_desc_t* desc)
 {
     gs_gfxt_mesh_t mesh = gs_default_val();
+    mesh.aabb = __gs_gfxt_aabb_empty();
 
     if (!desc) {
         return mesh;
@@ -534,6 +799,7 @@ gs_gfxt_mesh_create(const gs_gfxt_mesh_desc_t* desc)
             // Construct primitive
             gs_gfxt_mesh_primitive_t prim = gs_default_val();
             prim.count = vdata->count;
+            prim.aabb = __gs_gfxt_aabb_empty();
 
             // Positions
             if (vdata->positions.data) 
@@ -542,6 +808,9 @@ gs_gfxt_mesh_create(const gs_gfxt_mesh_desc_t* desc)
                 vdesc.data = vdata->positions.data;
                 vdesc.size = vdata->positions.size;
                 prim.stream.positions = gs_graphics_vertex_buffer_create(&vdesc);
+                prim.aabb = (vdata->quantize & GS_GFXT_MESH_QUANTIZE_POSITION_HALF) ? vdata->aabb : 
+                    __gs_gfxt_aabb_from_positions((const gs_vec3*)vdata->positions.data, vdata->positions.size / sizeof(gs_vec3));
+                mesh.aabb = __gs_gfxt_aabb_union(mesh.aabb, prim.aabb);
                 if (!desc->keep_data)
                 { 
                     gs_free(vdata->positions.data);
@@ -701,6 +970,7 @@ gs_gfxt_mesh_update_or_create(gs_gfxt_mesh_t* mesh, const gs_gfxt_mesh_desc_t* d
             if (gs_dyn_array_empty(mesh->primitives) || gs_dyn_array_size(mesh->primitives) < p)
             { 
                 gs_gfxt_mesh_primitive_t dprim = gs_default_val(); 
+                dprim.aabb = __gs_gfxt_aabb_empty();
                 gs_dyn_array_push(mesh->primitives, dprim);
             }
             prim = &mesh->primitives[p];
@@ -725,6 +995,8 @@ gs_gfxt_mesh_update_or_create(gs_gfxt_mesh_t* mesh, const gs_gfxt_mesh_desc_t* d
                 {
                     prim->stream.positions = gs_graphics_vertex_buffer_create(&vdesc);
                 }
+                prim->aabb = (vdata->quantize & GS_GFXT_MESH_QUANTIZE_POSITION_HALF) ? vdata->aabb : 
+                    __gs_gfxt_aabb_from_positions((const gs_vec3*)vdata->positions.data, vdata->positions.size / sizeof(gs_vec3));
                 if (!desc->keep_data)
                 { 
                     gs_free(vdata->positions.data);
@@ -925,6 +1197,12 @@ gs_gfxt_mesh_update_or_create(gs_gfxt_mesh_t* mesh, const gs_gfxt_mesh_desc_t* d
     {
         gs_free(desc->meshes);
     }
+
+    mesh->aabb = __gs_gfxt_aabb_empty();
+    for (uint32_t p = 0; p < (uint32_t)gs_dyn_array_size(mesh->primitives); ++p)
+    {
+        mesh->aabb = __gs_gfxt_aabb_union(mesh->aabb, mesh->primitives[p].aabb);
+    }
 }
 
 GS_API_DECL gs_gfxt_renderable_t 
@@ -1008,6 +1286,27 @@ gs_gfxt_uniform_block_destroy(gs_gfxt_uniform_block_t* ub)
     gs_hash_table_free(ub->lookup);
 }
 
+GS_API_DECL void 
+gs_gfxt_scene_destroy(gs_gfxt_scene_t* scene)
+{
+    gs_slot_array_free(scene->renderables);
+    gs_hash_table_free(scene->group_lookup);
+    gs_dyn_array_free(scene->groups);
+    gs_dyn_array_free(scene->group_idx);
+    gs_dyn_array_free(scene->instance_data);
+    if (scene->instance_vbo.id) gs_graphics_vertex_buffer_destroy(scene->instance_vbo);
+    gs_dyn_array_free(scene->bounds.cx);
+    gs_dyn_array_free(scene->bounds.cy);
+    gs_dyn_array_free(scene->bounds.cz);
+    gs_dyn_array_free(scene->bounds.ex);
+    gs_dyn_array_free(scene->bounds.ey);
+    gs_dyn_array_free(scene->bounds.ez);
+    gs_dyn_array_free(scene->bounds.hndl);
+    gs_dyn_array_free(scene->bounds.nodes);
+    gs_dyn_array_free(scene->visible);
+    gs_dyn_array_free(scene->cull_items);
+}
+
 GS_API_DECL void 
 gs_gfxt_pipeline_destroy(gs_gfxt_pipeline_t* pipeline)
 { 
@@ -1123,6 +1422,59 @@ void gs_gfxt_material_bind_pipeline(gs_command_buffer_t* cb, gs_gfxt_material_t*
     gs_graphics_pipeline_bind(cb, pip->hndl);
 }
 
+// Stream uniform ring shared by all materials. Allocations wrap when full; buffer updates and draws
+// execute in submission order, so overwriting an earlier region never affects draws already issued.
+typedef struct gs_gfxt_uniform_ring_t {
+    gs_handle(gs_graphics_uniform_buffer_t) ubo;
+    size_t offset;
+} gs_gfxt_uniform_ring_t;
+
+static gs_gfxt_uniform_ring_t _gs_gfxt_uniform_ring = gs_default_val();
+
+gs_inline size_t 
+__gs_gfxt_uniform_ring_alloc(gs_command_buffer_t* cb, void* data, size_t sz)
+{
+    gs_gfxt_uniform_ring_t* ring = &_gs_gfxt_uniform_ring;
+    gs_assert(sz <= GS_GFXT_UNIFORM_RING_SIZE);
+
+    if (!ring->ubo.id)
+    {
+        gs_graphics_uniform_buffer_desc_t desc = gs_default_val();
+        desc.size = GS_GFXT_UNIFORM_RING_SIZE;
+        desc.usage = GS_GRAPHICS_BUFFER_USAGE_STREAM;
+        desc.name = GS_GFXT_UNIFORM_BLOCK_NAME;
+        ring->ubo = gs_graphics_uniform_buffer_create(&desc);
+        ring->offset = 0;
+    }
+
+    if (ring->offset + sz > GS_GFXT_UNIFORM_RING_SIZE) ring->offset = 0;
+    size_t offset = ring->offset;
+    ring->offset = (offset + sz + GS_GFXT_UNIFORM_RING_ALIGN - 1) & ~((size_t)GS_GFXT_UNIFORM_RING_ALIGN - 1);
+
+    gs_graphics_uniform_buffer_desc_t update = gs_default_val();
+    update.data = data;
+    update.size = sz;
+    update.usage = GS_GRAPHICS_BUFFER_USAGE_STREAM;
+    update.update.type = GS_GRAPHICS_BUFFER_UPDATE_SUBDATA;
+    update.update.offset = offset;
+    gs_graphics_uniform_buffer_request_update(cb, ring->ubo, &update);
+
+    return offset;
+}
+
+GS_API_DECL void 
+gs_gfxt_uniform_ring_destroy()
+{
+    gs_gfxt_uniform_ring_t* ring = &_gs_gfxt_uniform_ring;
+    if (ring->ubo.id) {
+        gs_graphics_uniform_buffer_destroy(ring->ubo);
+    }
+    ring->ubo.id = 0;
+    ring->offset = 0;
+}
+
+#define GS_GFXT_BIND_BATCH_MAX 32
+
 GS_API_DECL 
 void gs_gfxt_material_bind_uniforms(gs_command_buffer_t* cb, gs_gfxt_material_t* mat)
 {
@@ -1131,38 +1483,59 @@ void gs_gfxt_material_bind_uniforms(gs_command_buffer_t* cb, gs_gfxt_material_t*
     gs_gfxt_pipeline_t* pip = GS_GFXT_RAW_DATA(&mat->desc.pip_func, gs_gfxt_pipeline_t);
     gs_assert(pip);
 
+    // Bindings are gathered and applied in as few calls as possible
+    gs_graphics_bind_uniform_desc_t uniforms[GS_GFXT_BIND_BATCH_MAX];
+    gs_graphics_bind_image_buffer_desc_t ibuffers[GS_GFXT_BIND_BATCH_MAX];
+    gs_graphics_bind_uniform_buffer_desc_t ubuffer = gs_default_val();
+    uint32_t uct = 0, ict = 0;
+
+    // Whole std140 block goes up in one ring allocation, bound with its offset
+    if (pip->ublock.block_size)
+    {
+        ubuffer.range.offset = __gs_gfxt_uniform_ring_alloc(cb, mat->uniform_data.data, pip->ublock.block_size);
+        ubuffer.range.size = pip->ublock.block_size;
+        ubuffer.buffer = _gs_gfxt_uniform_ring.ubo;
+        ubuffer.binding = GS_GFXT_UNIFORM_BLOCK_BINDING;
+    }
+
     // Grab uniform layout from pipeline
-    for (uint32_t i = 0; i < gs_dyn_array_size(pip->ublock.uniforms); ++i) 
+    const uint32_t ct = gs_dyn_array_size(pip->ublock.uniforms);
+    for (uint32_t i = 0; i < ct; ++i) 
     { 
         gs_gfxt_uniform_t* u = &pip->ublock.uniforms[i];
-        gs_graphics_bind_desc_t bind = gs_default_val(); 
 
-        // Need to buffer these up so it's a single call...
         switch (u->type)
         {
             case GS_GRAPHICS_UNIFORM_IMAGE2D_RGBA32F:
             {
-                gs_graphics_bind_image_buffer_desc_t ibuffer[1];
-                ibuffer[0].tex = *(gs_handle(gs_graphics_texture_t)*)(mat->image_buffer_data.data + u->offset);
-                ibuffer[0].binding = u->binding;
-                ibuffer[0].access = GS_GRAPHICS_ACCESS_WRITE_ONLY;
-                bind.image_buffers.desc = ibuffer;
-                bind.image_buffers.size = sizeof(ibuffer);
-                gs_graphics_apply_bindings(cb, &bind);
+                ibuffers[ict].tex = *(gs_handle(gs_graphics_texture_t)*)(mat->image_buffer_data.data + u->offset);
+                ibuffers[ict].binding = u->binding;
+                ibuffers[ict].access = GS_GRAPHICS_ACCESS_WRITE_ONLY;
+                ict++;
             } break;
 
             default:
             {
-                gs_graphics_bind_uniform_desc_t uniforms[1];
-                uniforms[0].uniform = u->hndl;
-                uniforms[0].data = (mat->uniform_data.data + u->offset);
-                uniforms[0].binding = u->binding;
-                bind.uniforms.desc = uniforms;
-                bind.uniforms.size = sizeof(uniforms); 
-                gs_graphics_apply_bindings(cb, &bind);
+                // Block members have no individual handle
+                if (u->hndl.id) {
+                    uniforms[uct].uniform = u->hndl;
+                    uniforms[uct].data = (mat->uniform_data.data + u->offset);
+                    uniforms[uct].binding = u->binding;
+                    uct++;
+                }
             } break;
         }
 
+        if (uct == GS_GFXT_BIND_BATCH_MAX || ict == GS_GFXT_BIND_BATCH_MAX || i == ct - 1)
+        {
+            gs_graphics_bind_desc_t bind = gs_default_val(); 
+            if (uct) {bind.uniforms.desc = uniforms; bind.uniforms.size = uct * sizeof(gs_graphics_bind_uniform_desc_t);}
+            if (ict) {bind.image_buffers.desc = ibuffers; bind.image_buffers.size = ict * sizeof(gs_graphics_bind_image_buffer_desc_t);}
+            if (ubuffer.buffer.id) {bind.uniform_buffers.desc = &ubuffer; bind.uniform_buffers.size = sizeof(ubuffer);}
+            if (uct || ict || ubuffer.buffer.id) gs_graphics_apply_bindings(cb, &bind);
+            ubuffer.buffer.id = 0;
+            uct = ict = 0;
+        }
     }
 }
 
@@ -1193,18 +1566,20 @@ gs_gfxt_mesh_draw(gs_command_buffer_t* cb, gs_gfxt_mesh_t* mp)
     */
 }
 
-GS_API_DECL void
-gs_gfxt_mesh_primitive_draw_layout(gs_command_buffer_t* cb, gs_gfxt_mesh_primitive_t* prim, gs_gfxt_mesh_layout_t* layout, size_t layout_size, uint32_t instance_count)
+// Binds mesh streams in layout order, followed by any extra (per-instance) buffers
+static void
+__gs_gfxt_mesh_primitive_draw_ext(gs_command_buffer_t* cb, gs_gfxt_mesh_primitive_t* prim, gs_gfxt_mesh_layout_t* layout, size_t layout_size, 
+    gs_graphics_bind_vertex_buffer_desc_t* extra, uint32_t extra_ct, uint32_t instance_count)
 { 
     if (!layout || !layout_size || !prim || !cb)
     {
         return;
     }
 
-    gs_graphics_bind_vertex_buffer_desc_t vbos[8] = {0};     // Make this a define
+    gs_graphics_bind_vertex_buffer_desc_t vbos[16] = {0};     // Make this a define
     uint32_t l = 0;
     const uint32_t ct = layout_size / sizeof(gs_gfxt_mesh_layout_t);
-    for (uint32_t a = 0; a < ct; ++a)
+    for (uint32_t a = 0; a < ct && l < 16; ++a)
     {
         vbos[l].data_type = GS_GRAPHICS_VERTEX_DATA_NONINTERLEAVED;
         switch (layout[a].type)
@@ -1221,6 +1596,11 @@ gs_gfxt_mesh_primitive_draw_layout(gs_command_buffer_t* cb, gs_gfxt_mesh_primiti
         ++l;
     }
 
+    for (uint32_t e = 0; e < extra_ct && l < 16; ++e)
+    {
+        vbos[l++] = extra[e];
+    }
+
     gs_graphics_bind_index_buffer_desc_t ibos = gs_default_val();
     ibos.buffer = prim->indices;
 
@@ -1241,6 +1621,12 @@ gs_gfxt_mesh_primitive_draw_layout(gs_command_buffer_t* cb, gs_gfxt_mesh_primiti
     gs_graphics_draw(cb, &ddesc);
 }
 
+GS_API_DECL void
+gs_gfxt_mesh_primitive_draw_layout(gs_command_buffer_t* cb, gs_gfxt_mesh_primitive_t* prim, gs_gfxt_mesh_layout_t* layout, size_t layout_size, uint32_t instance_count)
+{ 
+    __gs_gfxt_mesh_primitive_draw_ext(cb, prim, layout, layout_size, NULL, 0, instance_count);
+}
+
 GS_API_DECL void 
 gs_gfxt_mesh_draw_layout(gs_command_buffer_t* cb, gs_gfxt_mesh_t* mesh, gs_gfxt_mesh_layout_t* layout, size_t layout_size)
 {
@@ -1316,6 +1702,535 @@ gs_gfxt_mesh_draw_pipeline(gs_command_buffer_t* cb, gs_gfxt_mesh_t* mesh, gs_gfx
     gs_gfxt_mesh_draw_layout(cb, mesh, pip->mesh_layout, gs_dyn_array_size(pip->mesh_layout) * sizeof(gs_gfxt_mesh_layout_t));
 }
 
+// Scene API
+GS_API_DECL void 
+gs_gfxt_scene_render(gs_command_buffer_t* cb, gs_gfxt_scene_t* scene, const gs_mat4* view_projection)
+{
+    if (!cb || !scene) return;
+
+    memset(&scene->stats, 0, sizeof(scene->stats));
+    if (!scene->group_lookup) gs_hash_table_init_ctrl(scene->group_lookup, gs_gfxt_scene_group_key_t, uint32_t);
+    gs_hash_table_clear(scene->group_lookup);
+    gs_dyn_array_clear(scene->groups);
+    gs_dyn_array_clear(scene->group_idx);
+
+    // Draw the visible set of the last cull, otherwise every renderable
+    if (!scene->culled)
+    {
+        gs_dyn_array_clear(scene->visible);
+        for (
+            gs_slot_array_iter it = gs_slot_array_iter_new(scene->renderables);
+            gs_slot_array_iter_valid(scene->renderables, it);
+            gs_slot_array_iter_advance(scene->renderables, it)
+        )
+        {
+            gs_dyn_array_push(scene->visible, it);
+        }
+    }
+    scene->culled = false;
+    const uint32_t vct = gs_dyn_array_size(scene->visible);
+
+    // Group renderables by (mesh, material), counting instances per group
+    for (uint32_t v = 0; v < vct; ++v)
+    {
+        uint32_t gi = UINT32_MAX;
+        gs_gfxt_renderable_t* rend = gs_slot_array_exists(scene->renderables, scene->visible[v]) ? 
+            gs_slot_array_getp(scene->renderables, scene->visible[v]) : NULL;
+        gs_gfxt_scene_group_key_t key = gs_default_val();
+        if (rend) {
+            key.mesh = rend->desc.mesh.func ? GS_GFXT_RAW_DATA(&rend->desc.mesh, gs_gfxt_mesh_t) : (gs_gfxt_mesh_t*)rend->desc.mesh.hndl;
+            key.material = rend->desc.material.func ? GS_GFXT_RAW_DATA(&rend->desc.material, gs_gfxt_material_t) : (gs_gfxt_material_t*)rend->desc.material.hndl;
+        }
+
+        if (key.mesh && key.material)
+        {
+            uint32_t* gp = gs_hash_table_getp(scene->group_lookup, key);
+            if (gp) {
+                gi = *gp;
+            }
+            else {
+                gs_gfxt_scene_group_t grp = gs_default_val();
+                grp.mesh = key.mesh;
+                grp.material = key.material;
+                gs_dyn_array_push(scene->groups, grp);
+                gi = gs_dyn_array_size(scene->groups) - 1;
+                gs_hash_table_insert(scene->group_lookup, key, gi);
+            }
+            scene->groups[gi].count++;
+        }
+        gs_dyn_array_push(scene->group_idx, gi);
+    }
+
+    // Lay groups out contiguously, then scatter model matrices into place
+    uint32_t total = 0;
+    for (uint32_t g = 0; g < (uint32_t)gs_dyn_array_size(scene->groups); ++g)
+    {
+        scene->groups[g].offset = total;
+        total += scene->groups[g].count;
+        scene->groups[g].count = 0;
+    }
+
+    gs_dyn_array_reserve(scene->instance_data, total);
+    gs_dyn_array_head(scene->instance_data)->size = total;
+
+    for (uint32_t v = 0; v < vct; ++v)
+    {
+        uint32_t gi = scene->group_idx[v];
+        if (gi == UINT32_MAX) continue;
+        gs_gfxt_scene_group_t* grp = &scene->groups[gi];
+        scene->instance_data[grp->offset + grp->count++] = gs_slot_array_getp(scene->renderables, scene->visible[v])->model_matrix;
+    }
+
+    if (!total) return;
+
+    // Single streamed upload for every instanced group this frame
+    gs_graphics_vertex_buffer_desc_t vdesc = gs_default_val();
+    vdesc.data = scene->instance_data;
+    vdesc.size = total * sizeof(gs_mat4);
+    vdesc.usage = GS_GRAPHICS_BUFFER_USAGE_STREAM;
+    if (!scene->instance_vbo.id) {
+        scene->instance_vbo = gs_graphics_vertex_buffer_create(&vdesc);
+    }
+    else {
+        gs_graphics_vertex_buffer_request_update(cb, scene->instance_vbo, &vdesc);
+    }
+
+    scene->stats.groups = gs_dyn_array_size(scene->groups);
+    scene->stats.renderables = total;
+
+    for (uint32_t g = 0; g < (uint32_t)gs_dyn_array_size(scene->groups); ++g)
+    {
+        gs_gfxt_scene_group_t* grp = &scene->groups[g];
+        gs_gfxt_material_t* mat = grp->material;
+        gs_gfxt_pipeline_t* pip = gs_gfxt_material_get_pipeline(mat);
+        gs_gfxt_mesh_layout_t* layout = pip->mesh_layout;
+        const size_t layout_size = gs_dyn_array_size(pip->mesh_layout) * sizeof(gs_gfxt_mesh_layout_t);
+        const uint32_t pct = gs_dyn_array_size(grp->mesh->primitives);
+
+        if (pip->instance.enabled)
+        {
+            if (view_projection && gs_gfxt_pipeline_get_uniform(pip, GS_GFXT_UNIFORM_VIEW_PROJECTION_MATRIX)) {
+                gs_gfxt_material_set_uniform(mat, GS_GFXT_UNIFORM_VIEW_PROJECTION_MATRIX, view_projection);
+            }
+            gs_gfxt_material_bind(cb, mat);
+
+            // Each matrix column is its own attribute, sourced from this group's range of the instance buffer
+            gs_graphics_bind_vertex_buffer_desc_t cols[4] = gs_default_val();
+            for (uint32_t c = 0; c < 4; ++c) {
+                cols[c].buffer = scene->instance_vbo;
+                cols[c].offset = grp->offset * sizeof(gs_mat4) + c * sizeof(gs_vec4);
+                cols[c].data_type = GS_GRAPHICS_VERTEX_DATA_NONINTERLEAVED;
+            }
+
+            for (uint32_t p = 0; p < pct; ++p) {
+                __gs_gfxt_mesh_primitive_draw_ext(cb, &grp->mesh->primitives[p], layout, layout_size, cols, 4, grp->count);
+            }
+            scene->stats.draws += pct;
+            scene->stats.instanced += grp->count;
+        }
+        else
+        {
+            // Not instanced: one draw per renderable, model transform through uniforms
+            gs_gfxt_uniform_t* u_model = gs_gfxt_pipeline_get_uniform(pip, GS_GFXT_UNIFORM_MODEL_MATRIX);
+            gs_gfxt_uniform_t* u_mvp = view_projection ? gs_gfxt_pipeline_get_uniform(pip, GS_GFXT_UNIFORM_MODEL_VIEW_PROJECTION_MATRIX) : NULL;
+            for (uint32_t i = 0; i < grp->count; ++i)
+            {
+                gs_mat4* model = &scene->instance_data[grp->offset + i];
+                if (u_model) gs_gfxt_material_set_uniform(mat, GS_GFXT_UNIFORM_MODEL_MATRIX, model);
+                if (u_mvp) {
+                    gs_mat4 mvp = gs_mat4_mul(*view_projection, *model);
+                    gs_gfxt_material_set_uniform(mat, GS_GFXT_UNIFORM_MODEL_VIEW_PROJECTION_MATRIX, &mvp);
+                }
+                gs_gfxt_material_bind(cb, mat);
+                for (uint32_t p = 0; p < pct; ++p) {
+                    __gs_gfxt_mesh_primitive_draw_ext(cb, &grp->mesh->primitives[p], layout, layout_size, NULL, 0, 1);
+                }
+            }
+            scene->stats.draws += pct * grp->count;
+        }
+    }
+}
+
+// Bounds/culling
+
+static void
+__gs_gfxt_array32_resize(void** arr, uint32_t size)
+{
+    uint32_t** a = (uint32_t**)arr;
+    gs_dyn_array_reserve(*a, size);
+    gs_dyn_array_head(*a)->size = size;
+}
+
+// Gather arr[perm[i]] for 4 byte elements, through tmp
+static void
+__gs_gfxt_array32_permute(void* arr, const uint32_t* perm, uint32_t* tmp, uint32_t count)
+{
+    uint8_t* a = (uint8_t*)arr;
+    for (uint32_t i = 0; i < count; ++i) {
+        memcpy(&tmp[i], a + perm[i] * 4, 4);
+    }
+    memcpy(a, tmp, count * 4);
+}
+
+// Partial sort so idx[k] holds the k-th smallest key, smaller before it and larger after
+static void
+__gs_gfxt_scene_bvh_select(uint32_t* idx, const float* key, int32_t count, int32_t k)
+{
+    int32_t lo = 0, hi = count - 1;
+    while (lo < hi)
+    {
+        const float pivot = key[idx[lo + (hi - lo) / 2]];
+        int32_t i = lo, j = hi;
+        while (i <= j)
+        {
+            while (key[idx[i]] < pivot) ++i;
+            while (key[idx[j]] > pivot) --j;
+            if (i <= j) {
+                const uint32_t t = idx[i]; idx[i] = idx[j]; idx[j] = t;
+                ++i; --j;
+            }
+        }
+        if (k <= j) hi = j;
+        else if (k >= i) lo = i;
+        else break;
+    }
+}
+
+GS_API_DECL void
+gs_gfxt_scene_update_bounds(gs_gfxt_scene_t* scene)
+{
+    if (!scene) return;
+
+    gs_gfxt_scene_bounds_t* b = &scene->bounds;
+    const uint32_t n = gs_slot_array_size(scene->renderables);
+    const uint32_t padded = n + 3;      // Last 4 wide load of any leaf stays in bounds
+
+    float** c[3] = {&b->cx, &b->cy, &b->cz};
+    float** e[3] = {&b->ex, &b->ey, &b->ez};
+    for (uint32_t a = 0; a < 3; ++a) {
+        __gs_gfxt_array32_resize((void**)c[a], padded);
+        __gs_gfxt_array32_resize((void**)e[a], padded);
+        memset(*c[a], 0, padded * sizeof(float));
+        memset(*e[a], 0, padded * sizeof(float));
+    }
+    __gs_gfxt_array32_resize((void**)&b->hndl, padded);
+    gs_dyn_array_clear(b->nodes);
+    b->count = n;
+    if (!n) return;
+
+    // World center/extents of each mesh's local bounds under its model matrix (Arvo)
+    uint32_t i = 0;
+    for (
+        gs_slot_array_iter it = gs_slot_array_iter_new(scene->renderables);
+        gs_slot_array_iter_valid(scene->renderables, it);
+        gs_slot_array_iter_advance(scene->renderables, it), ++i
+    )
+    {
+        gs_gfxt_renderable_t* rend = gs_slot_array_iter_getp(scene->renderables, it);
+        gs_gfxt_mesh_t* mesh = rend->desc.mesh.func ? GS_GFXT_RAW_DATA(&rend->desc.mesh, gs_gfxt_mesh_t) : (gs_gfxt_mesh_t*)rend->desc.mesh.hndl;
+        const float* m = rend->model_matrix.elements;
+        b->hndl[i] = it;
+
+        // No bounds, never culled
+        if (!mesh || mesh->aabb.min.x > mesh->aabb.max.x) {
+            for (uint32_t a = 0; a < 3; ++a) {
+                (*c[a])[i] = m[a + 12];
+                (*e[a])[i] = 1e18f;
+            }
+            continue;
+        }
+
+        const gs_vec3 lc = gs_vec3_scale(gs_vec3_add(mesh->aabb.min, mesh->aabb.max), 0.5f);
+        const gs_vec3 le = gs_vec3_scale(gs_vec3_sub(mesh->aabb.max, mesh->aabb.min), 0.5f);
+        for (uint32_t a = 0; a < 3; ++a) {
+            (*c[a])[i] = m[a] * lc.x + m[a + 4] * lc.y + m[a + 8] * lc.z + m[a + 12];
+            (*e[a])[i] = fabsf(m[a]) * le.x + fabsf(m[a + 4]) * le.y + fabsf(m[a + 8]) * le.z;
+        }
+    }
+
+    // Median split BVH over a permutation of the entries
+    uint32_t* perm = (uint32_t*)gs_malloc(n * sizeof(uint32_t));
+    uint32_t* tmp = (uint32_t*)gs_malloc(n * sizeof(uint32_t));
+    for (i = 0; i < n; ++i) perm[i] = i;
+
+    gs_gfxt_scene_bvh_node_t root = gs_default_val();
+    root.count = n;
+    gs_dyn_array_push(b->nodes, root);
+
+    uint32_t stack[64];
+    uint32_t sp = 0;
+    stack[sp++] = 0;
+    while (sp)
+    {
+        const uint32_t ni = stack[--sp];
+        const uint32_t first = b->nodes[ni].first;
+        const uint32_t count = b->nodes[ni].count;
+
+        gs_gfxt_aabb_t nb = __gs_gfxt_aabb_empty();
+        gs_gfxt_aabb_t cb = __gs_gfxt_aabb_empty();
+        for (uint32_t k = first; k < first + count; ++k)
+        {
+            const uint32_t j = perm[k];
+            const gs_vec3 cj = gs_v3((*c[0])[j], (*c[1])[j], (*c[2])[j]);
+            const gs_vec3 ej = gs_v3((*e[0])[j], (*e[1])[j], (*e[2])[j]);
+            gs_gfxt_aabb_t eb = gs_default_val();
+            eb.min = gs_vec3_sub(cj, ej);
+            eb.max = gs_vec3_add(cj, ej);
+            nb = __gs_gfxt_aabb_union(nb, eb);
+            cb.min = gs_v3(gs_min(cb.min.x, cj.x), gs_min(cb.min.y, cj.y), gs_min(cb.min.z, cj.z));
+            cb.max = gs_v3(gs_max(cb.max.x, cj.x), gs_max(cb.max.y, cj.y), gs_max(cb.max.z, cj.z));
+        }
+        b->nodes[ni].aabb = nb;
+        if (count <= GS_GFXT_SCENE_BVH_LEAF_SIZE) continue;
+
+        // Split along the widest axis of the centroids
+        const gs_vec3 ext = gs_vec3_sub(cb.max, cb.min);
+        const uint32_t axis = ext.x >= ext.y && ext.x >= ext.z ? 0 : ext.y >= ext.z ? 1 : 2;
+        const uint32_t mid = count / 2;
+        __gs_gfxt_scene_bvh_select(perm + first, *c[axis], (int32_t)count, (int32_t)mid);
+
+        const uint32_t left = gs_dyn_array_size(b->nodes);
+        gs_gfxt_scene_bvh_node_t child = gs_default_val();
+        child.first = first;
+        child.count = mid;
+        gs_dyn_array_push(b->nodes, child);
+        child.first = first + mid;
+        child.count = count - mid;
+        gs_dyn_array_push(b->nodes, child);
+        b->nodes[ni].left = left;
+
+        stack[sp++] = left + 1;
+        stack[sp++] = left;
+    }
+
+    // Store entries in leaf order so every subtree is a contiguous range
+    for (uint32_t a = 0; a < 3; ++a) {
+        __gs_gfxt_array32_permute(*c[a], perm, tmp, n);
+        __gs_gfxt_array32_permute(*e[a], perm, tmp, n);
+    }
+    __gs_gfxt_array32_permute(b->hndl, perm, tmp, n);
+
+    gs_free(perm);
+    gs_free(tmp);
+}
+
+typedef struct __gs_gfxt_scene_cull_ctx_t {
+    gs_gfxt_scene_t* scene;
+    float plane[6][4];                  // Clip planes (unnormalized), inside when dot(n, p) + w >= 0
+} __gs_gfxt_scene_cull_ctx_t;
+
+// Planes of 'planes' the box still straddles, or UINT32_MAX when it is outside one of them
+gs_force_inline uint32_t
+__gs_gfxt_scene_cull_classify(const float plane[6][4], uint32_t planes, const gs_gfxt_aabb_t* aabb)
+{
+    const gs_vec3 c = gs_vec3_scale(gs_vec3_add(aabb->min, aabb->max), 0.5f);
+    const gs_vec3 e = gs_vec3_scale(gs_vec3_sub(aabb->max, aabb->min), 0.5f);
+    uint32_t straddled = 0;
+    for (uint32_t p = 0; p < 6; ++p)
+    {
+        if (!(planes & (1u << p))) continue;
+        const float* pl = plane[p];
+        const float d = pl[0] * c.x + pl[1] * c.y + pl[2] * c.z + pl[3];
+        const float r = fabsf(pl[0]) * e.x + fabsf(pl[1]) * e.y + fabsf(pl[2]) * e.z;
+        if (d + r < 0.f) return UINT32_MAX;
+        if (d - r < 0.f) straddled |= (1u << p);
+    }
+    return straddled;
+}
+
+// Test entries [first, first + count) four at a time, writing handles of visible ones to out
+static uint32_t
+__gs_gfxt_scene_cull_range(const gs_gfxt_scene_bounds_t* b, const float plane[6][4], uint32_t planes, uint32_t first, uint32_t count, uint32_t* out)
+{
+    if (!planes) {
+        memcpy(out, b->hndl + first, count * sizeof(uint32_t));
+        return count;
+    }
+
+    uint32_t n = 0;
+    const uint32_t end = first + count;
+    for (uint32_t i = first; i < end; i += 4)
+    {
+        const uint32_t lanes = end - i >= 4 ? 0xf : (1u << (end - i)) - 1;
+        uint32_t vis = 0;
+
+#ifdef __GS_SIMD
+        const __gs_simd_f4 zero = __gs_simd_splat(0.f);
+        const __gs_simd_f4 cx = __gs_simd_load(b->cx + i), cy = __gs_simd_load(b->cy + i), cz = __gs_simd_load(b->cz + i);
+        const __gs_simd_f4 ex = __gs_simd_load(b->ex + i), ey = __gs_simd_load(b->ey + i), ez = __gs_simd_load(b->ez + i);
+        __gs_simd_f4 outside = zero;
+        for (uint32_t p = 0; p < 6; ++p)
+        {
+            if (!(planes & (1u << p))) continue;
+            const float* pl = plane[p];
+            __gs_simd_f4 d = __gs_simd_splat(pl[3]);
+            d = __gs_simd_madd(d, __gs_simd_splat(pl[0]), cx);
+            d = __gs_simd_madd(d, __gs_simd_splat(pl[1]), cy);
+            d = __gs_simd_madd(d, __gs_simd_splat(pl[2]), cz);
+            d = __gs_simd_madd(d, __gs_simd_splat(fabsf(pl[0])), ex);
+            d = __gs_simd_madd(d, __gs_simd_splat(fabsf(pl[1])), ey);
+            d = __gs_simd_madd(d, __gs_simd_splat(fabsf(pl[2])), ez);
+            outside = __gs_simd_or(outside, __gs_simd_cmplt(d, zero));
+        }
+        vis = ~(uint32_t)__gs_simd_movemask(outside) & lanes;
+#else
+        for (uint32_t l = 0; l < 4; ++l)
+        {
+            const uint32_t k = i + l;
+            uint32_t inside = 1;
+            for (uint32_t p = 0; p < 6 && inside; ++p)
+            {
+                if (!(planes & (1u << p))) continue;
+                const float* pl = plane[p];
+                const float d = pl[0] * b->cx[k] + pl[1] * b->cy[k] + pl[2] * b->cz[k] + pl[3] + 
+                    fabsf(pl[0]) * b->ex[k] + fabsf(pl[1]) * b->ey[k] + fabsf(pl[2]) * b->ez[k];
+                inside = d >= 0.f;
+            }
+            vis |= inside << l;
+        }
+        vis &= lanes;
+#endif
+
+        for (uint32_t l = 0; l < 4; ++l) {
+            if (vis & (1u << l)) out[n++] = b->hndl[i + l];
+        }
+    }
+    return n;
+}
+
+static uint32_t
+__gs_gfxt_scene_cull_subtree(const gs_gfxt_scene_bounds_t* b, const float plane[6][4], uint32_t node, uint32_t planes, uint32_t* out)
+{
+    uint32_t n = 0;
+    uint32_t stack[64][2];
+    uint32_t sp = 0;
+    stack[sp][0] = node; stack[sp++][1] = planes;
+    while (sp)
+    {
+        --sp;
+        const gs_gfxt_scene_bvh_node_t* nd = &b->nodes[stack[sp][0]];
+        uint32_t pl = stack[sp][1];
+        if (pl) {
+            pl = __gs_gfxt_scene_cull_classify(plane, pl, &nd->aabb);
+            if (pl == UINT32_MAX) continue;
+        }
+
+        // Fully inside subtrees are taken whole, leaves are tested per entry
+        if (!pl || !nd->left) {
+            n += __gs_gfxt_scene_cull_range(b, plane, pl, nd->first, nd->count, out + n);
+            continue;
+        }
+
+        stack[sp][0] = nd->left + 1; stack[sp++][1] = pl;
+        stack[sp][0] = nd->left; stack[sp++][1] = pl;
+    }
+    return n;
+}
+
+// Each item writes into the visible array at its subtree's first entry
+static void
+__gs_gfxt_scene_cull_job(void* user_data, uint32_t start, uint32_t end, uint32_t thread)
+{
+    __gs_gfxt_scene_cull_ctx_t* ctx = (__gs_gfxt_scene_cull_ctx_t*)user_data;
+    gs_gfxt_scene_t* scene = ctx->scene;
+    for (uint32_t i = start; i < end; ++i)
+    {
+        gs_gfxt_scene_cull_item_t* item = &scene->cull_items[i];
+        const uint32_t first = scene->bounds.nodes[item->node].first;
+        item->count = __gs_gfxt_scene_cull_subtree(&scene->bounds, ctx->plane, item->node, item->planes, scene->visible + first);
+    }
+}
+
+GS_API_DECL uint32_t
+gs_gfxt_scene_cull(gs_gfxt_scene_t* scene, const gs_mat4* view_projection, gs_jobs_t* jobs)
+{
+    if (!scene || !view_projection) return 0;
+
+    gs_gfxt_scene_bounds_t* b = &scene->bounds;
+    __gs_gfxt_scene_cull_ctx_t ctx = gs_default_val();
+    ctx.scene = scene;
+
+    // Left/right, bottom/top, near/far from the rows of the column major view projection (Gribb/Hartmann)
+    const float* m = view_projection->elements;
+    for (uint32_t r = 0; r < 3; ++r) {
+        for (uint32_t j = 0; j < 4; ++j) {
+            ctx.plane[r * 2][j] = m[3 + 4 * j] + m[r + 4 * j];
+            ctx.plane[r * 2 + 1][j] = m[3 + 4 * j] - m[r + 4 * j];
+        }
+    }
+
+    __gs_gfxt_array32_resize((void**)&scene->visible, b->count);
+    gs_dyn_array_clear(scene->cull_items);
+    scene->culled = true;
+    if (!b->count || gs_dyn_array_empty(b->nodes)) return 0;
+
+    gs_gfxt_scene_cull_item_t root = gs_default_val();
+    root.planes = 0x3f;
+    gs_dyn_array_push(scene->cull_items, root);
+
+    // Open up the top of the tree until there are a few subtrees per thread
+    const bool32 parallel = jobs && jobs->thread_count > 1 && b->count >= GS_GFXT_SCENE_CULL_PARALLEL_MIN;
+    if (parallel)
+    {
+        const uint32_t target = jobs->thread_count * 4;
+        uint32_t head = 0;
+        while (head < (uint32_t)gs_dyn_array_size(scene->cull_items) && (uint32_t)gs_dyn_array_size(scene->cull_items) < target)
+        {
+            const gs_gfxt_scene_cull_item_t item = scene->cull_items[head];
+            const gs_gfxt_scene_bvh_node_t* nd = &b->nodes[item.node];
+            if (!item.planes || !nd->left) {
+                ++head;
+                continue;
+            }
+
+            scene->cull_items[head] = gs_dyn_array_back(scene->cull_items);
+            gs_dyn_array_pop(scene->cull_items);
+            for (uint32_t ch = 0; ch < 2; ++ch)
+            {
+                gs_gfxt_scene_cull_item_t child = gs_default_val();
+                child.node = nd->left + ch;
+                child.planes = __gs_gfxt_scene_cull_classify(ctx.plane, item.planes, &b->nodes[child.node].aabb);
+                if (child.planes != UINT32_MAX) gs_dyn_array_push(scene->cull_items, child);
+            }
+        }
+
+        // Ascending by first entry, so results compact in place
+        const uint32_t ct = gs_dyn_array_size(scene->cull_items);
+        for (uint32_t i = 1; i < ct; ++i)
+        {
+            const gs_gfxt_scene_cull_item_t item = scene->cull_items[i];
+            uint32_t j = i;
+            for (; j > 0 && b->nodes[scene->cull_items[j - 1].node].first > b->nodes[item.node].first; --j) {
+                scene->cull_items[j] = scene->cull_items[j - 1];
+            }
+            scene->cull_items[j] = item;
+        }
+    }
+
+    const uint32_t ict = gs_dyn_array_size(scene->cull_items);
+    if (parallel && ict > 1) gs_jobs_parallel_for(jobs, __gs_gfxt_scene_cull_job, &ctx, ict, 1);
+    else __gs_gfxt_scene_cull_job(&ctx, 0, ict, 0);
+
+    uint32_t n = 0;
+    for (uint32_t i = 0; i < ict; ++i)
+    {
+        const gs_gfxt_scene_cull_item_t* item = &scene->cull_items[i];
+        const uint32_t first = b->nodes[item->node].first;
+        if (first != n) memmove(scene->visible + n, scene->visible + first, item->count * sizeof(uint32_t));
+        n += item->count;
+    }
+    gs_dyn_array_head(scene->visible)->size = n;
+    return n;
+}
+
+GS_API_DECL uint32_t
+gs_gfxt_scene_cull_camera(gs_gfxt_scene_t* scene, const gs_camera_t* cam, int32_t view_width, int32_t view_height, gs_jobs_t* jobs)
+{
+    if (!cam) return 0;
+    const gs_mat4 vp = gs_camera_get_view_projection(cam, view_width, view_height);
+    return gs_gfxt_scene_cull(scene, &vp, jobs);
+}
+
 // Util API
 GS_API_DECL
 void* gs_gfxt_raw_data_default_impl(GS_GFXT_HNDL hndl, void* user_data)
@@ -1372,6 +2287,394 @@ gs_gfxt_mesh_t gs_gfxt_mesh_load_from_file(const char* path, gs_gfxt_mesh_import
     return mesh;
 }
 
+//=== Mesh Optimization ===//
+
+#define __GS_GFXT_FORSYTH_CACHE_SIZE 32
+#define __GS_GFXT_FORSYTH_VALENCE_MAX 32
+
+GS_API_DECL float 
+gs_gfxt_mesh_acmr(const uint32_t* indices, uint32_t index_count, uint32_t vertex_count, uint32_t cache_size)
+{
+    if (index_count < 3 || !vertex_count) return 0.f;
+
+    // FIFO cache by timestamp, a vertex is resident if it was last loaded less than cache_size misses ago
+    uint32_t* stamps = (uint32_t*)gs_malloc(vertex_count * sizeof(uint32_t));
+    memset(stamps, 0, vertex_count * sizeof(uint32_t));
+    uint32_t time = cache_size + 1, misses = 0;
+    for (uint32_t i = 0; i < index_count; ++i)
+    {
+        const uint32_t v = indices[i];
+        if (v >= vertex_count) continue;
+        if (time - stamps[v] > cache_size) {
+            stamps[v] = time++;
+            misses++;
+        }
+    }
+    gs_free(stamps);
+    return (float)misses / (float)(index_count / 3);
+}
+
+// Tom Forsyth, "Linear-Speed Vertex Cache Optimisation": greedily emit the best scoring triangle touching a simulated LRU cache
+GS_API_DECL void 
+gs_gfxt_mesh_optimize_vertex_cache(uint32_t* dst, const uint32_t* indices, uint32_t index_count, uint32_t vertex_count)
+{
+    const uint32_t tri_count = index_count / 3;
+    if (!tri_count || !vertex_count) {
+        if (dst != indices) memmove(dst, indices, index_count * sizeof(uint32_t));
+        return;
+    }
+
+    // Source copy so dst can alias indices
+    uint32_t* idx = (uint32_t*)gs_malloc(index_count * sizeof(uint32_t));
+    memcpy(idx, indices, index_count * sizeof(uint32_t));
+    for (uint32_t i = 0; i < tri_count * 3; ++i) {
+        if (idx[i] >= vertex_count) {
+            gs_log_warning("GFXT:Mesh:OptimizeVertexCache: Index %u out of range (%u vertices).", idx[i], vertex_count);
+            memmove(dst, idx, index_count * sizeof(uint32_t));
+            gs_free(idx);
+            return;
+        }
+    }
+
+    float cache_score[__GS_GFXT_FORSYTH_CACHE_SIZE];
+    float valence_score[__GS_GFXT_FORSYTH_VALENCE_MAX];
+    for (uint32_t i = 0; i < __GS_GFXT_FORSYTH_CACHE_SIZE; ++i) {
+        cache_score[i] = i < 3 ? 0.75f : powf(1.f - (float)(i - 3) / (float)(__GS_GFXT_FORSYTH_CACHE_SIZE - 3), 1.5f);
+    }
+    for (uint32_t i = 0; i < __GS_GFXT_FORSYTH_VALENCE_MAX; ++i) {
+        valence_score[i] = i ? 2.f * powf((float)i, -0.5f) : 0.f;
+    }
+
+    #define __GS_GFXT_FORSYTH_SCORE(POS, VAL)\
+        ((VAL) == 0 ? -1.f : ((POS) >= 0 ? cache_score[(POS)] : 0.f) +\
+            ((VAL) < __GS_GFXT_FORSYTH_VALENCE_MAX ? valence_score[(VAL)] : 2.f * powf((float)(VAL), -0.5f)))
+
+    // Vertex -> live triangle adjacency
+    uint32_t* offsets = (uint32_t*)gs_malloc((vertex_count + 1) * sizeof(uint32_t));
+    uint32_t* valence = (uint32_t*)gs_malloc(vertex_count * sizeof(uint32_t));
+    uint32_t* adj = (uint32_t*)gs_malloc(tri_count * 3 * sizeof(uint32_t));
+    int32_t* cache_pos = (int32_t*)gs_malloc(vertex_count * sizeof(int32_t));
+    float* vscore = (float*)gs_malloc(vertex_count * sizeof(float));
+    float* tscore = (float*)gs_malloc(tri_count * sizeof(float));
+    uint8_t* emitted = (uint8_t*)gs_malloc(tri_count);
+    memset(valence, 0, vertex_count * sizeof(uint32_t));
+    memset(emitted, 0, tri_count);
+
+    for (uint32_t i = 0; i < tri_count * 3; ++i) valence[idx[i]]++;
+    offsets[0] = 0;
+    for (uint32_t v = 0; v < vertex_count; ++v) {
+        offsets[v + 1] = offsets[v] + valence[v];
+        valence[v] = 0;
+    }
+    for (uint32_t t = 0; t < tri_count; ++t) {
+        for (uint32_t k = 0; k < 3; ++k) {
+            const uint32_t v = idx[t * 3 + k];
+            adj[offsets[v] + valence[v]++] = t;
+        }
+    }
+
+    for (uint32_t v = 0; v < vertex_count; ++v) {
+        cache_pos[v] = -1;
+        vscore[v] = __GS_GFXT_FORSYTH_SCORE(-1, valence[v]);
+    }
+
+    int32_t best = -1;
+    float best_score = -1.f;
+    for (uint32_t t = 0; t < tri_count; ++t) {
+        tscore[t] = vscore[idx[t * 3]] + vscore[idx[t * 3 + 1]] + vscore[idx[t * 3 + 2]];
+        if (tscore[t] > best_score) {best_score = tscore[t]; best = (int32_t)t;}
+    }
+
+    uint32_t cache[__GS_GFXT_FORSYTH_CACHE_SIZE + 3];
+    uint32_t cache_len = 0, cursor = 0;
+
+    for (uint32_t o = 0; o < tri_count; ++o)
+    {
+        // Nothing left touching the cache, restart from the next unemitted triangle in input order
+        if (best < 0) {
+            while (emitted[cursor]) cursor++;
+            best = (int32_t)cursor;
+        }
+
+        const uint32_t t = (uint32_t)best;
+        const uint32_t* tri = &idx[t * 3];
+        dst[o * 3 + 0] = tri[0];
+        dst[o * 3 + 1] = tri[1];
+        dst[o * 3 + 2] = tri[2];
+        emitted[t] = 1;
+
+        // Remove from live adjacency
+        for (uint32_t k = 0; k < 3; ++k) {
+            const uint32_t v = tri[k];
+            uint32_t* a = &adj[offsets[v]];
+            for (uint32_t j = 0; j < valence[v]; ++j) {
+                if (a[j] == t) {a[j] = a[--valence[v]]; break;}
+            }
+        }
+
+        // Triangle vertices move to the front, the rest shift back and fall off the end
+        uint32_t next[__GS_GFXT_FORSYTH_CACHE_SIZE + 3];
+        uint32_t n = 0;
+        for (uint32_t k = 0; k < 3; ++k) {
+            if (k && tri[k] == tri[0]) continue;
+            if (k == 2 && tri[2] == tri[1]) continue;
+            next[n++] = tri[k];
+        }
+        for (uint32_t j = 0; j < cache_len; ++j) {
+            const uint32_t v = cache[j];
+            if (v != tri[0] && v != tri[1] && v != tri[2]) next[n++] = v;
+        }
+
+        for (uint32_t j = 0; j < n; ++j) {
+            const uint32_t v = next[j];
+            cache_pos[v] = j < __GS_GFXT_FORSYTH_CACHE_SIZE ? (int32_t)j : -1;
+            vscore[v] = __GS_GFXT_FORSYTH_SCORE(cache_pos[v], valence[v]);
+        }
+        cache_len = gs_min(n, __GS_GFXT_FORSYTH_CACHE_SIZE);
+        memcpy(cache, next, cache_len * sizeof(uint32_t));
+
+        // Rescore triangles whose vertices changed, pick the best one touching the cache
+        best = -1;
+        best_score = -1.f;
+        for (uint32_t j = 0; j < n; ++j) {
+            const uint32_t v = next[j];
+            for (uint32_t a = 0; a < valence[v]; ++a) {
+                const uint32_t tt = adj[offsets[v] + a];
+                const uint32_t* ttri = &idx[tt * 3];
+                tscore[tt] = vscore[ttri[0]] + vscore[ttri[1]] + vscore[ttri[2]];
+                if (j < __GS_GFXT_FORSYTH_CACHE_SIZE && tscore[tt] > best_score) {
+                    best_score = tscore[tt];
+                    best = (int32_t)tt;
+                }
+            }
+        }
+    }
+
+    #undef __GS_GFXT_FORSYTH_SCORE
+
+    // Trailing indices of a non multiple of 3 list are left as is
+    for (uint32_t i = tri_count * 3; i < index_count; ++i) dst[i] = idx[i];
+
+    gs_free(idx);
+    gs_free(offsets);
+    gs_free(valence);
+    gs_free(adj);
+    gs_free(cache_pos);
+    gs_free(vscore);
+    gs_free(tscore);
+    gs_free(emitted);
+}
+
+typedef struct __gs_gfxt_overdraw_cluster_t {
+    float key;
+    uint32_t start;
+    uint32_t end;
+} __gs_gfxt_overdraw_cluster_t;
+
+static int 
+__gs_gfxt_overdraw_cluster_cmp(const void* a, const void* b)
+{
+    const __gs_gfxt_overdraw_cluster_t* ca = (const __gs_gfxt_overdraw_cluster_t*)a;
+    const __gs_gfxt_overdraw_cluster_t* cb = (const __gs_gfxt_overdraw_cluster_t*)b;
+    if (ca->key != cb->key) return ca->key > cb->key ? -1 : 1;
+    return ca->start < cb->start ? -1 : ca->start > cb->start ? 1 : 0;
+}
+
+// Sander et al., "Fast Triangle Reordering for Vertex Locality and Reduced Overdraw": split the (cache optimized) list 
+// into clusters that keep ACMR within threshold, then draw clusters facing away from the mesh center first
+GS_API_DECL void 
+gs_gfxt_mesh_optimize_overdraw(uint32_t* dst, const uint32_t* indices, uint32_t index_count, const gs_vec3* positions, uint32_t vertex_count, float threshold)
+{
+    const uint32_t tri_count = index_count / 3;
+    if (tri_count < 2 || !vertex_count || !positions) {
+        if (dst != indices) memmove(dst, indices, index_count * sizeof(uint32_t));
+        return;
+    }
+    threshold = threshold > 0.f ? threshold : 1.05f;
+
+    uint32_t* idx = (uint32_t*)gs_malloc(index_count * sizeof(uint32_t));
+    memcpy(idx, indices, index_count * sizeof(uint32_t));
+    for (uint32_t i = 0; i < tri_count * 3; ++i) {
+        if (idx[i] >= vertex_count) {
+            memmove(dst, idx, index_count * sizeof(uint32_t));
+            gs_free(idx);
+            return;
+        }
+    }
+
+    const uint32_t cache_size = GS_GFXT_MESH_CACHE_SIZE;
+    uint32_t* stamps = (uint32_t*)gs_malloc(vertex_count * sizeof(uint32_t));
+    memset(stamps, 0, vertex_count * sizeof(uint32_t));
+    uint32_t time = cache_size + 1;
+
+    #define __GS_GFXT_OVERDRAW_MISSES(T, MISSES)\
+        do {\
+            MISSES = 0;\
+            for (uint32_t k = 0; k < 3; ++k) {\
+                const uint32_t v = idx[(T) * 3 + k];\
+                if (time - stamps[v] > cache_size) {stamps[v] = time++; MISSES++;}\
+            }\
+        } while (0)
+
+    // Hard boundaries, where the cache has nothing in common with the previous triangles
+    gs_dyn_array(uint32_t) hard = NULL;
+    for (uint32_t t = 0; t < tri_count; ++t) {
+        uint32_t m = 0;
+        __GS_GFXT_OVERDRAW_MISSES(t, m);
+        if (t == 0 || m == 3) gs_dyn_array_push(hard, t);
+    }
+    gs_dyn_array_push(hard, tri_count);
+
+    // Soft boundaries, cut a hard cluster as soon as its running ACMR (from a cold cache) reaches threshold * cluster ACMR
+    gs_dyn_array(__gs_gfxt_overdraw_cluster_t) clusters = NULL;
+    for (uint32_t h = 0; h + 1 < (uint32_t)gs_dyn_array_size(hard); ++h)
+    {
+        const uint32_t start = hard[h], end = hard[h + 1];
+
+        uint32_t cluster_misses = 0;
+        time += cache_size + 1;
+        for (uint32_t t = start; t < end; ++t) {
+            uint32_t m = 0;
+            __GS_GFXT_OVERDRAW_MISSES(t, m);
+            cluster_misses += m;
+        }
+        const float cluster_threshold = threshold * (float)cluster_misses / (float)(end - start);
+
+        __gs_gfxt_overdraw_cluster_t c = gs_default_val();
+        c.start = start;
+        uint32_t running_misses = 0, running_tris = 0;
+        time += cache_size + 1;
+        for (uint32_t t = start; t < end; ++t)
+        {
+            uint32_t m = 0;
+            __GS_GFXT_OVERDRAW_MISSES(t, m);
+            running_misses += m;
+            running_tris++;
+            if ((float)running_misses / (float)running_tris <= cluster_threshold && t + 1 < end) {
+                c.end = t + 1;
+                gs_dyn_array_push(clusters, c);
+                c.start = t + 1;
+                running_misses = running_tris = 0;
+                time += cache_size + 1;
+            }
+        }
+        c.end = end;
+        gs_dyn_array_push(clusters, c);
+    }
+
+    #undef __GS_GFXT_OVERDRAW_MISSES
+
+    // Mesh center over referenced vertices
+    gs_vec3 center = gs_v3(0.f, 0.f, 0.f);
+    uint32_t referenced = 0;
+    memset(stamps, 0, vertex_count * sizeof(uint32_t));
+    for (uint32_t i = 0; i < tri_count * 3; ++i) {
+        if (stamps[idx[i]]) continue;
+        stamps[idx[i]] = 1;
+        center = gs_vec3_add(center, positions[idx[i]]);
+        referenced++;
+    }
+    center = gs_vec3_scale(center, 1.f / (float)referenced);
+
+    // Sort key, area weighted cluster centroid distance along the cluster's average normal
+    for (uint32_t c = 0; c < (uint32_t)gs_dyn_array_size(clusters); ++c)
+    {
+        __gs_gfxt_overdraw_cluster_t* cl = &clusters[c];
+        gs_vec3 centroid = gs_v3(0.f, 0.f, 0.f), normal = gs_v3(0.f, 0.f, 0.f);
+        float area = 0.f;
+        for (uint32_t t = cl->start; t < cl->end; ++t)
+        {
+            const gs_vec3 p0 = positions[idx[t * 3]], p1 = positions[idx[t * 3 + 1]], p2 = positions[idx[t * 3 + 2]];
+            const gs_vec3 n = gs_vec3_cross(gs_vec3_sub(p1, p0), gs_vec3_sub(p2, p0));
+            const float a = gs_vec3_len(n);
+            centroid = gs_vec3_add(centroid, gs_vec3_scale(gs_vec3_add(gs_vec3_add(p0, p1), p2), a / 3.f));
+            normal = gs_vec3_add(normal, n);
+            area += a;
+        }
+        const float nl = gs_vec3_len(normal);
+        cl->key = 0.f;
+        if (area > 0.f && nl > 0.f) {
+            centroid = gs_vec3_scale(centroid, 1.f / area);
+            cl->key = gs_vec3_dot(gs_vec3_sub(centroid, center), gs_vec3_scale(normal, 1.f / nl));
+        }
+    }
+
+    qsort(clusters, gs_dyn_array_size(clusters), sizeof(__gs_gfxt_overdraw_cluster_t), __gs_gfxt_overdraw_cluster_cmp);
+
+    uint32_t o = 0;
+    for (uint32_t c = 0; c < (uint32_t)gs_dyn_array_size(clusters); ++c) {
+        const uint32_t ct = (clusters[c].end - clusters[c].start) * 3;
+        memcpy(&dst[o], &idx[clusters[c].start * 3], ct * sizeof(uint32_t));
+        o += ct;
+    }
+    for (uint32_t i = tri_count * 3; i < index_count; ++i) dst[i] = idx[i];
+
+    gs_dyn_array_free(hard);
+    gs_dyn_array_free(clusters);
+    gs_free(stamps);
+    gs_free(idx);
+}
+
+GS_API_DECL uint32_t 
+gs_gfxt_mesh_optimize_vertex_fetch_remap(uint32_t* remap, uint32_t* indices, uint32_t index_count, uint32_t vertex_count)
+{
+    memset(remap, 0xFF, vertex_count * sizeof(uint32_t));
+    uint32_t next = 0;
+    for (uint32_t i = 0; i < index_count; ++i)
+    {
+        const uint32_t v = indices[i];
+        gs_assert(v < vertex_count);
+        if (remap[v] == UINT32_MAX) remap[v] = next++;
+        indices[i] = remap[v];
+    }
+    return next;
+}
+
+GS_API_DECL void 
+gs_gfxt_mesh_remap_vertex_buffer(void* dst, const void* src, size_t stride, const uint32_t* remap, uint32_t vertex_count)
+{
+    for (uint32_t v = 0; v < vertex_count; ++v) {
+        if (remap[v] == UINT32_MAX) continue;
+        memcpy((uint8_t*)dst + (size_t)remap[v] * stride, (const uint8_t*)src + (size_t)v * stride, stride);
+    }
+}
+
+gs_inline uint16_t 
+__gs_gfxt_quantize_half(float f)
+{
+    union {float f; uint32_t u;} b;
+    b.f = f;
+    const uint32_t s = (b.u >> 16) & 0x8000;
+    const uint32_t fe = (b.u >> 23) & 0xFF;
+    const int32_t e = (int32_t)fe - 127 + 15;
+    uint32_t m = b.u & 0x7FFFFF;
+
+    if (fe == 0xFF) return (uint16_t)(s | 0x7C00 | (m ? 0x200 : 0));     // Inf/NaN
+    if (e >= 31) return (uint16_t)(s | 0x7C00);                         // Overflow
+    if (e <= 0) {                                                       // Denormal/underflow
+        if (e < -10) return (uint16_t)s;
+        m |= 0x800000;
+        const uint32_t shift = (uint32_t)(14 - e);
+        return (uint16_t)(s | ((m >> shift) + ((m >> (shift - 1)) & 1)));
+    }
+    return (uint16_t)((s | ((uint32_t)e << 10) | (m >> 13)) + ((m >> 12) & 1));  // Rounding may carry into the exponent
+}
+
+// Octahedral unit vector encode, decoded in shaders by gs_oct_decode()
+gs_inline void 
+__gs_gfxt_quantize_oct(int16_t* out, gs_vec3 n)
+{
+    const float l1 = fabsf(n.x) + fabsf(n.y) + fabsf(n.z);
+    float x = l1 > 0.f ? n.x / l1 : 0.f, y = l1 > 0.f ? n.y / l1 : 0.f;
+    if (n.z < 0.f) {
+        const float ox = x;
+        x = (1.f - fabsf(y)) * (ox >= 0.f ? 1.f : -1.f);
+        y = (1.f - fabsf(ox)) * (y >= 0.f ? 1.f : -1.f);
+    }
+    out[0] = (int16_t)roundf(gs_clamp(x, -1.f, 1.f) * 32767.f);
+    out[1] = (int16_t)roundf(gs_clamp(y, -1.f, 1.f) * 32767.f);
+}
+
 GS_API_DECL bool 
 gs_gfxt_load_gltf_data_from_file(const char* path, gs_gfxt_mesh_import_options_t* options, 
     gs_gfxt_mesh_raw_data_t** out, uint32_t* mesh_count)
@@ -1420,6 +2723,28 @@ gs_gfxt_load_gltf_data_from_file(const char* path, gs_gfxt_mesh_import_options_t
 
     // Type of index data
     size_t index_element_size = options ? options->index_buffer_element_size : 0;
+    const uint32_t optimize = options ? options->optimize : 0;
+    const uint32_t quantize = options ? options->quantize : 0;
+    const bool track = options && (optimize || quantize || options->stats);
+
+    // Narrow to 16-bit indices only if every primitive in the file can address all of its vertices
+    if (optimize & GS_GFXT_MESH_OPTIMIZE_INDEX_16)
+    {
+        index_element_size = sizeof(uint16_t);
+        for (uint32_t m = 0; m < data->meshes_count; ++m) {
+            for (uint32_t p = 0; p < data->meshes[m].primitives_count; ++p) {
+                cgltf_primitive* prim = &data->meshes[m].primitives[p];
+                if (prim->attributes_count && prim->attributes[0].data->count > UINT16_MAX) {
+                    index_element_size = sizeof(uint32_t);
+                }
+            }
+        }
+    }
+
+    // Import stats, summed over primitives
+    gs_gfxt_mesh_import_stats_t stats = gs_default_val();
+    float acmr_sum_before = 0.f, acmr_sum_after = 0.f;
+    bool uv_clamped = false;
 
     // Temporary structures
     gs_dyn_array(gs_vec3) positions = NULL;
@@ -1430,6 +2755,8 @@ gs_gfxt_load_gltf_data_from_file(const char* path, gs_gfxt_mesh_import_options_t
     gs_dyn_array(float) weights[GS_GFXT_WEIGHT_MAX] = gs_default_val();
     gs_dyn_array(float) joints[GS_GFXT_JOINT_MAX] = gs_default_val();
     gs_dyn_array(gs_gfxt_mesh_layout_t) layouts = gs_default_val();
+    gs_dyn_array(uint32_t) idx = NULL;
+    gs_dyn_array(uint32_t) remap = NULL;
     gs_byte_buffer_t v_data = gs_byte_buffer_new();
     gs_byte_buffer_t i_data = gs_byte_buffer_new();
     gs_mat4 world_mat = gs_mat4_identity();
@@ -1493,6 +2820,7 @@ gs_gfxt_load_gltf_data_from_file(const char* path, gs_gfxt_mesh_import_options_t
                 for (uint32_t wi = 0; wi < GS_GFXT_WEIGHT_MAX; ++wi) gs_dyn_array_clear(weights[wi]);
                 for (uint32_t ji = 0; ji < GS_GFXT_JOINT_MAX; ++ji) gs_dyn_array_clear(joints[ji]);
                 gs_dyn_array_clear(layouts);
+                gs_dyn_array_clear(idx);
                 gs_byte_buffer_clear(&v_data);
                 gs_byte_buffer_clear(&i_data);
 
@@ -1627,7 +2955,7 @@ gs_gfxt_load_gltf_data_from_file(const char* path, gs_gfxt_mesh_import_options_t
                 // Indices for primitive
                 cgltf_accessor* acc = prim->indices;
 
-                #define __GFXT_GLTF_PUSH_IDX(BB, ACC, TYPE)\
+                #define __GFXT_GLTF_PUSH_IDX(ARR, ACC, TYPE)\
                     do {\
                         int32_t n = 0;\
                         TYPE* buf = (TYPE*)acc->buffer_view->buffer->data + acc->buffer_view->offset/sizeof(TYPE) + acc->offset/sizeof(TYPE);\
@@ -1640,12 +2968,8 @@ gs_gfxt_load_gltf_data_from_file(const char* path, gs_gfxt_mesh_import_options_t
                                 v = buf[n + l];\
                             }\
                             n += (int32_t)(acc->stride/sizeof(TYPE));\
-                            /* Add to temp positions array */\
-                            switch (index_element_size) {\
-                                case 0: gs_byte_buffer_write(BB, uint16_t, (uint16_t)v); break;\
-                                case 2: gs_byte_buffer_write(BB, uint16_t, (uint16_t)v); break;\
-                                case 4: gs_byte_buffer_write(BB, uint32_t, (uint32_t)v); break;\
-                            }\
+                            /* Add to temp index array, written out at the requested width once processed */\
+                            gs_dyn_array_push(ARR, (uint32_t)v);\
                         }\
                     } while (0)
 
@@ -1654,12 +2978,12 @@ gs_gfxt_load_gltf_data_from_file(const char* path, gs_gfxt_mesh_import_options_t
                 {
                     switch (acc->component_type) 
                     {
-                        case cgltf_component_type_r_8:   __GFXT_GLTF_PUSH_IDX(&i_data, acc, int8_t);   break;
-                        case cgltf_component_type_r_8u:  __GFXT_GLTF_PUSH_IDX(&i_data, acc, uint8_t);  break;
-                        case cgltf_component_type_r_16:  __GFXT_GLTF_PUSH_IDX(&i_data, acc, int16_t);  break;
-                        case cgltf_component_type_r_16u: __GFXT_GLTF_PUSH_IDX(&i_data, acc, uint16_t); break;
-                        case cgltf_component_type_r_32u: __GFXT_GLTF_PUSH_IDX(&i_data, acc, uint32_t); break;
-                        case cgltf_component_type_r_32f: __GFXT_GLTF_PUSH_IDX(&i_data, acc, float);    break;
+                        case cgltf_component_type_r_8:   __GFXT_GLTF_PUSH_IDX(idx, acc, int8_t);   break;
+                        case cgltf_component_type_r_8u:  __GFXT_GLTF_PUSH_IDX(idx, acc, uint8_t);  break;
+                        case cgltf_component_type_r_16:  __GFXT_GLTF_PUSH_IDX(idx, acc, int16_t);  break;
+                        case cgltf_component_type_r_16u: __GFXT_GLTF_PUSH_IDX(idx, acc, uint16_t); break;
+                        case cgltf_component_type_r_32u: __GFXT_GLTF_PUSH_IDX(idx, acc, uint32_t); break;
+                        case cgltf_component_type_r_32f: __GFXT_GLTF_PUSH_IDX(idx, acc, float);    break;
 
                         // Shouldn't hit here
                         default: {
@@ -1669,16 +2993,95 @@ gs_gfxt_load_gltf_data_from_file(const char* path, gs_gfxt_mesh_import_options_t
                 else 
                 {
                     // Iterate over positions size, then just push back indices
-                    for (uint32_t i = 0; i < gs_dyn_array_size(positions); ++i) 
+                    for (uint32_t k = 0; k < (uint32_t)gs_dyn_array_size(positions); ++k) 
                     {
-                        switch (index_element_size)
-                        {
-                            default:
-                            case 0: gs_byte_buffer_write(&i_data, uint16_t, (uint16_t)i); break;
-                            case 2: gs_byte_buffer_write(&i_data, uint16_t, (uint16_t)i); break;
-                            case 4: gs_byte_buffer_write(&i_data, uint32_t, (uint32_t)i); break;
-                        }
+                        gs_dyn_array_push(idx, k);
+                    }
+                }
+
+                // Reorder indices/vertices and measure before/after
+                const uint32_t icount = gs_dyn_array_size(idx);
+                uint32_t vcount = gs_dyn_array_size(positions);
+                const uint32_t vcount_before = vcount;
+                uint32_t uv_ct = 0, color_ct = 0;
+                for (uint32_t tci = 0; tci < GS_GFXT_TEX_COORD_MAX && !gs_dyn_array_empty(uvs[tci]); ++tci) uv_ct++;
+                for (uint32_t ci = 0; ci < GS_GFXT_COLOR_MAX && !gs_dyn_array_empty(colors[ci]); ++ci) color_ct++;
+
+                // Streams must line up 1:1 with positions to be reordered
+                bool streams_match = vcount && (gs_dyn_array_empty(normals) || (uint32_t)gs_dyn_array_size(normals) == vcount) && 
+                    (gs_dyn_array_empty(tangents) || (uint32_t)gs_dyn_array_size(tangents) == vcount);
+                for (uint32_t tci = 0; tci < uv_ct; ++tci) streams_match &= (uint32_t)gs_dyn_array_size(uvs[tci]) == vcount;
+                for (uint32_t ci = 0; ci < color_ct; ++ci) streams_match &= (uint32_t)gs_dyn_array_size(colors[ci]) == vcount;
+                for (uint32_t k = 0; k < icount && streams_match; ++k) streams_match &= idx[k] < vcount;
+                const bool triangles = prim->type == cgltf_primitive_type_triangles && icount && icount % 3 == 0;
+
+                float acmr_before = 0.f;
+                if (track && triangles && streams_match) {
+                    acmr_before = gs_gfxt_mesh_acmr(idx, icount, vcount, GS_GFXT_MESH_CACHE_SIZE);
+                }
+
+                if (optimize && triangles && streams_match)
+                {
+                    if (optimize & GS_GFXT_MESH_OPTIMIZE_VERTEX_CACHE) {
+                        gs_gfxt_mesh_optimize_vertex_cache(idx, idx, icount, vcount);
+                    }
+
+                    if (optimize & GS_GFXT_MESH_OPTIMIZE_OVERDRAW) {
+                        gs_gfxt_mesh_optimize_overdraw(idx, idx, icount, positions, vcount, options->overdraw_threshold);
+                    }
+
+                    if (optimize & GS_GFXT_MESH_OPTIMIZE_VERTEX_FETCH)
+                    {
+                        gs_dyn_array_reserve(remap, vcount);
+                        const uint32_t remapped = gs_gfxt_mesh_optimize_vertex_fetch_remap(remap, idx, icount, vcount);
+
+                        #define __GFXT_GLTF_REMAP(ARR, TYPE)\
+                            do {\
+                                if (gs_dyn_array_empty(ARR)) break;\
+                                TYPE* TMP = (TYPE*)gs_malloc(remapped * sizeof(TYPE));\
+                                gs_gfxt_mesh_remap_vertex_buffer(TMP, ARR, sizeof(TYPE), remap, vcount);\
+                                memcpy(ARR, TMP, remapped * sizeof(TYPE));\
+                                gs_dyn_array_head(ARR)->size = remapped;\
+                                gs_free(TMP);\
+                            } while (0)
+
+                        __GFXT_GLTF_REMAP(positions, gs_vec3);
+                        __GFXT_GLTF_REMAP(normals, gs_vec3);
+                        __GFXT_GLTF_REMAP(tangents, gs_vec3);
+                        for (uint32_t tci = 0; tci < uv_ct; ++tci) __GFXT_GLTF_REMAP(uvs[tci], gs_vec2);
+                        for (uint32_t ci = 0; ci < color_ct; ++ci) __GFXT_GLTF_REMAP(colors[ci], gs_color_t);
+                        vcount = remapped;
+                    }
+                }
+
+                if (track)
+                {
+                    const size_t bpv_before = (vcount ? sizeof(gs_vec3) : 0) + (!gs_dyn_array_empty(normals) ? sizeof(gs_vec3) : 0) + 
+                        (!gs_dyn_array_empty(tangents) ? sizeof(gs_vec3) : 0) + uv_ct * sizeof(gs_vec2) + color_ct * sizeof(gs_color_t);
+                    const size_t bpv_after = (vcount ? ((quantize & GS_GFXT_MESH_QUANTIZE_POSITION_HALF) ? 4 * sizeof(uint16_t) : sizeof(gs_vec3)) : 0) + 
+                        (!gs_dyn_array_empty(normals) ? ((quantize & GS_GFXT_MESH_QUANTIZE_NORMAL_OCT) ? 2 * sizeof(int16_t) : sizeof(gs_vec3)) : 0) + 
+                        (!gs_dyn_array_empty(tangents) ? sizeof(gs_vec3) : 0) + 
+                        uv_ct * ((quantize & GS_GFXT_MESH_QUANTIZE_TEXCOORD_UNORM) ? 2 * sizeof(uint16_t) : sizeof(gs_vec2)) + color_ct * sizeof(gs_color_t);
+                    const float acmr_after = (triangles && streams_match) ? gs_gfxt_mesh_acmr(idx, icount, vcount, GS_GFXT_MESH_CACHE_SIZE) : 0.f;
+
+                    stats.triangles += icount / 3;
+                    stats.vertices_before += vcount_before;
+                    stats.vertices_after += vcount;
+                    stats.vertex_bytes_before += vcount_before * bpv_before;
+                    stats.vertex_bytes_after += vcount * bpv_after;
+                    acmr_sum_before += acmr_before * (float)(icount / 3);
+                    acmr_sum_after += acmr_after * (float)(icount / 3);
+                }
+
+                // Write out indices
+                if (index_element_size == sizeof(uint16_t) || !index_element_size) {
+                    if (vcount > UINT16_MAX + 1) {
+                        gs_log_warning("GFXT:Mesh:LoadFromFile: Primitive has %u vertices, 16-bit indices will wrap (set index_buffer_element_size = 4).", vcount);
                     }
+                    for (uint32_t k = 0; k < icount; ++k) gs_byte_buffer_write(&i_data, uint16_t, (uint16_t)idx[k]);
+                }
+                else if (index_element_size == sizeof(uint32_t)) {
+                    for (uint32_t k = 0; k < icount; ++k) gs_byte_buffer_write(&i_data, uint32_t, idx[k]);
                 }
 
                 // Grab mesh layout pointer to use
@@ -1785,7 +3188,7 @@ gs_gfxt_load_gltf_data_from_file(const char* path, gs_gfxt_mesh_import_options_t
                 */
 
                 // Count
-                primitive.count = prim->indices->count;
+                primitive.count = icount;
 
                 // Indices
                 primitive.indices.size = i_data.size;
@@ -1793,7 +3196,22 @@ gs_gfxt_load_gltf_data_from_file(const char* path, gs_gfxt_mesh_import_options_t
                 memcpy(primitive.indices.data, i_data.data, i_data.size);
 
                 // Positions
-                if (!gs_dyn_array_empty(positions))
+                if (!gs_dyn_array_empty(positions) && (quantize & GS_GFXT_MESH_QUANTIZE_POSITION_HALF))
+                {
+                    const uint32_t ct = gs_dyn_array_size(positions);
+                    uint16_t* q = (uint16_t*)gs_malloc(ct * 4 * sizeof(uint16_t));
+                    for (uint32_t k = 0; k < ct; ++k) {
+                        q[k * 4 + 0] = __gs_gfxt_quantize_half(positions[k].x);
+                        q[k * 4 + 1] = __gs_gfxt_quantize_half(positions[k].y);
+                        q[k * 4 + 2] = __gs_gfxt_quantize_half(positions[k].z);
+                        q[k * 4 + 3] = __gs_gfxt_quantize_half(1.f);
+                    }
+                    primitive.positions.size = ct * 4 * sizeof(uint16_t);
+                    primitive.positions.data = q;
+                    primitive.aabb = __gs_gfxt_aabb_from_positions(positions, ct);
+                    primitive.quantize |= GS_GFXT_MESH_QUANTIZE_POSITION_HALF;
+                }
+                else if (!gs_dyn_array_empty(positions))
                 {
                     primitive.positions.size = gs_dyn_array_size(positions) * sizeof(gs_vec3);
                     primitive.positions.data = gs_malloc(primitive.positions.size);
@@ -1801,7 +3219,18 @@ gs_gfxt_load_gltf_data_from_file(const char* path, gs_gfxt_mesh_import_options_t
                 }
 
                 // Normals
-                if (!gs_dyn_array_empty(normals))
+                if (!gs_dyn_array_empty(normals) && (quantize & GS_GFXT_MESH_QUANTIZE_NORMAL_OCT))
+                {
+                    const uint32_t ct = gs_dyn_array_size(normals);
+                    int16_t* q = (int16_t*)gs_malloc(ct * 2 * sizeof(int16_t));
+                    for (uint32_t k = 0; k < ct; ++k) {
+                        __gs_gfxt_quantize_oct(&q[k * 2], normals[k]);
+                    }
+                    primitive.normals.size = ct * 2 * sizeof(int16_t);
+                    primitive.normals.data = q;
+                    primitive.quantize |= GS_GFXT_MESH_QUANTIZE_NORMAL_OCT;
+                }
+                else if (!gs_dyn_array_empty(normals))
                 {
                     primitive.normals.size = gs_dyn_array_size(normals) * sizeof(gs_vec3);
                     primitive.normals.data = gs_malloc(primitive.normals.size);
@@ -1819,7 +3248,21 @@ gs_gfxt_load_gltf_data_from_file(const char* path, gs_gfxt_mesh_import_options_t
                 // Texcoords
                 for (uint32_t tci = 0; tci < GS_GFXT_TEX_COORD_MAX; ++tci)
                 {
-                    if (!gs_dyn_array_empty(uvs[tci]))
+                    if (!gs_dyn_array_empty(uvs[tci]) && (quantize & GS_GFXT_MESH_QUANTIZE_TEXCOORD_UNORM))
+                    {
+                        const uint32_t ct = gs_dyn_array_size(uvs[tci]);
+                        uint16_t* q = (uint16_t*)gs_malloc(ct * 2 * sizeof(uint16_t));
+                        for (uint32_t k = 0; k < ct; ++k) {
+                            const gs_vec2 uv = uvs[tci][k];
+                            uv_clamped |= uv.x < 0.f || uv.x > 1.f || uv.y < 0.f || uv.y > 1.f;
+                            q[k * 2 + 0] = (uint16_t)roundf(gs_clamp(uv.x, 0.f, 1.f) * 65535.f);
+                            q[k * 2 + 1] = (uint16_t)roundf(gs_clamp(uv.y, 0.f, 1.f) * 65535.f);
+                        }
+                        primitive.tex_coords[tci].size = ct * 2 * sizeof(uint16_t);
+                        primitive.tex_coords[tci].data = q;
+                        primitive.quantize |= GS_GFXT_MESH_QUANTIZE_TEXCOORD_UNORM;
+                    }
+                    else if (!gs_dyn_array_empty(uvs[tci]))
                     {
                         primitive.tex_coords[tci].size = gs_dyn_array_size(uvs[tci]) * sizeof(gs_vec2);
                         primitive.tex_coords[tci].data = gs_malloc(primitive.tex_coords[tci].size);
@@ -1911,8 +3354,27 @@ gs_gfxt_load_gltf_data_from_file(const char* path, gs_gfxt_mesh_import_options_t
 
     gs_println("Finished loading mesh.");
 
+    if (track)
+    {
+        stats.acmr_before = stats.triangles ? acmr_sum_before / (float)stats.triangles : 0.f;
+        stats.acmr_after = stats.triangles ? acmr_sum_after / (float)stats.triangles : 0.f;
+        stats.bytes_per_vertex_before = stats.vertices_before ? (float)stats.vertex_bytes_before / (float)stats.vertices_before : 0.f;
+        stats.bytes_per_vertex_after = stats.vertices_after ? (float)stats.vertex_bytes_after / (float)stats.vertices_after : 0.f;
+        stats.index_element_size = index_element_size == sizeof(uint32_t) ? sizeof(uint32_t) : sizeof(uint16_t);
+        if (options->stats) *options->stats = stats;
+
+        if (uv_clamped) {
+            gs_log_warning("GFXT:Mesh:LoadFromFile: Texcoords outside [0, 1] were clamped by TEXCOORD_UNORM quantization.");
+        }
+        gs_println("GFXT:Mesh:Import: %u tris, ACMR %.3f -> %.3f, %u -> %u vertices, %.1f -> %.1f bytes/vertex, %zu -> %zu vertex bytes", 
+            stats.triangles, stats.acmr_before, stats.acmr_after, stats.vertices_before, stats.vertices_after, 
+            stats.bytes_per_vertex_before, stats.bytes_per_vertex_after, stats.vertex_bytes_before, stats.vertex_bytes_after);
+    }
+
     // Free all data at the end
     cgltf_free(data);
+    gs_dyn_array_free(idx);
+    gs_dyn_array_free(remap);
     gs_dyn_array_free(positions);
     gs_dyn_array_free(normals);
     gs_dyn_array_free(tangents);
@@ -2053,15 +3515,31 @@ typedef struct gs_shader_io_data_t
     char name[64];
 } gs_shader_io_data_t;
 
+typedef struct gs_shader_include_t
+{
+    char path[256];
+    uint64_t hash;              // Content hash, 0 if the file couldn't be read
+} gs_shader_include_t;
+
 typedef struct gs_pipeline_parse_data_t 
 { 
     gs_dyn_array(gs_shader_io_data_t) io_list[3];
     gs_dyn_array(gs_gfxt_mesh_layout_t) mesh_layout;
     gs_dyn_array(gs_graphics_vertex_attribute_type) vertex_layout;
+    gs_dyn_array(gs_shader_include_t) includes;     // Every include read, for pipeline cache invalidation
     char* code[3];
     char dir[256];
 } gs_ppd_t;
 
+#define GS_GFXT_PIPELINE_CACHE_MAGIC    0x43505347      // "GSPC"
+#define GS_GFXT_PIPELINE_CACHE_VERSION  2
+
+gs_force_inline uint64_t
+__gs_gfxt_pipeline_cache_hash(const void* data, size_t sz)
+{
+    return data ? (uint64_t)gs_hash_bytes((void*)data, sz, GS_GFXT_PIPELINE_CACHE_VERSION) : 0;
+}
+
 #define gs_parse_warning(TXT, ...)\
     do {\
         gs_printf("WARNING::");\
@@ -2119,6 +3597,10 @@ const char* gs_get_vertex_attribute_string(gs_graphics_vertex_attribute_type typ
         case GS_GRAPHICS_VERTEX_ATTRIBUTE_BYTE2:   return "vec2"; break;
         case GS_GRAPHICS_VERTEX_ATTRIBUTE_BYTE3:   return "vec3"; break;
         case GS_GRAPHICS_VERTEX_ATTRIBUTE_BYTE4:   return "vec4"; break;
+        case GS_GRAPHICS_VERTEX_ATTRIBUTE_HALF4:   return "vec4"; break;
+        case GS_GRAPHICS_VERTEX_ATTRIBUTE_HALF2:   return "vec2"; break;
+        case GS_GRAPHICS_VERTEX_ATTRIBUTE_SHORT2N: return "vec2"; break;
+        case GS_GRAPHICS_VERTEX_ATTRIBUTE_USHORT2N: return "vec2"; break;
         default: return "UNKNOWN"; break;
     }
 }
@@ -2137,6 +3619,10 @@ gs_graphics_vertex_attribute_type gs_get_vertex_attribute_from_token(const gs_to
     else if (gs_token_compare_text(t, "byte3"))  return GS_GRAPHICS_VERTEX_ATTRIBUTE_BYTE3;
     else if (gs_token_compare_text(t, "byte2"))  return GS_GRAPHICS_VERTEX_ATTRIBUTE_BYTE2;
     else if (gs_token_compare_text(t, "byte"))   return GS_GRAPHICS_VERTEX_ATTRIBUTE_BYTE;
+    else if (gs_token_compare_text(t, "half4"))  return GS_GRAPHICS_VERTEX_ATTRIBUTE_HALF4;
+    else if (gs_token_compare_text(t, "half2"))  return GS_GRAPHICS_VERTEX_ATTRIBUTE_HALF2;
+    else if (gs_token_compare_text(t, "short2n"))  return GS_GRAPHICS_VERTEX_ATTRIBUTE_SHORT2N;
+    else if (gs_token_compare_text(t, "ushort2n")) return GS_GRAPHICS_VERTEX_ATTRIBUTE_USHORT2N;
     return (gs_graphics_vertex_attribute_type)0x00;
 }
 
@@ -2505,6 +3991,12 @@ bool gs_parse_code(gs_lexer_t* lex, gs_gfxt_pipeline_desc_t* desc, gs_ppd_t* ppd
                                 char* inc_src = gs_platform_read_file_contents(FINAL_PATH, "rb", &len);
                                 gs_byte_buffer_write_bulk(&cbuffer, inc_src, len);
 
+                                gs_shader_include_t inc = gs_default_val();
+                                memcpy(inc.path, FINAL_PATH, gs_min(sizeof(inc.path) - 1, gs_string_length(FINAL_PATH)));
+                                inc.hash = __gs_gfxt_pipeline_cache_hash(inc_src, len);
+                                gs_dyn_array_push(ppd->includes, inc);
+                                if (inc_src) gs_free(inc_src);
+
                                 // includes[iidx].start = tkn.text;
                                 // includes[iidx].end = tkn.text + ilen + tkn.len;
 
@@ -2652,6 +4144,9 @@ bool gs_parse_vertex_mesh_attributes(gs_lexer_t* lex, gs_gfxt_pipeline_desc_t* d
 
                 #define PUSH_ATTR(MESH_ATTR, VERT_ATTR)\
                     do {\
+                        if (desc->instance.enabled) {\
+                            gs_log_warning("Vertex attribute %.*s declared after INSTANCE_MODEL, which must be last.", token_name.len, token_name.text);\
+                        }\
                         gs_gfxt_mesh_layout_t layout = gs_default_val();\
                         layout.type = GS_ASSET_MESH_ATTRIBUTE_TYPE_##MESH_ATTR;\
                         gs_dyn_array_push(ppd->mesh_layout, layout);\
@@ -2683,7 +4178,28 @@ bool gs_parse_vertex_mesh_attributes(gs_lexer_t* lex, gs_gfxt_pipeline_desc_t* d
                 else if (gs_token_compare_text(&token, "FLOAT2"))     PUSH_ATTR(TEXCOORD, FLOAT2); 
                 else if (gs_token_compare_text(&token, "FLOAT3"))     PUSH_ATTR(POSITION, FLOAT3);  
                 else if (gs_token_compare_text(&token, "UINT"))       PUSH_ATTR(UINT, UINT);  
+
+                // Quantized streams written by the mesh importer (see gs_gfxt_mesh_quantize_flags)
+                else if (gs_token_compare_text(&token, "POSITION_HALF"))  PUSH_ATTR(POSITION, HALF4);     // vec4, w = 1
+                else if (gs_token_compare_text(&token, "NORMAL_OCT"))     PUSH_ATTR(NORMAL, SHORT2N);     // vec2, decode with gs_oct_decode()
+                else if (gs_token_compare_text(&token, "TEXCOORD_UNORM")) PUSH_ATTR(TEXCOORD, USHORT2N);  // vec2 in [0, 1]
                 // else if (gs_token_compare_text(&token, "FLOAT4"))     PUSH_ATTR(TANGENT, FLOAT4);  
+
+                // Per-instance model matrix, declared as a mat4 (4 vec4 attributes) sourced from the scene instance buffer
+                else if (gs_token_compare_text(&token, "INSTANCE_MODEL")) 
+                {
+                    desc->instance.enabled = true;
+                    desc->instance.attr = gs_dyn_array_size(desc->pip_desc.layout.attrs);
+                    for (uint32_t c = 0; c < 4; ++c)
+                    {
+                        gs_graphics_vertex_attribute_desc_t attr = gs_default_val();
+                        memcpy(attr.name, token_name.text, token_name.len);
+                        attr.format = GS_GRAPHICS_VERTEX_ATTRIBUTE_FLOAT4;
+                        attr.stride = sizeof(gs_mat4);
+                        attr.divisor = 1;
+                        gs_dyn_array_push(desc->pip_desc.layout.attrs, attr);
+                    }
+                }
                 else 
                 {
                     gs_log_warning("Unidentified vertex attribute: %.*s: %.*s", 
@@ -3402,7 +4918,7 @@ char* gs_pipeline_generate_shader_code(gs_gfxt_pipeline_desc_t* pdesc, gs_ppd_t*
     if (ppd->code[sidx])
     {
         const size_t header_sz = (size_t)gs_string_length(shader_header);
-        size_t total_sz = gs_string_length(ppd->code[sidx]) + header_sz + 2048;
+        size_t total_sz = gs_string_length(ppd->code[sidx]) + header_sz + 2048 + gs_dyn_array_size(pdesc->ublock_desc.layout) * 96;
         src = (char*)gs_malloc(total_sz); 
         memset(src, 0, total_sz);
         strncat(src, shader_header, header_sz);
@@ -3415,21 +4931,69 @@ char* gs_pipeline_generate_shader_code(gs_gfxt_pipeline_desc_t* pdesc, gs_ppd_t*
                 const char* aname = pdesc->pip_desc.layout.attrs[i].name;
                 const char* atype = gs_get_vertex_attribute_string(pdesc->pip_desc.layout.attrs[i].format); 
 
+                // Instance matrix columns occupy 4 consecutive locations of a single mat4 input
+                if (pdesc->instance.enabled && i == pdesc->instance.attr)
+                {
+                    gs_snprintfc(ATTR, 96, "layout(location = %zu) in mat4 %s;\n", i, aname);
+                    strncat(src, ATTR, gs_string_length(ATTR));
+                    i += 3;
+                    continue;
+                }
+
                 gs_snprintfc(ATTR, 64, "layout(location = %zu) in %s %s;\n", i, atype, aname);
                 const size_t sz = gs_string_length(ATTR);
                 strncat(src, ATTR, sz);
             } 
+
+            // Octahedral normal decode for NORMAL_OCT streams
+            for (uint32_t i = 0; i < (uint32_t)gs_dyn_array_size(pdesc->pip_desc.layout.attrs); ++i)
+            {
+                if (pdesc->pip_desc.layout.attrs[i].format != GS_GRAPHICS_VERTEX_ATTRIBUTE_SHORT2N) continue;
+                strcat(src, 
+                    "vec3 gs_oct_decode(vec2 e) {\n"
+                    "    vec3 v = vec3(e, 1.0 - abs(e.x) - abs(e.y));\n"
+                    "    float t = max(-v.z, 0.0);\n"
+                    "    v.x += v.x >= 0.0 ? -t : t;\n"
+                    "    v.y += v.y >= 0.0 ? -t : t;\n"
+                    "    return normalize(v);\n"
+                    "}\n"
+                );
+                break;
+            }
         }
 
         // Compute shader image buffer binding
         uint32_t img_binding = 0;
 
+        // Uniform block, identical in every stage: all non-opaque uniforms of the pipeline, first declaration wins.
+        // Members are highp so precision matches across stages on ES.
+        if (pdesc->ublock_desc.block)
+        {
+            strcat(src, "layout(std140) uniform " GS_GFXT_UNIFORM_BLOCK_NAME " {\n");
+            for (uint32_t i = 0; i < (uint32_t)gs_dyn_array_size(pdesc->ublock_desc.layout); ++i)
+            {
+                gs_gfxt_uniform_desc_t* udesc = &pdesc->ublock_desc.layout[i]; 
+                if (!gs_gfxt_uniform_type_is_block_member(udesc->type)) continue;
+
+                bool dup = false;
+                for (uint32_t j = 0; j < i && !dup; ++j) {
+                    dup = gs_string_compare_equal(pdesc->ublock_desc.layout[j].name, udesc->name);
+                }
+                if (dup) continue;
+
+                gs_snprintfc(TMP, 96, "    highp %s %s;\n", gs_uniform_string_from_type(udesc->type), udesc->name);
+                strncat(src, TMP, gs_string_length(TMP));
+            }
+            strcat(src, "};\n");
+        }
+
         // Uniforms
         for (uint32_t i = 0; i < gs_dyn_array_size(pdesc->ublock_desc.layout); ++i)
         { 
             gs_gfxt_uniform_desc_t* udesc = &pdesc->ublock_desc.layout[i]; 
 
             if (udesc->stage != stage) continue;
+            if (pdesc->ublock_desc.block && gs_gfxt_uniform_type_is_block_member(udesc->type)) continue;
 
             switch (stage)
             {
@@ -3547,6 +5111,250 @@ char* gs_pipeline_generate_shader_code(gs_gfxt_pipeline_desc_t* pdesc, gs_ppd_t*
     return src;
 }
 
+//=== Pipeline cache ===//
+
+static const char* _gs_gfxt_pipeline_cache_dir = GS_GFXT_PIPELINE_CACHE_DIR;
+
+// Source, the path its includes resolve against, and everything else that shapes the parsed output
+static uint64_t
+__gs_gfxt_pipeline_cache_key(const char* data, size_t sz, const char* file_path)
+{
+    static const char* config = 
+        GS_GFXT_UNIFORM_VIEW_MATRIX GS_GFXT_UNIFORM_PROJECTION_MATRIX GS_GFXT_UNIFORM_VIEW_PROJECTION_MATRIX
+        GS_GFXT_UNIFORM_VIEW_PROJECTION_MATRIX_0 GS_GFXT_UNIFORM_VIEW_PROJECTION_MATRIX_1 GS_GFXT_UNIFORM_VIEW_PROJECTION_MATRIX_2
+        GS_GFXT_UNIFORM_VIEW_PROJECTION_MATRIX_3 GS_GFXT_UNIFORM_MODEL_MATRIX GS_GFXT_UNIFORM_INVERSE_MODEL_MATRIX
+        GS_GFXT_UNIFORM_VIEW_WORLD_POSITION GS_GFXT_UNIFORM_MODEL_VIEW_PROJECTION_MATRIX GS_GFXT_UNIFORM_MODEL_VIEW_PROJECTION_MATRIX_0
+        GS_GFXT_UNIFORM_MODEL_VIEW_PROJECTION_MATRIX_1 GS_GFXT_UNIFORM_TIME GS_GFXT_UNIFORM_BLOCK_NAME;
+    const uint32_t abi[] = {
+        GS_GFXT_UNIFORM_BLOCK_BINDING,
+        (uint32_t)sizeof(gs_gfxt_pipeline_desc_t),
+        (uint32_t)sizeof(gs_gfxt_uniform_desc_t),
+        (uint32_t)sizeof(gs_graphics_vertex_attribute_desc_t),
+        (uint32_t)sizeof(gs_gfxt_mesh_layout_t),
+        (uint32_t)sizeof(gs_shader_include_t)
+    };
+    const uint64_t parts[] = {
+        __gs_gfxt_pipeline_cache_hash(data, sz),
+        file_path ? __gs_gfxt_pipeline_cache_hash(file_path, gs_string_length(file_path)) : 0,
+        __gs_gfxt_pipeline_cache_hash(config, gs_string_length(config)),
+        __gs_gfxt_pipeline_cache_hash(abi, sizeof(abi))
+    };
+    return __gs_gfxt_pipeline_cache_hash(parts, sizeof(parts));
+}
+
+static bool
+__gs_gfxt_pipeline_cache_read(gs_byte_buffer_t* bb, void* dst, size_t sz)
+{
+    if ((size_t)bb->position + sz > (size_t)bb->size) return false;
+    if (sz) memcpy(dst, bb->data + bb->position, sz);
+    bb->position += (uint32_t)sz;
+    return true;
+}
+
+// Count followed by elements, into a dyn array
+static bool
+__gs_gfxt_pipeline_cache_read_array(gs_byte_buffer_t* bb, void** arr, size_t elem_sz)
+{
+    uint32_t ct = 0;
+    if (!__gs_gfxt_pipeline_cache_read(bb, &ct, sizeof(ct))) return false;
+    if ((size_t)ct * elem_sz > (size_t)(bb->size - bb->position)) return false;
+    if (!ct) return true;
+    gs_dyn_array_init(arr, elem_sz);
+    *arr = gs_dyn_array_resize_impl(*arr, elem_sz, ct);
+    gs_dyn_array_head(*arr)->size = ct;
+    return __gs_gfxt_pipeline_cache_read(bb, *arr, ct * elem_sz);
+}
+
+static void
+__gs_gfxt_pipeline_cache_write_array(gs_byte_buffer_t* bb, const void* arr, uint32_t ct, size_t elem_sz)
+{
+    gs_byte_buffer_write(bb, uint32_t, ct);
+    if (ct) gs_byte_buffer_write_bulk(bb, (void*)arr, ct * elem_sz);
+}
+
+static void
+__gs_gfxt_pipeline_cache_store(uint64_t key, const gs_gfxt_pipeline_desc_t* pdesc, gs_dyn_array(gs_gfxt_mesh_layout_t) mesh_layout,
+    gs_dyn_array(gs_shader_include_t) includes, const gs_graphics_shader_source_desc_t* sources, uint32_t source_ct, 
+    gs_handle(gs_graphics_shader_t) shader)
+{
+    const char* dir = _gs_gfxt_pipeline_cache_dir;
+    if (!dir) return;
+    if (!gs_platform_dir_exists(dir)) gs_platform_mkdir(dir, 0755);
+
+    gs_byte_buffer_t bb = gs_byte_buffer_new();
+    gs_byte_buffer_write(&bb, uint32_t, GS_GFXT_PIPELINE_CACHE_MAGIC);
+    gs_byte_buffer_write(&bb, uint32_t, GS_GFXT_PIPELINE_CACHE_VERSION);
+    gs_byte_buffer_write(&bb, uint64_t, key);
+    __gs_gfxt_pipeline_cache_write_array(&bb, includes, gs_dyn_array_size(includes), sizeof(gs_shader_include_t));
+
+    // Description as is, pointers and handles are patched on load
+    gs_byte_buffer_write_bulk(&bb, (void*)pdesc, sizeof(gs_gfxt_pipeline_desc_t));
+    __gs_gfxt_pipeline_cache_write_array(&bb, pdesc->pip_desc.layout.attrs, 
+        (uint32_t)(pdesc->pip_desc.layout.size / sizeof(gs_graphics_vertex_attribute_desc_t)), sizeof(gs_graphics_vertex_attribute_desc_t));
+    __gs_gfxt_pipeline_cache_write_array(&bb, pdesc->ublock_desc.layout, 
+        (uint32_t)(pdesc->ublock_desc.size / sizeof(gs_gfxt_uniform_desc_t)), sizeof(gs_gfxt_uniform_desc_t));
+    __gs_gfxt_pipeline_cache_write_array(&bb, mesh_layout, gs_dyn_array_size(mesh_layout), sizeof(gs_gfxt_mesh_layout_t));
+
+    // Generated GLSL, null terminated
+    gs_byte_buffer_write(&bb, uint32_t, source_ct);
+    for (uint32_t i = 0; i < source_ct; ++i)
+    {
+        const uint32_t len = gs_string_length(sources[i].source) + 1;
+        gs_byte_buffer_write(&bb, uint32_t, (uint32_t)sources[i].type);
+        gs_byte_buffer_write(&bb, uint32_t, len);
+        gs_byte_buffer_write_bulk(&bb, (void*)sources[i].source, len);
+    }
+
+    // Linked program, if the driver hands one out
+    uint32_t format = 0;
+    size_t binary_sz = gs_graphics_shader_get_binary(shader, NULL, 0, NULL);
+    void* binary = binary_sz ? gs_malloc(binary_sz) : NULL;
+    if (binary) binary_sz = gs_graphics_shader_get_binary(shader, binary, binary_sz, &format);
+    gs_byte_buffer_write(&bb, uint32_t, format);
+    gs_byte_buffer_write(&bb, uint32_t, (uint32_t)binary_sz);
+    if (binary) {
+        gs_byte_buffer_write_bulk(&bb, binary, binary_sz);
+        gs_free(binary);
+    }
+
+    gs_snprintfc(PATH, 512, "%s/%016llx.gsp", dir, (unsigned long long)key);
+    if (gs_byte_buffer_write_to_file(&bb, PATH) != GS_RESULT_SUCCESS) {
+        gs_log_warning("gs_gfxt_pipeline_cache::unable to write %s", PATH);
+    }
+    gs_byte_buffer_free(&bb);
+}
+
+typedef struct __gs_gfxt_pipeline_cache_entry_t {
+    gs_dyn_array(gs_shader_include_t) includes;
+    gs_gfxt_pipeline_desc_t pdesc;
+    gs_dyn_array(gs_graphics_vertex_attribute_desc_t) attrs;
+    gs_dyn_array(gs_gfxt_uniform_desc_t) uniforms;
+    gs_dyn_array(gs_gfxt_mesh_layout_t) mesh_layout;
+    gs_graphics_shader_source_desc_t sources[2];        // Point into the entry's file data
+    uint32_t source_ct;
+    const void* binary;
+    uint32_t binary_format;
+    uint32_t binary_size;
+} __gs_gfxt_pipeline_cache_entry_t;
+
+// Validates the entry against the key and the current include contents
+static bool
+__gs_gfxt_pipeline_cache_parse(gs_byte_buffer_t* bb, uint64_t key, __gs_gfxt_pipeline_cache_entry_t* e)
+{
+    uint32_t magic = 0, version = 0;
+    uint64_t fkey = 0;
+    if (!__gs_gfxt_pipeline_cache_read(bb, &magic, sizeof(magic)) || magic != GS_GFXT_PIPELINE_CACHE_MAGIC) return false;
+    if (!__gs_gfxt_pipeline_cache_read(bb, &version, sizeof(version)) || version != GS_GFXT_PIPELINE_CACHE_VERSION) return false;
+    if (!__gs_gfxt_pipeline_cache_read(bb, &fkey, sizeof(fkey)) || fkey != key) return false;
+
+    if (!__gs_gfxt_pipeline_cache_read_array(bb, (void**)&e->includes, sizeof(gs_shader_include_t))) return false;
+    for (uint32_t i = 0; i < (uint32_t)gs_dyn_array_size(e->includes); ++i)
+    {
+        gs_shader_include_t* inc = &e->includes[i];
+        inc->path[sizeof(inc->path) - 1] = '\0';
+        size_t len = 0;
+        char* src = gs_platform_read_file_contents(inc->path, "rb", &len);
+        const uint64_t hash = __gs_gfxt_pipeline_cache_hash(src, len);
+        if (src) gs_free(src);
+        if (hash != inc->hash) return false;
+    }
+
+    if (!__gs_gfxt_pipeline_cache_read(bb, &e->pdesc, sizeof(e->pdesc))) return false;
+    if (!__gs_gfxt_pipeline_cache_read_array(bb, (void**)&e->attrs, sizeof(gs_graphics_vertex_attribute_desc_t))) return false;
+    if (!__gs_gfxt_pipeline_cache_read_array(bb, (void**)&e->uniforms, sizeof(gs_gfxt_uniform_desc_t))) return false;
+    if (!__gs_gfxt_pipeline_cache_read_array(bb, (void**)&e->mesh_layout, sizeof(gs_gfxt_mesh_layout_t))) return false;
+
+    if (!__gs_gfxt_pipeline_cache_read(bb, &e->source_ct, sizeof(e->source_ct)) || !e->source_ct || e->source_ct > 2) return false;
+    for (uint32_t i = 0; i < e->source_ct; ++i)
+    {
+        uint32_t type = 0, len = 0;
+        if (!__gs_gfxt_pipeline_cache_read(bb, &type, sizeof(type))) return false;
+        if (!__gs_gfxt_pipeline_cache_read(bb, &len, sizeof(len)) || !len || len > bb->size - bb->position) return false;
+        e->sources[i].type = (gs_graphics_shader_stage_type)type;
+        e->sources[i].source = (const char*)(bb->data + bb->position);
+        if (e->sources[i].source[len - 1] != '\0') return false;
+        bb->position += len;
+    }
+
+    if (!__gs_gfxt_pipeline_cache_read(bb, &e->binary_format, sizeof(e->binary_format))) return false;
+    if (!__gs_gfxt_pipeline_cache_read(bb, &e->binary_size, sizeof(e->binary_size))) return false;
+    if (e->binary_size > bb->size - bb->position) return false;
+    e->binary = bb->data + bb->position;
+    return true;
+}
+
+// Skips lexing/generation, and compilation when the stored binary is accepted
+static bool
+__gs_gfxt_pipeline_cache_load(uint64_t key, gs_gfxt_pipeline_t* pip)
+{
+    const char* dir = _gs_gfxt_pipeline_cache_dir;
+    if (!dir) return false;
+
+    gs_snprintfc(PATH, 512, "%s/%016llx.gsp", dir, (unsigned long long)key);
+    if (!gs_platform_file_exists(PATH)) return false;
+
+    size_t len = 0;
+    gs_byte_buffer_t bb = gs_default_val();
+    bb.data = (uint8_t*)gs_platform_read_file_contents(PATH, "rb", &len);
+    if (!bb.data) return false;
+    bb.size = bb.capacity = (uint32_t)len;
+
+    __gs_gfxt_pipeline_cache_entry_t e = gs_default_val();
+    const bool valid = __gs_gfxt_pipeline_cache_parse(&bb, key, &e);
+    if (valid)
+    {
+        gs_gfxt_pipeline_desc_t pdesc = e.pdesc;
+        pdesc.pip_desc.layout.attrs = e.attrs;
+        pdesc.pip_desc.layout.size = gs_dyn_array_size(e.attrs) * sizeof(gs_graphics_vertex_attribute_desc_t);
+        pdesc.ublock_desc.layout = e.uniforms;
+        pdesc.ublock_desc.size = gs_dyn_array_size(e.uniforms) * sizeof(gs_gfxt_uniform_desc_t);
+
+        gs_handle(gs_graphics_shader_t) shader = gs_handle_invalid(gs_graphics_shader_t);
+        gs_graphics_shader_desc_t sdesc = gs_default_val();
+        if (e.binary_size && gs_graphics_info()->program_binary)
+        {
+            sdesc.binary = e.binary;
+            sdesc.binary_size = e.binary_size;
+            sdesc.binary_format = e.binary_format;
+            shader = gs_graphics_shader_create(&sdesc);
+        }
+
+        // No binary, or the driver rejected it: compile the cached sources and refresh the entry
+        const bool refresh = !gs_handle_is_valid(shader) && gs_graphics_info()->program_binary;
+        if (!gs_handle_is_valid(shader))
+        {
+            sdesc.binary = NULL;
+            sdesc.binary_size = 0;
+            sdesc.sources = e.sources;
+            sdesc.size = e.source_ct * sizeof(gs_graphics_shader_source_desc_t);
+            shader = gs_graphics_shader_create(&sdesc);
+        }
+
+        gs_handle(gs_graphics_shader_t) none = gs_default_val();
+        pdesc.pip_desc.raster.shader = none;
+        pdesc.pip_desc.compute.shader = none;
+        if (e.sources[0].type == GS_GRAPHICS_SHADER_STAGE_COMPUTE) pdesc.pip_desc.compute.shader = shader;
+        else pdesc.pip_desc.raster.shader = shader;
+
+        *pip = gs_gfxt_pipeline_create(&pdesc);
+        for (uint32_t i = 0; i < (uint32_t)gs_dyn_array_size(e.mesh_layout); ++i)
+        {
+            gs_dyn_array_push(pip->mesh_layout, e.mesh_layout[i]);
+        }
+
+        if (refresh && gs_handle_is_valid(shader)) {
+            __gs_gfxt_pipeline_cache_store(key, &pdesc, e.mesh_layout, e.includes, e.sources, e.source_ct, shader);
+        }
+    }
+
+    gs_dyn_array_free(e.includes);
+    gs_dyn_array_free(e.attrs);
+    gs_dyn_array_free(e.uniforms);
+    gs_dyn_array_free(e.mesh_layout);
+    gs_free(bb.data);
+    return valid;
+}
+
 GS_API_DECL gs_gfxt_pipeline_t 
 gs_gfxt_pipeline_load_from_file(const char* path)
 {
@@ -3572,6 +5380,13 @@ gs_gfxt_pipeline_load_from_memory_ext(const char* file_data, size_t sz, const ch
     // Cast to pip
     gs_gfxt_pipeline_t pip = gs_default_val();
 
+    // Hash before parsing, which rewrites the source in place
+    const uint64_t cache_key = _gs_gfxt_pipeline_cache_dir ? __gs_gfxt_pipeline_cache_key(file_data, sz, file_path) : 0;
+    if (cache_key && __gs_gfxt_pipeline_cache_load(cache_key, &pip))
+    {
+        return pip;
+    }
+
     gs_ppd_t ppd = gs_default_val();
     gs_gfxt_pipeline_desc_t pdesc = gs_default_val();
     pdesc.pip_desc.raster.index_buffer_element_size = sizeof(uint32_t); 
@@ -3621,6 +5436,12 @@ gs_gfxt_pipeline_load_from_memory_ext(const char* file_data, size_t sz, const ch
         }
     }
 
+    // Raster pipelines get their non-opaque uniforms in a single uniform block (an empty block won't compile)
+    pdesc.ublock_desc.block = false;
+    for (uint32_t i = 0; !ppd.code[2] && i < (uint32_t)gs_dyn_array_size(pdesc.ublock_desc.layout); ++i) {
+        pdesc.ublock_desc.block |= gs_gfxt_uniform_type_is_block_member(pdesc.ublock_desc.layout[i].type);
+    }
+
     // Generate vertex shader code
     char* v_src = gs_pipeline_generate_shader_code(&pdesc, &ppd, GS_GRAPHICS_SHADER_STAGE_VERTEX); 
     // gs_println("%s", v_src);
@@ -3678,6 +5499,25 @@ gs_gfxt_pipeline_load_from_memory_ext(const char* file_data, size_t sz, const ch
         }
     } 
 
+    // Cache for the next load
+    if (cache_key)
+    {
+        gs_graphics_shader_source_desc_t sources[2] = gs_default_val();
+        uint32_t source_ct = 0;
+        if (c_src) {
+            sources[source_ct].type = GS_GRAPHICS_SHADER_STAGE_COMPUTE; sources[source_ct++].source = c_src;
+        }
+        else if (v_src && f_src) {
+            sources[source_ct].type = GS_GRAPHICS_SHADER_STAGE_VERTEX; sources[source_ct++].source = v_src;
+            sources[source_ct].type = GS_GRAPHICS_SHADER_STAGE_FRAGMENT; sources[source_ct++].source = f_src;
+        }
+
+        gs_handle(gs_graphics_shader_t) shader = c_src ? pdesc.pip_desc.compute.shader : pdesc.pip_desc.raster.shader;
+        if (source_ct && gs_handle_is_valid(shader)) {
+            __gs_gfxt_pipeline_cache_store(cache_key, &pdesc, ppd.mesh_layout, ppd.includes, sources, source_ct, shader);
+        }
+    }
+
     // Free all malloc'd data 
     if (v_src) gs_free(v_src);
     if (f_src) gs_free(f_src); 
@@ -3686,6 +5526,7 @@ gs_gfxt_pipeline_load_from_memory_ext(const char* file_data, size_t sz, const ch
 	gs_dyn_array_free(pdesc.pip_desc.layout.attrs);
     gs_dyn_array_free(ppd.mesh_layout);
 	gs_dyn_array_free(ppd.vertex_layout);
+    gs_dyn_array_free(ppd.includes);
     
     for (uint32_t i = 0; i < 3; ++i)
     {
@@ -66,14 +66,14 @@
 
 #define GS_GUI_SPLIT_SIZE           2.f 
 #define GS_GUI_MAX_CNT              48 
-#define GS_GUI_COMMANDLIST_SIZE		(256 * 1024)
+#define GS_GUI_COMMANDLIST_SIZE		(256 * 1024)  // Size of each command list chunk
 #define GS_GUI_ROOTLIST_SIZE		32
 #define GS_GUI_CONTAINERSTACK_SIZE	32
 #define GS_GUI_CLIPSTACK_SIZE		32
 #define GS_GUI_IDSTACK_SIZE			32
 #define GS_GUI_LAYOUTSTACK_SIZE		16
-#define GS_GUI_CONTAINERPOOL_SIZE	48
-#define GS_GUI_TREENODEPOOL_SIZE	48
+#define GS_GUI_CONTAINERPOOL_SIZE	48     // Default, see gs_gui_desc_t
+#define GS_GUI_TREENODEPOOL_SIZE	48     // Default, see gs_gui_desc_t
 #define GS_GUI_GS_GUI_SPLIT_SIZE	32
 #define GS_GUI_GS_GUI_TAB_SIZE		32
 #define GS_GUI_MAX_WIDTHS			16
@@ -215,7 +215,18 @@ typedef struct {float radius; gs_vec2 center;} gs_gui_circle_t;
 typedef struct {gs_vec2 points[3];} gs_gui_triangle_t;
 typedef struct {gs_vec2 start; gs_vec2 end;} gs_gui_line_t;
 
-typedef struct {gs_gui_id id; int32_t last_update;} gs_gui_pool_item_t; 
+typedef struct {gs_gui_id id; int32_t last_update; int32_t prev, next;} gs_gui_pool_item_t; 
+
+// Retained state pool: open addressed id -> slot index, slots linked in lru order for eviction
+typedef struct gs_gui_pool_t
+{
+    gs_gui_pool_item_t* items;
+    int32_t* index;         // Slot per bucket, -1 if empty
+    int32_t len;
+    int32_t mask;           // Bucket count - 1 (power of two, at least twice len)
+    int32_t lru_head;       // Least recently updated
+    int32_t lru_tail;       // Most recently updated
+} gs_gui_pool_t;
 
 typedef struct 
 {
@@ -779,6 +790,20 @@ typedef struct gs_gui_inline_style_stack_t
     gs_dyn_array(uint32_t) animation_counts;                  // amount of animations to pop off at "top of stack" for each state
 } gs_gui_inline_style_stack_t;
 
+// Geometry recorded for a root container, replayed while its commands stay the same
+typedef struct gs_gui_render_cache_t
+{
+    uint64_t hash;                                  // Hash of the container's commands and entry draw state
+    int32_t frame;                                  // Last frame the container was rendered
+    bool recorded;                                  // Whether rec holds the geometry for hash
+    gsi_recording_t rec;
+    gs_gui_rect_t clip;                             // Draw state at the end of the container
+    gs_handle(gs_graphics_texture_t) texture;
+    gsi_pipeline_state_attr_t pipeline;
+    gs_color_t color;
+    gs_vec2 uv;
+} gs_gui_render_cache_t;
+
 typedef struct gs_gui_context_t 
 { 
 	// Core state
@@ -820,8 +845,15 @@ typedef struct gs_gui_context_t
     gs_gui_alt_drag_mode_type alt_drag_mode;
     gs_dyn_array(gs_gui_request_t) requests;
 
+	// Command list, grown in GS_GUI_COMMANDLIST_SIZE chunks chained together with jump commands
+	struct {
+		int32_t idx;                        // Write offset into current chunk
+		uint8_t* items;                     // Current chunk
+		uint32_t chunk;                     // Index of current chunk
+		gs_dyn_array(uint8_t*) chunks;      // Kept across frames
+	} command_list;
+
 	// Stacks
-	gs_gui_stack(uint8_t, GS_GUI_COMMANDLIST_SIZE) command_list;
 	gs_gui_stack(gs_gui_container_t*, GS_GUI_ROOTLIST_SIZE) root_list;
 	gs_gui_stack(gs_gui_container_t*, GS_GUI_CONTAINERSTACK_SIZE) container_stack;
 	gs_gui_stack(gs_gui_rect_t, GS_GUI_CLIPSTACK_SIZE) clip_stack;
@@ -832,9 +864,9 @@ typedef struct gs_gui_context_t
     gs_hash_table(gs_gui_element_type, gs_gui_inline_style_stack_t) inline_styles;
 
 	// Retained state pools
-	gs_gui_pool_item_t container_pool[GS_GUI_CONTAINERPOOL_SIZE];
-	gs_gui_container_t containers[GS_GUI_CONTAINERPOOL_SIZE];
-	gs_gui_pool_item_t treenode_pool[GS_GUI_TREENODEPOOL_SIZE];
+	gs_gui_pool_t container_pool;
+	gs_gui_container_t* containers;     // One per container pool slot
+	gs_gui_pool_t treenode_pool;
 
     gs_slot_array(gs_gui_split_t) splits;
     gs_slot_array(gs_gui_tab_bar_t) tab_bars;
@@ -854,6 +886,7 @@ typedef struct gs_gui_context_t
     uint32_t window_hndl;
     gs_immediate_draw_t gsi;
     gs_immediate_draw_t overlay_draw_list;                                  
+    gs_hash_table(gs_gui_id, gs_gui_render_cache_t) render_cache;          // Root container id -> recorded geometry
 
     // Active Transitions
     gs_hash_table(gs_gui_id, gs_gui_animation_t) animations;
@@ -971,12 +1004,19 @@ typedef struct gs_gui_hints_s
     int32_t flags;              // Flags for hints
 } gs_gui_hints_t;
 
+typedef struct gs_gui_desc_s
+{
+    int32_t container_pool_size;    // Max live containers (defaults to GS_GUI_CONTAINERPOOL_SIZE)
+    int32_t treenode_pool_size;     // Max expanded tree nodes/headers (defaults to GS_GUI_TREENODEPOOL_SIZE)
+} gs_gui_desc_t;
+
 GS_API_DECL gs_gui_rect_t gs_gui_rect(float x, float y, float w, float h);
 
 //=== Context ===//
 
 GS_API_DECL gs_gui_context_t gs_gui_new(uint32_t window_hndl);
 GS_API_DECL void gs_gui_init(gs_gui_context_t *ctx, uint32_t window_hndl);
+GS_API_DECL void gs_gui_init_ex(gs_gui_context_t *ctx, uint32_t window_hndl, const gs_gui_desc_t* desc);
 GS_API_DECL void gs_gui_init_font_stash(gs_gui_context_t *ctx, gs_gui_font_stash_desc_t* desc);
 GS_API_DECL gs_gui_context_t gs_gui_context_new(uint32_t window_hndl);
 GS_API_DECL void gs_gui_free(gs_gui_context_t* ctx); 
@@ -1045,9 +1085,12 @@ GS_API_DECL gs_gui_style_sheet_t gs_gui_style_sheet_load_from_memory(gs_gui_cont
 
 //=== Pools ===//
 
-GS_API_DECL int32_t gs_gui_pool_init(gs_gui_context_t *ctx, gs_gui_pool_item_t *items, int32_t len, gs_gui_id id);
-GS_API_DECL int32_t gs_gui_pool_get(gs_gui_context_t *ctx, gs_gui_pool_item_t *items, int32_t len, gs_gui_id id);
-GS_API_DECL void gs_gui_pool_update(gs_gui_context_t *ctx, gs_gui_pool_item_t *items, int32_t idx);
+GS_API_DECL gs_gui_pool_t gs_gui_pool_new(int32_t len);
+GS_API_DECL void gs_gui_pool_free(gs_gui_pool_t* pool);
+GS_API_DECL int32_t gs_gui_pool_init(gs_gui_context_t *ctx, gs_gui_pool_t* pool, gs_gui_id id);    // Evicts lru slot
+GS_API_DECL int32_t gs_gui_pool_get(gs_gui_context_t *ctx, gs_gui_pool_t* pool, gs_gui_id id);
+GS_API_DECL void gs_gui_pool_update(gs_gui_context_t *ctx, gs_gui_pool_t* pool, int32_t idx);
+GS_API_DECL void gs_gui_pool_remove(gs_gui_context_t *ctx, gs_gui_pool_t* pool, int32_t idx);
 
 //=== Input ===//
 
@@ -2824,13 +2867,13 @@ gs_gui_get_container_ex(gs_gui_context_t* ctx, gs_gui_id id, uint64_t opt)
 	gs_gui_container_t *cnt;
 
 	/* try to get existing container from pool */
-	int32_t idx = gs_gui_pool_get(ctx, ctx->container_pool, GS_GUI_CONTAINERPOOL_SIZE, id);
+	int32_t idx = gs_gui_pool_get(ctx, &ctx->container_pool, id);
 
 	if (idx >= 0) 
     {
 		if (ctx->containers[idx].open || ~opt & GS_GUI_OPT_CLOSED) 
         {
-			gs_gui_pool_update(ctx, ctx->container_pool, idx);
+			gs_gui_pool_update(ctx, &ctx->container_pool, idx);
 		}
 		return &ctx->containers[idx];
 	}
@@ -2838,7 +2881,7 @@ gs_gui_get_container_ex(gs_gui_context_t* ctx, gs_gui_id id, uint64_t opt)
 	if (opt & GS_GUI_OPT_CLOSED) { return NULL; }
 
 	/* container not found in pool: init new container */
-	idx = gs_gui_pool_init(ctx, ctx->container_pool, GS_GUI_CONTAINERPOOL_SIZE, id);
+	idx = gs_gui_pool_init(ctx, &ctx->container_pool, id);
 	cnt = &ctx->containers[idx];
 	memset(cnt, 0, sizeof(*cnt));
 	cnt->open = 1;
@@ -3564,8 +3607,21 @@ GS_API_DECL gs_gui_context_t gs_gui_new(uint32_t window_hndl)
 }
 
 GS_API_DECL void gs_gui_init(gs_gui_context_t *ctx, uint32_t window_hndl)
+{ 
+    gs_gui_init_ex(ctx, window_hndl, NULL);
+}
+
+GS_API_DECL void gs_gui_init_ex(gs_gui_context_t *ctx, uint32_t window_hndl, const gs_gui_desc_t* desc)
 { 
 	memset(ctx, 0, sizeof(*ctx));
+    int32_t container_pool_size = desc && desc->container_pool_size ? desc->container_pool_size : GS_GUI_CONTAINERPOOL_SIZE;
+    int32_t treenode_pool_size = desc && desc->treenode_pool_size ? desc->treenode_pool_size : GS_GUI_TREENODEPOOL_SIZE;
+    ctx->container_pool = gs_gui_pool_new(container_pool_size);
+    ctx->containers = (gs_gui_container_t*)gs_malloc(sizeof(gs_gui_container_t) * container_pool_size);
+    memset(ctx->containers, 0, sizeof(gs_gui_container_t) * container_pool_size);
+    ctx->treenode_pool = gs_gui_pool_new(treenode_pool_size);
+    gs_dyn_array_push(ctx->command_list.chunks, (uint8_t*)gs_malloc(GS_GUI_COMMANDLIST_SIZE));
+    ctx->command_list.items = ctx->command_list.chunks[0];
     ctx->gsi = gs_immediate_draw_new(); 
     ctx->overlay_draw_list = gs_immediate_draw_new();
     gs_gui_init_default_styles(ctx);
@@ -3704,8 +3760,24 @@ typedef struct gs_gui_context_t
 } gs_gui_context_t; 
 */
    gs_hash_table_free(ctx->font_stash); 
+   gs_gui_pool_free(&ctx->container_pool);
+   gs_gui_pool_free(&ctx->treenode_pool);
+   gs_free(ctx->containers);
    gs_immediate_draw_free(&ctx->gsi);
    gs_immediate_draw_free(&ctx->overlay_draw_list);
+   for (uint32_t i = 0; i < (uint32_t)gs_dyn_array_size(ctx->command_list.chunks); ++i) {
+       gs_free(ctx->command_list.chunks[i]);
+   }
+   gs_dyn_array_free(ctx->command_list.chunks);
+   for (
+       gs_hash_table_iter it = gs_hash_table_iter_new(ctx->render_cache);
+       gs_hash_table_iter_valid(ctx->render_cache, it);
+       gs_hash_table_iter_advance(ctx->render_cache, it)
+   )
+   {
+       gsi_recording_free(&gs_hash_table_iter_getp(ctx->render_cache, it)->rec);
+   }
+   gs_hash_table_free(ctx->render_cache);
    gs_hash_table_free(ctx->animations);
    gs_slot_array_free(ctx->splits);
    gs_slot_array_free(ctx->tab_bars);
@@ -4020,7 +4092,8 @@ gs_gui_begin(gs_gui_context_t* ctx, const gs_gui_hints_t* hints)
             case GS_PLATFORM_EVENT_TEXT:
             {
                 // Input text
-                char txt[2] = {(char)(evt.text.codepoint & 255), 0};
+                char txt[5] = gs_default_val();
+                gs_util_utf8_encode(evt.text.codepoint, txt);
                 gs_gui_input_text(ctx, txt);
             } break;
 
@@ -4062,6 +4135,8 @@ gs_gui_begin(gs_gui_context_t* ctx, const gs_gui_hints_t* hints)
     ctx->viewport = gs_gui_rect(hint.viewport.x, hint.viewport.y, hint.viewport.w, hint.viewport.h);
     ctx->mouse_pos = mouse_pos;
 	ctx->command_list.idx = 0;
+	ctx->command_list.chunk = 0;
+	ctx->command_list.items = ctx->command_list.chunks[0];
 	ctx->root_list.idx = 0;
 	ctx->scroll_target = NULL;
 	ctx->hover_root = ctx->next_hover_root;
@@ -4717,7 +4792,7 @@ GS_API_DECL void gs_gui_end(gs_gui_context_t *ctx)
 		// otherwise set the previous container's tail to jump to this one 
 		if (i == 0) 
         {
-			gs_gui_command_t *cmd = (gs_gui_command_t*) ctx->command_list.items;
+			gs_gui_command_t *cmd = (gs_gui_command_t*) ctx->command_list.chunks[0];
 			cmd->jump.dst = (char*) cnt->head + sizeof(gs_gui_jumpcommand_t);
 		} 
         else 
@@ -4734,10 +4809,247 @@ GS_API_DECL void gs_gui_end(gs_gui_context_t *ctx)
 	}
 } 
 
+static void 
+gs_gui_render_command(gs_gui_context_t* ctx, gs_gui_command_t* cmd, gs_gui_rect_t* clip)
+{
+    const gs_vec2 fb = ctx->framebuffer_size;
+    const gs_gui_rect_t* viewport = &ctx->viewport;
+
+    switch (cmd->type) 
+    {
+      case GS_GUI_COMMAND_CUSTOM:
+      { 
+          gsi_defaults(&ctx->gsi);
+          gsi_set_view_scissor(&ctx->gsi, 
+              (int32_t)(cmd->custom.clip.x), 
+              (int32_t)(fb.y - cmd->custom.clip.h - cmd->custom.clip.y), 
+              (int32_t)(cmd->custom.clip.w), 
+              (int32_t)(cmd->custom.clip.h));
+
+          if (cmd->custom.cb) {
+              cmd->custom.cb(ctx, &cmd->custom);
+          }
+
+          gsi_defaults(&ctx->gsi);
+          // gsi_camera2D(&ctx->gsi, (uint32_t)fb.x, (uint32_t)fb.y);
+          gsi_camera2D(&ctx->gsi, (uint32_t)viewport->w, (uint32_t)viewport->h);
+          gsi_blend_enabled(&ctx->gsi, true);
+          // gs_graphics_set_viewport(&ctx->gsi.commands, 0, 0, (uint32_t)fb.x, (uint32_t)fb.y);
+          gs_graphics_set_viewport(&ctx->gsi.commands, (uint32_t)viewport->x, (uint32_t)viewport->y, (uint32_t)viewport->w, (uint32_t)viewport->h);
+
+          gsi_set_view_scissor(&ctx->gsi, 
+              (int32_t)(clip->x), 
+              (int32_t)(fb.y - clip->h - clip->y), 
+              (int32_t)(clip->w), 
+              (int32_t)(clip->h));
+
+      } break;
+
+      case GS_GUI_COMMAND_PIPELINE:
+      {
+          gsi_pipeline_set(&ctx->gsi, cmd->pipeline.pipeline);
+
+          // Set layout if valid
+          if (cmd->pipeline.layout_sz)
+          {
+              switch (cmd->pipeline.layout_type)
+              {
+                  case GSI_LAYOUT_VATTR:
+                  {
+                      gsi_vattr_list(&ctx->gsi, (gsi_vattr_type*)cmd->pipeline.layout, cmd->pipeline.layout_sz);
+                  } break;
+
+                  case GSI_LAYOUT_MESH:
+                  {
+                      gsi_vattr_list_mesh(&ctx->gsi, (gs_asset_mesh_layout_t*)cmd->pipeline.layout, cmd->pipeline.layout_sz);
+                  } break;
+
+                  default: break;
+              }
+          } 
+
+          // If not a valid pipeline, then set back to default gui pipeline
+          if (!cmd->pipeline.pipeline.id)
+          { 
+              gsi_blend_enabled(&ctx->gsi, true);
+          }
+
+      } break;
+
+      case GS_GUI_COMMAND_UNIFORMS:
+      { 
+          gs_graphics_bind_desc_t bind = gs_default_val();
+
+          // Set uniform bind
+          gs_graphics_bind_uniform_desc_t uniforms[1] = gs_default_val(); 
+          bind.uniforms.desc = uniforms;
+          bind.uniforms.size = sizeof(uniforms); 
+
+          // Treat as byte buffer, read data
+          gs_byte_buffer_t buffer = gs_default_val();
+          buffer.capacity = GS_GUI_COMMANDLIST_SIZE;
+			buffer.data = (uint8_t*)cmd->uniforms.data;
+
+          // Write count
+          gs_byte_buffer_readc(&buffer, uint16_t, ct);
+
+          // Iterate through all uniforms, memcpy data as needed for each uniform in list
+          for (uint32_t i = 0; i < ct; ++i)
+          { 
+              gs_byte_buffer_readc(&buffer, gs_handle(gs_graphics_uniform_t), hndl);
+              gs_byte_buffer_readc(&buffer, size_t, sz);
+              gs_byte_buffer_readc(&buffer, uint16_t, binding);
+              void* udata = (buffer.data + buffer.position);
+              gs_byte_buffer_advance_position(&buffer, sz);
+
+              uniforms[0].uniform = hndl;
+              uniforms[0].binding = binding;
+              uniforms[0].data = udata; 
+              gs_graphics_apply_bindings(&ctx->gsi.commands, &bind);
+          }
+      } break;
+
+      case GS_GUI_COMMAND_TEXT:
+      {
+          const gs_vec2* tp = &cmd->text.pos;
+          const char* ts = cmd->text.str;
+          const gs_color_t* tc = &cmd->text.color; 
+          const gs_asset_font_t* tf = cmd->text.font;
+          gsi_text(&ctx->gsi, tp->x, tp->y, ts, tf, false, tc->r, tc->g, tc->b, tc->a);
+      } break;
+
+      case GS_GUI_COMMAND_SHAPE:
+      {
+          gsi_texture(&ctx->gsi, gs_handle_invalid(gs_graphics_texture_t));
+          gs_color_t* c = &cmd->shape.color;
+
+          switch (cmd->shape.type)
+          {
+              case GS_GUI_SHAPE_RECT:
+              {
+                  gs_gui_rect_t* r = &cmd->shape.rect; 
+                  gsi_rectvd(&ctx->gsi, gs_v2(r->x, r->y), gs_v2(r->w, r->h), gs_v2s(0.f), gs_v2s(1.f), *c, GS_GRAPHICS_PRIMITIVE_TRIANGLES);
+              } break;
+
+              case GS_GUI_SHAPE_CIRCLE:
+              {
+                  gs_vec2* cp = &cmd->shape.circle.center;
+                  float* r = &cmd->shape.circle.radius;
+                  gsi_circle(&ctx->gsi, cp->x, cp->y, *r, 16, c->r, c->g, c->b, c->a, GS_GRAPHICS_PRIMITIVE_TRIANGLES);
+              } break;
+
+              case GS_GUI_SHAPE_TRIANGLE:
+              {
+                  gs_vec2* pa = &cmd->shape.triangle.points[0];
+                  gs_vec2* pb = &cmd->shape.triangle.points[1];
+                  gs_vec2* pc = &cmd->shape.triangle.points[2];
+                  gsi_trianglev(&ctx->gsi, *pa, *pb, *pc, *c, GS_GRAPHICS_PRIMITIVE_TRIANGLES);
+
+              } break;
+
+              case GS_GUI_SHAPE_LINE:
+              {
+                  gs_vec2* s = &cmd->shape.line.start;
+                  gs_vec2* e = &cmd->shape.line.end;
+                  gsi_linev(&ctx->gsi, *s, *e, *c);
+              } break;
+          }
+          
+      } break; 
+
+      case GS_GUI_COMMAND_IMAGE:
+      {
+          gsi_texture(&ctx->gsi, cmd->image.hndl);
+          gs_color_t* c = &cmd->image.color;
+          gs_gui_rect_t* r = &cmd->image.rect; 
+          gs_vec4* uvs = &cmd->image.uvs;
+          gsi_rectvd(&ctx->gsi, gs_v2(r->x, r->y), gs_v2(r->w, r->h), gs_v2(uvs->x, uvs->y), gs_v2(uvs->z, uvs->w), *c, GS_GRAPHICS_PRIMITIVE_TRIANGLES);
+      } break;
+
+      case GS_GUI_COMMAND_CLIP:
+      { 
+          // Will project scissor/clipping rectangles into framebuffer space
+          gs_vec2 clip_off = gs_v2s(0.f);     // (0,0) unless using multi-viewports
+          gs_vec2 clip_scale = gs_v2s(1.f);   // (1,1) unless using retina display which are often (2,2) 
+
+          gs_gui_rect_t clip_rect;
+          clip_rect.x = (cmd->clip.rect.x - clip_off.x) * clip_scale.x;
+          clip_rect.y = (cmd->clip.rect.y - clip_off.y) * clip_scale.y;
+          clip_rect.w = (cmd->clip.rect.w - clip_off.x) * clip_scale.x;
+          clip_rect.h = (cmd->clip.rect.h - clip_off.y) * clip_scale.y;
+
+          clip_rect.x = gs_max(clip_rect.x, 0.f);
+          clip_rect.y = gs_max(clip_rect.y, 0.f);
+          clip_rect.w = gs_max(clip_rect.w, 0.f);
+          clip_rect.h = gs_max(clip_rect.h, 0.f);
+
+          *clip = clip_rect;
+
+          gsi_set_view_scissor(&ctx->gsi, 
+              (int32_t)(clip_rect.x), 
+              (int32_t)(fb.y - clip_rect.h - clip_rect.y), 
+              (int32_t)(clip_rect.w), 
+              (int32_t)(clip_rect.h));
+
+      } break;
+    }
+}
+
+// Hash a root container's commands along with the draw state they start from. Containers with custom 
+// callbacks, pipelines or uniforms draw outside of what can be recorded and are never cached.
+static bool 
+gs_gui_render_cache_hash(gs_gui_context_t* ctx, gs_gui_container_t* cnt, gs_gui_rect_t clip, uint64_t* hash)
+{
+    gs_immediate_draw_t* gsi = &ctx->gsi;
+    if (gsi->flags || gs_dyn_array_size(gsi->vattributes)) return false;
+
+    struct {
+        gs_gui_rect_t clip;
+        gs_vec2 fb;
+        gs_gui_rect_t viewport;
+        gs_handle(gs_graphics_texture_t) texture;
+        gsi_pipeline_state_attr_t pipeline;
+        gs_color_t color;
+        gs_vec2 uv;
+    } state;
+    memset(&state, 0, sizeof(state));
+    state.clip = clip;
+    state.fb = ctx->framebuffer_size;
+    state.viewport = ctx->viewport;
+    state.texture = gsi->cache.texture;
+    state.pipeline = gsi->cache.pipeline;
+    state.color = gsi->cache.color;
+    state.uv = gsi->cache.uv;
+    size_t h = gs_hash_bytes(&state, sizeof(state), GS_GUI_HASH_INITIAL);
+
+    gs_gui_command_t* cmd = (gs_gui_command_t*)((char*)cnt->head + sizeof(gs_gui_jumpcommand_t));
+    while (cmd != cnt->tail)
+    {
+        switch (cmd->type)
+        {
+            case GS_GUI_COMMAND_JUMP: cmd = (gs_gui_command_t*)cmd->jump.dst; continue;
+            case GS_GUI_COMMAND_CUSTOM:
+            case GS_GUI_COMMAND_PIPELINE:
+            case GS_GUI_COMMAND_UNIFORMS: return false;
+            default: break;
+        }
+        h = gs_hash_bytes(cmd, cmd->base.size, h);
+        if (cmd->type == GS_GUI_COMMAND_TEXT) 
+        {
+            // Glyph texture coordinates move when the font atlas grows or evicts
+            uint32_t version = gs_asset_font_atlas_version(cmd->text.font ? cmd->text.font : gsi_default_font());
+            h = gs_hash_bytes(&version, sizeof(version), h);
+        }
+        cmd = (gs_gui_command_t*)((char*)cmd + cmd->base.size);
+    }
+
+    *hash = (uint64_t)h;
+    return true;
+}
+
 GS_API_DECL void 
 gs_gui_render(gs_gui_context_t* ctx, gs_command_buffer_t* cb)
 {
-    const gs_vec2 fb = ctx->framebuffer_size;
     const gs_gui_rect_t* viewport = &ctx->viewport;
     gs_immediate_draw_t* gsi = &ctx->gsi;
 
@@ -4748,186 +5060,85 @@ gs_gui_render(gs_gui_context_t* ctx, gs_command_buffer_t* cb)
 
     gs_gui_rect_t clip = gs_gui_unclipped_rect;
 
-    gs_gui_command_t* cmd = NULL; 
-    while (gs_gui_next_command(ctx, &cmd)) 
+    // Root containers in z order. A container whose commands hash the same as last frame appends 
+    // the geometry recorded then instead of regenerating it.
+    for (int32_t i = 0; i < ctx->root_list.idx; ++i)
     {
-      switch (cmd->type) 
-      {
-        case GS_GUI_COMMAND_CUSTOM:
-        { 
-            gsi_defaults(&ctx->gsi);
-            gsi_set_view_scissor(&ctx->gsi, 
-                (int32_t)(cmd->custom.clip.x), 
-                (int32_t)(fb.y - cmd->custom.clip.h - cmd->custom.clip.y), 
-                (int32_t)(cmd->custom.clip.w), 
-                (int32_t)(cmd->custom.clip.h));
-
-            if (cmd->custom.cb) {
-                cmd->custom.cb(ctx, &cmd->custom);
-            }
-
-            gsi_defaults(&ctx->gsi);
-            // gsi_camera2D(&ctx->gsi, (uint32_t)fb.x, (uint32_t)fb.y);
-            gsi_camera2D(&ctx->gsi, (uint32_t)viewport->w, (uint32_t)viewport->h);
-            gsi_blend_enabled(&ctx->gsi, true);
-            // gs_graphics_set_viewport(&ctx->gsi.commands, 0, 0, (uint32_t)fb.x, (uint32_t)fb.y);
-            gs_graphics_set_viewport(&ctx->gsi.commands, (uint32_t)viewport->x, (uint32_t)viewport->y, (uint32_t)viewport->w, (uint32_t)viewport->h);
-
-            gsi_set_view_scissor(&ctx->gsi, 
-                (int32_t)(clip.x), 
-                (int32_t)(fb.y - clip.h - clip.y), 
-                (int32_t)(clip.w), 
-                (int32_t)(clip.h));
-
-        } break;
-
-        case GS_GUI_COMMAND_PIPELINE:
+        gs_gui_container_t* cnt = ctx->root_list.items[i];
+        gs_gui_render_cache_t* rc = NULL;
+        uint64_t hash = 0;
+        bool cacheable = gs_gui_render_cache_hash(ctx, cnt, clip, &hash);
+        if (cacheable && gs_hash_table_exists(ctx->render_cache, cnt->id))
         {
-            gsi_pipeline_set(&ctx->gsi, cmd->pipeline.pipeline);
-
-            // Set layout if valid
-            if (cmd->pipeline.layout_sz)
+            rc = gs_hash_table_getp(ctx->render_cache, cnt->id);
+            if (rc->recorded && rc->hash == hash)
             {
-                switch (cmd->pipeline.layout_type)
-                {
-                    case GSI_LAYOUT_VATTR:
-                    {
-                        gsi_vattr_list(&ctx->gsi, cmd->pipeline.layout, cmd->pipeline.layout_sz);
-                    } break;
-
-                    case GSI_LAYOUT_MESH:
-                    {
-                        gsi_vattr_list_mesh(&ctx->gsi, cmd->pipeline.layout, cmd->pipeline.layout_sz);
-                    } break;
-                }
-            } 
-
-            // If not a valid pipeline, then set back to default gui pipeline
-            if (!cmd->pipeline.pipeline.id)
-            { 
-                gsi_blend_enabled(&ctx->gsi, true);
-            }
-
-        } break;
-
-        case GS_GUI_COMMAND_UNIFORMS:
-        { 
-            gs_graphics_bind_desc_t bind = gs_default_val();
-
-            // Set uniform bind
-            gs_graphics_bind_uniform_desc_t uniforms[1] = gs_default_val(); 
-            bind.uniforms.desc = uniforms;
-            bind.uniforms.size = sizeof(uniforms); 
-
-            // Treat as byte buffer, read data
-            gs_byte_buffer_t buffer = gs_default_val();
-            buffer.capacity = GS_GUI_COMMANDLIST_SIZE;
-			buffer.data = cmd->uniforms.data;
-
-            // Write count
-            gs_byte_buffer_readc(&buffer, uint16_t, ct);
-
-            // Iterate through all uniforms, memcpy data as needed for each uniform in list
-            for (uint32_t i = 0; i < ct; ++i)
-            { 
-                gs_byte_buffer_readc(&buffer, gs_handle(gs_graphics_uniform_t), hndl);
-                gs_byte_buffer_readc(&buffer, size_t, sz);
-                gs_byte_buffer_readc(&buffer, uint16_t, binding);
-                void* udata = (buffer.data + buffer.position);
-                gs_byte_buffer_advance_position(&buffer, sz);
-
-                uniforms[0].uniform = hndl;
-                uniforms[0].binding = binding;
-                uniforms[0].data = udata; 
-                gs_graphics_apply_bindings(&ctx->gsi.commands, &bind);
+                gsi_replay(gsi, &rc->rec);
+                gsi->cache.texture = rc->texture;
+                gsi->cache.pipeline = rc->pipeline;
+                gsi->cache.color = rc->color;
+                gsi->cache.uv = rc->uv;
+                clip = rc->clip;
+                rc->frame = ctx->frame;
+                continue;
             }
-        } break;
-
-        case GS_GUI_COMMAND_TEXT:
-        {
-            const gs_vec2* tp = &cmd->text.pos;
-            const char* ts = cmd->text.str;
-            const gs_color_t* tc = &cmd->text.color; 
-            const gs_asset_font_t* tf = cmd->text.font;
-            gsi_text(&ctx->gsi, tp->x, tp->y, ts, tf, false, tc->r, tc->g, tc->b, tc->a);
-        } break;
+        }
 
-        case GS_GUI_COMMAND_SHAPE:
+        gsi_mark_t mark = gsi_mark(gsi);
+        gs_gui_command_t* cmd = (gs_gui_command_t*)((char*)cnt->head + sizeof(gs_gui_jumpcommand_t));
+        while (cmd != cnt->tail)
         {
-            gsi_texture(&ctx->gsi, gs_handle_invalid(gs_graphics_texture_t));
-            gs_color_t* c = &cmd->shape.color;
-
-            switch (cmd->shape.type)
+            if (cmd->type == GS_GUI_COMMAND_JUMP)
             {
-                case GS_GUI_SHAPE_RECT:
-                {
-                    gs_gui_rect_t* r = &cmd->shape.rect; 
-                    gsi_rectvd(&ctx->gsi, gs_v2(r->x, r->y), gs_v2(r->w, r->h), gs_v2s(0.f), gs_v2s(1.f), *c, GS_GRAPHICS_PRIMITIVE_TRIANGLES);
-                } break;
-
-                case GS_GUI_SHAPE_CIRCLE:
-                {
-                    gs_vec2* cp = &cmd->shape.circle.center;
-                    float* r = &cmd->shape.circle.radius;
-                    gsi_circle(&ctx->gsi, cp->x, cp->y, *r, 16, c->r, c->g, c->b, c->a, GS_GRAPHICS_PRIMITIVE_TRIANGLES);
-                } break;
-
-                case GS_GUI_SHAPE_TRIANGLE:
-                {
-                    gs_vec2* pa = &cmd->shape.triangle.points[0];
-                    gs_vec2* pb = &cmd->shape.triangle.points[1];
-                    gs_vec2* pc = &cmd->shape.triangle.points[2];
-                    gsi_trianglev(&ctx->gsi, *pa, *pb, *pc, *c, GS_GRAPHICS_PRIMITIVE_TRIANGLES);
-
-                } break;
-
-                case GS_GUI_SHAPE_LINE:
-                {
-                    gs_vec2* s = &cmd->shape.line.start;
-                    gs_vec2* e = &cmd->shape.line.end;
-                    gsi_linev(&ctx->gsi, *s, *e, *c);
-                } break;
+                cmd = (gs_gui_command_t*)cmd->jump.dst;
+                continue;
             }
-            
-        } break; 
+            gs_gui_render_command(ctx, cmd, &clip);
+            cmd = (gs_gui_command_t*)((char*)cmd + cmd->base.size);
+        }
 
-        case GS_GUI_COMMAND_IMAGE:
+        if (cacheable)
         {
-            gsi_texture(&ctx->gsi, cmd->image.hndl);
-            gs_color_t* c = &cmd->image.color;
-            gs_gui_rect_t* r = &cmd->image.rect; 
-            gs_vec4* uvs = &cmd->image.uvs;
-            gsi_rectvd(&ctx->gsi, gs_v2(r->x, r->y), gs_v2(r->w, r->h), gs_v2(uvs->x, uvs->y), gs_v2(uvs->z, uvs->w), *c, GS_GRAPHICS_PRIMITIVE_TRIANGLES);
-        } break;
-
-        case GS_GUI_COMMAND_CLIP:
-        { 
-            // Will project scissor/clipping rectangles into framebuffer space
-            gs_vec2 clip_off = gs_v2s(0.f);     // (0,0) unless using multi-viewports
-            gs_vec2 clip_scale = gs_v2s(1.f);   // (1,1) unless using retina display which are often (2,2) 
-
-            gs_gui_rect_t clip_rect;
-            clip_rect.x = (cmd->clip.rect.x - clip_off.x) * clip_scale.x;
-            clip_rect.y = (cmd->clip.rect.y - clip_off.y) * clip_scale.y;
-            clip_rect.w = (cmd->clip.rect.w - clip_off.x) * clip_scale.x;
-            clip_rect.h = (cmd->clip.rect.h - clip_off.y) * clip_scale.y;
-
-            clip_rect.x = gs_max(clip_rect.x, 0.f);
-            clip_rect.y = gs_max(clip_rect.y, 0.f);
-            clip_rect.w = gs_max(clip_rect.w, 0.f);
-            clip_rect.h = gs_max(clip_rect.h, 0.f);
-
-            clip = clip_rect;
+            if (!rc)
+            {
+                gs_gui_render_cache_t v = gs_default_val();
+                gs_hash_table_insert(ctx->render_cache, cnt->id, v);
+                rc = gs_hash_table_getp(ctx->render_cache, cnt->id);
+            }
 
-            gsi_set_view_scissor(&ctx->gsi, 
-                (int32_t)(clip_rect.x), 
-                (int32_t)(fb.y - clip_rect.h - clip_rect.y), 
-                (int32_t)(clip_rect.w), 
-                (int32_t)(clip_rect.h));
+            // Only record once the commands repeat, so containers that change every frame never pay for the copy
+            rc->recorded = rc->hash == hash;
+            if (rc->recorded) gsi_record(gsi, mark, &rc->rec);
+            rc->hash = hash;
+            rc->frame = ctx->frame;
+            rc->clip = clip;
+            rc->texture = gsi->cache.texture;
+            rc->pipeline = gsi->cache.pipeline;
+            rc->color = gsi->cache.color;
+            rc->uv = gsi->cache.uv;
+        }
+    }
 
-        } break;
-      }
+    // Drop recordings of containers that weren't drawn this frame
+    gs_dyn_array(gs_gui_id) stale = NULL;
+    for (
+        gs_hash_table_iter it = gs_hash_table_iter_new(ctx->render_cache);
+        gs_hash_table_iter_valid(ctx->render_cache, it);
+        gs_hash_table_iter_advance(ctx->render_cache, it)
+    )
+    {
+        gs_gui_render_cache_t* rc = gs_hash_table_iter_getp(ctx->render_cache, it);
+        if (rc->frame != ctx->frame)
+        {
+            gsi_recording_free(&rc->rec);
+            gs_dyn_array_push(stale, gs_hash_table_iter_getk(ctx->render_cache, it));
+        }
     }
+    for (uint32_t i = 0; i < (uint32_t)gs_dyn_array_size(stale); ++i)
+    {
+        gs_hash_table_erase(ctx->render_cache, stale[i]);
+    }
+    gs_dyn_array_free(stale);
 
     // Draw main list
     gsi_draw(&ctx->gsi, cb); 
@@ -5118,48 +5329,140 @@ gs_gui_bring_to_front(gs_gui_context_t* ctx, gs_gui_container_t* cnt)
 ** Pool
 **============================================================================*/
 
-GS_API_DECL int32_t 
-gs_gui_pool_init(gs_gui_context_t* ctx, gs_gui_pool_item_t* items, int32_t len, gs_gui_id id) 
+gs_force_inline int32_t 
+gs_gui_pool_bucket(const gs_gui_pool_t* pool, gs_gui_id id)
 {
-	int32_t i, n = -1, f = ctx->frame;
-	for (i = 0; i < len; i++) 
+    return (int32_t)((id * 2654435769u) >> 7) & pool->mask;
+}
+
+static void 
+gs_gui_pool_lru_unlink(gs_gui_pool_t* pool, int32_t idx)
+{
+    gs_gui_pool_item_t* it = &pool->items[idx];
+    if (it->prev >= 0) pool->items[it->prev].next = it->next; else pool->lru_head = it->next;
+    if (it->next >= 0) pool->items[it->next].prev = it->prev; else pool->lru_tail = it->prev;
+    it->prev = it->next = -1;
+}
+
+static void 
+gs_gui_pool_index_erase(gs_gui_pool_t* pool, int32_t idx)
+{
+    gs_gui_id id = pool->items[idx].id;
+    int32_t i = gs_gui_pool_bucket(pool, id);
+    while (pool->index[i] != idx) 
     {
-		if (items[i].last_update < f) 
+        if (pool->index[i] < 0) return;
+        i = (i + 1) & pool->mask;
+    }
+
+    // Backward shift following entries so probes never cross a hole
+    for (int32_t j = (i + 1) & pool->mask; pool->index[j] >= 0; j = (j + 1) & pool->mask) 
+    {
+        int32_t k = gs_gui_pool_bucket(pool, pool->items[pool->index[j]].id);
+        bool between = i <= j ? (i < k && k <= j) : (i < k || k <= j);
+        if (!between) 
         {
-			f = items[i].last_update;
-			n = i;
-		}
-	}
+            pool->index[i] = pool->index[j];
+            i = j;
+        }
+    }
+    pool->index[i] = -1;
+}
 
-	gs_gui_expect(n > -1);
-	items[n].id = id;
-	gs_gui_pool_update(ctx, items, n);
+GS_API_DECL gs_gui_pool_t 
+gs_gui_pool_new(int32_t len)
+{
+    gs_gui_pool_t pool = gs_default_val();
+    int32_t buckets = 2;
+    while (buckets < len * 2) buckets <<= 1;
+    pool.len = len;
+    pool.mask = buckets - 1;
+    pool.items = (gs_gui_pool_item_t*)gs_malloc(sizeof(gs_gui_pool_item_t) * len);
+    pool.index = (int32_t*)gs_malloc(sizeof(int32_t) * buckets);
+    memset(pool.index, 0xff, sizeof(int32_t) * buckets);
+    for (int32_t i = 0; i < len; ++i) 
+    {
+        pool.items[i].id = 0;
+        pool.items[i].last_update = 0;
+        pool.items[i].prev = i - 1;
+        pool.items[i].next = i + 1 < len ? i + 1 : -1;
+    }
+    pool.lru_head = len ? 0 : -1;
+    pool.lru_tail = len - 1;
+    return pool;
+}
+
+GS_API_DECL void 
+gs_gui_pool_free(gs_gui_pool_t* pool)
+{
+    if (pool->items) gs_free(pool->items);
+    if (pool->index) gs_free(pool->index);
+    memset(pool, 0, sizeof(*pool));
+}
+
+GS_API_DECL int32_t 
+gs_gui_pool_init(gs_gui_context_t* ctx, gs_gui_pool_t* pool, gs_gui_id id) 
+{
+    // Least recently updated slot, unless every slot is in use this frame
+	int32_t n = pool->lru_head;
+	gs_gui_expect(n > -1 && pool->items[n].last_update < ctx->frame);
+
+    if (pool->items[n].id) gs_gui_pool_index_erase(pool, n);
+	pool->items[n].id = id;
+
+    int32_t i = gs_gui_pool_bucket(pool, id);
+    while (pool->index[i] >= 0) i = (i + 1) & pool->mask;
+    pool->index[i] = n;
+
+	gs_gui_pool_update(ctx, pool, n);
 
 	return n;
 } 
 
 GS_API_DECL int32_t 
-gs_gui_pool_get(gs_gui_context_t* ctx, gs_gui_pool_item_t* items, int32_t len, gs_gui_id id) 
+gs_gui_pool_get(gs_gui_context_t* ctx, gs_gui_pool_t* pool, gs_gui_id id) 
 {
-    // Note(john): This is a linear hash lookup. Could speed this up with a quadratic lookup. 
-	int32_t i;
 	gs_gui_unused(ctx);
-	for (i = 0; i < len; i++) 
+    if (!pool->index) return -1;
+    for (int32_t i = gs_gui_pool_bucket(pool, id); pool->index[i] >= 0; i = (i + 1) & pool->mask) 
     {
-		if (items[i].id == id) 
+        if (pool->items[pool->index[i]].id == id) 
         { 
-            return i; 
+            return pool->index[i]; 
         }
-	}
+    }
 	return -1;
 }
 
 GS_API_DECL void 
-gs_gui_pool_update(gs_gui_context_t* ctx, gs_gui_pool_item_t* items, int32_t idx) 
+gs_gui_pool_update(gs_gui_context_t* ctx, gs_gui_pool_t* pool, int32_t idx) 
 {
-	items[idx].last_update = ctx->frame;
+	pool->items[idx].last_update = ctx->frame;
+
+    // Move to most recent
+    if (pool->lru_tail == idx) return;
+    gs_gui_pool_lru_unlink(pool, idx);
+    pool->items[idx].prev = pool->lru_tail;
+    pool->items[pool->lru_tail].next = idx;
+    pool->lru_tail = idx;
 } 
 
+GS_API_DECL void 
+gs_gui_pool_remove(gs_gui_context_t* ctx, gs_gui_pool_t* pool, int32_t idx) 
+{
+	gs_gui_unused(ctx);
+    if (pool->items[idx].id) gs_gui_pool_index_erase(pool, idx);
+    pool->items[idx].id = 0;
+    pool->items[idx].last_update = 0;
+
+    // Move to least recent, first to be reused
+    if (pool->lru_head == idx) return;
+    gs_gui_pool_lru_unlink(pool, idx);
+    pool->items[idx].next = pool->lru_head;
+    pool->items[pool->lru_head].prev = idx;
+    pool->lru_head = idx;
+}
+
 /*============================================================================
 ** input handlers
 **============================================================================*/
@@ -5221,8 +5524,30 @@ gs_gui_input_text(gs_gui_context_t* ctx, const char* text)
 GS_API_DECL gs_gui_command_t* 
 gs_gui_push_command(gs_gui_context_t* ctx, int32_t type, int32_t size) 
 {
+	// Every chunk keeps room for a trailing jump into the next one
+	const int32_t jsz = (int32_t)sizeof(gs_gui_jumpcommand_t);
+	gs_gui_expect(size + jsz <= GS_GUI_COMMANDLIST_SIZE);
+	if (ctx->command_list.idx + size + jsz > GS_GUI_COMMANDLIST_SIZE) 
+    {
+		uint32_t next = ctx->command_list.chunk + 1;
+		if (next == (uint32_t)gs_dyn_array_size(ctx->command_list.chunks)) 
+        {
+			gs_dyn_array_push(ctx->command_list.chunks, (uint8_t*)gs_malloc(GS_GUI_COMMANDLIST_SIZE));
+		}
+
+		gs_gui_command_t* jmp = (gs_gui_command_t*) (ctx->command_list.items + ctx->command_list.idx);
+		jmp->base.type = GS_GUI_COMMAND_JUMP;
+		jmp->base.size = jsz;
+		jmp->jump.dst = ctx->command_list.chunks[next];
+
+		ctx->command_list.chunk = next;
+		ctx->command_list.items = ctx->command_list.chunks[next];
+		ctx->command_list.idx = 0;
+	}
+
+	// Zeroed so padding bytes hash the same every frame (see gs_gui_render)
 	gs_gui_command_t* cmd = (gs_gui_command_t*) (ctx->command_list.items + ctx->command_list.idx);
-	gs_gui_expect(ctx->command_list.idx + size < GS_GUI_COMMANDLIST_SIZE);
+	memset(cmd, 0, size);
 	cmd->base.type = type;
 	cmd->base.size = size;
 	ctx->command_list.idx += size;
@@ -5238,7 +5563,7 @@ gs_gui_next_command(gs_gui_context_t* ctx, gs_gui_command_t** cmd)
 	} 
     else 
     {
-		*cmd = (gs_gui_command_t*) ctx->command_list.items;
+		*cmd = (gs_gui_command_t*) ctx->command_list.chunks[0];
 	}
 
 	while ((uint8_t*) *cmd != (uint8_t*)(ctx->command_list.items + ctx->command_list.idx)) 
@@ -5265,33 +5590,39 @@ gs_gui_set_pipeline(gs_gui_context_t* ctx, gs_handle(gs_graphics_pipeline_t) pip
     void* layout, size_t sz, gsi_layout_type type)
 {
 	gs_gui_command_t* cmd;
-    cmd = gs_gui_push_command(ctx, GS_GUI_COMMAND_PIPELINE, sizeof(gs_gui_pipelinecommand_t));
+    cmd = gs_gui_push_command(ctx, GS_GUI_COMMAND_PIPELINE, sizeof(gs_gui_pipelinecommand_t) + sz);
     cmd->pipeline.pipeline = pip;
     cmd->pipeline.layout_type = type;
-    cmd->pipeline.layout = ctx->command_list.items + ctx->command_list.idx;
+    cmd->pipeline.layout = (uint8_t*)cmd + sizeof(gs_gui_pipelinecommand_t);
     cmd->pipeline.layout_sz = sz; 
-    cmd->base.size += sz;
     
-    // Copy data and move list forward
-    memcpy(ctx->command_list.items + ctx->command_list.idx, layout, sz);
-    ctx->command_list.idx += sz;
+    // Copy data in after command
+    memcpy(cmd->pipeline.layout, layout, sz);
 }
 
 GS_API_DECL void 
 gs_gui_bind_uniforms(gs_gui_context_t* ctx,
     gs_graphics_bind_uniform_desc_t* uniforms, size_t uniforms_sz)
 { 
+    const uint16_t ct = uniforms_sz / sizeof(gs_graphics_bind_uniform_desc_t);
+
+    // Size of data written below
+    size_t sz = sizeof(uint16_t);
+    for (uint32_t i = 0; i < ct; ++i)
+    {
+        sz += sizeof(gs_handle(gs_graphics_uniform_t)) + sizeof(size_t) + sizeof(uint16_t);
+        sz += gs_graphics_uniform_size_query(uniforms[i].uniform);
+    }
+
 	gs_gui_command_t* cmd;
-    cmd = gs_gui_push_command(ctx, GS_GUI_COMMAND_UNIFORMS, sizeof(gs_gui_binduniformscommand_t)); 
-	cmd->uniforms.data = ctx->command_list.items + ctx->command_list.idx;
+    cmd = gs_gui_push_command(ctx, GS_GUI_COMMAND_UNIFORMS, sizeof(gs_gui_binduniformscommand_t) + sz); 
+	cmd->uniforms.data = (uint8_t*)cmd + sizeof(gs_gui_binduniformscommand_t);
 
-    // Treat as byte buffer, write into data then set size
+    // Treat as byte buffer, write into data after command (capacity padded by one as buffer writes grow on reaching it)
     gs_byte_buffer_t buffer = gs_default_val();
-    buffer.capacity = GS_GUI_COMMANDLIST_SIZE;
+    buffer.capacity = sz + 1;
     buffer.data = cmd->uniforms.data;
 
-    const uint16_t ct = uniforms_sz / sizeof(gs_graphics_bind_uniform_desc_t);
-
     // Write count
     gs_byte_buffer_write(&buffer, uint16_t, ct);
 
@@ -5306,11 +5637,6 @@ gs_gui_bind_uniforms(gs_gui_context_t* ctx,
         gs_byte_buffer_write(&buffer, uint16_t, (uint16_t)decl->binding);
         gs_byte_buffer_write_bulk(&buffer, decl->data, sz);
     }
-
-    // Record final sizes
-	const size_t sz = buffer.size;
-    cmd->base.size += sz;
-	ctx->command_list.idx += sz;
 } 
 
 GS_API_DECL void 
@@ -5520,20 +5846,18 @@ gs_gui_draw_custom(gs_gui_context_t* ctx, gs_gui_rect_t rect,
 	gs_gui_id res = (idx > 0) ? ctx->id_stack.items[idx - 1] : GS_GUI_HASH_INITIAL;
 
 	/* do custom command */
-	cmd = gs_gui_push_command(ctx, GS_GUI_COMMAND_CUSTOM, sizeof(gs_gui_customcommand_t));
+	cmd = gs_gui_push_command(ctx, GS_GUI_COMMAND_CUSTOM, sizeof(gs_gui_customcommand_t) + sz);
 	cmd->custom.clip = rect;
     cmd->custom.viewport = viewport;
 	cmd->custom.cb = cb;
     cmd->custom.hover = ctx->hover;
     cmd->custom.focus = ctx->focus; 
     cmd->custom.hash = res;
-    cmd->custom.data = ctx->command_list.items + ctx->command_list.idx;
+    cmd->custom.data = (uint8_t*)cmd + sizeof(gs_gui_customcommand_t);
     cmd->custom.sz = sz;
-    cmd->base.size += sz;
     
-    // Copy data and move list forward
-    memcpy(ctx->command_list.items + ctx->command_list.idx, data, sz);
-    ctx->command_list.idx += sz;
+    // Copy data in after command
+    memcpy(cmd->custom.data, data, sz);
 
 	/* reset clipping if it was set */
 	if (clipped) {gs_gui_set_clip(ctx, gs_gui_unclipped_rect);}
@@ -6985,7 +7309,7 @@ static int32_t _gs_gui_header(gs_gui_context_t *ctx, const char *label, int32_t
     gs_gui_parse_label_tag(ctx, label, label_tag, sizeof(label_tag));
 
 	gs_gui_id id = gs_gui_get_id(ctx, id_tag, strlen(id_tag));
-	int32_t idx = gs_gui_pool_get(ctx, ctx->treenode_pool, GS_GUI_TREENODEPOOL_SIZE, id);
+	int32_t idx = gs_gui_pool_get(ctx, &ctx->treenode_pool, id);
 
     gs_gui_push_id(ctx, id_tag, strlen(id_tag));
 
@@ -7001,17 +7325,17 @@ static int32_t _gs_gui_header(gs_gui_context_t *ctx, const char *label, int32_t
 	if (idx >= 0) 
     {
 		if (active) 
-        { gs_gui_pool_update(ctx, ctx->treenode_pool, idx); 
+        { gs_gui_pool_update(ctx, &ctx->treenode_pool, idx); 
         } 
 		else 
         { 
-            memset(&ctx->treenode_pool[idx], 0, sizeof(gs_gui_pool_item_t)); 
+            gs_gui_pool_remove(ctx, &ctx->treenode_pool, idx); 
         }
 
 	} 
     else if (active) 
     {
-		gs_gui_pool_init(ctx, ctx->treenode_pool, GS_GUI_TREENODEPOOL_SIZE, id);
+		gs_gui_pool_init(ctx, &ctx->treenode_pool, id);
 	}
 
 	/* draw */
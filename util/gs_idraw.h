@@ -119,17 +119,25 @@ gs_force_inline uint32_t gsi_pipeline_key(const gsi_pipeline_state_attr_t* s)
 		 | (prim_bit << 4);
 }
 
+// Number of vertex/index stream buffers cycled through by gsi_draw, so an upload never
+// writes into a buffer the GPU may still be reading from a previous frame
+#ifndef GSI_STREAM_BUFFER_COUNT
+	#define GSI_STREAM_BUFFER_COUNT 3
+#endif
+
 // Deferred draw command - one per batch (recorded in gsi_flush, replayed in gsi_draw)
 typedef struct gsi_draw_cmd_t
 {
-	gs_handle(gs_graphics_pipeline_t) pipeline;
+	gs_handle(gs_graphics_pipeline_t) pipeline;     // custom pipeline (GSI_FLAG_NO_BIND_CACHED_PIPELINES)
 	gs_handle(gs_graphics_texture_t)  texture;
 	gs_mat4  mvp;
+	uint32_t pipeline_key;   // cached pipeline key, resolved against the frame's index size in gsi_draw
 	uint32_t vert_offset;    // byte offset into vertex buffer
 	uint32_t vert_count;     // vertex count for non-indexed draws
-	uint32_t index_offset;   // byte offset into index buffer
+	uint32_t index_offset;   // element offset into index buffer
 	uint32_t index_count;    // if >0, this batch draws indexed
 	uint32_t flags;          // copy of gsi->flags at record time
+	uint32_t index_size;     // custom pipeline's index element size (GSI_FLAG_NO_BIND_CACHED_PIPELINES)
 	gs_vec4  viewscissor;    // x,y,w,h for set_view_scissor
 } gsi_draw_cmd_t;
 
@@ -150,6 +158,7 @@ typedef struct gs_immediate_cache_t
 	gs_color_t color;
 	gs_handle(gs_graphics_texture_t) texture;
 	gs_handle(gs_graphics_pipeline_t) custom_pipeline;
+	uint32_t custom_index_size;     // Index element size custom_pipeline was created with
 	gsi_pipeline_state_attr_t pipeline;
 } gs_immediate_cache_t;
 
@@ -158,16 +167,28 @@ typedef struct gs_immediate_draw_static_data_t
 	gs_handle(gs_graphics_texture_t) tex_default;
 	gs_asset_font_t font_default;
 	gs_handle(gs_graphics_pipeline_t) pipelines[32];   // Direct 5-bit indexed array
+	gs_handle(gs_graphics_pipeline_t) pipelines32[32]; // Same states with 32-bit indices
 	gs_handle(gs_graphics_uniform_t) uniform;
 	gs_handle(gs_graphics_uniform_t) sampler; 
-	gs_handle(gs_graphics_vertex_buffer_t) vbo;
-	gs_handle(gs_graphics_index_buffer_t) ibo;
 } gs_immediate_draw_static_data_t;
 
+// Upload counters for the last gsi_draw of a context
+typedef struct gsi_stats_t
+{
+	size_t vertex_bytes;        // Bytes sent to the vertex stream buffer
+	size_t index_bytes;         // Bytes sent to the index stream buffer
+	uint32_t reallocs;          // Stream buffers that had to grow
+	uint32_t draw_calls;
+	uint32_t index_size;        // 2 or 4
+	uint32_t skipped;           // Indexed draws dropped, custom 16-bit index pipeline in a 32-bit frame
+} gsi_stats_t;
+
 typedef struct gs_immediate_draw_t
 {
 	gs_byte_buffer_t vertices;
 	gs_dyn_array(uint16_t) indices;
+	gs_dyn_array(uint32_t) indices32;          // Used instead of indices once a frame addresses more than 65535 verts
+	uint8_t index_32;
     gs_dyn_array(gsi_vattr_type) vattributes;
 	gs_dyn_array(gsi_draw_cmd_t) draw_cmds;   // Deferred command list
 	uint32_t batch_vert_start;                  // Byte offset where current batch started
@@ -178,8 +199,32 @@ typedef struct gs_immediate_draw_t
 	uint32_t window_handle; 
 	gs_immediate_draw_static_data_t* data;
 	uint32_t flags;
+	gsi_stats_t stats;
+	gs_handle(gs_graphics_vertex_buffer_t) vbo[GSI_STREAM_BUFFER_COUNT];   // Stream buffers, owned per context
+	gs_handle(gs_graphics_index_buffer_t) ibo[GSI_STREAM_BUFFER_COUNT];
+	size_t vbo_capacity[GSI_STREAM_BUFFER_COUNT];
+	size_t ibo_capacity[GSI_STREAM_BUFFER_COUNT];
+	uint32_t stream_slot;                       // Next stream buffer pair to upload into
 } gs_immediate_draw_t;
 
+// Position in a context's vertex/index/command streams (see gsi_mark)
+typedef struct gsi_mark_t
+{
+	uint32_t vert_offset;   // Byte offset into vertices
+	uint32_t index_offset;  // Element offset into indices
+	uint32_t cmd_offset;    // Offset into draw_cmds
+} gsi_mark_t;
+
+// Copy of everything recorded between a mark and a later gsi_record, replayable on later frames.
+// Only valid for the default vertex layout (no gsi_vattr_list).
+typedef struct gsi_recording_t
+{
+	gs_dyn_array(uint8_t) vertices;
+	gs_dyn_array(uint32_t) indices;           // Relative to the first vertex of the recording
+	gs_dyn_array(gsi_draw_cmd_t) draw_cmds;   // Offsets relative to the start of the recording
+	uint32_t vert_count;
+} gsi_recording_t;
+
 #ifndef GS_NO_SHORT_NAME
 	typedef gs_immediate_draw_t gsid;
 	#define gsi_create gs_immediate_draw_new
@@ -217,6 +262,7 @@ GS_API_DECL void gsi_depth_enabled(gs_immediate_draw_t* gsi, bool enabled);
 GS_API_DECL void gsi_stencil_enabled(gs_immediate_draw_t* gsi, bool enabled);
 GS_API_DECL void gsi_face_cull_enabled(gs_immediate_draw_t* gsi, bool enabled);
 GS_API_DECL void gsi_defaults(gs_immediate_draw_t* gsi);
+// Custom pipelines drawing quads/text: 4 byte index pipelines promote the frame to 32-bit indices, 2 byte ones are skipped (stats.skipped, warned once) once the frame passes 65535 verts
 GS_API_DECL void gsi_pipeline_set(gs_immediate_draw_t* gsi, gs_handle(gs_graphics_pipeline_t) pipeline);		// Binds custom user pipeline, sets flag GSI_FLAG_NO_BIND_CACHED_PIPELINES
 GS_API_DECL void gsi_vattr_list(gs_immediate_draw_t* gsi, gsi_vattr_type* layout, size_t sz);					// Sets user vertex attribute list for custom bound pipeline
 GS_API_DECL void gsi_vattr_list_mesh(gs_immediate_draw_t* gsi, gs_asset_mesh_layout_t* layout, size_t sz);		// Same as above but uses mesh layout to determine which vertex attributes to bind and in what order
@@ -224,6 +270,12 @@ GS_API_DECL void gsi_vattr_list_mesh(gs_immediate_draw_t* gsi, gs_asset_mesh_lay
 // View/Scissor commands
 GS_API_DECL void gsi_set_view_scissor(gs_immediate_draw_t* gsi, uint32_t x, uint32_t y, uint32_t w, uint32_t h);
 
+// Record / Replay (reuse geometry that did not change since a previous frame)
+GS_API_DECL gsi_mark_t gsi_mark(gs_immediate_draw_t* gsi);                                          // Flushes, then returns the current stream positions
+GS_API_DECL void gsi_record(gs_immediate_draw_t* gsi, gsi_mark_t mark, gsi_recording_t* rec);       // Flushes, then copies everything since mark into rec
+GS_API_DECL void gsi_replay(gs_immediate_draw_t* gsi, const gsi_recording_t* rec);                  // Flushes, then appends rec rebased to the current stream positions
+GS_API_DECL void gsi_recording_free(gsi_recording_t* rec);
+
 // Final Submit / Merge
 GS_API_DECL void gsi_draw(gs_immediate_draw_t* gsi, gs_command_buffer_t* cb);
 GS_API_DECL void gsi_renderpass_submit(gs_immediate_draw_t* gsi, gs_command_buffer_t* cb, gs_vec4 viewport, gs_color_t clear_color);
@@ -388,6 +440,8 @@ void gsi_reset(gs_immediate_draw_t* gsi)
 	gs_command_buffer_clear(&gsi->commands);
 	gs_byte_buffer_clear(&gsi->vertices);	
 	gs_dyn_array_clear(gsi->indices);
+	gs_dyn_array_clear(gsi->indices32);
+	gsi->index_32 = 0;
 	gs_dyn_array_clear(gsi->draw_cmds);
 	gsi->batch_vert_start = 0;
 	gsi->batch_index_start = 0;
@@ -502,11 +556,13 @@ void gs_immediate_draw_static_data_init()
 
 		gs_handle(gs_graphics_pipeline_t) hndl = gs_graphics_pipeline_create(&pdesc);
 		GSI()->pipelines[gsi_pipeline_key(&attr)] = hndl;
+
+		pdesc.raster.index_buffer_element_size = sizeof(uint32_t);
+		GSI()->pipelines32[gsi_pipeline_key(&attr)] = gs_graphics_pipeline_create(&pdesc);
 	} 
 
 	// Create default font
 	gs_asset_font_t* f = &GSI()->font_default;
-	stbtt_fontinfo font = gs_default_val();
 	const char* compressed_ttf_data_base85 = GSGetDefaultCompressedFontDataTTFBase85();
 	s32 compressed_ttf_size = (((s32)strlen(compressed_ttf_data_base85) + 4) / 5) * 4;
     void* compressed_ttf_data = gs_malloc((usize)compressed_ttf_size);
@@ -515,63 +571,11 @@ void gs_immediate_draw_static_data_init()
     unsigned char* buf_decompressed_data = (unsigned char*)gs_malloc(buf_decompressed_size);
     gs_decompress(buf_decompressed_data, (unsigned char*)compressed_ttf_data, (u32)compressed_ttf_size);
 
-	const u32 w = 512;
-	const u32 h = 512;
-	const u32 num_comps = 4;
-	u8* alpha_bitmap = (u8*)gs_malloc(w * h);
-	u8* flipmap = (u8*)gs_malloc(w * h * num_comps);
-	memset(alpha_bitmap, 0, w * h);
-	memset(flipmap, 0, w * h * num_comps);
-   	s32 v = stbtt_BakeFontBitmap((u8*)buf_decompressed_data, 0, 13.f, alpha_bitmap, w, h, 32, 96, (stbtt_bakedchar*)f->glyphs); // no guarantee this fits!
-
-   	// Flip texture
-   	u32 r = h - 1;
-   	for (u32 i = 0; i < h; ++i)
-   	{
-   		for (u32 j = 0; j < w; ++j)
-   		{
-   			u32 i0 = i * w + j;
-   			u32 i1 = i * w * num_comps + j * num_comps;
-   			u8 a = alpha_bitmap[i0];
-   			flipmap[i1 + 0] = 255;
-   			flipmap[i1 + 1] = 255;
-   			flipmap[i1 + 2] = 255;
-   			flipmap[i1 + 3] = a;
-   		}
-   		r--;
-   	}
-
-   	gs_graphics_texture_desc_t desc = gs_default_val();
-   	desc.width = w;
-   	desc.height = h;
-   	*desc.data = flipmap;
-   	desc.format = GS_GRAPHICS_TEXTURE_FORMAT_RGBA8;
-   	desc.min_filter = GS_GRAPHICS_TEXTURE_FILTER_NEAREST;
-   	desc.mag_filter = GS_GRAPHICS_TEXTURE_FILTER_NEAREST;
-
-   	// Generate atlas texture for bitmap with bitmap data
-   	f->texture.hndl = gs_graphics_texture_create(&desc);
-   	f->texture.desc = desc;
-	*f->texture.desc.data = NULL; 
-
-	// Create vertex buffer 
-	gs_graphics_vertex_buffer_desc_t vdesc = gs_default_val();
-	vdesc.data = NULL;
-	vdesc.size = 0;
-	vdesc.usage = GS_GRAPHICS_BUFFER_USAGE_STREAM; 
-	GSI()->vbo = gs_graphics_vertex_buffer_create(&vdesc); 
-
-	// Create index buffer
-	gs_graphics_index_buffer_desc_t ibdesc = gs_default_val();
-	ibdesc.data = NULL;
-	ibdesc.size = 0;
-	ibdesc.usage = GS_GRAPHICS_BUFFER_USAGE_STREAM;
-	GSI()->ibo = gs_graphics_index_buffer_create(&ibdesc);
+	// Bakes ASCII into the atlas texture, anything else is rasterized on first use
+	gs_asset_font_load_from_memory(buf_decompressed_data, buf_decompressed_size, f, 13);
 
     gs_free(compressed_ttf_data);
    	gs_free(buf_decompressed_data);
-   	gs_free(alpha_bitmap);
-   	gs_free(flipmap);
 
 }
 
@@ -604,6 +608,22 @@ gs_immediate_draw_t gs_immediate_draw_new()
 
     gsi.vertices = gs_byte_buffer_new();
 
+	// Create stream vertex/index buffers (sized on first upload)
+	for (uint32_t i = 0; i < GSI_STREAM_BUFFER_COUNT; ++i)
+	{
+		gs_graphics_vertex_buffer_desc_t vdesc = gs_default_val();
+		vdesc.data = NULL;
+		vdesc.size = 0;
+		vdesc.usage = GS_GRAPHICS_BUFFER_USAGE_STREAM; 
+		gsi.vbo[i] = gs_graphics_vertex_buffer_create(&vdesc); 
+
+		gs_graphics_index_buffer_desc_t ibdesc = gs_default_val();
+		ibdesc.data = NULL;
+		ibdesc.size = 0;
+		ibdesc.usage = GS_GRAPHICS_BUFFER_USAGE_STREAM;
+		gsi.ibo[i] = gs_graphics_index_buffer_create(&ibdesc);
+	}
+
 	// Set up cache 
 	gsi_reset(&gsi);
 
@@ -615,6 +635,7 @@ gs_immediate_draw_free(gs_immediate_draw_t* ctx)
 {
 	gs_byte_buffer_free(&ctx->vertices);
 	gs_dyn_array_free(ctx->indices);
+	gs_dyn_array_free(ctx->indices32);
 	gs_dyn_array_free(ctx->draw_cmds);
 	gs_dyn_array_free(ctx->vattributes);
 	gs_command_buffer_free(&ctx->commands); 
@@ -622,6 +643,11 @@ gs_immediate_draw_free(gs_immediate_draw_t* ctx)
 	gs_dyn_array_free(ctx->cache.modelview); 
 	gs_dyn_array_free(ctx->cache.projection); 
 	gs_dyn_array_free(ctx->cache.modes);
+	for (uint32_t i = 0; i < GSI_STREAM_BUFFER_COUNT; ++i)
+	{
+		gs_graphics_vertex_buffer_destroy(ctx->vbo[i]);
+		gs_graphics_index_buffer_destroy(ctx->ibo[i]);
+	}
 }
 
 GS_API_DECL gs_asset_font_t* 
@@ -634,7 +660,7 @@ gsi_default_font()
 GS_API_DECL gs_handle(gs_graphics_pipeline_t) 
 gsi_get_pipeline(gs_immediate_draw_t* gsi, gsi_pipeline_state_attr_t state)
 {
-	return GSI()->pipelines[gsi_pipeline_key(&state)];
+	return gsi->index_32 ? GSI()->pipelines32[gsi_pipeline_key(&state)] : GSI()->pipelines[gsi_pipeline_key(&state)];
 }
 
 void gs_immediate_draw_set_pipeline(gs_immediate_draw_t* gsi)
@@ -704,10 +730,15 @@ gs_mat4 gsi_get_mvp_matrix(gs_immediate_draw_t* gsi)
 	return gs_mat4_mul(*proj, *mv);
 }
 
+gs_force_inline uint32_t gsi_index_count(gs_immediate_draw_t* gsi)
+{
+	return gsi->index_32 ? gs_dyn_array_size(gsi->indices32) : gs_dyn_array_size(gsi->indices);
+}
+
 void gsi_flush(gs_immediate_draw_t* gsi)
 {
 	uint32_t current_vsize  = (uint32_t)gsi->vertices.position;
-	uint32_t current_icount = gs_dyn_array_size(gsi->indices);
+	uint32_t current_icount = gsi_index_count(gsi);
 	uint32_t batch_vsize    = current_vsize - gsi->batch_vert_start;
 
 	// Nothing to flush
@@ -736,16 +767,17 @@ void gsi_flush(gs_immediate_draw_t* gsi)
 	if (gsi->flags & GSI_FLAG_NO_BIND_CACHED_PIPELINES)
 	{
 		cmd.pipeline = gsi->cache.custom_pipeline;
+		cmd.index_size = gsi->cache.custom_index_size;
 	}
 	else
 	{
-		cmd.pipeline = GSI()->pipelines[gsi_pipeline_key(&gsi->cache.pipeline)];
+		cmd.pipeline_key = gsi_pipeline_key(&gsi->cache.pipeline);
 	}
 	cmd.texture      = gsi->cache.texture;
 	cmd.mvp          = gsi_get_mvp_matrix(gsi);
 	cmd.vert_offset  = gsi->batch_vert_start;
 	cmd.vert_count   = (uint32_t)(batch_vsize / vsz);
-	cmd.index_offset = gsi->batch_index_start * sizeof(uint16_t);  // byte offset for glDrawElements
+	cmd.index_offset = gsi->batch_index_start;
 	cmd.index_count  = current_icount - gsi->batch_index_start;
 	cmd.flags        = gsi->flags;
 	gs_dyn_array_push(gsi->draw_cmds, cmd);
@@ -851,7 +883,12 @@ gsi_pipeline_set(gs_immediate_draw_t* gsi, gs_handle(gs_graphics_pipeline_t) pip
 	// Bind if valid
 	if (pipeline.id)
 	{
+		// Index width has to match the frame's index stream, resolved in gsi_draw
+		gs_graphics_pipeline_desc_t desc = gs_default_val();
+		gs_graphics_pipeline_desc_query(pipeline, &desc);
+		gs_dyn_array_free(desc.layout.attrs);
 		gsi->cache.custom_pipeline = pipeline;
+		gsi->cache.custom_index_size = desc.raster.index_buffer_element_size == sizeof(uint16_t) ? sizeof(uint16_t) : sizeof(uint32_t);
 		gsi->flags |= GSI_FLAG_NO_BIND_CACHED_PIPELINES;
 	}
 	// Otherwise we set back to cache, clear vattributes, clear flag
@@ -1003,6 +1040,16 @@ void gsi_v2fv(gs_immediate_draw_t* gsi, gs_vec2 v)
 	gsi_v3f(gsi, v.x, v.y, 0.f);
 }
 
+// Move the frame's indices over to 32-bit storage
+void gsi_promote_index_32(gs_immediate_draw_t* gsi)
+{
+	uint32_t n = gs_dyn_array_size(gsi->indices);
+	gs_dyn_array_reserve(gsi->indices32, n * 2);
+	for (uint32_t i = 0; i < n; ++i) gs_dyn_array_push(gsi->indices32, (uint32_t)gsi->indices[i]);
+	gs_dyn_array_clear(gsi->indices);
+	gsi->index_32 = 1;
+}
+
 // Push 6 indices for a quad (call BEFORE pushing the 4 verts for the quad)
 gs_force_inline void gsi_push_quad_indices(gs_immediate_draw_t* gsi)
 {
@@ -1013,13 +1060,33 @@ gs_force_inline void gsi_push_quad_indices(gs_immediate_draw_t* gsi)
 		if (batch_vsize > 0) gsi_flush(gsi);
 		gsi->batch_is_indexed = 1;
 	}
-	uint16_t base = (uint16_t)(gsi->vertices.position / sizeof(gs_immediate_vert_t));
-	gs_dyn_array_push(gsi->indices, (uint16_t)(base + 0));
-	gs_dyn_array_push(gsi->indices, (uint16_t)(base + 1));
-	gs_dyn_array_push(gsi->indices, (uint16_t)(base + 2));
-	gs_dyn_array_push(gsi->indices, (uint16_t)(base + 1));
-	gs_dyn_array_push(gsi->indices, (uint16_t)(base + 3));
-	gs_dyn_array_push(gsi->indices, (uint16_t)(base + 2));
+	uint32_t base = (uint32_t)(gsi->vertices.position / sizeof(gs_immediate_vert_t));
+
+	// Promote the frame to 32-bit indices once 16 bits can no longer address the quad
+	if (!gsi->index_32 && base + 3 > UINT16_MAX)
+	{
+		gsi_promote_index_32(gsi);
+	}
+
+	if (gsi->index_32)
+	{
+		gs_dyn_array_push(gsi->indices32, base + 0);
+		gs_dyn_array_push(gsi->indices32, base + 1);
+		gs_dyn_array_push(gsi->indices32, base + 2);
+		gs_dyn_array_push(gsi->indices32, base + 1);
+		gs_dyn_array_push(gsi->indices32, base + 3);
+		gs_dyn_array_push(gsi->indices32, base + 2);
+	}
+	else
+	{
+		uint16_t b = (uint16_t)base;
+		gs_dyn_array_push(gsi->indices, (uint16_t)(b + 0));
+		gs_dyn_array_push(gsi->indices, (uint16_t)(b + 1));
+		gs_dyn_array_push(gsi->indices, (uint16_t)(b + 2));
+		gs_dyn_array_push(gsi->indices, (uint16_t)(b + 1));
+		gs_dyn_array_push(gsi->indices, (uint16_t)(b + 3));
+		gs_dyn_array_push(gsi->indices, (uint16_t)(b + 2));
+	}
 }
 
 void gsi_push_matrix_ex(gs_immediate_draw_t* gsi, gsi_matrix_type type, bool flush)
@@ -2054,22 +2121,30 @@ gsi_text(gs_immediate_draw_t* gsi, float x, float y, const char* text,
     float th = gs_asset_font_max_height(fp);
     y += th;
 
+	// Rasterize any missing glyphs before emitting quads, so an atlas resize can't move ones already emitted
+	for (const char* at = text; at[0] != '\0';)
+	{
+		gs_baked_char_t glyph = gs_default_val();
+		gs_asset_font_glyph(fp, gs_util_utf8_next(&at), &glyph);
+	}
+	gs_asset_font_atlas_flush(fp);
+
 	// Needs to be fixed in here. Not elsewhere.
 	gsi_begin(gsi, GS_GRAPHICS_PRIMITIVE_TRIANGLES);
 	{
 		gs_color_t color = gs_color(r, g, b, a);
 		while (text[0] != '\0')
 		{
-			char c = text[0];
-			if (c >= 32 && c <= 127) 
+			gs_baked_char_t glyph = gs_default_val();
+			if (gs_asset_font_glyph(fp, gs_util_utf8_next(&text), &glyph)) 
 			{
-				stbtt_aligned_quad q = gs_default_val();
-				stbtt_GetBakedQuad((stbtt_bakedchar*)fp->glyphs, fp->texture.desc.width, fp->texture.desc.height, c - 32, &x, &y, &q, 1);
+				gs_vec4 q = gs_default_val(), uv = gs_default_val();
+				gs_asset_font_glyph_quad(fp, &glyph, &x, &y, &q, &uv);
 
-				gs_vec3 v0 = gs_v3(q.x0, q.y0, 0.f);	// TL
-				gs_vec3 v1 = gs_v3(q.x1, q.y0, 0.f);	// TR
-				gs_vec3 v2 = gs_v3(q.x0, q.y1, 0.f);	// BL
-				gs_vec3 v3 = gs_v3(q.x1, q.y1, 0.f);	// BR
+				gs_vec3 v0 = gs_v3(q.x, q.y, 0.f);	// TL
+				gs_vec3 v1 = gs_v3(q.z, q.y, 0.f);	// TR
+				gs_vec3 v2 = gs_v3(q.x, q.w, 0.f);	// BL
+				gs_vec3 v3 = gs_v3(q.z, q.w, 0.f);	// BR
 
 				if (flip_vertical) {
 					gs_mat4 rot = gs_mat4_rotatev(gs_deg2rad(-180.f), GS_XAXIS);
@@ -2079,10 +2154,10 @@ gsi_text(gs_immediate_draw_t* gsi, float x, float y, const char* text,
 					v3 = gs_mat4_mul_vec3(rot, v3);
 				}
 
-				gs_vec2 uv0 = gs_v2(q.s0, q.t0);	// TL
-				gs_vec2 uv1 = gs_v2(q.s1, q.t0);	// TR
-				gs_vec2 uv2 = gs_v2(q.s0, q.t1);	// BL
-				gs_vec2 uv3 = gs_v2(q.s1, q.t1);	// BR
+				gs_vec2 uv0 = gs_v2(uv.x, uv.y);	// TL
+				gs_vec2 uv1 = gs_v2(uv.z, uv.y);	// TR
+				gs_vec2 uv2 = gs_v2(uv.x, uv.w);	// BL
+				gs_vec2 uv3 = gs_v2(uv.z, uv.w);	// BR
 
 				// 4 verts + 6 indices per glyph
 				gsi_push_quad_indices(gsi);
@@ -2094,7 +2169,6 @@ gsi_text(gs_immediate_draw_t* gsi, float x, float y, const char* text,
 				};
 				gs_byte_buffer_write_bulk(&gsi->vertices, verts, sizeof(verts));
 			}
-			text++;
 		}
 	}
 	gsi_end(gsi);
@@ -2114,6 +2188,139 @@ gsi_set_view_scissor(gs_immediate_draw_t* gsi, uint32_t x, uint32_t y, uint32_t
     gs_dyn_array_push(gsi->draw_cmds, cmd);
 }
 
+// Record / Replay
+GS_API_DECL gsi_mark_t 
+gsi_mark(gs_immediate_draw_t* gsi)
+{
+    gsi_flush(gsi);
+
+    gsi_mark_t mark = gs_default_val();
+    mark.vert_offset = (uint32_t)gsi->vertices.position;
+    mark.index_offset = gsi_index_count(gsi);
+    mark.cmd_offset = gs_dyn_array_size(gsi->draw_cmds);
+    return mark;
+}
+
+GS_API_DECL void 
+gsi_record(gs_immediate_draw_t* gsi, gsi_mark_t mark, gsi_recording_t* rec)
+{
+    gsi_flush(gsi);
+
+    uint32_t vsz = (uint32_t)gsi->vertices.position - mark.vert_offset;
+    uint32_t icnt = gsi_index_count(gsi) - mark.index_offset;
+    uint32_t ccnt = gs_dyn_array_size(gsi->draw_cmds) - mark.cmd_offset;
+    uint32_t base = mark.vert_offset / sizeof(gs_immediate_vert_t);
+
+    gs_dyn_array_clear(rec->vertices);
+    gs_dyn_array_clear(rec->indices);
+    gs_dyn_array_clear(rec->draw_cmds);
+    rec->vert_count = vsz / sizeof(gs_immediate_vert_t);
+
+    // Vertices
+    if (vsz)
+    {
+        gs_dyn_array_reserve(rec->vertices, vsz);
+        memcpy(rec->vertices, gsi->vertices.data + mark.vert_offset, vsz);
+        gs_dyn_array_head(rec->vertices)->size = vsz;
+    }
+
+    // Indices, made relative to the first vertex
+    if (icnt)
+    {
+        gs_dyn_array_reserve(rec->indices, icnt);
+        for (uint32_t i = 0; i < icnt; ++i)
+        {
+            uint32_t idx = gsi->index_32 ? gsi->indices32[mark.index_offset + i] : (uint32_t)gsi->indices[mark.index_offset + i];
+            rec->indices[i] = idx - base;
+        }
+        gs_dyn_array_head(rec->indices)->size = icnt;
+    }
+
+    // Draw commands, made relative to the start of the recording
+    if (ccnt)
+    {
+        gs_dyn_array_reserve(rec->draw_cmds, ccnt);
+        for (uint32_t i = 0; i < ccnt; ++i)
+        {
+            gsi_draw_cmd_t cmd = gsi->draw_cmds[mark.cmd_offset + i];
+            if (!(cmd.flags & GSI_FLAG_SET_VIEW_SCISSOR))
+            {
+                cmd.vert_offset -= mark.vert_offset;
+                cmd.index_offset -= mark.index_offset;
+            }
+            rec->draw_cmds[i] = cmd;
+        }
+        gs_dyn_array_head(rec->draw_cmds)->size = ccnt;
+    }
+}
+
+GS_API_DECL void 
+gsi_replay(gs_immediate_draw_t* gsi, const gsi_recording_t* rec)
+{
+    gsi_flush(gsi);
+
+    uint32_t voff = (uint32_t)gsi->vertices.position;
+    uint32_t ioff = gsi_index_count(gsi);
+    uint32_t base = voff / sizeof(gs_immediate_vert_t);
+    uint32_t icnt = gs_dyn_array_size(rec->indices);
+    uint32_t ccnt = gs_dyn_array_size(rec->draw_cmds);
+
+    // Vertices
+    if (gs_dyn_array_size(rec->vertices))
+    {
+        gs_byte_buffer_write_bulk(&gsi->vertices, (void*)rec->vertices, gs_dyn_array_size(rec->vertices));
+    }
+
+    // Indices, rebased onto the current vertex count
+    if (icnt)
+    {
+        if (!gsi->index_32 && base + rec->vert_count - 1 > UINT16_MAX)
+        {
+            gsi_promote_index_32(gsi);
+        }
+
+        if (gsi->index_32)
+        {
+            uint32_t cap = (uint32_t)gs_dyn_array_capacity(gsi->indices32);
+            if (ioff + icnt > cap) gs_dyn_array_reserve(gsi->indices32, gs_max(ioff + icnt, 2 * cap));
+            for (uint32_t i = 0; i < icnt; ++i) gsi->indices32[ioff + i] = rec->indices[i] + base;
+            gs_dyn_array_head(gsi->indices32)->size = ioff + icnt;
+        }
+        else
+        {
+            uint32_t cap = (uint32_t)gs_dyn_array_capacity(gsi->indices);
+            if (ioff + icnt > cap) gs_dyn_array_reserve(gsi->indices, gs_max(ioff + icnt, 2 * cap));
+            for (uint32_t i = 0; i < icnt; ++i) gsi->indices[ioff + i] = (uint16_t)(rec->indices[i] + base);
+            gs_dyn_array_head(gsi->indices)->size = ioff + icnt;
+        }
+    }
+
+    // Draw commands
+    for (uint32_t i = 0; i < ccnt; ++i)
+    {
+        gsi_draw_cmd_t cmd = rec->draw_cmds[i];
+        if (!(cmd.flags & GSI_FLAG_SET_VIEW_SCISSOR))
+        {
+            cmd.vert_offset += voff;
+            cmd.index_offset += ioff;
+        }
+        gs_dyn_array_push(gsi->draw_cmds, cmd);
+    }
+
+    // Continue batching after the replayed range
+    gsi->batch_vert_start = (uint32_t)gsi->vertices.position;
+    gsi->batch_index_start = gsi_index_count(gsi);
+    gsi->batch_is_indexed = 0;
+}
+
+GS_API_DECL void 
+gsi_recording_free(gsi_recording_t* rec)
+{
+    gs_dyn_array_free(rec->vertices);
+    gs_dyn_array_free(rec->indices);
+    gs_dyn_array_free(rec->draw_cmds);
+}
+
 // Final Submit / Merge
 GS_API_DECL void 
 gsi_draw(gs_immediate_draw_t* gsi, gs_command_buffer_t* cb)
@@ -2122,24 +2329,69 @@ gsi_draw(gs_immediate_draw_t* gsi, gs_command_buffer_t* cb)
 	gsi_flush(gsi);
 
 	uint32_t cmd_count = gs_dyn_array_size(gsi->draw_cmds);
+	memset(&gsi->stats, 0, sizeof(gsi->stats));
+
+	// Custom pipelines created with 32-bit indices read the whole frame as 32-bit
+	for (uint32_t i = 0; i < cmd_count && !gsi->index_32; ++i)
+	{
+		gsi_draw_cmd_t* cmd = &gsi->draw_cmds[i];
+		if ((cmd->flags & GSI_FLAG_NO_BIND_CACHED_PIPELINES) && cmd->index_count && cmd->index_size == sizeof(uint32_t))
+		{
+			gsi_promote_index_32(gsi);
+		}
+	}
+
+	gsi->stats.index_size = gsi->index_32 ? sizeof(uint32_t) : sizeof(uint16_t);
 	if (cmd_count == 0) { gsi_reset(gsi); return; }
 
+	// Take the next stream buffer pair. Buffers only get recreated (at the cpu-side capacity,
+	// so they grow geometrically) when too small, otherwise data is written in place.
+	uint32_t slot = gsi->stream_slot;
+	gsi->stream_slot = (slot + 1) % GSI_STREAM_BUFFER_COUNT;
+	gs_handle(gs_graphics_vertex_buffer_t) vbo = gsi->vbo[slot];
+	gs_handle(gs_graphics_index_buffer_t) ibo = gsi->ibo[slot];
+
 	// ---- Single VBO upload for entire frame ----
 	gs_graphics_vertex_buffer_desc_t vdesc = gs_default_val();
 	vdesc.data  = gsi->vertices.data;
 	vdesc.size  = (size_t)gsi->vertices.position;
 	vdesc.usage = GS_GRAPHICS_BUFFER_USAGE_STREAM;
-	gs_graphics_vertex_buffer_request_update(cb, GSI()->vbo, &vdesc);
+	if (vdesc.size > gsi->vbo_capacity[slot])
+	{
+		vdesc.size = (size_t)gsi->vertices.capacity;
+		vdesc.update.type = GS_GRAPHICS_BUFFER_UPDATE_RECREATE;
+		gsi->vbo_capacity[slot] = vdesc.size;
+		gsi->stats.reallocs++;
+	}
+	else
+	{
+		vdesc.update.type = GS_GRAPHICS_BUFFER_UPDATE_SUBDATA;
+	}
+	gs_graphics_vertex_buffer_request_update(cb, vbo, &vdesc);
+	gsi->stats.vertex_bytes = vdesc.size;
 
 	// ---- Single IBO upload for entire frame (if any indexed batches) ----
-	uint32_t total_indices = gs_dyn_array_size(gsi->indices);
+	uint32_t total_indices = gsi_index_count(gsi);
+	size_t isz = gsi->stats.index_size;
 	if (total_indices > 0)
 	{
 		gs_graphics_index_buffer_desc_t ibdesc = gs_default_val();
-		ibdesc.data  = gsi->indices;
-		ibdesc.size  = total_indices * sizeof(uint16_t);
+		ibdesc.data  = gsi->index_32 ? (void*)gsi->indices32 : (void*)gsi->indices;
+		ibdesc.size  = total_indices * isz;
 		ibdesc.usage = GS_GRAPHICS_BUFFER_USAGE_STREAM;
-		gs_graphics_index_buffer_request_update(cb, GSI()->ibo, &ibdesc);
+		if (ibdesc.size > gsi->ibo_capacity[slot])
+		{
+			ibdesc.size = (gsi->index_32 ? gs_dyn_array_capacity(gsi->indices32) : gs_dyn_array_capacity(gsi->indices)) * isz;
+			ibdesc.update.type = GS_GRAPHICS_BUFFER_UPDATE_RECREATE;
+			gsi->ibo_capacity[slot] = ibdesc.size;
+			gsi->stats.reallocs++;
+		}
+		else
+		{
+			ibdesc.update.type = GS_GRAPHICS_BUFFER_UPDATE_SUBDATA;
+		}
+		gs_graphics_index_buffer_request_update(cb, ibo, &ibdesc);
+		gsi->stats.index_bytes = ibdesc.size;
 	}
 
 	// ---- Replay deferred draw commands ----
@@ -2155,15 +2407,32 @@ gsi_draw(gs_immediate_draw_t* gsi, gs_command_buffer_t* cb)
 			continue;
 		}
 
-		// Bind pipeline
-		if (cmd->pipeline.id && cmd->pipeline.id != UINT32_MAX)
+		// Custom 16-bit index pipeline can't address a frame promoted to 32-bit indices
+		if ((cmd->flags & GSI_FLAG_NO_BIND_CACHED_PIPELINES) && cmd->index_count && gsi->index_32 && cmd->index_size == sizeof(uint16_t))
+		{
+			static bool32_t warned = false;
+			if (!warned) {
+				gs_log_warning("Skipping draw: custom pipeline has 16-bit indices but the frame uses 32-bit indices (over 65535 verts), set raster.index_buffer_element_size to sizeof(uint32_t). Further skips are only counted in stats.skipped.");
+				warned = true;
+			}
+			gsi->stats.skipped++;
+			continue;
+		}
+
+		// Bind pipeline (cached pipelines are picked for the frame's index size)
+		gs_handle(gs_graphics_pipeline_t) pip = cmd->pipeline;
+		if (~cmd->flags & GSI_FLAG_NO_BIND_CACHED_PIPELINES)
+		{
+			pip = gsi->index_32 ? GSI()->pipelines32[cmd->pipeline_key] : GSI()->pipelines[cmd->pipeline_key];
+		}
+		if (pip.id && pip.id != UINT32_MAX)
 		{
-			gs_graphics_pipeline_bind(cb, cmd->pipeline);
+			gs_graphics_pipeline_bind(cb, pip);
 		}
 
 		// Vertex buffer binding
 		gs_graphics_bind_vertex_buffer_desc_t vbuffer = gs_default_val();
-		vbuffer.buffer = GSI()->vbo;
+		vbuffer.buffer = vbo;
 
 		// Uniform bindings
 		gs_graphics_bind_uniform_desc_t ubinds[2] = gs_default_val();
@@ -2183,13 +2452,13 @@ gsi_draw(gs_immediate_draw_t* gsi, gs_command_buffer_t* cb)
 		if (cmd->index_count > 0)
 		{
 			gs_graphics_bind_index_buffer_desc_t ibuffer = gs_default_val();
-			ibuffer.buffer = GSI()->ibo;
+			ibuffer.buffer = ibo;
 			binds.index_buffers.desc = &ibuffer;
 
 			gs_graphics_apply_bindings(cb, &binds);
 
 			gs_graphics_draw_desc_t draw = gs_default_val();
-			draw.start = cmd->index_offset;   // byte offset into IBO
+			draw.start = cmd->index_offset * (uint32_t)isz;   // byte offset into IBO
 			draw.count = cmd->index_count;
 			gs_graphics_draw(cb, &draw);
 		}
@@ -2203,6 +2472,7 @@ gsi_draw(gs_immediate_draw_t* gsi, gs_command_buffer_t* cb)
 			draw.count = cmd->vert_count;
 			gs_graphics_draw(cb, &draw);
 		}
+		gsi->stats.draw_calls++;
 	}
 
 	// Reset for next frame
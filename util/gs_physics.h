@@ -286,6 +286,44 @@ GS_API_DECL int32_t gs_cone_vs_cylinder(const gs_cone_t* a, const gs_vqs* xform_
 GS_API_DECL int32_t gs_cone_vs_capsule(const gs_cone_t* a, const gs_vqs* xform_a, const gs_capsule_t* b, const gs_vqs* xform_b, gs_contact_info_t* res);
 GS_API_DECL int32_t gs_cone_vs_ray(const gs_cone_t* a, const gs_vqs* xform_a, const gs_ray_t* b, const gs_vqs* xform_b, gs_contact_info_t* res);
 
+/*
+    Sphere/sphere, sphere/aabb, aabb/aabb, capsule/sphere, capsule/capsule and sphere/aabb/capsule vs. ray
+    are solved in closed form, all other pairs go through GJK/EPA. Return codes are the same either way
+    (0 on hit, -1 otherwise), and the normal points from a to b.
+
+    Ray tests report the first hit along the ray instead of a penetration: point on the surface, outward
+    surface normal and distance from the ray origin in depth.
+*/
+
+/* Batched (SoA) */
+
+// World space shapes laid out as structure of arrays, so one shape can be tested against several per SIMD lane
+typedef struct gs_sphere_soa_t {
+    const float* x;
+    const float* y;
+    const float* z;
+    const float* r;
+    uint32_t count;
+} gs_sphere_soa_t;
+
+typedef struct gs_aabb_soa_t {
+    const float* min_x;
+    const float* min_y;
+    const float* min_z;
+    const float* max_x;
+    const float* max_y;
+    const float* max_z;
+    uint32_t count;
+} gs_aabb_soa_t;
+
+// Writes indices of overlapping shapes in b into hits (up to b->count), returns number of hits.
+// Ray variants optionally write the distance along the ray (in units of ray->d) of each hit into t.
+GS_API_DECL uint32_t gs_sphere_vs_sphere_batch(const gs_sphere_t* a, const gs_vqs* xform_a, const gs_sphere_soa_t* b, uint32_t* hits);
+GS_API_DECL uint32_t gs_sphere_vs_aabb_batch(const gs_sphere_t* a, const gs_vqs* xform_a, const gs_aabb_soa_t* b, uint32_t* hits);
+GS_API_DECL uint32_t gs_aabb_vs_aabb_batch(const gs_aabb_t* a, const gs_aabb_soa_t* b, uint32_t* hits);
+GS_API_DECL uint32_t gs_ray_vs_sphere_batch(const gs_ray_t* a, const gs_sphere_soa_t* b, uint32_t* hits, float* t);
+GS_API_DECL uint32_t gs_ray_vs_aabb_batch(const gs_ray_t* a, const gs_aabb_soa_t* b, uint32_t* hits, float* t);
+
 // 2D Shapes (eventually)
 
 /* Hit */
@@ -381,12 +419,151 @@ GS_API_DECL int32_t _gs_ccd_gjk(const _gs_collision_obj_handle_t* c0, const _gs_
 
 /*==== Physics System ====*/
 
-#define EMPTY_VAR(...) int32_t __empty
+#ifndef GS_PHYSICS_AABB_MARGIN
+    #define GS_PHYSICS_AABB_MARGIN  0.1f                    // Fat AABB extension, bodies moving within it skip broadphase updates
+#endif
 
-/* Rigid Body */
+#ifndef GS_PHYSICS_LINEAR_SLOP
+    #define GS_PHYSICS_LINEAR_SLOP  0.005f                  // Allowed penetration before position correction kicks in
+#endif
+
+#ifndef GS_PHYSICS_BAUMGARTE
+    #define GS_PHYSICS_BAUMGARTE    0.2f
+#endif
+
+#ifndef GS_PHYSICS_CONTACT_BREAKING_DISTANCE
+    #define GS_PHYSICS_CONTACT_BREAKING_DISTANCE    0.02f   // Persistent manifold points drifting further than this are dropped
+#endif
+
+#ifndef GS_PHYSICS_SLEEP_TIME
+    #define GS_PHYSICS_SLEEP_TIME   0.5f                    // Seconds an island must stay at rest before sleeping
+#endif
+
+#ifndef GS_PHYSICS_SLEEP_LINEAR_TOLERANCE
+    #define GS_PHYSICS_SLEEP_LINEAR_TOLERANCE   0.05f
+#endif
+
+#ifndef GS_PHYSICS_SLEEP_ANGULAR_TOLERANCE
+    #define GS_PHYSICS_SLEEP_ANGULAR_TOLERANCE  0.05f
+#endif
+
+#ifndef GS_PHYSICS_DEFAULT_FRICTION
+    #define GS_PHYSICS_DEFAULT_FRICTION 0.6f
+#endif
+
+#define GS_PHYSICS_MANIFOLD_MAX_POINTS  4
+
+/* Dynamic AABB Tree */
+
+// Bounding volume hierarchy of leaf boxes, kept balanced with AVL rotations. Used as the scene broadphase.
+typedef struct gs_aabb_tree_node_t {
+    gs_aabb_t aabb;
+    int32_t parent;                 // Next free node when unused
+    int32_t child1;                 // -1 for leaves
+    int32_t child2;
+    int32_t height;                 // 0 for leaves, -1 when free
+    uint32_t user_id;
+} gs_aabb_tree_node_t;
+
+typedef struct gs_aabb_tree_t {
+    gs_dyn_array(gs_aabb_tree_node_t) nodes;
+    int32_t root;
+    int32_t free_list;
+} gs_aabb_tree_t;
+
+// Return false to stop the query
+typedef bool32_t (* gs_aabb_tree_query_func)(void* user_data, int32_t proxy, uint32_t user_id);
+
+// Return new max fraction along ray to clip the search, 0 to stop, or < 0 to ignore this leaf
+typedef float (* gs_aabb_tree_raycast_func)(void* user_data, const gs_ray_t* ray, float max_fraction, int32_t proxy, uint32_t user_id);
+
+GS_API_DECL gs_aabb_tree_t gs_aabb_tree_new();
+GS_API_DECL void     gs_aabb_tree_free(gs_aabb_tree_t* tree);
+GS_API_DECL int32_t  gs_aabb_tree_insert(gs_aabb_tree_t* tree, const gs_aabb_t* aabb, uint32_t user_id);
+GS_API_DECL void     gs_aabb_tree_remove(gs_aabb_tree_t* tree, int32_t proxy);
+GS_API_DECL void     gs_aabb_tree_update(gs_aabb_tree_t* tree, int32_t proxy, const gs_aabb_t* aabb);
+GS_API_DECL void     gs_aabb_tree_query(const gs_aabb_tree_t* tree, const gs_aabb_t* aabb, gs_aabb_tree_query_func cb, void* user_data);
+GS_API_DECL void     gs_aabb_tree_raycast(const gs_aabb_tree_t* tree, const gs_ray_t* ray, gs_aabb_tree_raycast_func cb, void* user_data);
+GS_API_DECL bool32_t gs_aabb_overlap(const gs_aabb_t* a, const gs_aabb_t* b);
+GS_API_DECL bool32_t gs_aabb_contains(const gs_aabb_t* a, const gs_aabb_t* b);
+
+/* Collision Shape */
+
+typedef enum gs_collision_shape_type {
+    GS_COLLISION_SHAPE_SPHERE = 0x00,
+    GS_COLLISION_SHAPE_AABB,        // Box, oriented with its body
+    GS_COLLISION_SHAPE_CAPSULE,
+    GS_COLLISION_SHAPE_CYLINDER,
+    GS_COLLISION_SHAPE_CONE,
+    GS_COLLISION_SHAPE_POLY         // Convex hull, vertex data owned by user
+} gs_collision_shape_type;
+
+// Single shape per body, centered on the body origin
+typedef struct gs_collision_shape_t {
+    gs_collision_shape_type type;
+    union {
+        gs_sphere_t sphere;
+        gs_aabb_t aabb;
+        gs_capsule_t capsule;
+        gs_cylinder_t cylinder;
+        gs_cone_t cone;
+        gs_poly_t poly;
+    };
+    float friction;                 // 0 uses GS_PHYSICS_DEFAULT_FRICTION
+    float restitution;
+    uint32_t body;                  // Owning body, set by scene
+    void* user_data;
+} gs_collision_shape_t;
+
+/* Contact Constraint */
+
+typedef enum gs_contact_flags {
+    GS_CONTACT_TOUCHING = 0x01,
+    GS_CONTACT_ISLAND   = 0x02
+} gs_contact_flags;
+
+typedef struct gs_contact_point_t {
+    gs_vec3 local_a;                // Anchors in body space, used to refresh persistent points every step
+    gs_vec3 local_b;
+    gs_vec3 ra;                     // World offsets from body centers
+    gs_vec3 rb;
+    float separation;               // Negative when penetrating
+    float normal_impulse;           // Accumulated, carried over for warm starting
+    float tangent_impulse[2];
+    float normal_mass;
+    float tangent_mass[2];
+    float bias;
+    float relative_velocity;        // Normal approach speed before solving, for restitution
+} gs_contact_point_t;
+
+struct gs_contact_constraint_t;
+
+// Links bodies in the contact graph (islands)
+typedef struct gs_contact_edge_t {
+    uint32_t other;
+    struct gs_contact_constraint_t* contact;
+    struct gs_contact_edge_t* prev;
+    struct gs_contact_edge_t* next;
+} gs_contact_edge_t;
+
+// Persistent manifold between two bodies whose fat AABBs overlap
+typedef struct gs_contact_constraint_t {
+    uint32_t body_a;
+    uint32_t body_b;
+    gs_vec3 normal;                 // From a to b
+    gs_vec3 tangent[2];
+    gs_contact_point_t points[GS_PHYSICS_MANIFOLD_MAX_POINTS];
+    uint32_t count;
+    float friction;
+    float restitution;
+    uint32_t flags;
+    gs_contact_edge_t edge_a;
+    gs_contact_edge_t edge_b;
+    struct gs_contact_constraint_t* prev;
+    struct gs_contact_constraint_t* next;
+} gs_contact_constraint_t;
 
-// Just want a single collision shape...not sure exactly how to handle this. 
-// Probably keep the data for the collision shape within the scene itself (or physics system)? Then give handles to users for the data.
+/* Rigid Body */
 
 typedef enum gs_rigid_body_type {
     GS_RIGID_BODY_STATIC, 
@@ -402,14 +579,12 @@ typedef enum gs_rigid_body_state_flags {
     GS_RIGID_BODY_STATE_STATIC      = 0x020,
     GS_RIGID_BODY_STATE_DYNAMIC     = 0x040,
     GS_RIGID_BODY_STATE_KINEMATIC   = 0x080,
-    GS_RIGID_BODY_STATE_LOCK_AXIS_X = 0x100,
+    GS_RIGID_BODY_STATE_LOCK_AXIS_X = 0x100,    // Locks rotation about world axis
     GS_RIGID_BODY_STATE_LOCK_AXIS_Y = 0x200,
     GS_RIGID_BODY_STATE_LOCK_AXIS_Z = 0x400
 } gs_rigid_body_state_flags;
 
 typedef struct gs_rigid_body_t {
-    EMPTY_VAR();
-
     float mass;
     float inverve_mass;
     gs_vec3 linear_velocity;
@@ -426,24 +601,44 @@ typedef struct gs_rigid_body_t {
     uint32_t island_index;
     void * user_data;
 
+    gs_rigid_body_type type;
+    float linear_damping;
+    float angular_damping;
+    gs_vec3 inverse_inertia_local;
+    gs_mat3 inverse_inertia_world;
+    gs_collision_shape_t shape;
+    gs_aabb_t aabb;                 // Tight world bounds of shape
+    int32_t proxy;                  // Broadphase leaf
+    bool32_t moved;                 // Proxy reinserted this step
+    gs_contact_edge_t* contacts;
+    uint32_t id;
 } gs_rigid_body_t;
 
 typedef struct gs_rigid_body_desc_t {
-    EMPTY_VAR();
+    gs_rigid_body_type type;
+    gs_vec3 position;
+    gs_quat rotation;               // Zero quat is treated as identity
+    gs_vec3 linear_velocity;
+    gs_vec3 angular_velocity;
+    float mass;                     // Dynamic only, 0 defaults to 1
+    float gravity_scale;            // 0 defaults to 1 (set on body afterwards to disable gravity)
+    float linear_damping;
+    float angular_damping;
+    uint32_t flags;                 // GS_RIGID_BODY_STATE_ALLOW_SLEEP, GS_RIGID_BODY_STATE_LOCK_AXIS_*
+    gs_collision_shape_t shape;
+    void* user_data;
 } gs_rigid_body_desc_t;
 
-/* Collision Shape */
-
-typedef struct gs_collision_shape_t {
-    EMPTY_VAR();
-} gs_collision_shape_t;
-
-typedef struct gs_contact_constraint_t {
-    EMPTY_VAR();
-} gs_contact_constraint_t;
+GS_API_DECL void gs_rigid_body_apply_force(gs_rigid_body_t* body, gs_vec3 force);
+GS_API_DECL void gs_rigid_body_apply_impulse(gs_rigid_body_t* body, gs_vec3 impulse, gs_vec3 point);
+GS_API_DECL void gs_rigid_body_set_awake(gs_rigid_body_t* body, bool32_t awake);
 
 typedef struct gs_raycast_data_t {
-    EMPTY_VAR();
+    bool32_t hit;
+    uint32_t body;
+    float fraction;                 // Along ray length
+    gs_vec3 point;
+    gs_vec3 normal;
 } gs_raycast_data_t;
 
 // The listener is used to gather information about two shapes colliding. Physics objects created in these callbacks
@@ -453,33 +648,52 @@ typedef struct gs_contact_listener_t {
     void (* end_contact)(const gs_contact_constraint_t*);
 } gs_contact_listener_t;
 
+// Return false from report_shape to skip shape in query
 typedef struct gs_query_callback_t {
     bool (* report_shape)(gs_collision_shape_t* shape);
 } gs_query_callback_t;
 
 // Contact Manager
 typedef struct gs_physics_contact_manager_t {
-    EMPTY_VAR();
+    gs_contact_constraint_t* contacts;     // All pairs with overlapping fat AABBs
+    uint32_t contact_count;
+    gs_contact_listener_t listener;
 } gs_physics_contact_manager_t;
 
 /* Physics Scene */
 
+typedef struct gs_physics_scene_stats_t {
+    uint32_t bodies;
+    uint32_t awake_bodies;
+    uint32_t islands;
+    uint32_t pairs;                 // Broadphase pairs (contact constraints)
+    uint32_t touching;              // Pairs with manifold points
+    uint32_t narrowphase_tests;
+} gs_physics_scene_stats_t;
+
 typedef struct gs_physics_scene_t {
     gs_physics_contact_manager_t contact_manager;
-    gs_paged_allocator_t paged_allocator;
-    gs_stack_allocator_t stack_allocator;
+    gs_paged_allocator_t paged_allocator;  // Contact constraints
+    gs_stack_allocator_t stack_allocator;  // Per step island scratch
     gs_heap_allocator_t  heap_allocator;
     gs_vec3 gravity;
     float delta_time;
     uint32_t iterations;    
+    gs_slot_array(gs_rigid_body_t) bodies;
+    gs_aabb_tree_t broadphase;
+    gs_dyn_array(uint32_t) move_buffer;
+    gs_physics_scene_stats_t stats;
 } gs_physics_scene_t;
 
 GS_API_DECL gs_physics_scene_t gs_physics_scene_new();
+GS_API_DECL void               gs_physics_scene_free(gs_physics_scene_t* scene);
 GS_API_DECL void               gs_physics_scene_step(gs_physics_scene_t* scene);
 GS_API_DECL uint32_t           gs_physics_scene_create_body(gs_physics_scene_t* scene, gs_rigid_body_desc_t* desc);
+GS_API_DECL gs_rigid_body_t*   gs_physics_scene_get_body(gs_physics_scene_t* scene, uint32_t id);
+GS_API_DECL void               gs_physics_scene_set_transform(gs_physics_scene_t* scene, uint32_t id, gs_vec3 position, gs_quat rotation);
 GS_API_DECL void               gs_physics_scene_destroy_body(gs_physics_scene_t* scene, uint32_t id);
 GS_API_DECL void               gs_physics_scene_destroy_all_bodies(gs_physics_scene_t* scene);
-GS_API_DECL gs_raycast_data_t  gs_physics_scene_raycast(gs_physics_scene_t* scene, gs_query_callback_t* cb);
+GS_API_DECL gs_raycast_data_t  gs_physics_scene_raycast(gs_physics_scene_t* scene, const gs_ray_t* ray, gs_query_callback_t* cb);
 
 /*
     Scene
@@ -501,6 +715,20 @@ GS_API_DECL gs_raycast_data_t  gs_physics_scene_raycast(gs_physics_scene_t* scen
     #include "../external/ccd/libccd.c"
 #endif
 
+// SIMD lanes for batched shape tests (define GS_PHYSICS_NO_SIMD to force scalar path)
+#ifndef GS_PHYSICS_NO_SIMD
+    #if (defined __AVX__)
+        #define GS_PHYSICS_SIMD_AVX
+        #include <immintrin.h>
+    #elif (defined __SSE2__ || defined _M_X64 || (defined _M_IX86_FP && _M_IX86_FP >= 2))
+        #define GS_PHYSICS_SIMD_SSE
+        #include <emmintrin.h>
+    #elif (defined __aarch64__ || defined _M_ARM64)
+        #define GS_PHYSICS_SIMD_NEON
+        #include <arm_neon.h>
+    #endif
+#endif
+
 /*==== Support Functions =====*/
 
 // Poly
@@ -578,7 +806,8 @@ GS_API_DECL void gs_support_aabb(const void* _o, const gs_vqs* xform, const gs_v
     const float hx = (a->max.x - a->min.x) * 0.5f * xform->scale.x;
     const float hy = (a->max.y - a->min.y) * 0.5f * xform->scale.y;
     const float hz = (a->max.z - a->min.z) * 0.5f * xform->scale.z;
-    gs_vec3 s = gs_vec3_sign(d);
+    // Always return a vertex, face centers degenerate the gjk simplex
+    gs_vec3 s = gs_v3(d.x < 0.f ? -1.f : 1.f, d.y < 0.f ? -1.f : 1.f, d.z < 0.f ? -1.f : 1.f);
 
     // Compure support for aabb
     *out = gs_v3(s.x * hx, s.y * hy, s.z * hz);
@@ -796,6 +1025,618 @@ GS_API_DECL int32_t gs_plane_vs_sphere(const gs_plane_t* a, gs_vqs* xform_a, con
 
 /* Hit */
 
+/* Closed Form */
+
+// Shape placement follows the support functions above, so both paths agree on where a shape is
+
+gs_force_inline
+void _gs_sphere_world(const gs_sphere_t* s, const gs_vqs* xform, gs_vec3* c, float* r)
+{
+    if (!xform) { *c = s->c; *r = s->r; return; }
+    *c = gs_vec3_add(xform->position, s->c);
+    *r = s->r * gs_max(xform->scale.x, gs_max(xform->scale.z, xform->scale.y));
+}
+
+// Aabb is centered on its transform, its extents scaled and rotated into an oriented box
+gs_force_inline
+void _gs_aabb_world(const gs_aabb_t* a, const gs_vqs* xform, gs_vec3* c, gs_vec3* u, gs_vec3* h)
+{
+    *h = gs_vec3_scale(gs_vec3_sub(a->max, a->min), 0.5f);
+    if (!xform) {
+        *c = gs_v3s(0.f);
+        u[0] = GS_XAXIS; u[1] = GS_YAXIS; u[2] = GS_ZAXIS;
+        return;
+    }
+    *c = xform->position;
+    *h = gs_vec3_mul(*h, xform->scale);
+    u[0] = gs_quat_rotate(xform->rotation, GS_XAXIS);
+    u[1] = gs_quat_rotate(xform->rotation, GS_YAXIS);
+    u[2] = gs_quat_rotate(xform->rotation, GS_ZAXIS);
+}
+
+// Capsule as segment p0->p1 swept by radius
+gs_force_inline
+void _gs_capsule_world(const gs_capsule_t* c, const gs_vqs* xform, gs_vec3* p0, gs_vec3* p1, float* r)
+{
+    gs_vqs x = xform ? *xform : gs_vqs_default();
+    gs_vec3 o = gs_vec3_add(x.position, c->base);
+    gs_vec3 axis = gs_vec3_scale(gs_quat_rotate(x.rotation, GS_YAXIS), c->height * 0.5f * x.scale.y);
+    *p0 = gs_vec3_sub(o, axis);
+    *p1 = gs_vec3_add(o, axis);
+    *r = c->r * gs_max(x.scale.x, x.scale.z);
+}
+
+gs_force_inline
+void _gs_ray_world(const gs_ray_t* r, const gs_vqs* xform, gs_vec3* p0, gs_vec3* p1)
+{
+    *p0 = r->p;
+    *p1 = gs_vec3_add(r->p, gs_vec3_scale(r->d, r->len));
+    if (xform) {
+        *p0 = gs_vec3_add(xform->position, gs_vec3_mul(xform->scale, gs_quat_rotate(xform->rotation, *p0)));
+        *p1 = gs_vec3_add(xform->position, gs_vec3_mul(xform->scale, gs_quat_rotate(xform->rotation, *p1)));
+    }
+}
+
+gs_force_inline
+int32_t _gs_contact_result(gs_contact_info_t* res, gs_vec3 n, float depth, gs_vec3 point)
+{
+    if (res) {
+        res->hit = true;
+        res->normal = n;
+        res->depth = depth;
+        res->point = point;
+    }
+    return 0;
+}
+
+// Sphere a vs. sphere b, point is halfway between the deepest points
+int32_t _gs_contact_spheres(gs_vec3 ca, float ra, gs_vec3 cb, float rb, gs_contact_info_t* res)
+{
+    gs_vec3 d = gs_vec3_sub(cb, ca);
+    float d2 = gs_vec3_len2(d), rs = ra + rb;
+    if (d2 > rs * rs) return -1;
+    float dist = sqrtf(d2);
+    gs_vec3 n = dist > 1e-6f ? gs_vec3_scale(d, 1.f / dist) : GS_YAXIS;
+    float depth = rs - dist;
+    return _gs_contact_result(res, n, depth, gs_vec3_add(ca, gs_vec3_scale(n, ra - 0.5f * depth)));
+}
+
+// Closest points between segments p0->q0 and p1->q1
+// Modified from: Real-Time Collision Detection (Christer Ericson), 5.1.9
+void _gs_segment_closest_points(gs_vec3 p0, gs_vec3 q0, gs_vec3 p1, gs_vec3 q1, gs_vec3* c0, gs_vec3* c1)
+{
+    const float eps = 1e-12f;
+    gs_vec3 d0 = gs_vec3_sub(q0, p0), d1 = gs_vec3_sub(q1, p1), r = gs_vec3_sub(p0, p1);
+    float a = gs_vec3_dot(d0, d0), e = gs_vec3_dot(d1, d1), f = gs_vec3_dot(d1, r);
+    float s = 0.f, t = 0.f;
+    if (a <= eps && e > eps) {
+        t = gs_clamp(f / e, 0.f, 1.f);
+    }
+    else if (a > eps)
+    {
+        float c = gs_vec3_dot(d0, r);
+        if (e <= eps) {
+            s = gs_clamp(-c / a, 0.f, 1.f);
+        }
+        else
+        {
+            float b = gs_vec3_dot(d0, d1), denom = a * e - b * b;
+            s = denom > eps ? gs_clamp((b * f - c * e) / denom, 0.f, 1.f) : 0.f;
+            t = (b * s + f) / e;
+            if (t < 0.f) { t = 0.f; s = gs_clamp(-c / a, 0.f, 1.f); }
+            else if (t > 1.f) { t = 1.f; s = gs_clamp((b - c) / a, 0.f, 1.f); }
+        }
+    }
+    *c0 = gs_vec3_add(p0, gs_vec3_scale(d0, s));
+    *c1 = gs_vec3_add(p1, gs_vec3_scale(d1, t));
+}
+
+// Overlap of two oriented boxes projected onto axis l, negative when separated
+gs_force_inline
+float _gs_obb_axis_overlap(gs_vec3 l, gs_vec3 t, const gs_vec3* ua, gs_vec3 ha, const gs_vec3* ub, gs_vec3 hb)
+{
+    float ra = fabsf(gs_vec3_dot(ua[0], l)) * ha.x + fabsf(gs_vec3_dot(ua[1], l)) * ha.y + fabsf(gs_vec3_dot(ua[2], l)) * ha.z;
+    float rb = fabsf(gs_vec3_dot(ub[0], l)) * hb.x + fabsf(gs_vec3_dot(ub[1], l)) * hb.y + fabsf(gs_vec3_dot(ub[2], l)) * hb.z;
+    return ra + rb - fabsf(gs_vec3_dot(t, l));
+}
+
+// Box vertex furthest along d, with axis skip (if < 3) left at its center to give the middle of an edge
+gs_force_inline
+gs_vec3 _gs_obb_support(gs_vec3 c, const gs_vec3* u, gs_vec3 h, gs_vec3 d, uint32_t skip)
+{
+    gs_vec3 p = c;
+    for (uint32_t i = 0; i < 3; ++i) {
+        if (i == skip) continue;
+        float s = gs_vec3_dot(d, u[i]) < 0.f ? -h.xyz[i] : h.xyz[i];
+        p = gs_vec3_add(p, gs_vec3_scale(u[i], s));
+    }
+    return p;
+}
+
+/* Sphere */
+
+GS_API_DECL int32_t gs_sphere_vs_sphere(const gs_sphere_t* a, const gs_vqs* xform_a, const gs_sphere_t* b, const gs_vqs* xform_b, gs_contact_info_t* res)
+{
+    gs_vec3 ca, cb; float ra, rb;
+    _gs_sphere_world(a, xform_a, &ca, &ra);
+    _gs_sphere_world(b, xform_b, &cb, &rb);
+    return _gs_contact_spheres(ca, ra, cb, rb, res);
+}
+
+GS_API_DECL int32_t gs_sphere_vs_aabb(const gs_sphere_t* a, const gs_vqs* xform_a, const gs_aabb_t* b, const gs_vqs* xform_b, gs_contact_info_t* res)
+{
+    gs_vec3 cs, cb, u[3], h; float r;
+    _gs_sphere_world(a, xform_a, &cs, &r);
+    _gs_aabb_world(b, xform_b, &cb, u, &h);
+
+    // Sphere center in box space
+    gs_vec3 d = gs_vec3_sub(cs, cb);
+    gs_vec3 l = gs_v3(gs_vec3_dot(d, u[0]), gs_vec3_dot(d, u[1]), gs_vec3_dot(d, u[2]));
+    gs_vec3 q = gs_v3(gs_clamp(l.x, -h.x, h.x), gs_clamp(l.y, -h.y, h.y), gs_clamp(l.z, -h.z, h.z));
+    gs_vec3 e = gs_vec3_sub(l, q);
+    float e2 = gs_vec3_len2(e);
+    if (e2 > r * r) return -1;
+
+    gs_vec3 ln;
+    float depth;
+    if (e2 > 1e-12f)
+    {
+        float dist = sqrtf(e2);
+        ln = gs_vec3_scale(e, -1.f / dist);
+        depth = r - dist;
+    }
+    else
+    {
+        // Center inside box, push out through nearest face
+        uint32_t k = 0;
+        float best = FLT_MAX;
+        for (uint32_t i = 0; i < 3; ++i) {
+            float f = h.xyz[i] - fabsf(l.xyz[i]);
+            if (f < best) { best = f; k = i; }
+        }
+        ln = gs_v3s(0.f);
+        ln.xyz[k] = l.xyz[k] < 0.f ? 1.f : -1.f;
+        q.xyz[k] = -ln.xyz[k] * h.xyz[k];
+        depth = r + best;
+    }
+
+    gs_vec3 n = gs_vec3_add(gs_vec3_add(gs_vec3_scale(u[0], ln.x), gs_vec3_scale(u[1], ln.y)), gs_vec3_scale(u[2], ln.z));
+    gs_vec3 wq = gs_vec3_add(gs_vec3_add(cb, gs_vec3_scale(u[0], q.x)), gs_vec3_add(gs_vec3_scale(u[1], q.y), gs_vec3_scale(u[2], q.z)));
+    return _gs_contact_result(res, n, depth, gs_vec3_add(wq, gs_vec3_scale(n, 0.5f * depth)));
+}
+
+GS_API_DECL int32_t gs_sphere_vs_capsule(const gs_sphere_t* a, const gs_vqs* xform_a, const gs_capsule_t* b, const gs_vqs* xform_b, gs_contact_info_t* res)
+{
+    gs_vec3 cs, p0, p1; float rs, rc;
+    _gs_sphere_world(a, xform_a, &cs, &rs);
+    _gs_capsule_world(b, xform_b, &p0, &p1, &rc);
+    gs_vec3 q, p;
+    _gs_segment_closest_points(cs, cs, p0, p1, &q, &p);
+    return _gs_contact_spheres(cs, rs, p, rc, res);
+}
+
+// First entry of segment p0->p1 into sphere, as fraction of segment, or -1 on miss
+float _gs_segment_vs_sphere(gs_vec3 p0, gs_vec3 p1, gs_vec3 c, float r)
+{
+    gs_vec3 d = gs_vec3_sub(p1, p0), m = gs_vec3_sub(p0, c);
+    float a = gs_vec3_dot(d, d), b = gs_vec3_dot(m, d), cc = gs_vec3_dot(m, m) - r * r;
+    if (cc <= 0.f) return 0.f;
+    if (b > 0.f || a <= 0.f) return -1.f;
+    float disc = b * b - a * cc;
+    if (disc < 0.f) return -1.f;
+    float t = (-b - sqrtf(disc)) / a;
+    return t <= 1.f ? t : -1.f;
+}
+
+GS_API_DECL int32_t gs_sphere_vs_ray(const gs_sphere_t* a, const gs_vqs* xform_a, const gs_ray_t* b, const gs_vqs* xform_b, gs_contact_info_t* res)
+{
+    gs_vec3 c, p0, p1; float r;
+    _gs_sphere_world(a, xform_a, &c, &r);
+    _gs_ray_world(b, xform_b, &p0, &p1);
+    float t = _gs_segment_vs_sphere(p0, p1, c, r);
+    if (t < 0.f) return -1;
+    gs_vec3 d = gs_vec3_sub(p1, p0), p = gs_vec3_add(p0, gs_vec3_scale(d, t));
+    gs_vec3 n = gs_vec3_sub(p, c);
+    n = gs_vec3_len2(n) > 1e-12f ? gs_vec3_norm(n) : GS_YAXIS;
+    return _gs_contact_result(res, n, t * gs_vec3_len(d), p);
+}
+
+/* AABB */
+
+// Separating axis test over the 3 + 3 face axes and 9 edge axes
+// Modified from: Real-Time Collision Detection (Christer Ericson), 4.4.1
+GS_API_DECL int32_t gs_aabb_vs_aabb(const gs_aabb_t* a, const gs_vqs* xform_a, const gs_aabb_t* b, const gs_vqs* xform_b, gs_contact_info_t* res)
+{
+    gs_vec3 ca, ua[3], ha, cb, ub[3], hb;
+    _gs_aabb_world(a, xform_a, &ca, ua, &ha);
+    _gs_aabb_world(b, xform_b, &cb, ub, &hb);
+    gs_vec3 t = gs_vec3_sub(cb, ca);
+
+    float best = FLT_MAX;
+    gs_vec3 n = GS_YAXIS;
+    int32_t axis = 0;   // 0-2 faces of a, 3-5 faces of b, 6-14 edge pairs
+    for (int32_t i = 0; i < 6; ++i)
+    {
+        gs_vec3 l = i < 3 ? ua[i] : ub[i - 3];
+        float o = _gs_obb_axis_overlap(l, t, ua, ha, ub, hb);
+        if (o < 0.f) return -1;
+        if (i < 3 ? o < best : o < 0.98f * best - 0.001f) { best = o; n = l; axis = i; }
+    }
+
+    // Faces of b and edge axes only win when clearly shallower, so resting boxes keep a stable normal
+    const float face = best;
+    for (int32_t i = 0; i < 3; ++i)
+    {
+        for (int32_t j = 0; j < 3; ++j)
+        {
+            gs_vec3 l = gs_vec3_cross(ua[i], ub[j]);
+            float l2 = gs_vec3_len2(l);
+            if (l2 < 1e-6f) continue;
+            l = gs_vec3_scale(l, 1.f / sqrtf(l2));
+            float o = _gs_obb_axis_overlap(l, t, ua, ha, ub, hb);
+            if (o < 0.f) return -1;
+            if (o < best && o < 0.95f * face - 0.01f) { best = o; n = l; axis = 6 + i * 3 + j; }
+        }
+    }
+    if (gs_vec3_dot(t, n) < 0.f) n = gs_vec3_neg(n);
+    if (!res) return 0;
+
+    // Deepest vertex of the incident box, or closest points of the two edges
+    gs_vec3 p;
+    if (axis < 3) {
+        p = gs_vec3_add(_gs_obb_support(cb, ub, hb, gs_vec3_neg(n), 3), gs_vec3_scale(n, 0.5f * best));
+    }
+    else if (axis < 6) {
+        p = gs_vec3_sub(_gs_obb_support(ca, ua, ha, n, 3), gs_vec3_scale(n, 0.5f * best));
+    }
+    else
+    {
+        uint32_t i = (axis - 6) / 3, j = (axis - 6) % 3;
+        gs_vec3 ea = _gs_obb_support(ca, ua, ha, n, i), eb = _gs_obb_support(cb, ub, hb, gs_vec3_neg(n), j);
+        gs_vec3 da = gs_vec3_scale(ua[i], ha.xyz[i]), db = gs_vec3_scale(ub[j], hb.xyz[j]);
+        gs_vec3 pa, pb;
+        _gs_segment_closest_points(gs_vec3_sub(ea, da), gs_vec3_add(ea, da), gs_vec3_sub(eb, db), gs_vec3_add(eb, db), &pa, &pb);
+        p = gs_vec3_scale(gs_vec3_add(pa, pb), 0.5f);
+    }
+    return _gs_contact_result(res, n, best, p);
+}
+
+GS_API_DECL int32_t gs_aabb_vs_sphere(const gs_aabb_t* a, const gs_vqs* xform_a, const gs_sphere_t* b, const gs_vqs* xform_b, gs_contact_info_t* res)
+{
+    int32_t r = gs_sphere_vs_aabb(b, xform_b, a, xform_a, res);
+    if (r == 0 && res) res->normal = gs_vec3_neg(res->normal);
+    return r;
+}
+
+GS_API_DECL int32_t gs_aabb_vs_ray(const gs_aabb_t* a, const gs_vqs* xform_a, const gs_ray_t* b, const gs_vqs* xform_b, gs_contact_info_t* res)
+{
+    gs_vec3 c, u[3], h, p0, p1;
+    _gs_aabb_world(a, xform_a, &c, u, &h);
+    _gs_ray_world(b, xform_b, &p0, &p1);
+
+    // Slab test in box space, over segment fraction [0, 1]
+    gs_vec3 o = gs_vec3_sub(p0, c), d = gs_vec3_sub(p1, p0);
+    float t0 = 0.f, t1 = 1.f;
+    uint32_t k = 0;
+    float ks = 1.f;
+    for (uint32_t i = 0; i < 3; ++i)
+    {
+        float lo = gs_vec3_dot(o, u[i]), ld = gs_vec3_dot(d, u[i]);
+        if (fabsf(ld) < 1e-12f) {
+            if (lo < -h.xyz[i] || lo > h.xyz[i]) return -1;
+            continue;
+        }
+        float tn = (-h.xyz[i] - lo) / ld, tf = (h.xyz[i] - lo) / ld;
+        float s = -1.f;
+        if (tn > tf) { float tmp = tn; tn = tf; tf = tmp; s = 1.f; }
+        if (tn > t0) { t0 = tn; k = i; ks = s; }
+        t1 = gs_min(t1, tf);
+        if (t0 > t1) return -1;
+    }
+
+    // Origin inside box, report nearest face
+    if (t0 == 0.f)
+    {
+        float best = FLT_MAX;
+        for (uint32_t i = 0; i < 3; ++i) {
+            float lo = gs_vec3_dot(o, u[i]), f = h.xyz[i] - fabsf(lo);
+            if (f < best) { best = f; k = i; ks = lo < 0.f ? -1.f : 1.f; }
+        }
+    }
+    gs_vec3 p = gs_vec3_add(p0, gs_vec3_scale(d, t0));
+    return _gs_contact_result(res, gs_vec3_scale(u[k], ks), t0 * gs_vec3_len(d), p);
+}
+
+/* Capsule */
+
+GS_API_DECL int32_t gs_capsule_vs_sphere(const gs_capsule_t* a, const gs_vqs* xform_a, const gs_sphere_t* b, const gs_vqs* xform_b, gs_contact_info_t* res)
+{
+    int32_t r = gs_sphere_vs_capsule(b, xform_b, a, xform_a, res);
+    if (r == 0 && res) res->normal = gs_vec3_neg(res->normal);
+    return r;
+}
+
+GS_API_DECL int32_t gs_capsule_vs_capsule(const gs_capsule_t* a, const gs_vqs* xform_a, const gs_capsule_t* b, const gs_vqs* xform_b, gs_contact_info_t* res)
+{
+    gs_vec3 a0, a1, b0, b1, pa, pb; float ra, rb;
+    _gs_capsule_world(a, xform_a, &a0, &a1, &ra);
+    _gs_capsule_world(b, xform_b, &b0, &b1, &rb);
+    _gs_segment_closest_points(a0, a1, b0, b1, &pa, &pb);
+    return _gs_contact_spheres(pa, ra, pb, rb, res);
+}
+
+GS_API_DECL int32_t gs_capsule_vs_ray(const gs_capsule_t* a, const gs_vqs* xform_a, const gs_ray_t* b, const gs_vqs* xform_b, gs_contact_info_t* res)
+{
+    gs_vec3 c0, c1, p0, p1; float r;
+    _gs_capsule_world(a, xform_a, &c0, &c1, &r);
+    _gs_ray_world(b, xform_b, &p0, &p1);
+    gs_vec3 d = gs_vec3_sub(p1, p0), axis = gs_vec3_sub(c1, c0);
+    float h2 = gs_vec3_len2(axis);
+
+    // Nearest of the two end caps and the cylinder body
+    float t = _gs_segment_vs_sphere(p0, p1, c0, r), tc = _gs_segment_vs_sphere(p0, p1, c1, r);
+    if (tc >= 0.f && (t < 0.f || tc < t)) t = tc;
+    if (h2 > 1e-12f)
+    {
+        // Project out capsule axis, leaving a 2D circle test
+        gs_vec3 an = gs_vec3_scale(axis, 1.f / sqrtf(h2));
+        gs_vec3 m = gs_vec3_sub(p0, c0);
+        gs_vec3 dp = gs_vec3_sub(d, gs_vec3_scale(an, gs_vec3_dot(d, an)));
+        gs_vec3 mp = gs_vec3_sub(m, gs_vec3_scale(an, gs_vec3_dot(m, an)));
+        float qa = gs_vec3_dot(dp, dp), qb = gs_vec3_dot(mp, dp), qc = gs_vec3_dot(mp, mp) - r * r;
+        float disc = qb * qb - qa * qc;
+        if (qa > 1e-12f && disc >= 0.f)
+        {
+            float tb = gs_max((-qb - sqrtf(disc)) / qa, 0.f);
+            float y = gs_vec3_dot(gs_vec3_add(m, gs_vec3_scale(d, tb)), an);
+            bool32_t ahead = (-qb + sqrtf(disc)) >= 0.f;
+            if (ahead && tb <= 1.f && y >= 0.f && y * y <= h2 && (t < 0.f || tb < t)) t = tb;
+        }
+    }
+    if (t < 0.f) return -1;
+
+    gs_vec3 p = gs_vec3_add(p0, gs_vec3_scale(d, t));
+    gs_line_t seg = gs_line(c0, c1);
+    gs_vec3 n = gs_vec3_sub(p, h2 > 1e-12f ? gs_line_closest_point(&seg, p) : c0);
+    n = gs_vec3_len2(n) > 1e-12f ? gs_vec3_norm(n) : GS_YAXIS;
+    return _gs_contact_result(res, n, t * gs_vec3_len(d), p);
+}
+
+/* Batched (SoA) */
+
+#if (defined GS_PHYSICS_SIMD_AVX)
+    #define _GS_PHYSICS_SIMD_WIDTH  8
+    typedef __m256 _gs_physics_vf_t;
+    #define _gs_vf_load(P)          _mm256_loadu_ps(P)
+    #define _gs_vf_store(P, A)      _mm256_storeu_ps(P, A)
+    #define _gs_vf_set1(S)          _mm256_set1_ps(S)
+    #define _gs_vf_add(A, B)        _mm256_add_ps(A, B)
+    #define _gs_vf_sub(A, B)        _mm256_sub_ps(A, B)
+    #define _gs_vf_mul(A, B)        _mm256_mul_ps(A, B)
+    #define _gs_vf_min(A, B)        _mm256_min_ps(A, B)
+    #define _gs_vf_max(A, B)        _mm256_max_ps(A, B)
+    #define _gs_vf_sqrt(A)          _mm256_sqrt_ps(A)
+    #define _gs_vf_le(A, B)         _mm256_cmp_ps(A, B, _CMP_LE_OQ)
+    #define _gs_vf_and(A, B)        _mm256_and_ps(A, B)
+    #define _gs_vf_mask(A)          (uint32_t)_mm256_movemask_ps(A)
+#elif (defined GS_PHYSICS_SIMD_SSE)
+    #define _GS_PHYSICS_SIMD_WIDTH  4
+    typedef __m128 _gs_physics_vf_t;
+    #define _gs_vf_load(P)          _mm_loadu_ps(P)
+    #define _gs_vf_store(P, A)      _mm_storeu_ps(P, A)
+    #define _gs_vf_set1(S)          _mm_set1_ps(S)
+    #define _gs_vf_add(A, B)        _mm_add_ps(A, B)
+    #define _gs_vf_sub(A, B)        _mm_sub_ps(A, B)
+    #define _gs_vf_mul(A, B)        _mm_mul_ps(A, B)
+    #define _gs_vf_min(A, B)        _mm_min_ps(A, B)
+    #define _gs_vf_max(A, B)        _mm_max_ps(A, B)
+    #define _gs_vf_sqrt(A)          _mm_sqrt_ps(A)
+    #define _gs_vf_le(A, B)         _mm_cmple_ps(A, B)
+    #define _gs_vf_and(A, B)        _mm_and_ps(A, B)
+    #define _gs_vf_mask(A)          (uint32_t)_mm_movemask_ps(A)
+#elif (defined GS_PHYSICS_SIMD_NEON)
+    #define _GS_PHYSICS_SIMD_WIDTH  4
+    typedef float32x4_t _gs_physics_vf_t;
+    #define _gs_vf_load(P)          vld1q_f32(P)
+    #define _gs_vf_store(P, A)      vst1q_f32(P, A)
+    #define _gs_vf_set1(S)          vdupq_n_f32(S)
+    #define _gs_vf_add(A, B)        vaddq_f32(A, B)
+    #define _gs_vf_sub(A, B)        vsubq_f32(A, B)
+    #define _gs_vf_mul(A, B)        vmulq_f32(A, B)
+    #define _gs_vf_min(A, B)        vminq_f32(A, B)
+    #define _gs_vf_max(A, B)        vmaxq_f32(A, B)
+    #define _gs_vf_sqrt(A)          vsqrtq_f32(A)
+    #define _gs_vf_le(A, B)         vreinterpretq_f32_u32(vcleq_f32(A, B))
+    #define _gs_vf_and(A, B)        vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(A), vreinterpretq_u32_f32(B)))
+
+    gs_force_inline
+    uint32_t _gs_vf_mask(_gs_physics_vf_t m)
+    {
+        uint32x4_t u = vshrq_n_u32(vreinterpretq_u32_f32(m), 31);
+        return vgetq_lane_u32(u, 0) | (vgetq_lane_u32(u, 1) << 1) | (vgetq_lane_u32(u, 2) << 2) | (vgetq_lane_u32(u, 3) << 3);
+    }
+#endif
+
+// Append lane indices set in mask, optionally with their lane values
+gs_force_inline
+uint32_t _gs_physics_batch_emit(uint32_t mask, uint32_t base, uint32_t* hits, uint32_t n, const float* lt, float* t)
+{
+    for (uint32_t l = 0; mask; ++l, mask >>= 1) {
+        if (!(mask & 1)) continue;
+        if (t) t[n] = lt[l];
+        hits[n++] = base + l;
+    }
+    return n;
+}
+
+// Ray vs. world aabb slab, t in units of ray d. Zero direction components use a huge finite inverse so
+// lanes stay NaN free.
+gs_force_inline
+gs_vec3 _gs_ray_inv_dir(gs_vec3 d)
+{
+    gs_vec3 r;
+    for (uint32_t i = 0; i < 3; ++i) {
+        r.xyz[i] = fabsf(d.xyz[i]) > 1e-12f ? 1.f / d.xyz[i] : (d.xyz[i] < 0.f ? -1e12f : 1e12f);
+    }
+    return r;
+}
+
+GS_API_DECL uint32_t gs_sphere_vs_sphere_batch(const gs_sphere_t* a, const gs_vqs* xform_a, const gs_sphere_soa_t* b, uint32_t* hits)
+{
+    gs_vec3 c; float r;
+    _gs_sphere_world(a, xform_a, &c, &r);
+    uint32_t i = 0, n = 0;
+#ifdef _GS_PHYSICS_SIMD_WIDTH
+    const _gs_physics_vf_t cx = _gs_vf_set1(c.x), cy = _gs_vf_set1(c.y), cz = _gs_vf_set1(c.z), ra = _gs_vf_set1(r);
+    for (; i + _GS_PHYSICS_SIMD_WIDTH <= b->count; i += _GS_PHYSICS_SIMD_WIDTH)
+    {
+        _gs_physics_vf_t dx = _gs_vf_sub(_gs_vf_load(b->x + i), cx);
+        _gs_physics_vf_t dy = _gs_vf_sub(_gs_vf_load(b->y + i), cy);
+        _gs_physics_vf_t dz = _gs_vf_sub(_gs_vf_load(b->z + i), cz);
+        _gs_physics_vf_t rs = _gs_vf_add(_gs_vf_load(b->r + i), ra);
+        _gs_physics_vf_t d2 = _gs_vf_add(_gs_vf_add(_gs_vf_mul(dx, dx), _gs_vf_mul(dy, dy)), _gs_vf_mul(dz, dz));
+        n = _gs_physics_batch_emit(_gs_vf_mask(_gs_vf_le(d2, _gs_vf_mul(rs, rs))), i, hits, n, NULL, NULL);
+    }
+#endif
+    for (; i < b->count; ++i)
+    {
+        float dx = b->x[i] - c.x, dy = b->y[i] - c.y, dz = b->z[i] - c.z, rs = b->r[i] + r;
+        if (dx * dx + dy * dy + dz * dz <= rs * rs) hits[n++] = i;
+    }
+    return n;
+}
+
+GS_API_DECL uint32_t gs_sphere_vs_aabb_batch(const gs_sphere_t* a, const gs_vqs* xform_a, const gs_aabb_soa_t* b, uint32_t* hits)
+{
+    gs_vec3 c; float r;
+    _gs_sphere_world(a, xform_a, &c, &r);
+    uint32_t i = 0, n = 0;
+#ifdef _GS_PHYSICS_SIMD_WIDTH
+    const _gs_physics_vf_t cx = _gs_vf_set1(c.x), cy = _gs_vf_set1(c.y), cz = _gs_vf_set1(c.z);
+    const _gs_physics_vf_t r2 = _gs_vf_set1(r * r), zero = _gs_vf_set1(0.f);
+    for (; i + _GS_PHYSICS_SIMD_WIDTH <= b->count; i += _GS_PHYSICS_SIMD_WIDTH)
+    {
+        // Distance from center to box along each axis (0 inside slab)
+        _gs_physics_vf_t dx = _gs_vf_add(_gs_vf_max(_gs_vf_sub(_gs_vf_load(b->min_x + i), cx), zero), _gs_vf_max(_gs_vf_sub(cx, _gs_vf_load(b->max_x + i)), zero));
+        _gs_physics_vf_t dy = _gs_vf_add(_gs_vf_max(_gs_vf_sub(_gs_vf_load(b->min_y + i), cy), zero), _gs_vf_max(_gs_vf_sub(cy, _gs_vf_load(b->max_y + i)), zero));
+        _gs_physics_vf_t dz = _gs_vf_add(_gs_vf_max(_gs_vf_sub(_gs_vf_load(b->min_z + i), cz), zero), _gs_vf_max(_gs_vf_sub(cz, _gs_vf_load(b->max_z + i)), zero));
+        _gs_physics_vf_t d2 = _gs_vf_add(_gs_vf_add(_gs_vf_mul(dx, dx), _gs_vf_mul(dy, dy)), _gs_vf_mul(dz, dz));
+        n = _gs_physics_batch_emit(_gs_vf_mask(_gs_vf_le(d2, r2)), i, hits, n, NULL, NULL);
+    }
+#endif
+    for (; i < b->count; ++i)
+    {
+        float dx = gs_max(b->min_x[i] - c.x, 0.f) + gs_max(c.x - b->max_x[i], 0.f);
+        float dy = gs_max(b->min_y[i] - c.y, 0.f) + gs_max(c.y - b->max_y[i], 0.f);
+        float dz = gs_max(b->min_z[i] - c.z, 0.f) + gs_max(c.z - b->max_z[i], 0.f);
+        if (dx * dx + dy * dy + dz * dz <= r * r) hits[n++] = i;
+    }
+    return n;
+}
+
+GS_API_DECL uint32_t gs_aabb_vs_aabb_batch(const gs_aabb_t* a, const gs_aabb_soa_t* b, uint32_t* hits)
+{
+    uint32_t i = 0, n = 0;
+#ifdef _GS_PHYSICS_SIMD_WIDTH
+    const _gs_physics_vf_t nx = _gs_vf_set1(a->min.x), ny = _gs_vf_set1(a->min.y), nz = _gs_vf_set1(a->min.z);
+    const _gs_physics_vf_t xx = _gs_vf_set1(a->max.x), xy = _gs_vf_set1(a->max.y), xz = _gs_vf_set1(a->max.z);
+    for (; i + _GS_PHYSICS_SIMD_WIDTH <= b->count; i += _GS_PHYSICS_SIMD_WIDTH)
+    {
+        _gs_physics_vf_t mx = _gs_vf_and(_gs_vf_le(nx, _gs_vf_load(b->max_x + i)), _gs_vf_le(_gs_vf_load(b->min_x + i), xx));
+        _gs_physics_vf_t my = _gs_vf_and(_gs_vf_le(ny, _gs_vf_load(b->max_y + i)), _gs_vf_le(_gs_vf_load(b->min_y + i), xy));
+        _gs_physics_vf_t mz = _gs_vf_and(_gs_vf_le(nz, _gs_vf_load(b->max_z + i)), _gs_vf_le(_gs_vf_load(b->min_z + i), xz));
+        n = _gs_physics_batch_emit(_gs_vf_mask(_gs_vf_and(_gs_vf_and(mx, my), mz)), i, hits, n, NULL, NULL);
+    }
+#endif
+    for (; i < b->count; ++i)
+    {
+        if (a->min.x <= b->max_x[i] && b->min_x[i] <= a->max.x &&
+            a->min.y <= b->max_y[i] && b->min_y[i] <= a->max.y &&
+            a->min.z <= b->max_z[i] && b->min_z[i] <= a->max.z) hits[n++] = i;
+    }
+    return n;
+}
+
+GS_API_DECL uint32_t gs_ray_vs_sphere_batch(const gs_ray_t* a, const gs_sphere_soa_t* b, uint32_t* hits, float* t)
+{
+    const gs_vec3 p = a->p, d = a->d;
+    const float dd = gs_vec3_dot(d, d);
+    if (dd <= 0.f) return 0;
+    const float inv = 1.f / dd;
+    uint32_t i = 0, n = 0;
+#ifdef _GS_PHYSICS_SIMD_WIDTH
+    const _gs_physics_vf_t px = _gs_vf_set1(p.x), py = _gs_vf_set1(p.y), pz = _gs_vf_set1(p.z);
+    const _gs_physics_vf_t vx = _gs_vf_set1(d.x), vy = _gs_vf_set1(d.y), vz = _gs_vf_set1(d.z);
+    const _gs_physics_vf_t va = _gs_vf_set1(dd), vinv = _gs_vf_set1(inv), vlen = _gs_vf_set1(a->len), zero = _gs_vf_set1(0.f);
+    float lt[_GS_PHYSICS_SIMD_WIDTH];
+    for (; i + _GS_PHYSICS_SIMD_WIDTH <= b->count; i += _GS_PHYSICS_SIMD_WIDTH)
+    {
+        _gs_physics_vf_t mx = _gs_vf_sub(px, _gs_vf_load(b->x + i));
+        _gs_physics_vf_t my = _gs_vf_sub(py, _gs_vf_load(b->y + i));
+        _gs_physics_vf_t mz = _gs_vf_sub(pz, _gs_vf_load(b->z + i));
+        _gs_physics_vf_t r = _gs_vf_load(b->r + i);
+        _gs_physics_vf_t qb = _gs_vf_add(_gs_vf_add(_gs_vf_mul(mx, vx), _gs_vf_mul(my, vy)), _gs_vf_mul(mz, vz));
+        _gs_physics_vf_t qc = _gs_vf_sub(_gs_vf_add(_gs_vf_add(_gs_vf_mul(mx, mx), _gs_vf_mul(my, my)), _gs_vf_mul(mz, mz)), _gs_vf_mul(r, r));
+        _gs_physics_vf_t disc = _gs_vf_sub(_gs_vf_mul(qb, qb), _gs_vf_mul(va, qc));
+        _gs_physics_vf_t sq = _gs_vf_sqrt(_gs_vf_max(disc, zero));
+        _gs_physics_vf_t t0 = _gs_vf_mul(_gs_vf_sub(_gs_vf_sub(zero, qb), sq), vinv);
+        _gs_physics_vf_t t1 = _gs_vf_mul(_gs_vf_add(_gs_vf_sub(zero, qb), sq), vinv);
+        _gs_physics_vf_t m = _gs_vf_and(_gs_vf_and(_gs_vf_le(zero, disc), _gs_vf_le(zero, t1)), _gs_vf_le(t0, vlen));
+        _gs_vf_store(lt, _gs_vf_max(t0, zero));
+        n = _gs_physics_batch_emit(_gs_vf_mask(m), i, hits, n, lt, t);
+    }
+#endif
+    for (; i < b->count; ++i)
+    {
+        float mx = p.x - b->x[i], my = p.y - b->y[i], mz = p.z - b->z[i];
+        float qb = mx * d.x + my * d.y + mz * d.z;
+        float qc = mx * mx + my * my + mz * mz - b->r[i] * b->r[i];
+        float disc = qb * qb - dd * qc;
+        if (disc < 0.f) continue;
+        float sq = sqrtf(disc), t0 = (-qb - sq) * inv, t1 = (-qb + sq) * inv;
+        if (t1 < 0.f || t0 > a->len) continue;
+        if (t) t[n] = gs_max(t0, 0.f);
+        hits[n++] = i;
+    }
+    return n;
+}
+
+GS_API_DECL uint32_t gs_ray_vs_aabb_batch(const gs_ray_t* a, const gs_aabb_soa_t* b, uint32_t* hits, float* t)
+{
+    const gs_vec3 p = a->p, id = _gs_ray_inv_dir(a->d);
+    uint32_t i = 0, n = 0;
+#ifdef _GS_PHYSICS_SIMD_WIDTH
+    const _gs_physics_vf_t px = _gs_vf_set1(p.x), py = _gs_vf_set1(p.y), pz = _gs_vf_set1(p.z);
+    const _gs_physics_vf_t ix = _gs_vf_set1(id.x), iy = _gs_vf_set1(id.y), iz = _gs_vf_set1(id.z);
+    const _gs_physics_vf_t vlen = _gs_vf_set1(a->len), zero = _gs_vf_set1(0.f);
+    float lt[_GS_PHYSICS_SIMD_WIDTH];
+    for (; i + _GS_PHYSICS_SIMD_WIDTH <= b->count; i += _GS_PHYSICS_SIMD_WIDTH)
+    {
+        _gs_physics_vf_t ax = _gs_vf_mul(_gs_vf_sub(_gs_vf_load(b->min_x + i), px), ix), bx = _gs_vf_mul(_gs_vf_sub(_gs_vf_load(b->max_x + i), px), ix);
+        _gs_physics_vf_t ay = _gs_vf_mul(_gs_vf_sub(_gs_vf_load(b->min_y + i), py), iy), by = _gs_vf_mul(_gs_vf_sub(_gs_vf_load(b->max_y + i), py), iy);
+        _gs_physics_vf_t az = _gs_vf_mul(_gs_vf_sub(_gs_vf_load(b->min_z + i), pz), iz), bz = _gs_vf_mul(_gs_vf_sub(_gs_vf_load(b->max_z + i), pz), iz);
+        _gs_physics_vf_t t0 = _gs_vf_max(_gs_vf_max(_gs_vf_min(ax, bx), _gs_vf_min(ay, by)), _gs_vf_max(_gs_vf_min(az, bz), zero));
+        _gs_physics_vf_t t1 = _gs_vf_min(_gs_vf_min(_gs_vf_max(ax, bx), _gs_vf_max(ay, by)), _gs_vf_min(_gs_vf_max(az, bz), vlen));
+        _gs_vf_store(lt, t0);
+        n = _gs_physics_batch_emit(_gs_vf_mask(_gs_vf_le(t0, t1)), i, hits, n, lt, t);
+    }
+#endif
+    for (; i < b->count; ++i)
+    {
+        float ax = (b->min_x[i] - p.x) * id.x, bx = (b->max_x[i] - p.x) * id.x;
+        float ay = (b->min_y[i] - p.y) * id.y, by = (b->max_y[i] - p.y) * id.y;
+        float az = (b->min_z[i] - p.z) * id.z, bz = (b->max_z[i] - p.z) * id.z;
+        float t0 = gs_max(gs_max(gs_min(ax, bx), gs_min(ay, by)), gs_max(gs_min(az, bz), 0.f));
+        float t1 = gs_min(gs_min(gs_max(ax, bx), gs_max(ay, by)), gs_min(gs_max(az, bz), a->len));
+        if (t0 > t1) continue;
+        if (t) t[n] = t0;
+        hits[n++] = i;
+    }
+    return n;
+}
+
+/* GJK */
+
 #define _GS_COLLIDE_FUNC_IMPL(_TA, _TB, _F0, _F1)\
     GS_API_DECL int32_t gs_##_TA##_vs_##_TB(const gs_##_TA##_t* a, const gs_vqs* xa, const gs_##_TB##_t* b, const gs_vqs* xb, gs_contact_info_t* r)\
     {\
@@ -804,32 +1645,22 @@ GS_API_DECL int32_t gs_plane_vs_sphere(const gs_plane_t* a, gs_vqs* xform_a, con
 
 /* Sphere */
 
-_GS_COLLIDE_FUNC_IMPL(sphere, sphere, gs_support_sphere, gs_support_sphere);      // Sphere vs. Sphere 
 _GS_COLLIDE_FUNC_IMPL(sphere, cylinder, gs_support_sphere, gs_support_cylinder);  // Sphere vs. Cylinder
 _GS_COLLIDE_FUNC_IMPL(sphere, cone, gs_support_sphere, gs_support_cone);          // Sphere vs. Cone
-_GS_COLLIDE_FUNC_IMPL(sphere, aabb, gs_support_sphere, gs_support_aabb);          // Sphere vs. AABB
-_GS_COLLIDE_FUNC_IMPL(sphere, capsule, gs_support_sphere, gs_support_capsule);    // Sphere vs. Capsule
 _GS_COLLIDE_FUNC_IMPL(sphere, poly, gs_support_sphere, gs_support_poly);          // Sphere vs. Poly 
-_GS_COLLIDE_FUNC_IMPL(sphere, ray, gs_support_sphere, gs_support_ray);            // Sphere vs. Ray
 /* AABB */
 
-_GS_COLLIDE_FUNC_IMPL(aabb, aabb, gs_support_aabb, gs_support_aabb);          // AABB vs. AABB
 _GS_COLLIDE_FUNC_IMPL(aabb, cylinder, gs_support_aabb, gs_support_cylinder);  // AABB vs. Cylinder
 _GS_COLLIDE_FUNC_IMPL(aabb, cone, gs_support_aabb, gs_support_cone);          // AABB vs. Cone
-_GS_COLLIDE_FUNC_IMPL(aabb, sphere, gs_support_aabb, gs_support_sphere);      // AABB vs. Sphere
 _GS_COLLIDE_FUNC_IMPL(aabb, capsule, gs_support_aabb, gs_support_capsule);    // AABB vs. Capsule
 _GS_COLLIDE_FUNC_IMPL(aabb, poly, gs_support_aabb, gs_support_poly);          // AABB vs. Poly
-_GS_COLLIDE_FUNC_IMPL(aabb, ray, gs_support_aabb, gs_support_ray);            // AABB vs. Ray
 
 /* Capsule */
 
-_GS_COLLIDE_FUNC_IMPL(capsule, capsule, gs_support_capsule, gs_support_capsule);    // Capsule vs. Capsule
 _GS_COLLIDE_FUNC_IMPL(capsule, cylinder, gs_support_capsule, gs_support_cylinder);  // Capsule vs. Cylinder
 _GS_COLLIDE_FUNC_IMPL(capsule, cone, gs_support_capsule, gs_support_cone);          // Capsule vs. Cone
-_GS_COLLIDE_FUNC_IMPL(capsule, sphere, gs_support_capsule, gs_support_sphere);      // Capsule vs. Sphere
 _GS_COLLIDE_FUNC_IMPL(capsule, aabb, gs_support_capsule, gs_support_aabb);          // Capsule vs. AABB
 _GS_COLLIDE_FUNC_IMPL(capsule, poly, gs_support_capsule, gs_support_poly);          // Capsule vs. Poly
-_GS_COLLIDE_FUNC_IMPL(capsule, ray, gs_support_capsule, gs_support_ray);            // Capsule vs. Ray
 
 /* Poly */
 
@@ -1705,6 +2536,1558 @@ GS_API_DECL void _gs_ccd_support_func(const void* _obj, const ccd_vec3_t* _dir,
     }
 }
 
+/*==== Physics System ====*/
+
+/* Dynamic AABB Tree */
+
+// Modified from: Box2D b2_dynamic_tree (Erin Catto)
+
+#define _GS_AABB_TREE_NULL          -1
+#define _GS_AABB_TREE_STACK_SIZE    256
+
+gs_force_inline
+gs_aabb_t _gs_aabb_union(const gs_aabb_t* a, const gs_aabb_t* b)
+{
+    gs_aabb_t r = gs_default_val();
+    r.min = gs_v3(gs_min(a->min.x, b->min.x), gs_min(a->min.y, b->min.y), gs_min(a->min.z, b->min.z));
+    r.max = gs_v3(gs_max(a->max.x, b->max.x), gs_max(a->max.y, b->max.y), gs_max(a->max.z, b->max.z));
+    return r;
+}
+
+// Surface area heuristic cost
+gs_force_inline
+float _gs_aabb_perimeter(const gs_aabb_t* a)
+{
+    float wx = a->max.x - a->min.x, wy = a->max.y - a->min.y, wz = a->max.z - a->min.z;
+    return 2.f * (wx * wy + wy * wz + wz * wx);
+}
+
+GS_API_DECL bool32_t gs_aabb_overlap(const gs_aabb_t* a, const gs_aabb_t* b)
+{
+    return !(a->max.x < b->min.x || a->min.x > b->max.x ||
+             a->max.y < b->min.y || a->min.y > b->max.y ||
+             a->max.z < b->min.z || a->min.z > b->max.z);
+}
+
+GS_API_DECL bool32_t gs_aabb_contains(const gs_aabb_t* a, const gs_aabb_t* b)
+{
+    return a->min.x <= b->min.x && a->min.y <= b->min.y && a->min.z <= b->min.z &&
+           a->max.x >= b->max.x && a->max.y >= b->max.y && a->max.z >= b->max.z;
+}
+
+GS_API_DECL gs_aabb_tree_t gs_aabb_tree_new()
+{
+    gs_aabb_tree_t tree = gs_default_val();
+    tree.root = _GS_AABB_TREE_NULL;
+    tree.free_list = _GS_AABB_TREE_NULL;
+    return tree;
+}
+
+GS_API_DECL void gs_aabb_tree_free(gs_aabb_tree_t* tree)
+{
+    gs_dyn_array_free(tree->nodes);
+    tree->nodes = NULL;
+    tree->root = _GS_AABB_TREE_NULL;
+    tree->free_list = _GS_AABB_TREE_NULL;
+}
+
+int32_t _gs_aabb_tree_alloc_node(gs_aabb_tree_t* tree)
+{
+    int32_t id = tree->free_list;
+    if (id == _GS_AABB_TREE_NULL) {
+        gs_aabb_tree_node_t n = gs_default_val();
+        gs_dyn_array_push(tree->nodes, n);
+        id = gs_dyn_array_size(tree->nodes) - 1;
+    } else {
+        tree->free_list = tree->nodes[id].parent;
+    }
+    gs_aabb_tree_node_t* n = &tree->nodes[id];
+    n->parent = _GS_AABB_TREE_NULL;
+    n->child1 = _GS_AABB_TREE_NULL;
+    n->child2 = _GS_AABB_TREE_NULL;
+    n->height = 0;
+    n->user_id = 0;
+    return id;
+}
+
+void _gs_aabb_tree_free_node(gs_aabb_tree_t* tree, int32_t id)
+{
+    tree->nodes[id].parent = tree->free_list;
+    tree->nodes[id].height = -1;
+    tree->free_list = id;
+}
+
+// Rotate subtree rooted at a if it's imbalanced, returns new root
+int32_t _gs_aabb_tree_balance(gs_aabb_tree_t* tree, int32_t ia)
+{
+    gs_aabb_tree_node_t* N = tree->nodes;
+    gs_aabb_tree_node_t* A = &N[ia];
+    if (A->child1 == _GS_AABB_TREE_NULL || A->height < 2) return ia;
+
+    int32_t ib = A->child1, ic = A->child2;
+    gs_aabb_tree_node_t* B = &N[ib];
+    gs_aabb_tree_node_t* C = &N[ic];
+    int32_t balance = C->height - B->height;
+
+    // Rotate C up
+    if (balance > 1)
+    {
+        int32_t i_f = C->child1, ig = C->child2;
+        gs_aabb_tree_node_t* F = &N[i_f];
+        gs_aabb_tree_node_t* G = &N[ig];
+
+        C->child1 = ia;
+        C->parent = A->parent;
+        A->parent = ic;
+        if (C->parent != _GS_AABB_TREE_NULL) {
+            if (N[C->parent].child1 == ia) N[C->parent].child1 = ic;
+            else N[C->parent].child2 = ic;
+        } else {
+            tree->root = ic;
+        }
+
+        if (F->height > G->height) {
+            C->child2 = i_f;
+            A->child2 = ig;
+            G->parent = ia;
+            A->aabb = _gs_aabb_union(&B->aabb, &G->aabb);
+            C->aabb = _gs_aabb_union(&A->aabb, &F->aabb);
+            A->height = 1 + gs_max(B->height, G->height);
+            C->height = 1 + gs_max(A->height, F->height);
+        } else {
+            C->child2 = ig;
+            A->child2 = i_f;
+            F->parent = ia;
+            A->aabb = _gs_aabb_union(&B->aabb, &F->aabb);
+            C->aabb = _gs_aabb_union(&A->aabb, &G->aabb);
+            A->height = 1 + gs_max(B->height, F->height);
+            C->height = 1 + gs_max(A->height, G->height);
+        }
+        return ic;
+    }
+
+    // Rotate B up
+    if (balance < -1)
+    {
+        int32_t id = B->child1, ie = B->child2;
+        gs_aabb_tree_node_t* D = &N[id];
+        gs_aabb_tree_node_t* E = &N[ie];
+
+        B->child1 = ia;
+        B->parent = A->parent;
+        A->parent = ib;
+        if (B->parent != _GS_AABB_TREE_NULL) {
+            if (N[B->parent].child1 == ia) N[B->parent].child1 = ib;
+            else N[B->parent].child2 = ib;
+        } else {
+            tree->root = ib;
+        }
+
+        if (D->height > E->height) {
+            B->child2 = id;
+            A->child1 = ie;
+            E->parent = ia;
+            A->aabb = _gs_aabb_union(&C->aabb, &E->aabb);
+            B->aabb = _gs_aabb_union(&A->aabb, &D->aabb);
+            A->height = 1 + gs_max(C->height, E->height);
+            B->height = 1 + gs_max(A->height, D->height);
+        } else {
+            B->child2 = ie;
+            A->child1 = id;
+            D->parent = ia;
+            A->aabb = _gs_aabb_union(&C->aabb, &D->aabb);
+            B->aabb = _gs_aabb_union(&A->aabb, &E->aabb);
+            A->height = 1 + gs_max(C->height, D->height);
+            B->height = 1 + gs_max(A->height, E->height);
+        }
+        return ib;
+    }
+
+    return ia;
+}
+
+// Walk back up from index, refitting bounds and rebalancing
+void _gs_aabb_tree_refit(gs_aabb_tree_t* tree, int32_t index)
+{
+    while (index != _GS_AABB_TREE_NULL)
+    {
+        index = _gs_aabb_tree_balance(tree, index);
+        gs_aabb_tree_node_t* n = &tree->nodes[index];
+        gs_aabb_tree_node_t* c1 = &tree->nodes[n->child1];
+        gs_aabb_tree_node_t* c2 = &tree->nodes[n->child2];
+        n->height = 1 + gs_max(c1->height, c2->height);
+        n->aabb = _gs_aabb_union(&c1->aabb, &c2->aabb);
+        index = n->parent;
+    }
+}
+
+void _gs_aabb_tree_insert_leaf(gs_aabb_tree_t* tree, int32_t leaf)
+{
+    if (tree->root == _GS_AABB_TREE_NULL) {
+        tree->root = leaf;
+        tree->nodes[leaf].parent = _GS_AABB_TREE_NULL;
+        return;
+    }
+
+    // Find best sibling by descending towards the child with cheapest area increase
+    gs_aabb_t leaf_aabb = tree->nodes[leaf].aabb;
+    int32_t index = tree->root;
+    while (tree->nodes[index].child1 != _GS_AABB_TREE_NULL)
+    {
+        gs_aabb_tree_node_t* n = &tree->nodes[index];
+        int32_t c1 = n->child1, c2 = n->child2;
+        float area = _gs_aabb_perimeter(&n->aabb);
+        gs_aabb_t combined = _gs_aabb_union(&n->aabb, &leaf_aabb);
+        float combined_area = _gs_aabb_perimeter(&combined);
+
+        // Cost of creating a new parent for this node and the new leaf, and minimum cost of pushing leaf further down
+        float cost = 2.f * combined_area;
+        float inheritance = 2.f * (combined_area - area);
+
+        float cost1, cost2;
+        gs_aabb_t u1 = _gs_aabb_union(&leaf_aabb, &tree->nodes[c1].aabb);
+        gs_aabb_t u2 = _gs_aabb_union(&leaf_aabb, &tree->nodes[c2].aabb);
+        cost1 = _gs_aabb_perimeter(&u1) + inheritance;
+        cost2 = _gs_aabb_perimeter(&u2) + inheritance;
+        if (tree->nodes[c1].child1 != _GS_AABB_TREE_NULL) cost1 -= _gs_aabb_perimeter(&tree->nodes[c1].aabb);
+        if (tree->nodes[c2].child1 != _GS_AABB_TREE_NULL) cost2 -= _gs_aabb_perimeter(&tree->nodes[c2].aabb);
+
+        if (cost < cost1 && cost < cost2) break;
+        index = cost1 < cost2 ? c1 : c2;
+    }
+
+    // Create new parent (allocation may move node storage)
+    int32_t sibling = index;
+    int32_t old_parent = tree->nodes[sibling].parent;
+    int32_t new_parent = _gs_aabb_tree_alloc_node(tree);
+    gs_aabb_tree_node_t* np = &tree->nodes[new_parent];
+    np->parent = old_parent;
+    np->aabb = _gs_aabb_union(&leaf_aabb, &tree->nodes[sibling].aabb);
+    np->height = tree->nodes[sibling].height + 1;
+    np->child1 = sibling;
+    np->child2 = leaf;
+    tree->nodes[sibling].parent = new_parent;
+    tree->nodes[leaf].parent = new_parent;
+
+    if (old_parent != _GS_AABB_TREE_NULL) {
+        if (tree->nodes[old_parent].child1 == sibling) tree->nodes[old_parent].child1 = new_parent;
+        else tree->nodes[old_parent].child2 = new_parent;
+    } else {
+        tree->root = new_parent;
+    }
+
+    _gs_aabb_tree_refit(tree, tree->nodes[leaf].parent);
+}
+
+void _gs_aabb_tree_remove_leaf(gs_aabb_tree_t* tree, int32_t leaf)
+{
+    if (leaf == tree->root) {
+        tree->root = _GS_AABB_TREE_NULL;
+        return;
+    }
+
+    int32_t parent = tree->nodes[leaf].parent;
+    int32_t grand_parent = tree->nodes[parent].parent;
+    int32_t sibling = tree->nodes[parent].child1 == leaf ? tree->nodes[parent].child2 : tree->nodes[parent].child1;
+
+    if (grand_parent != _GS_AABB_TREE_NULL) {
+        // Destroy parent and connect sibling to grand parent
+        if (tree->nodes[grand_parent].child1 == parent) tree->nodes[grand_parent].child1 = sibling;
+        else tree->nodes[grand_parent].child2 = sibling;
+        tree->nodes[sibling].parent = grand_parent;
+        _gs_aabb_tree_free_node(tree, parent);
+        _gs_aabb_tree_refit(tree, grand_parent);
+    } else {
+        tree->root = sibling;
+        tree->nodes[sibling].parent = _GS_AABB_TREE_NULL;
+        _gs_aabb_tree_free_node(tree, parent);
+    }
+}
+
+GS_API_DECL int32_t gs_aabb_tree_insert(gs_aabb_tree_t* tree, const gs_aabb_t* aabb, uint32_t user_id)
+{
+    int32_t proxy = _gs_aabb_tree_alloc_node(tree);
+    tree->nodes[proxy].aabb = *aabb;
+    tree->nodes[proxy].user_id = user_id;
+    _gs_aabb_tree_insert_leaf(tree, proxy);
+    return proxy;
+}
+
+GS_API_DECL void gs_aabb_tree_remove(gs_aabb_tree_t* tree, int32_t proxy)
+{
+    _gs_aabb_tree_remove_leaf(tree, proxy);
+    _gs_aabb_tree_free_node(tree, proxy);
+}
+
+GS_API_DECL void gs_aabb_tree_update(gs_aabb_tree_t* tree, int32_t proxy, const gs_aabb_t* aabb)
+{
+    _gs_aabb_tree_remove_leaf(tree, proxy);
+    tree->nodes[proxy].aabb = *aabb;
+    _gs_aabb_tree_insert_leaf(tree, proxy);
+}
+
+GS_API_DECL void gs_aabb_tree_query(const gs_aabb_tree_t* tree, const gs_aabb_t* aabb, gs_aabb_tree_query_func cb, void* user_data)
+{
+    if (tree->root == _GS_AABB_TREE_NULL) return;
+
+    int32_t stack[_GS_AABB_TREE_STACK_SIZE];
+    int32_t sp = 0;
+    stack[sp++] = tree->root;
+
+    while (sp)
+    {
+        const gs_aabb_tree_node_t* n = &tree->nodes[stack[--sp]];
+        if (!gs_aabb_overlap(&n->aabb, aabb)) continue;
+
+        if (n->child1 == _GS_AABB_TREE_NULL) {
+            if (!cb(user_data, (int32_t)(n - tree->nodes), n->user_id)) return;
+        } else {
+            gs_assert(sp + 2 <= _GS_AABB_TREE_STACK_SIZE);
+            stack[sp++] = n->child1;
+            stack[sp++] = n->child2;
+        }
+    }
+}
+
+// Slab test, returns entry fraction in [0, max_t] or -1
+gs_force_inline
+float _gs_ray_vs_aabb_slab(gs_vec3 p, gs_vec3 inv_d, const gs_aabb_t* a, float max_t)
+{
+    float t0 = 0.f, t1 = max_t;
+    for (uint32_t i = 0; i < 3; ++i)
+    {
+        float tn = (a->min.xyz[i] - p.xyz[i]) * inv_d.xyz[i];
+        float tf = (a->max.xyz[i] - p.xyz[i]) * inv_d.xyz[i];
+        if (tn > tf) { float t = tn; tn = tf; tf = t; }
+        if (tn == tn) t0 = gs_max(t0, tn);  // NaN when origin on slab with zero direction
+        if (tf == tf) t1 = gs_min(t1, tf);
+        if (t0 > t1) return -1.f;
+    }
+    return t0;
+}
+
+GS_API_DECL void gs_aabb_tree_raycast(const gs_aabb_tree_t* tree, const gs_ray_t* ray, gs_aabb_tree_raycast_func cb, void* user_data)
+{
+    if (tree->root == _GS_AABB_TREE_NULL) return;
+
+    // Fraction is along normalized direction, scaled by ray length
+    float len = gs_vec3_len(ray->d);
+    if (len <= 0.f) return;
+    gs_vec3 d = gs_vec3_scale(ray->d, 1.f / len);
+    gs_vec3 inv_d = gs_v3(1.f / d.x, 1.f / d.y, 1.f / d.z);
+    float max_t = ray->len;
+
+    int32_t stack[_GS_AABB_TREE_STACK_SIZE];
+    int32_t sp = 0;
+    stack[sp++] = tree->root;
+
+    while (sp)
+    {
+        const gs_aabb_tree_node_t* n = &tree->nodes[stack[--sp]];
+        if (_gs_ray_vs_aabb_slab(ray->p, inv_d, &n->aabb, max_t) < 0.f) continue;
+
+        if (n->child1 == _GS_AABB_TREE_NULL) {
+            float f = cb(user_data, ray, max_t / ray->len, (int32_t)(n - tree->nodes), n->user_id);
+            if (f == 0.f) return;
+            if (f > 0.f) max_t = f * ray->len;
+        } else {
+            gs_assert(sp + 2 <= _GS_AABB_TREE_STACK_SIZE);
+            stack[sp++] = n->child1;
+            stack[sp++] = n->child2;
+        }
+    }
+}
+
+/* Rigid Body */
+
+GS_API_DECL void gs_rigid_body_apply_force(gs_rigid_body_t* body, gs_vec3 force)
+{
+    if (body->type != GS_RIGID_BODY_DYNAMIC) return;
+    body->force = gs_vec3_add(body->force, force);
+    gs_rigid_body_set_awake(body, true);
+}
+
+GS_API_DECL void gs_rigid_body_apply_impulse(gs_rigid_body_t* body, gs_vec3 impulse, gs_vec3 point)
+{
+    if (body->type != GS_RIGID_BODY_DYNAMIC) return;
+    gs_vec3 r = gs_vec3_sub(point, body->world_center);
+    body->linear_velocity = gs_vec3_add(body->linear_velocity, gs_vec3_scale(impulse, body->inverve_mass));
+    body->angular_velocity = gs_vec3_add(body->angular_velocity, gs_mat3_mul_vec3(body->inverse_inertia_world, gs_vec3_cross(r, impulse)));
+    gs_rigid_body_set_awake(body, true);
+}
+
+GS_API_DECL void gs_rigid_body_set_awake(gs_rigid_body_t* body, bool32_t awake)
+{
+    if (awake) {
+        body->flags |= GS_RIGID_BODY_STATE_AWAKE;
+        body->sleep_time = 0.f;
+    } else {
+        body->flags &= ~GS_RIGID_BODY_STATE_AWAKE;
+        body->sleep_time = 0.f;
+        body->linear_velocity = gs_v3s(0.f);
+        body->angular_velocity = gs_v3s(0.f);
+        body->force = gs_v3s(0.f);
+        body->torque = gs_v3s(0.f);
+    }
+}
+
+gs_force_inline
+gs_vqs _gs_rigid_body_xform(const gs_rigid_body_t* b)
+{
+    gs_vqs x = gs_default_val();
+    x.position = b->world_center;
+    x.rotation = b->rotation;
+    x.scale = gs_v3s(1.f);
+    return x;
+}
+
+gs_force_inline
+gs_support_func_t _gs_collision_shape_support(const gs_collision_shape_t* s)
+{
+    switch (s->type)
+    {
+        case GS_COLLISION_SHAPE_SPHERE:   return gs_support_sphere;
+        case GS_COLLISION_SHAPE_AABB:     return gs_support_aabb;
+        case GS_COLLISION_SHAPE_CAPSULE:  return gs_support_capsule;
+        case GS_COLLISION_SHAPE_CYLINDER: return gs_support_cylinder;
+        case GS_COLLISION_SHAPE_CONE:     return gs_support_cone;
+        case GS_COLLISION_SHAPE_POLY:     return gs_support_poly;
+        default:                          return NULL;
+    }
+}
+
+// Shapes without flat faces never need perturbed manifold points
+gs_force_inline
+bool32_t _gs_collision_shape_is_round(const gs_collision_shape_t* s)
+{
+    return s->type == GS_COLLISION_SHAPE_SPHERE || s->type == GS_COLLISION_SHAPE_CAPSULE;
+}
+
+// World bounds from support points along each axis, consistent with narrowphase for every shape type
+gs_aabb_t _gs_rigid_body_compute_aabb(const gs_rigid_body_t* b)
+{
+    gs_vqs x = _gs_rigid_body_xform(b);
+    gs_support_func_t f = _gs_collision_shape_support(&b->shape);
+    gs_aabb_t r = gs_default_val();
+    for (uint32_t i = 0; i < 3; ++i)
+    {
+        gs_vec3 d = gs_v3s(0.f), p = gs_v3s(0.f);
+        d.xyz[i] = 1.f;
+        f(&b->shape.sphere, &x, &d, &p);
+        r.max.xyz[i] = p.xyz[i];
+        d.xyz[i] = -1.f;
+        f(&b->shape.sphere, &x, &d, &p);
+        r.min.xyz[i] = p.xyz[i];
+    }
+    return r;
+}
+
+void _gs_rigid_body_compute_mass(gs_rigid_body_t* b, float mass)
+{
+    if (b->type != GS_RIGID_BODY_DYNAMIC) {
+        b->mass = 0.f;
+        b->inverve_mass = 0.f;
+        b->inverse_inertia_local = gs_v3s(0.f);
+        return;
+    }
+
+    float m = mass > 0.f ? mass : 1.f;
+    const gs_collision_shape_t* s = &b->shape;
+    gs_vec3 I = gs_v3s(0.f);
+
+    switch (s->type)
+    {
+        case GS_COLLISION_SHAPE_SPHERE: {
+            float i = 0.4f * m * s->sphere.r * s->sphere.r;
+            I = gs_v3s(i);
+        } break;
+
+        case GS_COLLISION_SHAPE_CAPSULE:
+        case GS_COLLISION_SHAPE_CYLINDER: {
+            float r = s->type == GS_COLLISION_SHAPE_CAPSULE ? s->capsule.r : s->cylinder.r;
+            float h = s->type == GS_COLLISION_SHAPE_CAPSULE ? s->capsule.height + 2.f * r : s->cylinder.height;
+            float ixz = m * (3.f * r * r + h * h) / 12.f;
+            I = gs_v3(ixz, 0.5f * m * r * r, ixz);
+        } break;
+
+        case GS_COLLISION_SHAPE_CONE: {
+            float r = s->cone.r, h = s->cone.height;
+            float ixz = m * (3.f * r * r / 20.f + 3.f * h * h / 80.f);
+            I = gs_v3(ixz, 0.3f * m * r * r, ixz);
+        } break;
+
+        // Poly uses the box inertia of its local bounds
+        case GS_COLLISION_SHAPE_AABB:
+        case GS_COLLISION_SHAPE_POLY:
+        default: {
+            gs_vec3 e = gs_vec3_sub(s->aabb.max, s->aabb.min);
+            if (s->type == GS_COLLISION_SHAPE_POLY) {
+                gs_vec3 mn = gs_v3s(FLT_MAX), mx = gs_v3s(-FLT_MAX);
+                for (int32_t i = 0; i < s->poly.cnt; ++i) {
+                    gs_vec3 v = s->poly.verts[i];
+                    mn = gs_v3(gs_min(mn.x, v.x), gs_min(mn.y, v.y), gs_min(mn.z, v.z));
+                    mx = gs_v3(gs_max(mx.x, v.x), gs_max(mx.y, v.y), gs_max(mx.z, v.z));
+                }
+                e = s->poly.cnt ? gs_vec3_sub(mx, mn) : gs_v3s(1.f);
+            }
+            I = gs_v3(m * (e.y * e.y + e.z * e.z) / 12.f, m * (e.x * e.x + e.z * e.z) / 12.f, m * (e.x * e.x + e.y * e.y) / 12.f);
+        } break;
+    }
+
+    b->mass = m;
+    b->inverve_mass = 1.f / m;
+    b->inverse_inertia_local = gs_v3(I.x > 0.f ? 1.f / I.x : 0.f, I.y > 0.f ? 1.f / I.y : 0.f, I.z > 0.f ? 1.f / I.z : 0.f);
+}
+
+// R * diag(I^-1) * R^T (symmetric, so storage order doesn't matter), with locked rotation axes removed
+void _gs_rigid_body_update_inertia(gs_rigid_body_t* b)
+{
+    gs_vec3 c[3] = {
+        gs_quat_rotate(b->rotation, gs_v3(1.f, 0.f, 0.f)),
+        gs_quat_rotate(b->rotation, gs_v3(0.f, 1.f, 0.f)),
+        gs_quat_rotate(b->rotation, gs_v3(0.f, 0.f, 1.f))
+    };
+    const float* il = b->inverse_inertia_local.xyz;
+    gs_mat3* m = &b->inverse_inertia_world;
+    for (uint32_t i = 0; i < 3; ++i) {
+        for (uint32_t j = 0; j < 3; ++j) {
+            m->m[i + j * 3] = c[0].xyz[i] * c[0].xyz[j] * il[0] + c[1].xyz[i] * c[1].xyz[j] * il[1] + c[2].xyz[i] * c[2].xyz[j] * il[2];
+        }
+    }
+
+    const uint32_t locks[3] = {GS_RIGID_BODY_STATE_LOCK_AXIS_X, GS_RIGID_BODY_STATE_LOCK_AXIS_Y, GS_RIGID_BODY_STATE_LOCK_AXIS_Z};
+    for (uint32_t i = 0; i < 3; ++i) {
+        if (!(b->flags & locks[i])) continue;
+        for (uint32_t j = 0; j < 3; ++j) {
+            m->m[i + j * 3] = 0.f;
+            m->m[j + i * 3] = 0.f;
+        }
+    }
+}
+
+/* Contact Manager */
+
+gs_force_inline
+void _gs_physics_tangent_basis(gs_vec3 n, gs_vec3* t0, gs_vec3* t1)
+{
+    // Erin Catto's orthonormal basis from unit vector
+    if (fabsf(n.x) >= 0.57735f) *t0 = gs_vec3_norm(gs_v3(n.y, -n.x, 0.f));
+    else *t0 = gs_vec3_norm(gs_v3(0.f, n.z, -n.y));
+    *t1 = gs_vec3_cross(n, *t0);
+}
+
+void _gs_physics_contact_create(gs_physics_scene_t* scene, uint32_t ia, uint32_t ib)
+{
+    gs_rigid_body_t* a = gs_slot_array_getp(scene->bodies, ia);
+    gs_rigid_body_t* b = gs_slot_array_getp(scene->bodies, ib);
+
+    gs_contact_constraint_t* c = (gs_contact_constraint_t*)gs_paged_allocator_allocate(&scene->paged_allocator);
+    memset(c, 0, sizeof(gs_contact_constraint_t));
+    c->body_a = ia;
+    c->body_b = ib;
+    float fa = a->shape.friction > 0.f ? a->shape.friction : GS_PHYSICS_DEFAULT_FRICTION;
+    float fb = b->shape.friction > 0.f ? b->shape.friction : GS_PHYSICS_DEFAULT_FRICTION;
+    c->friction = sqrtf(fa * fb);
+    c->restitution = gs_max(a->shape.restitution, b->shape.restitution);
+
+    // Link into manager
+    gs_physics_contact_manager_t* cm = &scene->contact_manager;
+    c->next = cm->contacts;
+    if (cm->contacts) cm->contacts->prev = c;
+    cm->contacts = c;
+    cm->contact_count++;
+
+    // Link into contact graph
+    c->edge_a.contact = c;
+    c->edge_a.other = ib;
+    c->edge_a.next = a->contacts;
+    if (a->contacts) a->contacts->prev = &c->edge_a;
+    a->contacts = &c->edge_a;
+
+    c->edge_b.contact = c;
+    c->edge_b.other = ia;
+    c->edge_b.next = b->contacts;
+    if (b->contacts) b->contacts->prev = &c->edge_b;
+    b->contacts = &c->edge_b;
+}
+
+void _gs_physics_contact_destroy(gs_physics_scene_t* scene, gs_contact_constraint_t* c)
+{
+    gs_physics_contact_manager_t* cm = &scene->contact_manager;
+    gs_rigid_body_t* a = gs_slot_array_getp(scene->bodies, c->body_a);
+    gs_rigid_body_t* b = gs_slot_array_getp(scene->bodies, c->body_b);
+
+    if ((c->flags & GS_CONTACT_TOUCHING) && cm->listener.end_contact) {
+        cm->listener.end_contact(c);
+    }
+
+    // Bodies lose support, let them fall
+    if (c->flags & GS_CONTACT_TOUCHING) {
+        if (a->type == GS_RIGID_BODY_DYNAMIC) gs_rigid_body_set_awake(a, true);
+        if (b->type == GS_RIGID_BODY_DYNAMIC) gs_rigid_body_set_awake(b, true);
+    }
+
+    if (c->prev) c->prev->next = c->next;
+    if (c->next) c->next->prev = c->prev;
+    if (c == cm->contacts) cm->contacts = c->next;
+    cm->contact_count--;
+
+    if (c->edge_a.prev) c->edge_a.prev->next = c->edge_a.next;
+    if (c->edge_a.next) c->edge_a.next->prev = c->edge_a.prev;
+    if (&c->edge_a == a->contacts) a->contacts = c->edge_a.next;
+
+    if (c->edge_b.prev) c->edge_b.prev->next = c->edge_b.next;
+    if (c->edge_b.next) c->edge_b.next->prev = c->edge_b.prev;
+    if (&c->edge_b == b->contacts) b->contacts = c->edge_b.next;
+
+    gs_paged_allocator_deallocate(&scene->paged_allocator, c);
+}
+
+typedef struct _gs_physics_pair_query_t {
+    gs_physics_scene_t* scene;
+    uint32_t body;
+} _gs_physics_pair_query_t;
+
+bool32_t _gs_physics_pair_query_cb(void* user_data, int32_t proxy, uint32_t id)
+{
+    _gs_physics_pair_query_t* q = (_gs_physics_pair_query_t*)user_data;
+    gs_physics_scene_t* scene = q->scene;
+    if (id == q->body) return true;
+
+    gs_rigid_body_t* a = gs_slot_array_getp(scene->bodies, q->body);
+    gs_rigid_body_t* b = gs_slot_array_getp(scene->bodies, id);
+
+    // Both moved, pair is found from the other side too
+    if (b->moved && id < q->body) return true;
+    if (a->type != GS_RIGID_BODY_DYNAMIC && b->type != GS_RIGID_BODY_DYNAMIC) return true;
+
+    // Already have a contact
+    for (gs_contact_edge_t* e = a->contacts; e; e = e->next) {
+        if (e->other == id) return true;
+    }
+
+    uint32_t ia = gs_min(q->body, id), ib = gs_max(q->body, id);
+    _gs_physics_contact_create(scene, ia, ib);
+    return true;
+}
+
+// Closest match within breaking distance, or -1
+int32_t _gs_physics_manifold_find_point(const gs_contact_constraint_t* c, gs_vec3 local_a)
+{
+    float best = GS_PHYSICS_CONTACT_BREAKING_DISTANCE * GS_PHYSICS_CONTACT_BREAKING_DISTANCE;
+    int32_t idx = -1;
+    for (uint32_t i = 0; i < c->count; ++i) {
+        float d2 = gs_vec3_len2(gs_vec3_sub(c->points[i].local_a, local_a));
+        if (d2 < best) { best = d2; idx = (int32_t)i; }
+    }
+    return idx;
+}
+
+gs_force_inline
+float _gs_physics_area4(gs_vec3 p0, gs_vec3 p1, gs_vec3 p2, gs_vec3 p3)
+{
+    float a = gs_vec3_len2(gs_vec3_cross(gs_vec3_sub(p0, p1), gs_vec3_sub(p2, p3)));
+    float b = gs_vec3_len2(gs_vec3_cross(gs_vec3_sub(p0, p2), gs_vec3_sub(p1, p3)));
+    float c = gs_vec3_len2(gs_vec3_cross(gs_vec3_sub(p0, p3), gs_vec3_sub(p1, p2)));
+    return gs_max(a, gs_max(b, c));
+}
+
+// Add point to manifold, replacing a close match (keeping its impulses for warm starting) 
+// or, when full, the point whose removal leaves the largest contact area. Deepest point is always kept.
+void _gs_physics_manifold_add_point(gs_contact_constraint_t* c, const gs_contact_point_t* p)
+{
+    int32_t match = _gs_physics_manifold_find_point(c, p->local_a);
+    if (match >= 0) {
+        gs_contact_point_t* cp = &c->points[match];
+        float ni = cp->normal_impulse, t0 = cp->tangent_impulse[0], t1 = cp->tangent_impulse[1];
+        *cp = *p;
+        cp->normal_impulse = ni;
+        cp->tangent_impulse[0] = t0;
+        cp->tangent_impulse[1] = t1;
+        return;
+    }
+
+    if (c->count < GS_PHYSICS_MANIFOLD_MAX_POINTS) {
+        c->points[c->count++] = *p;
+        return;
+    }
+
+    gs_contact_point_t cand[GS_PHYSICS_MANIFOLD_MAX_POINTS + 1];
+    memcpy(cand, c->points, sizeof(c->points));
+    cand[GS_PHYSICS_MANIFOLD_MAX_POINTS] = *p;
+
+    int32_t deepest = 0;
+    for (int32_t i = 1; i <= GS_PHYSICS_MANIFOLD_MAX_POINTS; ++i) {
+        if (cand[i].separation < cand[deepest].separation) deepest = i;
+    }
+
+    int32_t remove = -1;
+    float best = -1.f;
+    for (int32_t r = 0; r <= GS_PHYSICS_MANIFOLD_MAX_POINTS; ++r)
+    {
+        if (r == deepest) continue;
+        gs_vec3 q[GS_PHYSICS_MANIFOLD_MAX_POINTS];
+        for (int32_t i = 0, k = 0; i <= GS_PHYSICS_MANIFOLD_MAX_POINTS; ++i) {
+            if (i != r) q[k++] = cand[i].local_a;
+        }
+        float area = _gs_physics_area4(q[0], q[1], q[2], q[3]);
+        if (area > best) { best = area; remove = r; }
+    }
+
+    for (int32_t i = 0, k = 0; i <= GS_PHYSICS_MANIFOLD_MAX_POINTS; ++i) {
+        if (i != remove) c->points[k++] = cand[i];
+    }
+}
+
+// Is point within the lateral extent of shape (perpendicular to contact normal)
+bool32_t _gs_physics_point_in_extent(const gs_rigid_body_t* b, gs_vec3 p, gs_vec3 t0, gs_vec3 t1)
+{
+    gs_vqs x = _gs_rigid_body_xform(b);
+    gs_support_func_t f = _gs_collision_shape_support(&b->shape);
+    const gs_vec3 dirs[4] = {t0, t1, gs_vec3_neg(t0), gs_vec3_neg(t1)};
+    for (uint32_t i = 0; i < 4; ++i) {
+        gs_vec3 s = gs_v3s(0.f);
+        f(&b->shape.sphere, &x, &dirs[i], &s);
+        if (gs_vec3_dot(p, dirs[i]) > gs_vec3_dot(s, dirs[i]) + GS_PHYSICS_LINEAR_SLOP) return false;
+    }
+    return true;
+}
+
+// Penetration of a into b along axis u (pointing from a to b), negative when separated
+gs_force_inline
+float _gs_physics_axis_overlap(const gs_rigid_body_t* a, const gs_vqs* xa, gs_support_func_t fa, 
+    const gs_rigid_body_t* b, const gs_vqs* xb, gs_support_func_t fb, gs_vec3 u)
+{
+    gs_vec3 sa = gs_v3s(0.f), sb = gs_v3s(0.f), nu = gs_vec3_neg(u);
+    fa(&a->shape.sphere, xa, &u, &sa);
+    fb(&b->shape.sphere, xb, &nu, &sb);
+    return gs_vec3_dot(sa, u) - gs_vec3_dot(sb, u);
+}
+
+// EPA's normal drifts (and can be arbitrary for barely touching shapes). Test it against the face axes of 
+// any boxes involved and keep the axis of least penetration. Returns false if an axis separates the shapes.
+bool32_t _gs_physics_refine_normal(const gs_rigid_body_t* a, const gs_vqs* xa, gs_support_func_t fa, 
+    const gs_rigid_body_t* b, const gs_vqs* xb, gs_support_func_t fb, gs_vec3* n, float* depth)
+{
+    float best = _gs_physics_axis_overlap(a, xa, fa, b, xb, fb, *n);
+    gs_vec3 bn = *n;
+    const gs_rigid_body_t* bodies[2] = {a, b};
+    for (uint32_t k = 0; k < 2; ++k)
+    {
+        if (bodies[k]->shape.type != GS_COLLISION_SHAPE_AABB) continue;
+        for (uint32_t i = 0; i < 3; ++i)
+        {
+            gs_vec3 e = gs_v3s(0.f);
+            e.xyz[i] = 1.f;
+            gs_vec3 u = gs_quat_rotate(bodies[k]->rotation, e);
+            for (uint32_t j = 0; j < 2; ++j, u = gs_vec3_neg(u)) {
+                float o = _gs_physics_axis_overlap(a, xa, fa, b, xb, fb, u);
+                if (o < best) { best = o; bn = u; }
+            }
+        }
+    }
+    *n = bn;
+    *depth = best;
+    return best >= 0.f;
+}
+
+// Closed form pairs, exact normal and depth so no refinement needed. Returns false when pair needs GJK/EPA.
+bool32_t _gs_physics_collide_closed_form(const gs_rigid_body_t* a, const gs_vqs* xa, const gs_rigid_body_t* b, 
+    const gs_vqs* xb, gs_contact_info_t* res)
+{
+    const gs_collision_shape_t* sa = &a->shape;
+    const gs_collision_shape_t* sb = &b->shape;
+    switch (sa->type)
+    {
+        case GS_COLLISION_SHAPE_SPHERE: switch (sb->type) 
+        {
+            case GS_COLLISION_SHAPE_SPHERE:  gs_sphere_vs_sphere(&sa->sphere, xa, &sb->sphere, xb, res); return true;
+            case GS_COLLISION_SHAPE_AABB:    gs_sphere_vs_aabb(&sa->sphere, xa, &sb->aabb, xb, res); return true;
+            case GS_COLLISION_SHAPE_CAPSULE: gs_sphere_vs_capsule(&sa->sphere, xa, &sb->capsule, xb, res); return true;
+            default: return false;
+        }
+
+        case GS_COLLISION_SHAPE_AABB: switch (sb->type) 
+        {
+            case GS_COLLISION_SHAPE_SPHERE:  gs_aabb_vs_sphere(&sa->aabb, xa, &sb->sphere, xb, res); return true;
+            case GS_COLLISION_SHAPE_AABB:    gs_aabb_vs_aabb(&sa->aabb, xa, &sb->aabb, xb, res); return true;
+            default: return false;
+        }
+
+        case GS_COLLISION_SHAPE_CAPSULE: switch (sb->type) 
+        {
+            case GS_COLLISION_SHAPE_SPHERE:  gs_capsule_vs_sphere(&sa->capsule, xa, &sb->sphere, xb, res); return true;
+            case GS_COLLISION_SHAPE_CAPSULE: gs_capsule_vs_capsule(&sa->capsule, xa, &sb->capsule, xb, res); return true;
+            default: return false;
+        }
+
+        default: return false;
+    }
+}
+
+// Build manifold point from the deepest point of one shape (sampled in pose qs) and its projection onto 
+// the surface plane of the other. EPA's own contact point is not reliable for large flat shapes.
+gs_contact_point_t _gs_physics_manifold_point(const gs_rigid_body_t* a, const gs_rigid_body_t* b, bool32_t sample_a, 
+    gs_quat qs, gs_vec3 n, gs_vec3 plane)
+{
+    const gs_rigid_body_t* s = sample_a ? a : b;
+    const gs_rigid_body_t* o = sample_a ? b : a;
+    gs_vqs xs = _gs_rigid_body_xform(s);
+    xs.rotation = qs;
+    gs_vec3 dir = sample_a ? n : gs_vec3_neg(n);
+    gs_vec3 ps = gs_v3s(0.f);
+    _gs_collision_shape_support(&s->shape)(&s->shape.sphere, &xs, &dir, &ps);
+
+    // Anchor in the unperturbed pose of the sampled shape
+    gs_vec3 ls = gs_quat_rotate(gs_quat_conjugate(qs), gs_vec3_sub(ps, s->world_center));
+    ps = gs_vec3_add(s->world_center, gs_quat_rotate(s->rotation, ls));
+    gs_vec3 po = gs_vec3_add(ps, gs_vec3_scale(n, gs_vec3_dot(gs_vec3_sub(plane, ps), n)));
+    gs_vec3 lo = gs_quat_rotate(gs_quat_conjugate(o->rotation), gs_vec3_sub(po, o->world_center));
+
+    gs_contact_point_t p = gs_default_val();
+    p.local_a = sample_a ? ls : lo;
+    p.local_b = sample_a ? lo : ls;
+    gs_vec3 pa = sample_a ? ps : po, pb = sample_a ? po : ps;
+    p.separation = gs_vec3_dot(gs_vec3_sub(pb, pa), n);
+    return p;
+}
+
+void _gs_physics_contact_update(gs_physics_scene_t* scene, gs_contact_constraint_t* c)
+{
+    gs_rigid_body_t* a = gs_slot_array_getp(scene->bodies, c->body_a);
+    gs_rigid_body_t* b = gs_slot_array_getp(scene->bodies, c->body_b);
+    gs_vqs xa = _gs_rigid_body_xform(a), xb = _gs_rigid_body_xform(b);
+    gs_support_func_t fa = _gs_collision_shape_support(&a->shape);
+    gs_support_func_t fb = _gs_collision_shape_support(&b->shape);
+    bool32_t was_touching = (c->flags & GS_CONTACT_TOUCHING) != 0;
+
+    gs_contact_info_t res = gs_default_val();
+    if (!_gs_physics_collide_closed_form(a, &xa, b, &xb, &res))
+    {
+        _gs_ccd_gjk_internal(&a->shape.sphere, &xa, fa, &b->shape.sphere, &xb, fb, &res);
+        if (res.hit && !_gs_physics_refine_normal(a, &xa, fa, b, &xb, fb, &res.normal, &res.depth)) {
+            res.hit = false;
+        }
+    }
+    scene->stats.narrowphase_tests++;
+
+    // Normal changed significantly, old points are no longer valid
+    if (res.hit) {
+        if (c->count && gs_vec3_dot(res.normal, c->normal) < 0.9f) c->count = 0;
+        c->normal = res.normal;
+    }
+    gs_vec3 n = c->normal;
+    gs_vec3 t0, t1;
+    _gs_physics_tangent_basis(n, &t0, &t1);
+
+    // Refresh persistent points, drop ones that separated or slid apart
+    const float brk = GS_PHYSICS_CONTACT_BREAKING_DISTANCE;
+    for (uint32_t i = 0; i < c->count;)
+    {
+        gs_contact_point_t* p = &c->points[i];
+        gs_vec3 wa = gs_vec3_add(a->world_center, gs_quat_rotate(a->rotation, p->local_a));
+        gs_vec3 wb = gs_vec3_add(b->world_center, gs_quat_rotate(b->rotation, p->local_b));
+        gs_vec3 d = gs_vec3_sub(wb, wa);
+        p->separation = gs_vec3_dot(d, n);
+        gs_vec3 drift = gs_vec3_sub(d, gs_vec3_scale(n, p->separation));
+        if (p->separation > brk || gs_vec3_len2(drift) > brk * brk) {
+            c->points[i] = c->points[--c->count];
+            continue;
+        }
+        ++i;
+    }
+
+    if (res.hit)
+    {
+        // Surface planes of both shapes, depth apart along the normal
+        gs_vec3 plane_a = gs_v3s(0.f);
+        fa(&a->shape.sphere, &xa, &n, &plane_a);
+        gs_vec3 plane_b = gs_vec3_sub(plane_a, gs_vec3_scale(n, res.depth));
+
+        // Deepest point of the smaller shape
+        gs_vec3 ea = gs_vec3_sub(a->aabb.max, a->aabb.min), eb = gs_vec3_sub(b->aabb.max, b->aabb.min);
+        bool32_t small_is_a = gs_vec3_len2(ea) <= gs_vec3_len2(eb);
+        gs_contact_point_t p = small_is_a ? 
+            _gs_physics_manifold_point(a, b, true, a->rotation, n, plane_b) : 
+            _gs_physics_manifold_point(a, b, false, b->rotation, n, plane_a);
+        _gs_physics_manifold_add_point(c, &p);
+
+        // Flat shapes only report one point per query. Tilt each shape slightly around axes perpendicular 
+        // to the normal to find the corners of the contact patch, instead of waiting for them over several steps.
+        // Corners are kept when they lie within the other shape's extent.
+        for (uint32_t k = 0; k < 2 && c->count < GS_PHYSICS_MANIFOLD_MAX_POINTS; ++k)
+        {
+            const gs_rigid_body_t* s = k == 0 ? a : b;
+            const gs_rigid_body_t* o = k == 0 ? b : a;
+            if (_gs_collision_shape_is_round(&s->shape)) continue;
+
+            const float angle = 0.05f;
+            for (uint32_t i = 0; i < 4; ++i)
+            {
+                float r = (float)i * GS_PI * 0.5f;
+                gs_vec3 axis = gs_vec3_add(gs_vec3_scale(t0, cosf(r)), gs_vec3_scale(t1, sinf(r)));
+                gs_quat qp = gs_quat_mul(gs_quat_angle_axis(angle, axis), s->rotation);
+                gs_contact_point_t pp = _gs_physics_manifold_point(a, b, k == 0, qp, n, k == 0 ? plane_b : plane_a);
+                gs_vec3 wp = gs_vec3_add(s->world_center, gs_quat_rotate(s->rotation, k == 0 ? pp.local_a : pp.local_b));
+                if (pp.separation < brk && _gs_physics_point_in_extent(o, wp, t0, t1)) {
+                    _gs_physics_manifold_add_point(c, &pp);
+                }
+            }
+        }
+    }
+
+    // Solver offsets
+    for (uint32_t i = 0; i < c->count; ++i) {
+        gs_contact_point_t* p = &c->points[i];
+        p->ra = gs_quat_rotate(a->rotation, p->local_a);
+        p->rb = gs_quat_rotate(b->rotation, p->local_b);
+    }
+    c->tangent[0] = t0;
+    c->tangent[1] = t1;
+
+    bool32_t touching = c->count > 0;
+    if (touching) c->flags |= GS_CONTACT_TOUCHING;
+    else c->flags &= ~GS_CONTACT_TOUCHING;
+
+    // Something moved into a sleeping body
+    if (touching && !was_touching) {
+        if (a->type == GS_RIGID_BODY_DYNAMIC && !(a->flags & GS_RIGID_BODY_STATE_AWAKE)) gs_rigid_body_set_awake(a, true);
+        if (b->type == GS_RIGID_BODY_DYNAMIC && !(b->flags & GS_RIGID_BODY_STATE_AWAKE)) gs_rigid_body_set_awake(b, true);
+    }
+
+    gs_contact_listener_t* l = &scene->contact_manager.listener;
+    if (touching && !was_touching && l->begin_contact) l->begin_contact(c);
+    if (!touching && was_touching && l->end_contact) l->end_contact(c);
+}
+
+/* Solver */
+
+typedef struct _gs_physics_solver_body_t {
+    gs_vec3 v;
+    gs_vec3 w;
+    float inv_mass;
+} _gs_physics_solver_body_t;
+
+// Per point jacobians for normal and both tangents, so iterations are only dot products
+typedef struct _gs_physics_solver_point_t {
+    gs_vec3 ca[3];                          // ra x axis
+    gs_vec3 cb[3];                          // rb x axis
+    gs_vec3 ia[3];                          // Inverse inertia a * ca
+    gs_vec3 ib[3];                          // Inverse inertia b * cb
+} _gs_physics_solver_point_t;
+
+typedef struct _gs_physics_island_t {
+    gs_rigid_body_t** bodies;
+    gs_contact_constraint_t** contacts;
+    uint32_t* contact_bodies;               // Island indices of a/b per contact
+    _gs_physics_solver_body_t* solver;
+    _gs_physics_solver_point_t* points;     // GS_PHYSICS_MANIFOLD_MAX_POINTS per contact
+    uint32_t body_count;
+    uint32_t contact_count;
+} _gs_physics_island_t;
+
+#define _GS_PHYSICS_RELAX_ITERATIONS   2
+
+gs_force_inline
+float _gs_physics_axis_velocity(const _gs_physics_solver_body_t* a, const _gs_physics_solver_body_t* b, 
+    gs_vec3 axis, gs_vec3 ca, gs_vec3 cb)
+{
+    return gs_vec3_dot(gs_vec3_sub(b->v, a->v), axis) + gs_vec3_dot(b->w, cb) - gs_vec3_dot(a->w, ca);
+}
+
+gs_force_inline
+void _gs_physics_axis_impulse(_gs_physics_solver_body_t* a, _gs_physics_solver_body_t* b, 
+    gs_vec3 axis, gs_vec3 ia, gs_vec3 ib, float lambda)
+{
+    a->v = gs_vec3_sub(a->v, gs_vec3_scale(axis, lambda * a->inv_mass));
+    a->w = gs_vec3_sub(a->w, gs_vec3_scale(ia, lambda));
+    b->v = gs_vec3_add(b->v, gs_vec3_scale(axis, lambda * b->inv_mass));
+    b->w = gs_vec3_add(b->w, gs_vec3_scale(ib, lambda));
+}
+
+// One sequential impulse pass. Without bias only speculative (separated) contacts keep their target.
+void _gs_physics_solve_contacts(_gs_physics_island_t* island, bool32_t use_bias)
+{
+    for (uint32_t i = 0; i < island->contact_count; ++i)
+    {
+        gs_contact_constraint_t* c = island->contacts[i];
+        _gs_physics_solver_body_t* a = &island->solver[island->contact_bodies[i * 2 + 0]];
+        _gs_physics_solver_body_t* b = &island->solver[island->contact_bodies[i * 2 + 1]];
+        _gs_physics_solver_point_t* sp = &island->points[i * GS_PHYSICS_MANIFOLD_MAX_POINTS];
+
+        for (uint32_t j = 0; j < c->count; ++j, ++sp)
+        {
+            gs_contact_point_t* p = &c->points[j];
+
+            // Friction, clamped by current normal impulse
+            float max_f = c->friction * p->normal_impulse;
+            for (uint32_t k = 0; k < 2; ++k)
+            {
+                float vt = _gs_physics_axis_velocity(a, b, c->tangent[k], sp->ca[k + 1], sp->cb[k + 1]);
+                float old = p->tangent_impulse[k];
+                p->tangent_impulse[k] = gs_clamp(old - p->tangent_mass[k] * vt, -max_f, max_f);
+                _gs_physics_axis_impulse(a, b, c->tangent[k], sp->ia[k + 1], sp->ib[k + 1], p->tangent_impulse[k] - old);
+            }
+
+            // Normal, accumulated impulse stays positive
+            float bias = use_bias ? p->bias : gs_max(p->bias, 0.f);
+            float vn = _gs_physics_axis_velocity(a, b, c->normal, sp->ca[0], sp->cb[0]);
+            float old = p->normal_impulse;
+            p->normal_impulse = gs_max(old - p->normal_mass * (vn + bias), 0.f);
+            _gs_physics_axis_impulse(a, b, c->normal, sp->ia[0], sp->ib[0], p->normal_impulse - old);
+        }
+    }
+}
+
+gs_force_inline
+void _gs_physics_integrate_transform(gs_rigid_body_t* b, gs_vec3 v, gs_vec3 w, float dt)
+{
+    b->world_center = gs_vec3_add(b->world_center, gs_vec3_scale(v, dt));
+    gs_quat dq = gs_quat_mul(gs_quat_ctor(w.x, w.y, w.z, 0.f), b->rotation);
+    b->rotation = gs_quat_norm(gs_quat_add(b->rotation, gs_quat_scale(dq, 0.5f * dt)));
+}
+
+void _gs_physics_island_solve(gs_physics_scene_t* scene, _gs_physics_island_t* island)
+{
+    const float dt = scene->delta_time;
+    const float inv_dt = 1.f / dt;
+
+    // Integrate velocities
+    for (uint32_t i = 0; i < island->body_count; ++i)
+    {
+        gs_rigid_body_t* b = island->bodies[i];
+        _gs_physics_solver_body_t* sb = &island->solver[i];
+        if (b->type != GS_RIGID_BODY_DYNAMIC) {
+            sb->v = b->type == GS_RIGID_BODY_KINEMATIC ? b->linear_velocity : gs_v3s(0.f);
+            sb->w = b->type == GS_RIGID_BODY_KINEMATIC ? b->angular_velocity : gs_v3s(0.f);
+            sb->inv_mass = 0.f;
+            continue;
+        }
+
+        _gs_rigid_body_update_inertia(b);
+        gs_vec3 v = b->linear_velocity, w = b->angular_velocity;
+        v = gs_vec3_add(v, gs_vec3_scale(gs_vec3_add(gs_vec3_scale(scene->gravity, b->gravity_scale), gs_vec3_scale(b->force, b->inverve_mass)), dt));
+        w = gs_vec3_add(w, gs_vec3_scale(gs_mat3_mul_vec3(b->inverse_inertia_world, b->torque), dt));
+        sb->v = gs_vec3_scale(v, 1.f / (1.f + dt * b->linear_damping));
+        sb->w = gs_vec3_scale(w, 1.f / (1.f + dt * b->angular_damping));
+        sb->inv_mass = b->inverve_mass;
+    }
+
+    // Prepare contacts and warm start with last step's impulses
+    for (uint32_t i = 0; i < island->contact_count; ++i)
+    {
+        gs_contact_constraint_t* c = island->contacts[i];
+        uint32_t ia = island->contact_bodies[i * 2 + 0], ib = island->contact_bodies[i * 2 + 1];
+        _gs_physics_solver_body_t* a = &island->solver[ia];
+        _gs_physics_solver_body_t* b = &island->solver[ib];
+        gs_rigid_body_t* ba = island->bodies[ia];
+        gs_rigid_body_t* bb = island->bodies[ib];
+        bool32_t dyn_a = ba->type == GS_RIGID_BODY_DYNAMIC, dyn_b = bb->type == GS_RIGID_BODY_DYNAMIC;
+        const gs_vec3 axes[3] = {c->normal, c->tangent[0], c->tangent[1]};
+        _gs_physics_solver_point_t* sp = &island->points[i * GS_PHYSICS_MANIFOLD_MAX_POINTS];
+
+        for (uint32_t j = 0; j < c->count; ++j, ++sp)
+        {
+            gs_contact_point_t* p = &c->points[j];
+            float k[3];
+            for (uint32_t x = 0; x < 3; ++x) {
+                sp->ca[x] = gs_vec3_cross(p->ra, axes[x]);
+                sp->cb[x] = gs_vec3_cross(p->rb, axes[x]);
+                sp->ia[x] = dyn_a ? gs_mat3_mul_vec3(ba->inverse_inertia_world, sp->ca[x]) : gs_v3s(0.f);
+                sp->ib[x] = dyn_b ? gs_mat3_mul_vec3(bb->inverse_inertia_world, sp->cb[x]) : gs_v3s(0.f);
+                k[x] = a->inv_mass + b->inv_mass + gs_vec3_dot(sp->ca[x], sp->ia[x]) + gs_vec3_dot(sp->cb[x], sp->ib[x]);
+                k[x] = k[x] > 0.f ? 1.f / k[x] : 0.f;
+            }
+            p->normal_mass = k[0];
+            p->tangent_mass[0] = k[1];
+            p->tangent_mass[1] = k[2];
+            p->relative_velocity = _gs_physics_axis_velocity(a, b, c->normal, sp->ca[0], sp->cb[0]);
+
+            // Speculative for separated points, Baumgarte for penetrating ones
+            if (p->separation > 0.f) p->bias = p->separation * inv_dt;
+            else p->bias = -GS_PHYSICS_BAUMGARTE * inv_dt * gs_max(0.f, -p->separation - GS_PHYSICS_LINEAR_SLOP);
+
+            for (uint32_t x = 0; x < 3; ++x) {
+                float lambda = x == 0 ? p->normal_impulse : p->tangent_impulse[x - 1];
+                _gs_physics_axis_impulse(a, b, axes[x], sp->ia[x], sp->ib[x], lambda);
+            }
+        }
+    }
+
+    // Solve with position correction, move, then relax without it so the correction doesn't persist as velocity
+    for (uint32_t it = 0; it < scene->iterations; ++it) {
+        _gs_physics_solve_contacts(island, true);
+    }
+
+    for (uint32_t i = 0; i < island->body_count; ++i)
+    {
+        gs_rigid_body_t* b = island->bodies[i];
+        if (b->type != GS_RIGID_BODY_DYNAMIC) continue;
+
+        _gs_physics_solver_body_t* sb = &island->solver[i];
+        if (b->flags & GS_RIGID_BODY_STATE_LOCK_AXIS_X) sb->w.x = 0.f;
+        if (b->flags & GS_RIGID_BODY_STATE_LOCK_AXIS_Y) sb->w.y = 0.f;
+        if (b->flags & GS_RIGID_BODY_STATE_LOCK_AXIS_Z) sb->w.z = 0.f;
+        _gs_physics_integrate_transform(b, sb->v, sb->w, dt);
+    }
+
+    for (uint32_t it = 0; it < _GS_PHYSICS_RELAX_ITERATIONS; ++it) {
+        _gs_physics_solve_contacts(island, false);
+    }
+
+    // Restitution against approach speed at start of step
+    for (uint32_t i = 0; i < island->contact_count; ++i)
+    {
+        gs_contact_constraint_t* c = island->contacts[i];
+        if (c->restitution == 0.f) continue;
+        _gs_physics_solver_body_t* a = &island->solver[island->contact_bodies[i * 2 + 0]];
+        _gs_physics_solver_body_t* b = &island->solver[island->contact_bodies[i * 2 + 1]];
+        _gs_physics_solver_point_t* sp = &island->points[i * GS_PHYSICS_MANIFOLD_MAX_POINTS];
+
+        for (uint32_t j = 0; j < c->count; ++j, ++sp)
+        {
+            gs_contact_point_t* p = &c->points[j];
+            if (p->relative_velocity > -1.f || p->normal_impulse == 0.f) continue;
+            float vn = _gs_physics_axis_velocity(a, b, c->normal, sp->ca[0], sp->cb[0]);
+            float old = p->normal_impulse;
+            p->normal_impulse = gs_max(old - p->normal_mass * (vn + c->restitution * p->relative_velocity), 0.f);
+            _gs_physics_axis_impulse(a, b, c->normal, sp->ia[0], sp->ib[0], p->normal_impulse - old);
+        }
+    }
+
+    // Store velocities, track rest time for sleeping
+    float min_sleep = FLT_MAX;
+    const float lin_tol2 = GS_PHYSICS_SLEEP_LINEAR_TOLERANCE * GS_PHYSICS_SLEEP_LINEAR_TOLERANCE;
+    const float ang_tol2 = GS_PHYSICS_SLEEP_ANGULAR_TOLERANCE * GS_PHYSICS_SLEEP_ANGULAR_TOLERANCE;
+    for (uint32_t i = 0; i < island->body_count; ++i)
+    {
+        gs_rigid_body_t* b = island->bodies[i];
+        if (b->type != GS_RIGID_BODY_DYNAMIC) continue;
+
+        _gs_physics_solver_body_t* sb = &island->solver[i];
+        b->linear_velocity = sb->v;
+        b->angular_velocity = sb->w;
+        if (b->flags & GS_RIGID_BODY_STATE_LOCK_AXIS_X) b->angular_velocity.x = 0.f;
+        if (b->flags & GS_RIGID_BODY_STATE_LOCK_AXIS_Y) b->angular_velocity.y = 0.f;
+        if (b->flags & GS_RIGID_BODY_STATE_LOCK_AXIS_Z) b->angular_velocity.z = 0.f;
+
+        if (!(b->flags & GS_RIGID_BODY_STATE_ALLOW_SLEEP) || 
+            gs_vec3_len2(b->linear_velocity) > lin_tol2 || gs_vec3_len2(b->angular_velocity) > ang_tol2) {
+            b->sleep_time = 0.f;
+            min_sleep = 0.f;
+        } else {
+            b->sleep_time += dt;
+            min_sleep = gs_min(min_sleep, b->sleep_time);
+        }
+    }
+
+    // Whole island has been at rest long enough
+    if (min_sleep >= GS_PHYSICS_SLEEP_TIME) {
+        for (uint32_t i = 0; i < island->body_count; ++i) {
+            gs_rigid_body_t* b = island->bodies[i];
+            if (b->type == GS_RIGID_BODY_DYNAMIC) gs_rigid_body_set_awake(b, false);
+        }
+    }
+}
+
+// Pad so the allocator's trailing header keeps the next block 16 byte aligned
+gs_force_inline
+void* _gs_physics_scratch_alloc(gs_stack_allocator_t* sa, size_t sz)
+{
+    const size_t h = sizeof(gs_stack_allocator_header_t);
+    return gs_stack_allocator_allocate(sa, ((sz + h + 15) & ~(size_t)15) - h);
+}
+
+/* Physics Scene */
+
+GS_API_DECL gs_physics_scene_t gs_physics_scene_new()
+{
+    gs_physics_scene_t scene = gs_default_val();
+    scene.paged_allocator = gs_paged_allocator_new(sizeof(gs_contact_constraint_t), 256);
+    scene.stack_allocator = gs_stack_allocator_new(1024 * 64);
+    scene.gravity = gs_v3(0.f, -9.8f, 0.f);
+    scene.delta_time = 1.f / 60.f;
+    scene.iterations = 10;
+    scene.broadphase = gs_aabb_tree_new();
+    return scene;
+}
+
+GS_API_DECL void gs_physics_scene_free(gs_physics_scene_t* scene)
+{
+    gs_paged_allocator_free(&scene->paged_allocator);
+    gs_stack_allocator_free(&scene->stack_allocator);
+    gs_slot_array_free(scene->bodies);
+    gs_aabb_tree_free(&scene->broadphase);
+    gs_dyn_array_free(scene->move_buffer);
+    scene->move_buffer = NULL;
+    memset(&scene->contact_manager, 0, sizeof(gs_physics_contact_manager_t));
+}
+
+void _gs_physics_scene_update_proxy(gs_physics_scene_t* scene, gs_rigid_body_t* b, gs_vec3 displacement)
+{
+    b->aabb = _gs_rigid_body_compute_aabb(b);
+    if (b->proxy != _GS_AABB_TREE_NULL && gs_aabb_contains(&scene->broadphase.nodes[b->proxy].aabb, &b->aabb)) {
+        return;
+    }
+
+    // Fatten, and stretch in direction of travel
+    gs_aabb_t fat = b->aabb;
+    fat.min = gs_vec3_sub(fat.min, gs_v3s(GS_PHYSICS_AABB_MARGIN));
+    fat.max = gs_vec3_add(fat.max, gs_v3s(GS_PHYSICS_AABB_MARGIN));
+    for (uint32_t i = 0; i < 3; ++i) {
+        if (displacement.xyz[i] < 0.f) fat.min.xyz[i] += displacement.xyz[i];
+        else fat.max.xyz[i] += displacement.xyz[i];
+    }
+
+    if (b->proxy == _GS_AABB_TREE_NULL) b->proxy = gs_aabb_tree_insert(&scene->broadphase, &fat, b->id);
+    else gs_aabb_tree_update(&scene->broadphase, b->proxy, &fat);
+
+    if (!b->moved) {
+        b->moved = true;
+        gs_dyn_array_push(scene->move_buffer, b->id);
+    }
+}
+
+GS_API_DECL uint32_t gs_physics_scene_create_body(gs_physics_scene_t* scene, gs_rigid_body_desc_t* desc)
+{
+    gs_rigid_body_t body = gs_default_val();
+    body.type = desc->type;
+    body.world_center = desc->position;
+    body.rotation = gs_quat_dot(desc->rotation, desc->rotation) > 0.f ? gs_quat_norm(desc->rotation) : gs_quat_default();
+    body.linear_velocity = desc->linear_velocity;
+    body.angular_velocity = desc->angular_velocity;
+    body.gravity_scale = desc->gravity_scale != 0.f ? desc->gravity_scale : 1.f;
+    body.linear_damping = desc->linear_damping;
+    body.angular_damping = desc->angular_damping;
+    body.flags = desc->flags | GS_RIGID_BODY_STATE_AWAKE;
+    body.shape = desc->shape;
+    body.user_data = desc->user_data;
+    body.proxy = _GS_AABB_TREE_NULL;
+
+    switch (body.type) {
+        case GS_RIGID_BODY_STATIC:    body.flags |= GS_RIGID_BODY_STATE_STATIC; break;
+        case GS_RIGID_BODY_DYNAMIC:   body.flags |= GS_RIGID_BODY_STATE_DYNAMIC; break;
+        case GS_RIGID_BODY_KINEMATIC: body.flags |= GS_RIGID_BODY_STATE_KINEMATIC; break;
+    }
+
+    _gs_rigid_body_compute_mass(&body, desc->mass);
+    _gs_rigid_body_update_inertia(&body);
+
+    uint32_t id = gs_slot_array_insert(scene->bodies, body);
+    gs_rigid_body_t* b = gs_slot_array_getp(scene->bodies, id);
+    b->id = id;
+    b->shape.body = id;
+    _gs_physics_scene_update_proxy(scene, b, gs_v3s(0.f));
+    return id;
+}
+
+GS_API_DECL gs_rigid_body_t* gs_physics_scene_get_body(gs_physics_scene_t* scene, uint32_t id)
+{
+    return gs_slot_array_exists(scene->bodies, id) ? gs_slot_array_getp(scene->bodies, id) : NULL;
+}
+
+GS_API_DECL void gs_physics_scene_set_transform(gs_physics_scene_t* scene, uint32_t id, gs_vec3 position, gs_quat rotation)
+{
+    gs_rigid_body_t* b = gs_physics_scene_get_body(scene, id);
+    if (!b) return;
+    b->world_center = position;
+    b->rotation = gs_quat_norm(rotation);
+    _gs_rigid_body_update_inertia(b);
+    _gs_physics_scene_update_proxy(scene, b, gs_v3s(0.f));
+
+    // Wake anything resting against it
+    if (b->type == GS_RIGID_BODY_DYNAMIC) gs_rigid_body_set_awake(b, true);
+    for (gs_contact_edge_t* e = b->contacts; e; e = e->next) {
+        gs_rigid_body_t* o = gs_slot_array_getp(scene->bodies, e->other);
+        if (o->type == GS_RIGID_BODY_DYNAMIC) gs_rigid_body_set_awake(o, true);
+    }
+}
+
+GS_API_DECL void gs_physics_scene_destroy_body(gs_physics_scene_t* scene, uint32_t id)
+{
+    gs_rigid_body_t* b = gs_physics_scene_get_body(scene, id);
+    if (!b) return;
+
+    while (b->contacts) {
+        _gs_physics_contact_destroy(scene, b->contacts->contact);
+    }
+
+    if (b->proxy != _GS_AABB_TREE_NULL) gs_aabb_tree_remove(&scene->broadphase, b->proxy);
+    for (int32_t i = 0; i < gs_dyn_array_size(scene->move_buffer); ++i) {
+        if (scene->move_buffer[i] == id) {
+            scene->move_buffer[i] = gs_dyn_array_back(scene->move_buffer);
+            gs_dyn_array_pop(scene->move_buffer);
+            break;
+        }
+    }
+
+    gs_slot_array_erase(scene->bodies, id);
+}
+
+GS_API_DECL void gs_physics_scene_destroy_all_bodies(gs_physics_scene_t* scene)
+{
+    gs_paged_allocator_clear(&scene->paged_allocator);
+    scene->contact_manager.contacts = NULL;
+    scene->contact_manager.contact_count = 0;
+    gs_slot_array_clear(scene->bodies);
+    gs_aabb_tree_free(&scene->broadphase);
+    gs_dyn_array_clear(scene->move_buffer);
+}
+
+GS_API_DECL void gs_physics_scene_step(gs_physics_scene_t* scene)
+{
+    const float dt = scene->delta_time;
+    if (dt <= 0.f || !scene->bodies) return;
+
+    gs_physics_scene_stats_t* stats = &scene->stats;
+    memset(stats, 0, sizeof(gs_physics_scene_stats_t));
+    const uint32_t body_count = gs_slot_array_size(scene->bodies);
+    gs_rigid_body_t* bodies = scene->bodies->data;
+
+    // Broadphase: refit moving proxies, then pair up everything that left its fat bounds
+    for (uint32_t i = 0; i < body_count; ++i)
+    {
+        gs_rigid_body_t* b = &bodies[i];
+        if (b->type == GS_RIGID_BODY_STATIC || !(b->flags & GS_RIGID_BODY_STATE_AWAKE)) continue;
+        _gs_physics_scene_update_proxy(scene, b, gs_vec3_scale(b->linear_velocity, 2.f * dt));
+    }
+
+    for (int32_t i = 0; i < gs_dyn_array_size(scene->move_buffer); ++i)
+    {
+        gs_rigid_body_t* b = gs_slot_array_getp(scene->bodies, scene->move_buffer[i]);
+        _gs_physics_pair_query_t q = {scene, b->id};
+        gs_aabb_tree_query(&scene->broadphase, &scene->broadphase.nodes[b->proxy].aabb, _gs_physics_pair_query_cb, &q);
+    }
+    for (int32_t i = 0; i < gs_dyn_array_size(scene->move_buffer); ++i) {
+        gs_slot_array_getp(scene->bodies, scene->move_buffer[i])->moved = false;
+    }
+    gs_dyn_array_clear(scene->move_buffer);
+
+    // Narrowphase: update persistent manifolds, drop pairs whose fat bounds separated
+    for (gs_contact_constraint_t* c = scene->contact_manager.contacts; c;)
+    {
+        gs_contact_constraint_t* next = c->next;
+        gs_rigid_body_t* a = gs_slot_array_getp(scene->bodies, c->body_a);
+        gs_rigid_body_t* b = gs_slot_array_getp(scene->bodies, c->body_b);
+        bool32_t active_a = (a->flags & GS_RIGID_BODY_STATE_AWAKE) && a->type != GS_RIGID_BODY_STATIC;
+        bool32_t active_b = (b->flags & GS_RIGID_BODY_STATE_AWAKE) && b->type != GS_RIGID_BODY_STATIC;
+
+        if (active_a || active_b) {
+            if (!gs_aabb_overlap(&scene->broadphase.nodes[a->proxy].aabb, &scene->broadphase.nodes[b->proxy].aabb)) {
+                _gs_physics_contact_destroy(scene, c);
+            } else {
+                _gs_physics_contact_update(scene, c);
+            }
+        }
+        c = next;
+    }
+
+    // Solve: build islands from awake dynamic bodies through touching contacts
+    const uint32_t contact_count = scene->contact_manager.contact_count;
+    const uint32_t max_contacts = gs_max(contact_count, 1);
+    size_t scratch = body_count * (2 * sizeof(gs_rigid_body_t*) + sizeof(_gs_physics_solver_body_t)) + 
+        max_contacts * (sizeof(gs_contact_constraint_t*) + 2 * sizeof(uint32_t) + GS_PHYSICS_MANIFOLD_MAX_POINTS * sizeof(_gs_physics_solver_point_t)) + 
+        6 * (sizeof(gs_stack_allocator_header_t) + 16);  // Alignment padding
+    if (scratch > scene->stack_allocator.memory.size) {
+        gs_stack_allocator_free(&scene->stack_allocator);
+        scene->stack_allocator = gs_stack_allocator_new(scratch * 2);
+    }
+
+    _gs_physics_island_t island = gs_default_val();
+    gs_rigid_body_t** stack = (gs_rigid_body_t**)_gs_physics_scratch_alloc(&scene->stack_allocator, body_count * sizeof(gs_rigid_body_t*));
+    island.bodies = (gs_rigid_body_t**)_gs_physics_scratch_alloc(&scene->stack_allocator, body_count * sizeof(gs_rigid_body_t*));
+    island.solver = (_gs_physics_solver_body_t*)_gs_physics_scratch_alloc(&scene->stack_allocator, body_count * sizeof(_gs_physics_solver_body_t));
+    island.contacts = (gs_contact_constraint_t**)_gs_physics_scratch_alloc(&scene->stack_allocator, max_contacts * sizeof(gs_contact_constraint_t*));
+    island.contact_bodies = (uint32_t*)_gs_physics_scratch_alloc(&scene->stack_allocator, max_contacts * 2 * sizeof(uint32_t));
+    island.points = (_gs_physics_solver_point_t*)_gs_physics_scratch_alloc(&scene->stack_allocator, 
+        max_contacts * GS_PHYSICS_MANIFOLD_MAX_POINTS * sizeof(_gs_physics_solver_point_t));
+
+    for (uint32_t i = 0; i < body_count; ++i) bodies[i].flags &= ~GS_RIGID_BODY_STATE_ISLAND;
+    for (gs_contact_constraint_t* c = scene->contact_manager.contacts; c; c = c->next) c->flags &= ~GS_CONTACT_ISLAND;
+
+    for (uint32_t s = 0; s < body_count; ++s)
+    {
+        gs_rigid_body_t* seed = &bodies[s];
+        if ((seed->flags & GS_RIGID_BODY_STATE_ISLAND) || !(seed->flags & GS_RIGID_BODY_STATE_AWAKE) || seed->type != GS_RIGID_BODY_DYNAMIC) {
+            continue;
+        }
+
+        island.body_count = 0;
+        island.contact_count = 0;
+        uint32_t sp = 0;
+        stack[sp++] = seed;
+        seed->flags |= GS_RIGID_BODY_STATE_ISLAND;
+
+        while (sp)
+        {
+            gs_rigid_body_t* b = stack[--sp];
+            b->island_index = island.body_count;
+            island.bodies[island.body_count++] = b;
+
+            // Don't propagate islands across static or kinematic bodies
+            if (b->type != GS_RIGID_BODY_DYNAMIC) continue;
+            if (!(b->flags & GS_RIGID_BODY_STATE_AWAKE)) gs_rigid_body_set_awake(b, true);
+
+            for (gs_contact_edge_t* e = b->contacts; e; e = e->next)
+            {
+                gs_contact_constraint_t* c = e->contact;
+                if ((c->flags & GS_CONTACT_ISLAND) || !(c->flags & GS_CONTACT_TOUCHING)) continue;
+                c->flags |= GS_CONTACT_ISLAND;
+                island.contacts[island.contact_count++] = c;
+
+                gs_rigid_body_t* o = gs_slot_array_getp(scene->bodies, e->other);
+                if (o->flags & GS_RIGID_BODY_STATE_ISLAND) continue;
+                o->flags |= GS_RIGID_BODY_STATE_ISLAND;
+                stack[sp++] = o;
+            }
+        }
+
+        for (uint32_t i = 0; i < island.contact_count; ++i) {
+            gs_contact_constraint_t* c = island.contacts[i];
+            island.contact_bodies[i * 2 + 0] = gs_slot_array_getp(scene->bodies, c->body_a)->island_index;
+            island.contact_bodies[i * 2 + 1] = gs_slot_array_getp(scene->bodies, c->body_b)->island_index;
+        }
+
+        _gs_physics_island_solve(scene, &island);
+        stats->islands++;
+
+        // Static and kinematic bodies can be part of many islands
+        for (uint32_t i = 0; i < island.body_count; ++i) {
+            if (island.bodies[i]->type != GS_RIGID_BODY_DYNAMIC) island.bodies[i]->flags &= ~GS_RIGID_BODY_STATE_ISLAND;
+        }
+    }
+
+    gs_stack_allocator_clear(&scene->stack_allocator);
+
+    // Kinematic bodies just follow their velocity
+    for (uint32_t i = 0; i < body_count; ++i)
+    {
+        gs_rigid_body_t* b = &bodies[i];
+        if (b->type == GS_RIGID_BODY_KINEMATIC) {
+            _gs_physics_integrate_transform(b, b->linear_velocity, b->angular_velocity, dt);
+        }
+        b->force = gs_v3s(0.f);
+        b->torque = gs_v3s(0.f);
+        if ((b->flags & GS_RIGID_BODY_STATE_AWAKE) && b->type == GS_RIGID_BODY_DYNAMIC) stats->awake_bodies++;
+    }
+
+    stats->bodies = body_count;
+    stats->pairs = scene->contact_manager.contact_count;
+    for (gs_contact_constraint_t* c = scene->contact_manager.contacts; c; c = c->next) {
+        if (c->flags & GS_CONTACT_TOUCHING) stats->touching++;
+    }
+}
+
+/* Raycast */
+
+typedef struct _gs_physics_raycast_query_t {
+    gs_physics_scene_t* scene;
+    gs_query_callback_t* cb;
+    gs_raycast_data_t result;
+} _gs_physics_raycast_query_t;
+
+// First intersection along segment p + d * [0, len] with boolean GJK, or -1 on miss
+float _gs_physics_ray_bisect(const void* shape, const gs_vqs* xform, gs_support_func_t f, gs_vec3 p, gs_vec3 d, float len)
+{
+    ccd_t ccd = gs_default_val();
+    CCD_INIT(&ccd);
+    ccd.support1 = _gs_ccd_support_func;
+    ccd.support2 = _gs_ccd_support_func;
+    ccd.max_iterations = 100;
+
+    gs_ray_t seg = {p, d, len};
+    gs_vqs xs = gs_vqs_default();
+    _gs_collision_obj_handle_t h0 = {&seg, gs_support_ray, &xs};
+    _gs_collision_obj_handle_t h1 = {shape, f, xform};
+    if (!ccdGJKIntersect(&h0, &h1, &ccd)) return -1.f;
+
+    float lo = 0.f, hi = len;
+    for (uint32_t i = 0; i < 20; ++i) {
+        seg.len = 0.5f * (lo + hi);
+        if (ccdGJKIntersect(&h0, &h1, &ccd)) hi = seg.len;
+        else lo = seg.len;
+    }
+    return hi;
+}
+
+// Ray against single body shape. Fraction is along ray->d * ray->len.
+bool32_t _gs_physics_raycast_body(const gs_rigid_body_t* b, gs_vec3 p, gs_vec3 d, float len, float* t_out, gs_vec3* n_out)
+{
+    const gs_collision_shape_t* s = &b->shape;
+    gs_vqs x = _gs_rigid_body_xform(b);
+    gs_ray_t ray = {p, d, len};
+    gs_contact_info_t res = gs_default_val();
+    switch (s->type)
+    {
+        // Closed form, depth is distance along unit d
+        case GS_COLLISION_SHAPE_SPHERE:  if (gs_sphere_vs_ray(&s->sphere, &x, &ray, NULL, &res) != 0) return false; break;
+        case GS_COLLISION_SHAPE_AABB:    if (gs_aabb_vs_ray(&s->aabb, &x, &ray, NULL, &res) != 0) return false; break;
+        case GS_COLLISION_SHAPE_CAPSULE: if (gs_capsule_vs_ray(&s->capsule, &x, &ray, NULL, &res) != 0) return false; break;
+
+        // Bisect with GJK on ray segments for remaining shapes
+        default:
+        {
+            gs_support_func_t f = _gs_collision_shape_support(s);
+            float t = _gs_physics_ray_bisect(&s->sphere, &x, f, p, d, len);
+            if (t < 0.f) return false;
+
+            // Normal from neighbouring hits, EPA is too coarse on curved surfaces
+            const float eps = 1e-2f;
+            gs_vec3 t0, t1, q = gs_vec3_add(p, gs_vec3_scale(d, t));
+            _gs_physics_tangent_basis(d, &t0, &t1);
+            gs_vec3 p0 = gs_vec3_add(p, gs_vec3_scale(t0, eps)), p1 = gs_vec3_add(p, gs_vec3_scale(t1, eps));
+            float h0 = _gs_physics_ray_bisect(&s->sphere, &x, f, p0, d, len + 1.f);
+            float h1 = _gs_physics_ray_bisect(&s->sphere, &x, f, p1, d, len + 1.f);
+            gs_vec3 n = gs_vec3_neg(d);
+            if (h0 >= 0.f && h1 >= 0.f) {
+                gs_vec3 e0 = gs_vec3_sub(gs_vec3_add(p0, gs_vec3_scale(d, h0)), q);
+                gs_vec3 e1 = gs_vec3_sub(gs_vec3_add(p1, gs_vec3_scale(d, h1)), q);
+                gs_vec3 c = gs_vec3_cross(e0, e1);
+                if (gs_vec3_len2(c) > 0.f) {
+                    n = gs_vec3_norm(c);
+                    if (gs_vec3_dot(n, d) > 0.f) n = gs_vec3_neg(n);
+                }
+            }
+            res.depth = t;
+            res.normal = n;
+        } break;
+    }
+    *t_out = res.depth;
+    *n_out = res.normal;
+    return true;
+}
+
+float _gs_physics_raycast_cb(void* user_data, const gs_ray_t* ray, float max_fraction, int32_t proxy, uint32_t id)
+{
+    _gs_physics_raycast_query_t* q = (_gs_physics_raycast_query_t*)user_data;
+    gs_rigid_body_t* b = gs_slot_array_getp(q->scene->bodies, id);
+    if (q->cb && q->cb->report_shape && !q->cb->report_shape(&b->shape)) return -1.f;
+
+    float len = gs_vec3_len(ray->d);
+    gs_vec3 d = gs_vec3_scale(ray->d, 1.f / len);
+    float t = 0.f;
+    gs_vec3 n = gs_v3s(0.f);
+    if (!_gs_physics_raycast_body(b, ray->p, d, max_fraction * ray->len, &t, &n)) return -1.f;
+
+    q->result.hit = true;
+    q->result.body = id;
+    q->result.fraction = ray->len > 0.f ? t / ray->len : 0.f;
+    q->result.point = gs_vec3_add(ray->p, gs_vec3_scale(d, t));
+    q->result.normal = n;
+    return q->result.fraction;
+}
+
+GS_API_DECL gs_raycast_data_t gs_physics_scene_raycast(gs_physics_scene_t* scene, const gs_ray_t* ray, gs_query_callback_t* cb)
+{
+    _gs_physics_raycast_query_t q = gs_default_val();
+    q.scene = scene;
+    q.cb = cb;
+    if (scene->bodies && ray->len > 0.f) {
+        gs_aabb_tree_raycast(&scene->broadphase, ray, _gs_physics_raycast_cb, &q);
+    }
+    return q.result;
+}
+
 #endif // GS_PHYSICS_IMPL
 #endif // GS_PHYSICS_H
 